@@ -0,0 +1,191 @@
+"""
+ra15link.py
+
+Python side of the RA15 host link (RA15_Host/src/Link/):
+ - read_log(path) maps a column log written by nxt_link or libnxtlink.so (ColumnLog.h) and returns its columns as
+   numpy arrays. Needs numpy only.
+ - NxtLink wraps libnxtlink.so (nxt_link_api.h) through ctypes. Build it with: make link
+
+    import ra15link
+    with ra15link.NxtLink('/dev/rfcomm0', 'logs') as nxt:
+        nxt.list_signals(); time.sleep(1)
+        nxt.subscribe(['j1_p', 'rs_err'], decimation=1)
+        time.sleep(10)
+        print(nxt.stats())
+    samples = ra15link.read_log('logs/samples.ra15log')
+
+Created on: Oct 19, 2026
+Author: Daniel
+"""
+
+import ctypes
+import os
+
+import numpy as np
+
+LOG_MAGIC = b'RA15LOG1'
+LOG_TYPES = ['<u1', '<i1', '<u2', '<i2', '<u4', '<i4', '<i4', '<i8']    # LogType; fix16 (6) is its raw int32
+LOG_FIX16 = 6
+
+_HEADER = np.dtype([('magic', 'S8'), ('version', '<u4'), ('header_bytes', '<u4'), ('block_rows', '<u4'),
+                    ('block_bytes', '<u4'), ('columns', '<u4'), ('reserved', '<u4'), ('rows', '<u8')])
+_ENTRY = np.dtype([('name', 'S24'), ('type', 'u1'), ('bytes', 'u1'), ('reserved', '<u2'), ('offset', '<u4')])
+
+
+def read_log(path, fix16_as_float=True):
+    """Columns of a column log, as {name: array}. fix16 columns are converted to float64 unless fix16_as_float is
+    False. Only the rows of the blocks written so far are returned, so a log still being written can be read."""
+    raw = np.memmap(path, dtype='u1', mode='r')
+    header = raw[:_HEADER.itemsize].view(_HEADER)[0]
+    if header['magic'] != LOG_MAGIC:
+        raise ValueError('%s is not an RA15 column log' % path)
+    entries = raw[_HEADER.itemsize:_HEADER.itemsize + header['columns'] * _ENTRY.itemsize].view(_ENTRY)
+    rows = int(header['rows'])
+    block_rows, block_bytes = int(header['block_rows']), int(header['block_bytes'])
+    blocks = -(-rows // block_rows)
+    body = raw[header['header_bytes']:header['header_bytes'] + blocks * block_bytes].reshape(blocks, block_bytes)
+
+    columns = {}
+    for e in entries:
+        width = int(e['bytes'])
+        # Column c of every block, one block per row, then flattened in block order
+        part = body[:, e['offset']:e['offset'] + block_rows * width]
+        values = np.ascontiguousarray(part).view(LOG_TYPES[e['type']]).reshape(-1)[:rows]
+        if e['type'] == LOG_FIX16 and fix16_as_float:
+            values = values / 65536.0
+        columns[e['name'].decode()] = values
+    return columns
+
+
+class _Stats(ctypes.Structure):
+    _fields_ = [('connected', ctypes.c_int32), ('layout', ctypes.c_int32)] + \
+               [(name, ctypes.c_uint64) for name in ('rx_bytes', 'rx_packets', 'rx_resyncs', 'rx_overflows', 'tx_packets',
+                                                     'tx_overflows', 'nxt1', 'samples', 'samples_lost', 'records',
+                                                     'records_lost', 'param_replies', 'echoes')]
+
+
+class _Joints(ctypes.Structure):
+    _fields_ = [('systick', ctypes.c_uint32), ('p', ctypes.c_double * 6), ('v', ctypes.c_double * 6),
+                ('pwm', ctypes.c_int32 * 6)]
+
+
+class _ParamReply(ctypes.Structure):
+    _fields_ = [(name, ctypes.c_int32) for name in ('op', 'joint', 'param', 'result', 'version')] + \
+               [('value', ctypes.c_double)]
+
+
+class _Clock(ctypes.Structure):
+    _fields_ = [('host_ns', ctypes.c_int64), ('offset_ms', ctypes.c_double), ('drift_ppm', ctypes.c_double),
+                ('delay_ms', ctypes.c_double), ('exchanges', ctypes.c_uint64)]
+
+
+def _load(path=None):
+    if path is None:
+        path = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'build', 'libnxtlink.so')
+    lib = ctypes.CDLL(path)
+    handle = ctypes.c_void_p
+    lib.nxt_link_open.restype = handle
+    lib.nxt_link_open.argtypes = [ctypes.c_char_p, ctypes.c_char_p]
+    lib.nxt_link_close.argtypes = [handle]
+    lib.nxt_link_error.restype = ctypes.c_char_p
+    lib.nxt_link_get_stats.argtypes = [handle, ctypes.POINTER(_Stats)]
+    lib.nxt_link_get_joints.argtypes = [handle, ctypes.POINTER(_Joints)]
+    lib.nxt_link_send_targets.argtypes = [handle, ctypes.c_double * 6, ctypes.c_double * 6, ctypes.c_uint16, ctypes.c_uint8]
+    lib.nxt_link_list_signals.argtypes = [handle]
+    lib.nxt_link_signal_count.argtypes = [handle]
+    lib.nxt_link_signal.argtypes = [handle, ctypes.c_int, ctypes.c_char_p, ctypes.POINTER(ctypes.c_int32)]
+    lib.nxt_link_subscribe.argtypes = [handle, ctypes.c_char_p, ctypes.c_int]
+    lib.nxt_link_param.argtypes = [handle, ctypes.c_int, ctypes.c_int, ctypes.c_int, ctypes.c_double, ctypes.c_int]
+    lib.nxt_link_get_param_reply.argtypes = [handle, ctypes.POINTER(_ParamReply), ctypes.POINTER(ctypes.c_uint64)]
+    lib.nxt_link_get_clock.argtypes = [handle, ctypes.POINTER(_Clock)]
+    lib.nxt_link_to_host_ns.argtypes = [handle, ctypes.c_uint32, ctypes.POINTER(ctypes.c_int64)]
+    lib.nxt_link_now_ns.restype = ctypes.c_int64
+    return lib
+
+
+class NxtLink:
+    """Connection to NXT1 through libnxtlink.so. Receiving and logging run in the library's own threads."""
+
+    DISABLE = float('nan')      # DISABLE_PT / DISABLE_VT in send_targets()
+
+    def __init__(self, device, log_dir=None, library=None):
+        self._lib = _load(library)
+        self._h = self._lib.nxt_link_open(device.encode(), log_dir.encode() if log_dir else None)
+        if not self._h:
+            raise IOError(self._lib.nxt_link_error().decode())
+
+    def close(self):
+        if self._h:
+            self._lib.nxt_link_close(self._h)
+            self._h = None
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *args):
+        self.close()
+
+    def _check(self, result):
+        if result != 0:
+            raise IOError(self._lib.nxt_link_error().decode())
+
+    def stats(self):
+        s = _Stats()
+        self._check(self._lib.nxt_link_get_stats(self._h, ctypes.byref(s)))
+        return {name: getattr(s, name) for name, _ in _Stats._fields_}
+
+    def joints(self):
+        """Latest NXT1_BT: (systick ms, positions deg, velocities deg/s, pwm)"""
+        j = _Joints()
+        self._check(self._lib.nxt_link_get_joints(self._h, ctypes.byref(j)))
+        return j.systick, list(j.p), list(j.v), list(j.pwm)
+
+    def send_targets(self, pt, vt, interval_ms=100, compress=False):
+        self._check(self._lib.nxt_link_send_targets(self._h, (ctypes.c_double * 6)(*pt), (ctypes.c_double * 6)(*vt),
+                                                    interval_ms, int(compress)))
+
+    def list_signals(self):
+        """Ends any subscription and asks for the registry. signals() has it once it arrived."""
+        self._check(self._lib.nxt_link_list_signals(self._h))
+
+    def signals(self):
+        """[(name, telemetry_type)] of NXT1's registry, or None until it arrived"""
+        count = self._lib.nxt_link_signal_count(self._h)
+        if count < 0:
+            return None
+        name, kind = ctypes.create_string_buffer(13), ctypes.c_int32()
+        out = []
+        for k in range(count):
+            self._check(self._lib.nxt_link_signal(self._h, k, name, ctypes.byref(kind)))
+            out.append((name.value.decode(), kind.value))
+        return out
+
+    def subscribe(self, names, decimation=1):
+        self._check(self._lib.nxt_link_subscribe(self._h, ','.join(names).encode(), decimation))
+
+    def param(self, op, joint, param, value=0.0, version=0):
+        """PARAM_BT request, with the enums of PacketSchema.h. The answer arrives in param_reply()."""
+        self._check(self._lib.nxt_link_param(self._h, op, joint, param, value, version))
+
+    def param_reply(self):
+        """(latest PARAM_REPLY_BT as a dict, replies received in all)"""
+        r, n = _ParamReply(), ctypes.c_uint64()
+        self._check(self._lib.nxt_link_get_param_reply(self._h, ctypes.byref(r), ctypes.byref(n)))
+        return {name: getattr(r, name) for name, _ in _ParamReply._fields_}, n.value
+
+    def clock(self):
+        """Estimate of NXT1's clock as a dict: offset_ms (systick - PC clock at host_ns), drift_ppm, delay_ms and
+        exchanges. Raises IOError until the first clock probe was echoed."""
+        c = _Clock()
+        self._check(self._lib.nxt_link_get_clock(self._h, ctypes.byref(c)))
+        return {name: getattr(c, name) for name, _ in _Clock._fields_}
+
+    def to_host_ns(self, systick):
+        """PC time (now_ns(), host_ns in the logs) of NXT1's systick, ms"""
+        ns = ctypes.c_int64()
+        self._check(self._lib.nxt_link_to_host_ns(self._h, systick & 0xFFFFFFFF, ctypes.byref(ns)))
+        return ns.value
+
+    def now_ns(self):
+        """The PC's clock of host_ns in the logs"""
+        return self._lib.nxt_link_now_ns()
@@ -0,0 +1,303 @@
+/*
+ * JointParameters.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Daniel
+ */
+
+#include "JointParameters.h"
+#include "SourceFile.h"
+
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace ra15 {
+
+// PRIVATE FUNCTIONS
+
+// Recursive descent parser for + - * / ( ) and float literals (with optional 'f' suffix)
+class ExpressionParser
+{
+public:
+	explicit ExpressionParser(const std::string& s) : str(s) {}
+
+	double parse()
+	{
+		double v = expression();
+		skip_space();
+		if(pos != str.size())
+			throw std::runtime_error("Unexpected '" + str.substr(pos) + "' in expression: " + str);
+		return v;
+	}
+
+private:
+	const std::string& str;
+	size_t pos = 0;
+
+	void skip_space()	{ while(pos < str.size() && std::isspace((unsigned char)str[pos])) pos++; }
+
+	double expression()
+	{
+		double v = term();
+		for(;;)
+		{
+			skip_space();
+			if(pos < str.size() && str[pos] == '+')			{ pos++; v += term(); }
+			else if(pos < str.size() && str[pos] == '-')	{ pos++; v -= term(); }
+			else return v;
+		}
+	}
+
+	double term()
+	{
+		double v = factor();
+		for(;;)
+		{
+			skip_space();
+			if(pos < str.size() && str[pos] == '*')			{ pos++; v *= factor(); }
+			else if(pos < str.size() && str[pos] == '/')	{ pos++; v /= factor(); }
+			else return v;
+		}
+	}
+
+	double factor()
+	{
+		skip_space();
+		if(pos >= str.size())
+			throw std::runtime_error("Unexpected end of expression: " + str);
+		if(str[pos] == '-')	{ pos++; return -factor(); }
+		if(str[pos] == '+')	{ pos++; return factor(); }
+		if(str[pos] == '(')
+		{
+			pos++;
+			double v = expression();
+			skip_space();
+			if(pos >= str.size() || str[pos] != ')')
+				throw std::runtime_error("Missing ')' in expression: " + str);
+			pos++;
+			return v;
+		}
+		const char* begin = str.c_str() + pos;
+		char* end = nullptr;
+		double v = std::strtod(begin, &end);
+		if(end == begin)
+			throw std::runtime_error("Bad number in expression: " + str);
+		pos += (end - begin);
+		if(pos < str.size() && (str[pos] == 'f' || str[pos] == 'F'))
+			pos++;
+		return v;
+	}
+};
+
+// Returns the text between the parenthesis at open_paren and its matching close
+static std::string balanced(const std::string& s, size_t open_paren)
+{
+	int depth = 0;
+	for(size_t i=open_paren; i<s.size(); i++)
+	{
+		if(s[i] == '(') depth++;
+		else if(s[i] == ')' && --depth == 0)
+			return s.substr(open_paren+1, i-open_paren-1);
+	}
+	throw std::runtime_error("Unbalanced parenthesis in jpmtr initializer");
+}
+
+// Returns the position of the designated initializer ".field =" at or after pos, or npos
+static size_t find_field(const std::string& s, const std::string& field, size_t pos)
+{
+	while((pos = s.find("." + field, pos)) != std::string::npos)
+	{
+		size_t q = pos + field.size() + 1;
+		while(q < s.size() && std::isspace((unsigned char)s[q])) q++;
+		if(q < s.size() && s[q] == '=')		// otherwise matched a longer field name, e.g. ".gear" inside ".gear_rec"
+			return pos;
+		pos++;
+	}
+	return std::string::npos;
+}
+
+// Finds ".field = F16(expr)" within block and evaluates expr. Returns false if the field is absent.
+static bool field_value(const std::string& block, const std::string& field, double& value)
+{
+	size_t q = find_field(block, field, 0);
+	if(q == std::string::npos)
+		return false;
+	q = block.find('=', q) + 1;
+	while(q < block.size() && std::isspace((unsigned char)block[q])) q++;
+	if(block.compare(q, 4, "F16(") != 0)
+		return false;
+	value = eval_constant_expression(balanced(block, q+3));
+	return true;
+}
+
+// Finds ".field = {F16(expr), ...}" within block and evaluates count elements. Returns false if the field is absent.
+static bool field_array(const std::string& block, const std::string& field, double* values, int count)
+{
+	size_t q = find_field(block, field, 0);
+	if(q == std::string::npos)
+		return false;
+	q = block.find('=', q) + 1;
+	while(q < block.size() && std::isspace((unsigned char)block[q])) q++;
+	if(q >= block.size() || block[q] != '{')
+		return false;
+	for(int i=0; i<count; i++)
+	{
+		q = block.find("F16(", q);
+		if(q == std::string::npos)
+			throw std::runtime_error("." + field + " in jpmtr initializer has fewer than " + std::to_string(count) + " F16() values");
+		std::string expr = balanced(block, q+3);
+		values[i] = eval_constant_expression(expr);
+		q += 4 + expr.size();
+	}
+	return true;
+}
+
+// Returns the text of the first <tag>...</tag> at or after pos
+static std::string xml_value(const std::string& s, const std::string& tag, size_t pos, size_t limit)
+{
+	size_t b = s.find("<" + tag + ">", pos);
+	if(b == std::string::npos || b >= limit)
+		throw std::runtime_error("Missing <" + tag + "> in kinematic model");
+	b += tag.size() + 2;
+	size_t e = s.find("</" + tag + ">", b);
+	return s.substr(b, e-b);
+}
+
+
+// Returns [begin,end) of each joint's initializer block within the jpmtr[] table
+static std::vector<std::pair<size_t,size_t>> joint_blocks(const std::string& src, const std::string& path)
+{
+	size_t table = src.find("struct joint_parameter jpmtr_defaults");
+	if(table == std::string::npos)
+		throw std::runtime_error("jpmtr_defaults[] not found in " + path);
+	size_t table_end = src.find("};", table);
+
+	std::vector<std::pair<size_t,size_t>> blocks;
+	size_t p = table;
+	for(int ji=0; ji<NUM_JOINTS; ji++)
+	{
+		size_t b = find_field(src, "n", p);
+		if(b == std::string::npos || b > table_end)
+			throw std::runtime_error("jpmtr_defaults[] in " + path + " has fewer than 6 joints");
+		size_t e = find_field(src, "n", b+1);
+		if(e == std::string::npos || e > table_end)
+			e = table_end;
+		blocks.emplace_back(b, e);
+		p = e;
+	}
+	return blocks;
+}
+
+// Pointer to the member of JointParameter that holds a jpmtr field, or nullptr if it is not mirrored on the host
+static double JointParameter::* member_for_field(const std::string& field)
+{
+	if(field == "gear")		return &JointParameter::gear;
+	if(field == "ka")		return &JointParameter::ka;
+	if(field == "d")		return &JointParameter::d;
+	if(field == "r")		return &JointParameter::r;
+	if(field == "a")		return &JointParameter::a;
+	if(field == "prest")	return &JointParameter::prest;
+	if(field == "pmin")		return &JointParameter::pmin;
+	if(field == "pmax")		return &JointParameter::pmax;
+	if(field == "vmax")		return &JointParameter::vmax;
+	if(field == "phome")	return &JointParameter::phome;
+	return nullptr;
+}
+
+static const char* const MIRRORED_FIELDS[] = { "gear", "ka", "d", "r", "a", "prest", "pmin", "pmax", "vmax", "phome" };
+
+
+// PUBLIC FUNCTIONS
+
+double eval_constant_expression(const std::string& expr)
+{
+	return ExpressionParser(expr).parse();
+}
+
+JointParameters load_joint_parameters(const std::string& globals_path)
+{
+	std::string src = read_text_file(globals_path);
+	std::vector<std::pair<size_t,size_t>> blocks = joint_blocks(src, globals_path);
+
+	JointParameters params;
+	for(int ji=0; ji<NUM_JOINTS; ji++)
+	{
+		std::string block = src.substr(blocks[ji].first, blocks[ji].second - blocks[ji].first);
+		JointParameter& jp = params[ji];
+		jp.n = ji;
+		double v;
+		for(const char* field : MIRRORED_FIELDS)
+			if(field_value(block, field, v))
+				jp.*member_for_field(field) = v;
+		field_array(block, "b", jp.b, 6);
+	}
+	return params;
+}
+
+void update_joint_parameters(const std::string& globals_path, const JointParameters& params, const std::vector<std::string>& fields)
+{
+	std::string src = read_text_file(globals_path);
+	std::vector<std::pair<size_t,size_t>> blocks = joint_blocks(src, globals_path);
+
+	for(int ji=NUM_JOINTS-1; ji>=0; ji--)		// Back to front, so that earlier block offsets stay valid
+	{
+		for(const std::string& field : fields)
+		{
+			double JointParameter::* member = member_for_field(field);
+			if(member == nullptr)
+				throw std::runtime_error("jpmtr field ." + field + " is not known to the host tools");
+
+			std::string block = src.substr(blocks[ji].first, blocks[ji].second - blocks[ji].first);
+			size_t q = find_field(block, field, 0);
+			if(q == std::string::npos)
+				throw std::runtime_error("Joint " + std::to_string(ji+1) + " has no ." + field + " in " + globals_path);
+			q = block.find('=', q) + 1;
+			while(q < block.size() && std::isspace((unsigned char)block[q])) q++;
+			if(block.compare(q, 4, "F16(") != 0)
+				throw std::runtime_error("Joint " + std::to_string(ji+1) + " ." + field + " is not an F16() literal");
+			std::string expr = balanced(block, q+3);
+			if(std::fabs(eval_constant_expression(expr) - params[ji].*member) < 0.0005)		// Unchanged; keep the original expression
+				continue;
+			size_t expr_len = expr.size();
+
+			char value[32];
+			std::snprintf(value, sizeof(value), "%.3ff", params[ji].*member);
+			src.replace(blocks[ji].first + q + 4, expr_len, value);
+			blocks[ji].second += std::strlen(value) - expr_len;
+		}
+	}
+	write_source_file(globals_path, src);
+}
+
+void load_dh_from_xml(const std::string& xml_path, JointParameters& params)
+{
+	std::string src = read_text_file(xml_path);
+
+	size_t p = 0;
+	for(int ji=0; ji<NUM_JOINTS; ji++)
+	{
+		size_t b = src.find("<RAJoint", p);
+		if(b == std::string::npos)
+			throw std::runtime_error(xml_path + " has fewer than 6 joints");
+		size_t e = src.find("</RAJoint>", b);
+		p = e;
+
+		int index = std::atoi(xml_value(src, "Index", b, e).c_str());
+		if(index < 0 || index >= NUM_JOINTS)
+			throw std::runtime_error("Bad joint index in " + xml_path);
+
+		JointParameter& jp = params[index];
+		jp.d		= std::atof(xml_value(src, "JointOffset", b, e).c_str());
+		jp.r		= std::atof(xml_value(src, "JointLength", b, e).c_str());
+		jp.a		= std::atof(xml_value(src, "TwistAngle",  b, e).c_str());
+		jp.prest	= std::atof(xml_value(src, "JVInitial",   b, e).c_str());
+	}
+}
+
+}
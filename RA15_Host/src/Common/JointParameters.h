@@ -0,0 +1,67 @@
+/*
+ * JointParameters.h
+ *
+ *	Host-side copy of the jpmtr[] table, loaded from the firmware sources so that
+ *	host tools never drift from the values flashed onto the NXTs.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Daniel
+ */
+
+#ifndef SRC_COMMON_JOINTPARAMETERS_H_
+#define SRC_COMMON_JOINTPARAMETERS_H_
+
+#include <array>
+#include <string>
+#include <vector>
+
+namespace ra15 {
+
+static const int NUM_JOINTS = 6;
+
+// Mirrors the scalar fields of struct joint_parameter in RA15_Master/src/Globals.h
+struct JointParameter
+{
+	int n = 0;				// Which joint this set of parameters corresponds to (0-5)
+
+	double gear = 1.0;		// Encoder counts per degree of joint angle change
+
+	double b[6] = {};		// Motor model: pwm_estimate = b0 + b1x1 + b2x2 + b3x1^2 + b4x2^2 + b5x1x2, x1 = joint velocity (deg/s).
+							// x2 is a pointer to firmware state; host tools take it as 0.
+	double ka = 0.0;		// Extra pwm per deg/s^2 of acceleration. 0 if not identified.
+
+	double d = 0.0;			// DH Param: offset along previous z to the common normal (mm)
+	double r = 0.0;			// DH Param: length of the common normal (mm)
+	double a = 0.0;			// DH Param: (alpha) angle about common normal, from old z axis to new z axis (deg)
+	double prest = 0.0;		// DH Param: (theta) resting position (deg)
+
+	double pmin = -180.0;	// Min allowable joint angle (deg)
+	double pmax = 180.0;	// Max allowable joint angle (deg)
+	double vmax = 0.0;		// Max allowable joint velocity (deg/s)
+
+	double phome = 0.0;		// Angle at the center of the joint's homing switch (deg)
+};
+
+using JointParameters = std::array<JointParameter, NUM_JOINTS>;
+
+// Default locations, relative to the RA15_Host directory
+static const char DEFAULT_GLOBALS_PATH[]	= "../RA15_Master/src/Globals.h";
+static const char DEFAULT_DH_XML_PATH[]		= "../kinematic model/kinematic model.xml";
+
+// Parses the jpmtr[] initializer in Globals.h. Throws std::runtime_error on failure.
+JointParameters load_joint_parameters(const std::string& globals_path);
+
+// Rewrites the F16() values of the given fields (e.g. "d", "phome") of every joint in the jpmtr[]
+// initializer in Globals.h. Fields whose value is unchanged and the rest of the file are left untouched. Throws std::runtime_error on failure.
+void update_joint_parameters(const std::string& globals_path, const JointParameters& params, const std::vector<std::string>& fields);
+
+// Overwrites d, r, a and prest with the values stored in the Inventor kinematic model export.
+// Joint limits are not part of the XML, so they keep whatever values params already holds.
+void load_dh_from_xml(const std::string& xml_path, JointParameters& params);
+
+// Evaluates a constant float expression as written inside F16(...), e.g. "1500.0f/(25.0f/3.0f)"
+double eval_constant_expression(const std::string& expr);
+
+}
+
+#endif /* SRC_COMMON_JOINTPARAMETERS_H_ */
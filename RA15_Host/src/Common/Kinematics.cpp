@@ -0,0 +1,56 @@
+/*
+ * Kinematics.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Daniel
+ */
+
+#include "Kinematics.h"
+
+#include <cmath>
+
+namespace ra15 {
+
+static const double DEG_TO_RAD = 3.14159265358979323846 / 180.0;
+
+Mat4 mat4_identity()
+{
+	return { 1,0,0,0,  0,1,0,0,  0,0,1,0,  0,0,0,1 };
+}
+
+Mat4 mat4_mul(const Mat4& a, const Mat4& b)
+{
+	Mat4 c;
+	for(int row=0; row<4; row++)
+		for(int col=0; col<4; col++)
+			c[row*4+col] =	a[row*4+0]*b[0*4+col] + a[row*4+1]*b[1*4+col] +
+							a[row*4+2]*b[2*4+col] + a[row*4+3]*b[3*4+col];
+	return c;
+}
+
+Mat4 dh_transform(double theta, double alpha, double r, double d)
+{
+	double st = std::sin(theta*DEG_TO_RAD), ct = std::cos(theta*DEG_TO_RAD);
+	double sa = std::sin(alpha*DEG_TO_RAD), ca = std::cos(alpha*DEG_TO_RAD);
+	return {	ct, -st*ca,  st*sa, r*ct,
+				st,  ct*ca, -ct*sa, r*st,
+				 0,     sa,     ca,    d,
+				 0,      0,      0,    1	};
+}
+
+void forward_kinematics(const JointParameters& params, const double q[NUM_JOINTS], Mat4 frames[NUM_JOINTS+1])
+{
+	frames[0] = mat4_identity();
+	for(int ji=0; ji<NUM_JOINTS; ji++)
+		frames[ji+1] = mat4_mul(frames[ji], dh_transform(q[ji], params[ji].a, params[ji].r, params[ji].d));
+}
+
+Vec3 wrist_center(const JointParameters& params, const double q[NUM_JOINTS])
+{
+	Mat4 t = mat4_identity();
+	for(int ji=0; ji<4; ji++)		// Frame 4 origin; theta of joint 3 only rotates about z3, so q[3] has no effect here
+		t = mat4_mul(t, dh_transform(q[ji], params[ji].a, params[ji].r, params[ji].d));
+	return mat4_origin(t);
+}
+
+}
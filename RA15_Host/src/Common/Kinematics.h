@@ -0,0 +1,41 @@
+/*
+ * Kinematics.h
+ *
+ *	Double-precision forward kinematics for host tools, using the same DH convention as
+ *	matlab/Kinematics.m: T = Rz(theta) * Tz(d) * Tx(r) * Rx(alpha). Angles in degrees, lengths in mm.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Daniel
+ */
+
+#ifndef SRC_COMMON_KINEMATICS_H_
+#define SRC_COMMON_KINEMATICS_H_
+
+#include <array>
+
+#include "JointParameters.h"
+
+namespace ra15 {
+
+struct Vec3 { double x, y, z; };
+
+// Row-major homogeneous transform
+using Mat4 = std::array<double, 16>;
+
+Mat4 mat4_identity(void);
+Mat4 mat4_mul(const Mat4& a, const Mat4& b);
+inline Vec3 mat4_origin(const Mat4& t)	{ return { t[3], t[7], t[11] }; }
+inline Vec3 mat4_z_axis(const Mat4& t)	{ return { t[2], t[6], t[10] }; }
+
+// Homogeneous transformation matrix for one set of DH parameters
+Mat4 dh_transform(double theta, double alpha, double r, double d);
+
+// Computes the pose of frames 0..6 in the base frame. frames[0] is identity, frames[6] is the tool flange.
+void forward_kinematics(const JointParameters& params, const double q[NUM_JOINTS], Mat4 frames[NUM_JOINTS+1]);
+
+// Position of the wrist center (O4 == O5), which depends only on q[0..2].
+Vec3 wrist_center(const JointParameters& params, const double q[NUM_JOINTS]);
+
+}
+
+#endif /* SRC_COMMON_KINEMATICS_H_ */
@@ -0,0 +1,78 @@
+/*
+ * Packets.h
+ *
+ *	Host-side structs for every RS485 and Bluetooth packet, generated from the field lists in
+ *	RA15_Master/src/Comms/PacketSchema.h so that they always match the firmware.
+ *	fix16_t members hold the raw 16.16 value (see fix16_to_double() in Waypoint.h).
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Daniel
+ */
+
+#ifndef SRC_COMMON_PACKETS_H_
+#define SRC_COMMON_PACKETS_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "../../../RA15_Master/src/Comms/PacketSchema.h"
+
+namespace ra15 {
+
+typedef int32_t fix16_t;		// Named in the field lists. Expanded inside this namespace.
+
+// Little-endian, independent of the host's byte order
+template<typename T> inline void put_le(uint8_t*& buf, T v)
+{
+	for(size_t i=0; i<sizeof(T); i++)
+		*buf++ = (uint8_t)((uint64_t)v >> (8*i));
+}
+
+template<typename T> inline void get_le(const uint8_t*& buf, T& v)
+{
+	uint64_t u = 0;
+	for(size_t i=0; i<sizeof(T); i++)
+		u |= (uint64_t)*buf++ << (8*i);
+	v = (T)u;
+}
+
+#define HOST_PACKET_MEMBER(name, type, wire, shift, expr)	type name = 0;
+#define HOST_PACKET_ENCODE(name, type, wire, shift, expr)	put_le<wire>(buf, PACKET_QUANTIZED(type, wire) ? (wire)packet_quantize(name, shift) : (wire)name);
+#define HOST_PACKET_DECODE(name, type, wire, shift, expr)	{ wire w; get_le<wire>(buf, w); name = PACKET_QUANTIZED(type, wire) ? (type)packet_dequantize(w, shift) : (type)w; }
+#define HOST_PACKET_VISIT(name, type, wire, shift, expr)	f(#name, #type, #wire, shift, name);
+
+// Each packet struct has one member per field, BYTES (payload size on the wire), encode()/decode() of exactly
+// BYTES bytes, and for_each_field(f), which calls f(const char* name, const char* type, const char* wire, int shift,
+// value) in wire order. Members hold the unquantized value; quantized fields lose their low bits in encode().
+#define DEFINE_HOST_PACKET(Name, FIELDS)										\
+	struct Name																	\
+	{																			\
+		FIELDS(HOST_PACKET_MEMBER)												\
+		static const size_t BYTES = PACKET_BYTES(FIELDS);						\
+		void encode(uint8_t* buf) const		{ FIELDS(HOST_PACKET_ENCODE) }		\
+		void decode(const uint8_t* buf)		{ FIELDS(HOST_PACKET_DECODE) }		\
+		template<typename F> void for_each_field(F f) const { FIELDS(HOST_PACKET_VISIT) }	\
+	};
+
+// RS485
+DEFINE_HOST_PACKET(Nxt1Packet, PACKET_NXT1_FIELDS)
+DEFINE_HOST_PACKET(Nxt2Packet, PACKET_NXT2_FIELDS)
+DEFINE_HOST_PACKET(Nxt3Packet, PACKET_NXT3_FIELDS)
+
+// Bluetooth
+DEFINE_HOST_PACKET(Nxt1BtPacket, NXT1_BT_FIELDS)
+DEFINE_HOST_PACKET(PcBtPacket, PC_BT_FIELDS)
+DEFINE_HOST_PACKET(ClockBtPacket, CLOCK_BT_FIELDS)
+DEFINE_HOST_PACKET(WaypointBtPacket, WAYPOINT_BT_FIELDS)
+DEFINE_HOST_PACKET(CaptureCmdBtPacket, CAPTURE_CMD_BT_FIELDS)
+DEFINE_HOST_PACKET(TelemetryFramePacket, TELEMETRY_FRAME_FIELDS)
+DEFINE_HOST_PACKET(TelemetrySamplePacket, TELEMETRY_SAMPLE_FIELDS)
+DEFINE_HOST_PACKET(SubscribeBtPacket, SUBSCRIBE_BT_FIELDS)
+DEFINE_HOST_PACKET(TelemetrySchemaPacket, TELEMETRY_SCHEMA_FIELDS)
+DEFINE_HOST_PACKET(TelemetrySubPacket, TELEMETRY_SUB_FIELDS)
+DEFINE_HOST_PACKET(ParamBtPacket, PARAM_BT_FIELDS)
+DEFINE_HOST_PACKET(ParamReplyBtPacket, PARAM_REPLY_BT_FIELDS)
+
+}
+
+#endif /* SRC_COMMON_PACKETS_H_ */
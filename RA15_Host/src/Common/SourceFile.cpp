@@ -0,0 +1,43 @@
+/*
+ * SourceFile.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Daniel
+ */
+
+#include "SourceFile.h"
+
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+namespace ra15 {
+
+std::string read_text_file(const std::string& path)
+{
+	std::ifstream in(path, std::ios::binary);
+	if(!in)
+		throw std::runtime_error("Cannot open " + path);
+	std::stringstream ss;
+	ss << in.rdbuf();
+	return ss.str();
+}
+
+void write_source_file(const std::string& path, const std::string& text)
+{
+	std::ofstream out(path, std::ios::binary);
+	if(!out)
+		throw std::runtime_error("Cannot write " + path);
+	char prev = 0;
+	for(char ch : text)
+	{
+		if(ch == '\n' && prev != '\r')		// text read back from a CRLF file already has them
+			out << '\r';
+		out << ch;
+		prev = ch;
+	}
+	if(!out)
+		throw std::runtime_error("Error writing " + path);
+}
+
+}
@@ -0,0 +1,26 @@
+/*
+ * SourceFile.h
+ *
+ *	Reading and writing firmware source files from host tools.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Daniel
+ */
+
+#ifndef SRC_COMMON_SOURCEFILE_H_
+#define SRC_COMMON_SOURCEFILE_H_
+
+#include <string>
+
+namespace ra15 {
+
+// Returns the whole file as a string. Throws std::runtime_error if it cannot be opened.
+std::string read_text_file(const std::string& path);
+
+// Writes text to path with CRLF line endings, matching the rest of the firmware sources.
+// text may use '\n' or '\r\n' line endings. Throws std::runtime_error if the file cannot be written.
+void write_source_file(const std::string& path, const std::string& text);
+
+}
+
+#endif /* SRC_COMMON_SOURCEFILE_H_ */
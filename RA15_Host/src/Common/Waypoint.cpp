@@ -0,0 +1,89 @@
+/*
+ * Waypoint.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Daniel
+ */
+
+#include "Waypoint.h"
+
+#include <cmath>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+namespace ra15 {
+
+// PUBLIC FUNCTIONS
+
+int32_t fix16_from_double(double v)
+{
+	double scaled = std::round(v * 65536.0);
+	if(scaled > INT32_MAX || scaled < INT32_MIN)
+		throw std::runtime_error("Value " + std::to_string(v) + " does not fit in fix16_t");
+	return (int32_t)scaled;
+}
+
+double fix16_to_double(int32_t v)
+{
+	return v / 65536.0;
+}
+
+void encode_waypoint(const Waypoint& w, std::vector<uint8_t>& out)
+{
+	WaypointBtPacket packet;
+	packet.dtMs = w.dt_ms;
+	packet.jointMask = w.joint_mask;
+	fix16_t* p[NUM_JOINTS] = { &packet.p1, &packet.p2, &packet.p3, &packet.p4, &packet.p5, &packet.p6 };
+	for(int ji=0; ji<NUM_JOINTS; ji++)
+		*p[ji] = fix16_from_double(w.p[ji]);
+
+	size_t offset = out.size();
+	out.resize(offset + WAYPOINT_BYTES);
+	packet.encode(&out[offset]);
+}
+
+Waypoint decode_waypoint(const uint8_t* bytes)
+{
+	WaypointBtPacket packet;
+	packet.decode(bytes);
+	Waypoint w;
+	w.dt_ms = packet.dtMs;
+	w.joint_mask = packet.jointMask;
+	const fix16_t* p[NUM_JOINTS] = { &packet.p1, &packet.p2, &packet.p3, &packet.p4, &packet.p5, &packet.p6 };
+	for(int ji=0; ji<NUM_JOINTS; ji++)
+		w.p[ji] = fix16_to_double(*p[ji]);
+	return w;
+}
+
+std::vector<Waypoint> read_waypoint_file(const std::string& path)
+{
+	std::ifstream in(path, std::ios::binary);
+	if(!in)
+		throw std::runtime_error("Cannot open " + path);
+	std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+	if(bytes.size() % WAYPOINT_BYTES != 0)
+		throw std::runtime_error(path + " is not a whole number of " + std::to_string(WAYPOINT_BYTES) + " byte waypoints");
+
+	std::vector<Waypoint> waypoints;
+	for(size_t i=0; i<bytes.size(); i+=WAYPOINT_BYTES)
+		waypoints.push_back(decode_waypoint(&bytes[i]));
+	return waypoints;
+}
+
+void write_waypoint_file(const std::string& path, const std::vector<Waypoint>& waypoints)
+{
+	std::vector<uint8_t> bytes;
+	bytes.reserve(waypoints.size() * WAYPOINT_BYTES);
+	for(const Waypoint& w : waypoints)
+		encode_waypoint(w, bytes);
+
+	std::ofstream out(path, std::ios::binary);
+	if(!out)
+		throw std::runtime_error("Cannot write " + path);
+	out.write((const char*)bytes.data(), bytes.size());
+	if(!out)
+		throw std::runtime_error("Error writing " + path);
+}
+
+}
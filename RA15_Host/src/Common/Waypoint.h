@@ -0,0 +1,49 @@
+/*
+ * Waypoint.h
+ *
+ *	Host-side copy of struct waypoint (RA15_Master/src/Control/Trajectory.h), and its wire format:
+ *	the payload of the Bluetooth waypoint packet (WAYPOINT_BT_FIELDS). Waypoint files (.wpt) are these payloads back to back.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Daniel
+ */
+
+#ifndef SRC_COMMON_WAYPOINT_H_
+#define SRC_COMMON_WAYPOINT_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "JointParameters.h"
+#include "Packets.h"
+
+namespace ra15 {
+
+static const size_t WAYPOINT_BYTES = WaypointBtPacket::BYTES;
+static const uint8_t ALL_JOINTS_MASK = 0x3F;
+
+struct Waypoint
+{
+	uint16_t dt_ms = 0;					// Time since the previous waypoint (ms). 0 stops the trajectory of the joints in joint_mask.
+	uint8_t joint_mask = ALL_JOINTS_MASK;
+	double p[NUM_JOINTS] = {};			// Joint positions (deg)
+};
+
+// 16.16 fixed point, rounded to nearest
+int32_t fix16_from_double(double v);
+double fix16_to_double(int32_t v);
+
+// Appends the wire format of w to out
+void encode_waypoint(const Waypoint& w, std::vector<uint8_t>& out);
+
+// Decodes WAYPOINT_BYTES bytes
+Waypoint decode_waypoint(const uint8_t* bytes);
+
+// Reads/writes a .wpt file. Throws std::runtime_error on failure.
+std::vector<Waypoint> read_waypoint_file(const std::string& path);
+void write_waypoint_file(const std::string& path, const std::vector<Waypoint>& waypoints);
+
+}
+
+#endif /* SRC_COMMON_WAYPOINT_H_ */
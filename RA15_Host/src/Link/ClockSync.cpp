@@ -0,0 +1,108 @@
+/*
+ * ClockSync.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Daniel
+ */
+
+#include "ClockSync.h"
+
+#include <cmath>
+
+namespace ra15 {
+
+static const int64_t NS_PER_MS = 1000000;
+
+
+int64_t ClockSync::nxt_ns(uint32_t nxt_ms) const
+{
+	return (last_unwrapped_ms_ + (int32_t)(nxt_ms - last_ms_)) * NS_PER_MS;
+}
+
+
+void ClockSync::add(int64_t t1_ns, uint32_t rx_ms, uint32_t tx_ms, int64_t t4_ns)
+{
+	if(!have_ms_)
+		last_unwrapped_ms_ = rx_ms;
+	else
+		last_unwrapped_ms_ += (int32_t)(rx_ms - last_ms_);
+	last_ms_ = rx_ms;
+	have_ms_ = true;
+
+	int64_t t2_ns = last_unwrapped_ms_ * NS_PER_MS;
+	int64_t t3_ns = t2_ns + (int64_t)(int32_t)(tx_ms - rx_ms) * NS_PER_MS;
+	Point p;
+	p.t1_ns = t1_ns;
+	p.offset_ns = ((double)(t2_ns - t1_ns) + (double)(t3_ns - t4_ns)) / 2;
+	p.delay_ns = (t4_ns - t1_ns) - (t3_ns - t2_ns);
+
+	if(window_count_ == 0 || p.delay_ns < window_best_.delay_ns)
+		window_best_ = p;
+	exchanges_++;
+	if(++window_count_ == CLOCK_SYNC_WINDOW)
+	{
+		points_.push_back(window_best_);
+		if(points_.size() > CLOCK_FIT_WINDOWS)
+			points_.pop_front();
+		window_count_ = 0;
+	}
+	fit();
+}
+
+
+// Least squares line through the windows' best probes, against t1 relative to the newest
+void ClockSync::fit()
+{
+	if(points_.empty())
+	{
+		estimate_.at_ns = window_best_.t1_ns;
+		estimate_.offset_ns = window_best_.offset_ns;
+		estimate_.drift = 0;
+		estimate_.delay_ns = window_best_.delay_ns;
+		estimate_.windows = 0;
+		return;
+	}
+
+	int64_t at = points_.back().t1_ns;
+	double n = (double)points_.size(), t_mean = 0, o_mean = 0;
+	int64_t delay = points_.front().delay_ns;
+	for(const Point& p : points_)
+	{
+		t_mean += (double)(p.t1_ns - at) / n;
+		o_mean += p.offset_ns / n;
+		if(p.delay_ns < delay)
+			delay = p.delay_ns;
+	}
+	double stt = 0, sto = 0;
+	for(const Point& p : points_)
+	{
+		double t = (double)(p.t1_ns - at) - t_mean;
+		stt += t * t;
+		sto += t * (p.offset_ns - o_mean);
+	}
+	estimate_.at_ns = at;
+	estimate_.drift = (stt > 0) ? sto / stt : 0;
+	estimate_.offset_ns = o_mean - estimate_.drift * t_mean;
+	estimate_.delay_ns = delay;
+	estimate_.windows = points_.size();
+}
+
+
+double ClockSync::offset_ns(int64_t host_ns) const
+{
+	if(!valid())
+		return 0;
+	return estimate_.offset_ns + estimate_.drift * (double)(host_ns - estimate_.at_ns);
+}
+
+
+// nxt = host + offset + drift*(host - at), solved for host
+int64_t ClockSync::to_host_ns(uint32_t nxt_ms) const
+{
+	if(!valid())
+		return 0;
+	double x = ((double)(nxt_ns(nxt_ms) - estimate_.at_ns) - estimate_.offset_ns) / (1 + estimate_.drift);
+	return estimate_.at_ns + (int64_t)std::llround(x);
+}
+
+}
@@ -0,0 +1,80 @@
+/*
+ * ClockSync.h
+ *
+ *	Offset and drift of NXT1's systick to the PC's steady clock (link_now_ns()), from probes NXT1 echoes over
+ *	Bluetooth: a PC_BT or CLOCK_BT stamped pcStamp, answered by the next NXT1_BT with echoStamp. Each echo gives four
+ *	timestamps, as in Cristian's algorithm with NTP's correction for the time NXT1 holds the echo:
+ *		t1 PC sends the probe			t2 NXT1 reads it (echoRxMs)
+ *		t4 PC receives the echo			t3 NXT1 sends the echo (txMs)
+ *	offset = ((t2 - t1) + (t3 - t4)) / 2 is NXT1's clock minus the PC's, if both ways take as long. The error is at
+ *	most half the delay (t4 - t1) - (t3 - t2), so as Timing.c does over RS485, only the probe with the least delay of
+ *	each window of CLOCK_SYNC_WINDOW is kept. The offset is a least squares line through the last CLOCK_FIT_WINDOWS
+ *	of them, whose slope is the drift. Until the first window completes, the best probe so far stands alone.
+ *
+ *	NXT1 stamps whole ms, which leaves the offset up to 1ms off. systick is unwrapped against the latest echo, so
+ *	NXT1 times within 24 days of it convert.
+ *
+ *	Not thread-safe.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Daniel
+ */
+
+#ifndef SRC_LINK_CLOCKSYNC_H_
+#define SRC_LINK_CLOCKSYNC_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+
+namespace ra15 {
+
+static const int CLOCK_SYNC_WINDOW = 16;		// As Timing.c
+static const size_t CLOCK_FIT_WINDOWS = 32;
+
+class ClockSync
+{
+public:
+	struct Estimate
+	{
+		int64_t at_ns = 0;			// PC time the offset is given at
+		double offset_ns = 0;		// NXT1's systick minus the PC's clock, at at_ns
+		double drift = 0;			// ... and its change per ns (1e-6 is 1 ppm: NXT1's clock runs fast)
+		int64_t delay_ns = 0;		// Least round trip of the probes fitted, without NXT1's processing
+		size_t windows = 0;			// Windows fitted, 0 while the first one fills
+	};
+
+	// One echoed probe: sent at t1_ns, read at NXT1's rx_ms, echoed in an NXT1_BT encoded at tx_ms, received at t4_ns.
+	void add(int64_t t1_ns, uint32_t rx_ms, uint32_t tx_ms, int64_t t4_ns);
+
+	bool valid() const						{ return exchanges_ > 0; }
+	uint64_t exchanges() const				{ return exchanges_; }
+	const Estimate& estimate() const		{ return estimate_; }
+
+	// NXT1's systick, unwrapped, in ns
+	int64_t nxt_ns(uint32_t nxt_ms) const;
+
+	// NXT1's clock minus the PC's at PC time host_ns, ns. 0 until valid().
+	double offset_ns(int64_t host_ns) const;
+
+	// PC time of NXT1's systick nxt_ms, ns. 0 until valid().
+	int64_t to_host_ns(uint32_t nxt_ms) const;
+
+private:
+	struct Point { int64_t t1_ns; double offset_ns; int64_t delay_ns; };
+
+	void fit();
+
+	bool have_ms_ = false;
+	uint32_t last_ms_ = 0;
+	int64_t last_unwrapped_ms_ = 0;
+	uint64_t exchanges_ = 0;
+	int window_count_ = 0;
+	Point window_best_;				// Of the window filling
+	std::deque<Point> points_;		// Best of each full window, oldest first
+	Estimate estimate_;
+};
+
+}
+
+#endif /* SRC_LINK_CLOCKSYNC_H_ */
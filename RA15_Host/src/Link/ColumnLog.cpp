@@ -0,0 +1,141 @@
+/*
+ * ColumnLog.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Daniel
+ */
+
+#include "ColumnLog.h"
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace ra15 {
+
+static_assert(sizeof(LogHeader) == 40 && sizeof(LogColumnEntry) == 32, "ColumnLog header layout changed");
+
+size_t log_type_bytes(LogType type)
+{
+	if(type == LOG_INT64)
+		return 8;
+	return TELEMETRY_TYPE_BYTES((int)type);
+}
+
+
+static void write_all(int fd, const void* buf, size_t len, off_t at, const std::string& path)
+{
+	const uint8_t* p = (const uint8_t*)buf;
+	while(len > 0)
+	{
+		ssize_t n = pwrite(fd, p, len, at);
+		if(n < 0 && errno == EINTR)
+			continue;
+		if(n <= 0)
+			throw std::runtime_error("Cannot write " + path + ": " + std::strerror(errno));
+		p += n;
+		len -= n;
+		at += n;
+	}
+}
+
+
+ColumnLog::ColumnLog(const std::string& path, const std::vector<LogColumn>& columns, size_t block_rows)
+	: path_(path), columns_(columns), block_rows_(block_rows)
+{
+	if(columns.empty() || columns.size() > LOG_MAX_COLUMNS)
+		throw std::runtime_error(path + ": a log has 1 to " + std::to_string(LOG_MAX_COLUMNS) + " columns");
+	if(block_rows == 0)
+		throw std::runtime_error(path + ": block_rows must be positive");
+
+	LogHeader header = {};
+	memcpy(header.magic, LOG_MAGIC, sizeof(header.magic));
+	header.version = 1;
+	header.header_bytes = LOG_HEADER_BYTES;
+	header.block_rows = (uint32_t)block_rows;
+	header.columns = (uint32_t)columns.size();
+
+	std::vector<LogColumnEntry> entries(columns.size());
+	for(size_t c=0; c<columns.size(); c++)
+	{
+		if(columns[c].type >= LOG_NUM_TYPES || columns[c].name.empty() || columns[c].name.size() > LOG_NAME_CHARS)
+			throw std::runtime_error(path + ": bad column '" + columns[c].name + "'");
+		size_t bytes = log_type_bytes(columns[c].type);
+		offset_.push_back(block_bytes_);
+		memcpy(entries[c].name, columns[c].name.data(), columns[c].name.size());
+		entries[c].type = columns[c].type;
+		entries[c].bytes = (uint8_t)bytes;
+		entries[c].offset = (uint32_t)block_bytes_;
+		block_bytes_ += bytes * block_rows;
+		row_bytes_ += bytes;
+	}
+	block_bytes_ = (block_bytes_ + LOG_PAGE_BYTES - 1) / LOG_PAGE_BYTES * LOG_PAGE_BYTES;
+	header.block_bytes = (uint32_t)block_bytes_;
+	block_.assign(block_bytes_, 0);
+
+	fd_ = open(path.c_str(), O_CREAT | O_TRUNC | O_WRONLY, 0644);
+	if(fd_ < 0)
+		throw std::runtime_error("Cannot create " + path + ": " + std::strerror(errno));
+	std::vector<uint8_t> head(LOG_HEADER_BYTES, 0);
+	memcpy(head.data(), &header, sizeof(header));
+	memcpy(head.data() + sizeof(header), entries.data(), entries.size() * sizeof(LogColumnEntry));
+	write_all(fd_, head.data(), head.size(), 0, path_);
+}
+
+
+ColumnLog::~ColumnLog()
+{
+	try { close(); }
+	catch(const std::exception&) {}		// Nothing to report it to. The header still counts the whole blocks.
+}
+
+
+void ColumnLog::append(const uint8_t* row)
+{
+	for(size_t c=0; c<columns_.size(); c++)
+	{
+		size_t bytes = log_type_bytes(columns_[c].type);
+		memcpy(&block_[offset_[c] + block_used_*bytes], row, bytes);
+		row += bytes;
+	}
+	block_used_++;
+	rows_++;
+	if(block_used_ == block_rows_)
+		write_block();
+}
+
+
+void ColumnLog::write_block()
+{
+	write_all(fd_, block_.data(), block_bytes_, (off_t)(LOG_HEADER_BYTES + blocks_written_*block_bytes_), path_);
+	blocks_written_++;
+	uint64_t rows = rows_;
+	write_all(fd_, &rows, sizeof(rows), offsetof(LogHeader, rows), path_);
+	std::fill(block_.begin(), block_.end(), 0);
+	block_used_ = 0;
+}
+
+
+void ColumnLog::close()
+{
+	if(fd_ < 0)
+		return;
+	int fd = fd_;
+	if(block_used_ > 0)
+		write_block();
+	fd_ = -1;
+	::close(fd);
+}
+
+
+LogRow& LogRow::put_bytes(const uint8_t* b, size_t n)
+{
+	memcpy(&row_[used_], b, n);
+	used_ += n;
+	return *this;
+}
+
+}
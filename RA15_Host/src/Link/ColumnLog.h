@@ -0,0 +1,136 @@
+/*
+ * ColumnLog.h
+ *
+ *	Append-only columnar log, laid out so that a reader can mmap it and index any column directly.
+ *
+ *	[header, LOG_HEADER_BYTES][block 0][block 1]...
+ *	The header holds the column names and types and the number of rows written. Each block holds block_rows rows,
+ *	column after column: column c of row r is at LOG_HEADER_BYTES + (r / block_rows)*block_bytes + offset[c]
+ *	+ (r % block_rows)*bytes[c]. Blocks are padded to a multiple of LOG_PAGE_BYTES. A block is written once it
+ *	is full, and the row count in the header after it, so a reader (or a crash) only ever sees whole blocks.
+ *	close() writes the last, partly filled block.
+ *
+ *	Values are little-endian. fix16 is the NXT's raw 16.16 int32, as in the telemetry registry. Readers:
+ *	python/ra15link.py read_log() and matlab/NXTLink.readLog().
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Daniel
+ */
+
+#ifndef SRC_LINK_COLUMNLOG_H_
+#define SRC_LINK_COLUMNLOG_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "../Common/Packets.h"
+
+namespace ra15 {
+
+static const char LOG_MAGIC[8] = { 'R', 'A', '1', '5', 'L', 'O', 'G', '1' };
+static const size_t LOG_HEADER_BYTES = 4096;
+static const size_t LOG_PAGE_BYTES = 4096;
+static const size_t LOG_NAME_CHARS = 24;		// Column names, zero padded
+static const size_t LOG_DEFAULT_BLOCK_ROWS = 1024;
+
+// Column types. The first ones are the telemetry registry's (enum telemetry_type), so signals keep their type.
+enum LogType : uint8_t {
+	LOG_UINT8 = TLM_UINT8,
+	LOG_INT8 = TLM_INT8,
+	LOG_UINT16 = TLM_UINT16,
+	LOG_INT16 = TLM_INT16,
+	LOG_UINT32 = TLM_UINT32,
+	LOG_INT32 = TLM_INT32,
+	LOG_FIX16 = TLM_FIX16,
+	LOG_INT64 = TLM_NUM_TYPES,		// Host timestamps (ns)
+	LOG_NUM_TYPES
+};
+
+size_t log_type_bytes(LogType type);
+
+struct LogColumn
+{
+	std::string name;				// At most LOG_NAME_CHARS
+	LogType type;
+};
+
+// Header layout, at offset 0 of the file
+struct LogHeader
+{
+	char magic[8];
+	uint32_t version;				// 1
+	uint32_t header_bytes;			// LOG_HEADER_BYTES
+	uint32_t block_rows;
+	uint32_t block_bytes;
+	uint32_t columns;
+	uint32_t reserved;
+	uint64_t rows;					// Rows in the blocks written so far
+};
+
+struct LogColumnEntry				// columns of these follow the header
+{
+	char name[LOG_NAME_CHARS];
+	uint8_t type;					// LogType
+	uint8_t bytes;
+	uint16_t reserved;
+	uint32_t offset;				// Of the column within a block
+};
+
+static const size_t LOG_MAX_COLUMNS = (LOG_HEADER_BYTES - sizeof(LogHeader)) / sizeof(LogColumnEntry);
+
+
+class ColumnLog
+{
+public:
+	// Creates (or truncates) path. Throws std::runtime_error on failure.
+	ColumnLog(const std::string& path, const std::vector<LogColumn>& columns, size_t block_rows = LOG_DEFAULT_BLOCK_ROWS);
+	~ColumnLog();
+	ColumnLog(const ColumnLog&) = delete;
+	ColumnLog& operator=(const ColumnLog&) = delete;
+
+	// Appends a row: one value per column, each log_type_bytes() long, back to back in column order.
+	void append(const uint8_t* row);
+
+	// Writes the last block and the final row count, and closes the file. Called by the destructor if need be.
+	void close();
+
+	const std::vector<LogColumn>& columns() const	{ return columns_; }
+	size_t row_bytes() const						{ return row_bytes_; }
+	uint64_t rows() const							{ return rows_; }
+
+private:
+	void write_block();
+
+	int fd_ = -1;
+	std::string path_;
+	std::vector<LogColumn> columns_;
+	std::vector<size_t> offset_;			// Of each column within a block
+	size_t row_bytes_ = 0;
+	size_t block_rows_;
+	size_t block_bytes_ = 0;
+	std::vector<uint8_t> block_;			// Block being filled
+	size_t block_used_ = 0;					// Rows in it
+	uint64_t rows_ = 0;						// Appended in all
+	uint64_t blocks_written_ = 0;
+};
+
+// Builds a row for ColumnLog::append() one value at a time, in column order
+class LogRow
+{
+public:
+	explicit LogRow(size_t bytes) : row_(bytes) {}
+	template<typename T> LogRow& put(T v)	{ uint8_t* p = &row_[used_]; put_le<T>(p, v); used_ += sizeof(T); return *this; }
+	LogRow& put_bytes(const uint8_t* b, size_t n);
+	const uint8_t* data() const				{ return row_.data(); }
+	void clear()							{ used_ = 0; }
+
+private:
+	std::vector<uint8_t> row_;
+	size_t used_ = 0;
+};
+
+}
+
+#endif /* SRC_LINK_COLUMNLOG_H_ */
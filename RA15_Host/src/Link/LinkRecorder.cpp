@@ -0,0 +1,398 @@
+/*
+ * LinkRecorder.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Daniel
+ */
+
+#include "LinkRecorder.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+
+namespace ra15 {
+
+static const uint8_t sample_field_bytes[] = { TELEMETRY_SAMPLE_FIELDS(PACKET_FIELD_WIRE_BYTES) };
+static const size_t FRAME_BYTES = TelemetryFramePacket::BYTES;
+static const size_t SAMPLE_BYTES = TelemetrySamplePacket::BYTES;
+static const size_t SCHEMA_BYTES = TelemetrySchemaPacket::BYTES;
+static const size_t SUB_BYTES = TelemetrySubPacket::BYTES;
+
+// Log column type of a packet field, from its host type. fix16_t is an int32_t, so it is told apart by name.
+template<typename T> static LogType log_type(const char* type_name)
+{
+	if(std::strcmp(type_name, "fix16_t") == 0)
+		return LOG_FIX16;
+	switch(sizeof(T))
+	{
+		case 1:		return T(-1) < 0 ? LOG_INT8 : LOG_UINT8;
+		case 2:		return T(-1) < 0 ? LOG_INT16 : LOG_UINT16;
+		default:	return T(-1) < 0 ? LOG_INT32 : LOG_UINT32;
+	}
+}
+
+#define LOG_FIELD_COLUMN(name, type, wire, shift, expr)	columns.push_back({ #name, log_type<type>(#type) });
+#define LOG_FIELD_PUT(name, type, wire, shift, expr)	row.put<type>(packet.name);
+
+static std::unique_ptr<ColumnLog> open_log(const std::string& dir, const std::string& name, const std::vector<LogColumn>& columns)
+{
+	if(dir.empty())
+		return nullptr;
+	return std::unique_ptr<ColumnLog>(new ColumnLog(dir + "/" + name, columns));
+}
+
+
+LinkRecorder::LinkRecorder(const std::string& log_dir) : log_dir_(log_dir)
+{
+	std::vector<LogColumn> columns = { { "host_ns", LOG_INT64 }, { "nxt_host_ns", LOG_INT64 } };
+	NXT1_BT_FIELDS(LOG_FIELD_COLUMN)
+	nxt1_log_ = open_log(log_dir_, "nxt1.ra15log", columns);
+
+	columns = { { "host_ns", LOG_INT64 }, { "nxt_host_ns", LOG_INT64 }, { "seq", LOG_UINT16 } };
+	TELEMETRY_SAMPLE_FIELDS(LOG_FIELD_COLUMN)
+	sample_log_ = open_log(log_dir_, "samples.ra15log", columns);
+
+	columns = { { "host_ns", LOG_INT64 } };
+	PARAM_REPLY_BT_FIELDS(LOG_FIELD_COLUMN)
+	param_log_ = open_log(log_dir_, "params.ra15log", columns);
+
+	columns = { { "host_ns", LOG_INT64 } };
+	PC_BT_FIELDS(LOG_FIELD_COLUMN)
+	command_log_ = open_log(log_dir_, "commands.ra15log", columns);
+
+	clock_log_ = open_log(log_dir_, "clock.ra15log", { { "host_ns", LOG_INT64 }, { "sent_ns", LOG_INT64 },
+					{ "rx_ms", LOG_UINT32 }, { "tx_ms", LOG_UINT32 }, { "offset_ns", LOG_INT64 }, { "drift_ppb", LOG_INT32 },
+					{ "delay_ns", LOG_INT64 } });
+}
+
+
+LinkRecorder::~LinkRecorder()
+{
+	close();
+}
+
+
+void LinkRecorder::close()
+{
+	for(ColumnLog* log : { nxt1_log_.get(), sample_log_.get(), sub_log_.get(), param_log_.get(), command_log_.get(), clock_log_.get() })
+		if(log)
+			log->close();
+}
+
+
+void LinkRecorder::handle(const LinkPacket& in)
+{
+	switch(in.bytes)
+	{
+		case Nxt1BtPacket::BYTES:
+		{
+			nxt1_.decode(in.payload);
+			have_nxt1_ = true;
+			nxt1_packets_++;
+			if(nxt1_.echoStamp != 0)
+				handle_echo(in);
+			if(nxt1_log_)
+			{
+				LogRow row(nxt1_log_->row_bytes());
+				row.put<int64_t>(in.host_ns).put<int64_t>(clock_.to_host_ns(nxt1_.systick));
+				const Nxt1BtPacket& packet = nxt1_;
+				NXT1_BT_FIELDS(LOG_FIELD_PUT)
+				nxt1_log_->append(row.data());
+			}
+			break;
+		}
+		case TELEMETRY_BT_BYTES:
+			handle_samples(in, false);
+			break;
+		case TELEMETRY_Z_BT_BYTES:
+			handle_samples(in, true);
+			break;
+		case TELEMETRY_SCHEMA_BT_BYTES:
+			handle_schema(in);
+			break;
+		case TELEMETRY_SUB_BT_BYTES:
+			handle_records(in);
+			break;
+		case ParamReplyBtPacket::BYTES:
+		{
+			param_reply_.decode(in.payload);
+			param_replies_++;
+			if(param_log_)
+			{
+				LogRow row(param_log_->row_bytes());
+				row.put<int64_t>(in.host_ns);
+				const ParamReplyBtPacket& packet = param_reply_;
+				PARAM_REPLY_BT_FIELDS(LOG_FIELD_PUT)
+				param_log_->append(row.data());
+			}
+			break;
+		}
+		case CAPTURE_BT_BYTES:
+			captures_++;
+			break;
+		default:
+			ignored_++;
+			break;
+	}
+}
+
+
+// TELEMETRY_BT: up to TELEMETRY_BATCH whole samples. TELEMETRY_Z_BT: the first sample whole, then each field of the
+// others as a delta from the sample before, as unpacked in PacketBench.cpp.
+void LinkRecorder::handle_samples(const LinkPacket& in, bool delta)
+{
+	TelemetryFramePacket frame;
+	frame.decode(in.payload);
+	size_t count = std::min<size_t>(frame.count, delta ? TELEMETRY_Z_MAX : TELEMETRY_BATCH);
+	if(count == 0)
+		return;
+
+	if(next_sample_seq_ >= 0)
+		samples_lost_ += (uint16_t)(frame.seq - next_sample_seq_);
+	next_sample_seq_ = (uint16_t)(frame.seq + count);
+
+	uint8_t cur[SAMPLE_BYTES], prev[SAMPLE_BYTES];
+	size_t pos = FRAME_BYTES;
+	for(size_t k=0; k<count; k++)
+	{
+		if(!delta || k == 0)
+		{
+			memcpy(cur, &in.payload[pos], SAMPLE_BYTES);
+			pos += SAMPLE_BYTES;
+		}
+		else
+		{
+			memcpy(prev, cur, SAMPLE_BYTES);
+			size_t offset = 0;
+			for(uint8_t n : sample_field_bytes)
+			{
+				if(pos >= in.bytes)
+					return;				// Corrupt: ran off the end of the frame
+				pos += packet_get_delta(&in.payload[pos], &cur[offset], &prev[offset], n);
+				offset += n;
+			}
+		}
+		samples_++;
+		if(sample_log_)
+		{
+			TelemetrySamplePacket packet;
+			packet.decode(cur);
+			LogRow row(sample_log_->row_bytes());
+			row.put<int64_t>(in.host_ns).put<int64_t>(clock_.to_host_ns(packet.systick)).put<uint16_t>((uint16_t)(frame.seq + k));
+			TELEMETRY_SAMPLE_FIELDS(LOG_FIELD_PUT)
+			sample_log_->append(row.data());
+		}
+	}
+}
+
+
+// The NXT1_BT in, decoded into nxt1_, echoes a probe: time it, and forget the probes that were lost
+void LinkRecorder::handle_echo(const LinkPacket& in)
+{
+	auto it = std::find_if(probes_.begin(), probes_.end(),
+						   [this](const std::pair<uint32_t, int64_t>& p) { return p.first == nxt1_.echoStamp; });
+	if(it == probes_.end())
+		return;					// Sent by someone else, or timed out
+	int64_t sent_ns = it->second;
+	clock_.add(sent_ns, nxt1_.echoRxMs, nxt1_.txMs, in.host_ns);
+	last_echo_ = { sent_ns, in.host_ns, nxt1_.echoRxMs, nxt1_.txMs };
+	echoes_++;
+	probes_.erase(probes_.begin(), ++it);	// Older stamps were not echoed: NXT1 echoes only the latest
+
+	if(clock_log_)
+	{
+		const ClockSync::Estimate& e = clock_.estimate();
+		LogRow row(clock_log_->row_bytes());
+		row.put<int64_t>(in.host_ns).put<int64_t>(sent_ns).put<uint32_t>(nxt1_.echoRxMs).put<uint32_t>(nxt1_.txMs);
+		row.put<int64_t>((int64_t)clock_.offset_ns(in.host_ns)).put<int32_t>((int32_t)std::lround(e.drift * 1e9)).put<int64_t>(e.delay_ns);
+		clock_log_->append(row.data());
+	}
+}
+
+
+void LinkRecorder::probe_sent(uint32_t stamp, int64_t host_ns)
+{
+	while(!probes_.empty() && host_ns - probes_.front().second > CLOCK_PROBE_TIMEOUT_NS)
+		probes_.pop_front();
+	probes_.emplace_back(stamp, host_ns);
+}
+
+
+void LinkRecorder::command_sent(const PcBtPacket& packet, int64_t host_ns)
+{
+	if(packet.pcStamp != 0)
+		probe_sent(packet.pcStamp, host_ns);
+	if(command_log_)
+	{
+		LogRow row(command_log_->row_bytes());
+		row.put<int64_t>(host_ns);
+		PC_BT_FIELDS(LOG_FIELD_PUT)
+		command_log_->append(row.data());
+	}
+}
+
+
+std::vector<uint8_t> LinkRecorder::clock_probe(int64_t host_ns)
+{
+	ClockBtPacket probe;
+	probe.pcStamp = link_stamp_ms(host_ns);
+	probe_sent(probe.pcStamp, host_ns);
+	std::vector<uint8_t> payload(ClockBtPacket::BYTES);
+	probe.encode(payload.data());
+	return payload;
+}
+
+
+// As NXTConnection.schemaReceived(): entries first and on of the registry, or of a subscription
+void LinkRecorder::handle_schema(const LinkPacket& in)
+{
+	TelemetrySchemaPacket header;
+	header.decode(in.payload);
+	schemas_++;
+
+	TelemetryLayout& layout = (header.layout == 0) ? registry_ : subscription_;
+	bool was_complete = layout.complete();
+	if(layout.layout != header.layout || layout.signals.size() != header.total || (header.layout == 0 && header.first == 0))
+	{
+		layout = TelemetryLayout();
+		layout.layout = header.layout;
+		layout.decimation = header.decimation;
+		layout.signals.resize(header.total);
+		was_complete = false;
+	}
+
+	for(size_t k=0; k<TELEMETRY_SCHEMA_ENTRIES && header.first + k < header.total; k++)
+	{
+		const uint8_t* entry = &in.payload[SCHEMA_BYTES + k*TELEMETRY_SCHEMA_ENTRY_BYTES];
+		TelemetrySignal& signal = layout.signals[header.first + k];
+		if(signal.name.empty())
+			layout.received++;
+		signal.id = entry[0];
+		signal.type = entry[1];
+		signal.name.assign((const char*)&entry[2], strnlen((const char*)&entry[2], TELEMETRY_NAME_CHARS));
+		if(signal.name.empty())
+			signal.name = "signal" + std::to_string(signal.id);
+	}
+
+	if(header.layout != 0 && layout.complete() && !was_complete)
+		open_subscription_log();
+}
+
+
+void LinkRecorder::open_subscription_log()
+{
+	next_record_seq_ = -1;
+	records_ = 0;
+	records_lost_ = 0;
+	if(sub_log_)
+		sub_log_->close();
+	std::vector<LogColumn> columns = { { "host_ns", LOG_INT64 }, { "seq", LOG_UINT16 } };
+	for(const TelemetrySignal& signal : subscription_.signals)
+		columns.push_back({ signal.name, (LogType)std::min<uint8_t>(signal.type, TLM_FIX16) });
+	sub_log_ = open_log(log_dir_, "sub" + std::to_string(subscription_.layout) + ".ra15log", columns);
+}
+
+
+// As NXTConnection.subscribedReceived(): count records of the current subscription
+void LinkRecorder::handle_records(const LinkPacket& in)
+{
+	TelemetrySubPacket frame;
+	frame.decode(in.payload);
+	if(frame.layout != subscription_.layout || !subscription_.complete())
+	{
+		ignored_++;			// Not described yet, or of a subscription since replaced
+		return;
+	}
+
+	size_t record_bytes = 0;
+	for(const TelemetrySignal& signal : subscription_.signals)
+		record_bytes += TELEMETRY_TYPE_BYTES(signal.type);
+	if(record_bytes == 0 || SUB_BYTES + frame.count*record_bytes > in.bytes)
+	{
+		ignored_++;
+		return;
+	}
+
+	if(next_record_seq_ >= 0)
+		records_lost_ += (uint16_t)(frame.seq - next_record_seq_);
+	next_record_seq_ = (uint16_t)(frame.seq + frame.count);
+	records_ += frame.count;
+
+	if(sub_log_)
+	{
+		LogRow row(sub_log_->row_bytes());
+		for(size_t k=0; k<frame.count; k++)
+		{
+			row.clear();
+			row.put<int64_t>(in.host_ns).put<uint16_t>((uint16_t)(frame.seq + k));
+			row.put_bytes(&in.payload[SUB_BYTES + k*record_bytes], record_bytes);		// Already little-endian, in entry order
+			sub_log_->append(row.data());
+		}
+	}
+}
+
+
+LinkRecorder::Stats LinkRecorder::stats() const
+{
+	Stats s;
+	s.nxt1 = nxt1_packets_;
+	s.captures = captures_;
+	s.param_replies = param_replies_;
+	s.schemas = schemas_;
+	s.ignored = ignored_;
+	s.samples = samples_;
+	s.samples_lost = samples_lost_;
+	s.records = records_;
+	s.records_lost = records_lost_;
+	s.echoes = echoes_;
+	return s;
+}
+
+
+std::vector<uint8_t> LinkRecorder::subscribe_payload(const std::vector<std::string>& names, uint8_t decimation) const
+{
+	std::vector<uint8_t> payload(SUBSCRIBE_BT_BYTES, 0);
+	SubscribeBtPacket header;
+	if(!names.empty())
+	{
+		if(!registry_.complete())
+			throw std::runtime_error("NXT1 has not described its telemetry registry yet");
+		if(names.size() > TELEMETRY_SUB_MAX)
+			throw std::runtime_error("At most " + std::to_string(TELEMETRY_SUB_MAX) + " signals");
+		if(decimation == 0)
+			throw std::runtime_error("Decimation must be 1 or more");
+		for(size_t i=0; i<names.size(); i++)
+		{
+			auto it = std::find_if(registry_.signals.begin(), registry_.signals.end(),
+								   [&](const TelemetrySignal& s) { return s.name == names[i]; });
+			if(it == registry_.signals.end())
+				throw std::runtime_error("Unknown signal " + names[i]);
+			payload[SubscribeBtPacket::BYTES + i] = it->id;
+		}
+		header.decimation = decimation;
+		header.count = (uint8_t)names.size();
+	}
+	header.encode(payload.data());
+	return payload;
+}
+
+
+std::vector<std::string> split_names(const std::string& list)
+{
+	std::vector<std::string> names;
+	size_t start = 0;
+	while(start <= list.size())
+	{
+		size_t end = list.find(',', start);
+		if(end == std::string::npos)
+			end = list.size();
+		if(end > start)
+			names.push_back(list.substr(start, end - start));
+		start = end + 1;
+	}
+	return names;
+}
+
+}
@@ -0,0 +1,141 @@
+/*
+ * LinkRecorder.h
+ *
+ *	Consumer side of NxtLink: decodes the packets NXT1 sends, keeps what the PC needs to talk back (the latest
+ *	NXT1_BT, the telemetry registry and the subscription NXT1 described), counts what was lost, keeps NXT1's clock
+ *	in step with the PC's (ClockSync.h), and appends everything to ColumnLogs in a directory:
+ *		nxt1.ra15log			NXT1_BT packets: host_ns, nxt_host_ns, then its fields
+ *		samples.ra15log			Joint states of every TASK_MOTORREG cycle (TELEMETRY_BT or TELEMETRY_Z_BT): host_ns,
+ *								nxt_host_ns, seq, then the TELEMETRY_SAMPLE fields
+ *		sub<layout>.ra15log		Records of a subscription: host_ns, seq, then its signals under their registry names
+ *		params.ra15log			PARAM_REPLY_BT packets: host_ns, then its fields
+ *		commands.ra15log		PC_BT packets sent (command_sent()): host_ns, then its fields
+ *		clock.ra15log			Echoed clock probes: host_ns, sent_ns, rx_ms, tx_ms (ClockSync::add()), then the
+ *								estimate after it: offset_ns at host_ns, drift_ppb and delay_ns
+ *	host_ns is when the packet arrived or was sent (link_now_ns()). nxt_host_ns is the packet's systick on the same
+ *	clock, as the estimate stood when it arrived, and 0 before the first echo; clock.ra15log allows a better fit
+ *	afterwards. Commands and joint states are so on one timeline. fix16_t fields are stored raw; quantized sample
+ *	fields are stored as the fix16_t they decode to. RS485 capture packets are counted, not logged (see
+ *	NXTConnection.startCapture).
+ *
+ *	Not thread-safe: one thread calls handle() and the rest, usually the one that reads the NxtLink.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Daniel
+ */
+
+#ifndef SRC_LINK_LINKRECORDER_H_
+#define SRC_LINK_LINKRECORDER_H_
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../Common/Packets.h"
+#include "ClockSync.h"
+#include "ColumnLog.h"
+#include "NxtLink.h"
+
+namespace ra15 {
+
+static const int64_t CLOCK_PROBE_INTERVAL_NS = 250000000;	// clock_probe() every this often keeps ClockSync fed
+static const int64_t CLOCK_PROBE_TIMEOUT_NS = 5000000000LL;	// A probe not echoed by then was lost
+
+struct TelemetrySignal
+{
+	uint8_t id = 0;
+	uint8_t type = 0;					// enum telemetry_type
+	std::string name;
+};
+
+// A layout NXT1 described: the registry (layout 0), or a subscription's record
+struct TelemetryLayout
+{
+	int layout = -1;					// -1 before NXT1 described one
+	uint8_t decimation = 0;
+	std::vector<TelemetrySignal> signals;	// total entries; those not received yet have an empty name
+	size_t received = 0;
+
+	bool complete() const				{ return layout >= 0 && received == signals.size(); }
+};
+
+class LinkRecorder
+{
+public:
+	struct Echo
+	{
+		int64_t sent_ns, host_ns;		// PC times of sending the probe and receiving the echo
+		uint32_t rx_ms, tx_ms;			// NXT1's systick at reading the probe and at sending the echo
+	};
+
+	struct Stats
+	{
+		uint64_t nxt1, captures, param_replies, schemas, ignored;	// Packets
+		uint64_t echoes;				// Clock probes echoed
+		uint64_t samples, samples_lost;
+		uint64_t records, records_lost;	// Of the current subscription
+	};
+
+	// log_dir empty: keep state and counts only, no logs. Throws std::runtime_error if a log cannot be created.
+	explicit LinkRecorder(const std::string& log_dir);
+	~LinkRecorder();
+
+	void handle(const LinkPacket& packet);
+
+	// Closes the logs, writing their last rows
+	void close();
+
+	bool have_nxt1() const						{ return have_nxt1_; }
+	const Nxt1BtPacket& nxt1() const			{ return nxt1_; }
+	const TelemetryLayout& registry() const		{ return registry_; }
+	const TelemetryLayout& subscription() const	{ return subscription_; }
+	bool have_param_reply() const				{ return param_replies_ > 0; }
+	const ParamReplyBtPacket& param_reply() const	{ return param_reply_; }
+	const ClockSync& clock() const				{ return clock_; }
+	const Echo& last_echo() const				{ return last_echo_; }		// Valid once stats().echoes > 0
+	Stats stats() const;
+
+	// Logs a PC_BT as it is sent at host_ns, and waits for the echo of its pcStamp
+	void command_sent(const PcBtPacket& packet, int64_t host_ns);
+
+	// CLOCK_BT payload, stamped with host_ns, and waits for its echo. Only the first of probes stamped in the same ms
+	// is timed.
+	std::vector<uint8_t> clock_probe(int64_t host_ns);
+
+	// SUBSCRIBE_BT payload for the named signals of the registry. Throws std::runtime_error if the registry is
+	// incomplete or a name is not in it. No names: ends the subscription and asks for the registry.
+	std::vector<uint8_t> subscribe_payload(const std::vector<std::string>& names, uint8_t decimation) const;
+
+private:
+	void handle_samples(const LinkPacket& packet, bool delta);
+	void handle_schema(const LinkPacket& packet);
+	void handle_records(const LinkPacket& packet);
+	void open_subscription_log();
+	void probe_sent(uint32_t stamp, int64_t host_ns);
+	void handle_echo(const LinkPacket& packet);
+
+	std::string log_dir_;
+	std::unique_ptr<ColumnLog> nxt1_log_, sample_log_, sub_log_, param_log_, command_log_, clock_log_;
+
+	bool have_nxt1_ = false;
+	Nxt1BtPacket nxt1_;
+	ParamReplyBtPacket param_reply_;
+	TelemetryLayout registry_, subscription_;
+	ClockSync clock_;
+	Echo last_echo_ = {};
+	std::deque<std::pair<uint32_t, int64_t>> probes_;	// pcStamp and PC time of the probes not echoed yet, oldest first
+
+	int next_sample_seq_ = -1;			// seq expected next, -1 before the first frame
+	int next_record_seq_ = -1;
+	uint64_t nxt1_packets_ = 0, captures_ = 0, param_replies_ = 0, schemas_ = 0, ignored_ = 0;
+	uint64_t samples_ = 0, samples_lost_ = 0, records_ = 0, records_lost_ = 0, echoes_ = 0;
+};
+
+// Splits "a,b,c" at commas
+std::vector<std::string> split_names(const std::string& list);
+
+}
+
+#endif /* SRC_LINK_LINKRECORDER_H_ */
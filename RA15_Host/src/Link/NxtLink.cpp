@@ -0,0 +1,339 @@
+/*
+ * NxtLink.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Daniel
+ */
+
+#include "NxtLink.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include "../Common/Packets.h"
+
+namespace ra15 {
+
+// RFCOMM socket address, as in BlueZ's <bluetooth/rfcomm.h>, so that the link builds without the BlueZ headers
+static const int LINK_AF_BLUETOOTH = 31;
+static const int LINK_BTPROTO_RFCOMM = 3;
+struct link_sockaddr_rc
+{
+	sa_family_t rc_family;
+	uint8_t rc_bdaddr[6];				// Least significant byte first, the reverse of how addresses are written
+	uint8_t rc_channel;
+};
+
+static const size_t LINK_READ_BYTES = 4096;
+
+
+int64_t link_now_ns()
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+
+uint32_t link_stamp_ms(int64_t host_ns)
+{
+	uint32_t ms = (uint32_t)(host_ns / 1000000);
+	return ms != 0 ? ms : 1;
+}
+
+
+bool link_rx_length(size_t bytes)
+{
+	switch(bytes)
+	{
+		case PACKET_BYTES(NXT1_BT_FIELDS):
+		case TELEMETRY_BT_BYTES:
+		case TELEMETRY_Z_BT_BYTES:
+		case TELEMETRY_SCHEMA_BT_BYTES:
+		case TELEMETRY_SUB_BT_BYTES:
+		case PACKET_BYTES(PARAM_REPLY_BT_FIELDS):
+		case CAPTURE_BT_BYTES:
+			return true;
+		default:
+			return false;
+	}
+}
+
+
+// "XX:XX:XX:XX:XX:XX[@channel]" -> RFCOMM address. False if device is not a Bluetooth address.
+static bool parse_bt_address(const std::string& device, link_sockaddr_rc& addr)
+{
+	unsigned b[6], channel = 1;
+	char tail = 0;
+	int n = std::sscanf(device.c_str(), "%2x:%2x:%2x:%2x:%2x:%2x@%u%c", &b[5], &b[4], &b[3], &b[2], &b[1], &b[0], &channel, &tail);
+	if(n != 6 && n != 7)
+		return false;
+	if(n == 6 && device.size() != 17)
+		return false;
+	if(channel < 1 || channel > 30)
+		throw std::runtime_error(device + ": RFCOMM channel must be 1 to 30");
+	memset(&addr, 0, sizeof(addr));
+	addr.rc_family = LINK_AF_BLUETOOTH;
+	for(int i=0; i<6; i++)
+		addr.rc_bdaddr[i] = (uint8_t)b[i];
+	addr.rc_channel = (uint8_t)channel;
+	return true;
+}
+
+
+static int open_device(const std::string& device)
+{
+	link_sockaddr_rc addr;
+	if(parse_bt_address(device, addr))
+	{
+		int fd = socket(LINK_AF_BLUETOOTH, SOCK_STREAM, LINK_BTPROTO_RFCOMM);
+		if(fd < 0)
+			throw std::runtime_error("Cannot create an RFCOMM socket: " + std::string(std::strerror(errno)));
+		if(connect(fd, (const sockaddr*)&addr, sizeof(addr)) != 0)
+		{
+			std::string why = std::strerror(errno);
+			::close(fd);
+			throw std::runtime_error("Cannot connect to " + device + ": " + why);
+		}
+		return fd;
+	}
+
+	int fd = open(device.c_str(), O_RDWR | O_NOCTTY);
+	if(fd < 0)
+		throw std::runtime_error("Cannot open " + device + ": " + std::strerror(errno));
+	termios tio;
+	if(tcgetattr(fd, &tio) == 0)		// A tty (rfcomm, pty): raw bytes, no echo or line editing
+	{
+		cfmakeraw(&tio);
+		tcsetattr(fd, TCSANOW, &tio);
+	}
+	return fd;
+}
+
+
+NxtLink::NxtLink(const std::string& device)
+{
+	fd_ = open_device(device);
+	fcntl(fd_, F_SETFL, fcntl(fd_, F_GETFL) | O_NONBLOCK);
+	rx_event_ = eventfd(0, EFD_NONBLOCK);
+	tx_event_ = eventfd(0, EFD_NONBLOCK);
+	if(rx_event_ < 0 || tx_event_ < 0)
+	{
+		std::string why = std::strerror(errno);
+		close();
+		throw std::runtime_error("Cannot create an eventfd: " + why);
+	}
+	running_.store(true, std::memory_order_release);
+	thread_ = std::thread(&NxtLink::run, this);
+}
+
+
+NxtLink::~NxtLink()
+{
+	close();
+}
+
+
+static void signal_event(int fd)
+{
+	uint64_t one = 1;
+	ssize_t n = write(fd, &one, sizeof(one));
+	(void)n;			// Only fails if the counter is about to overflow, and then it is already signalled
+}
+
+static void clear_event(int fd)
+{
+	uint64_t count;
+	ssize_t n = read(fd, &count, sizeof(count));
+	(void)n;
+}
+
+
+bool NxtLink::wait(int timeout_ms)
+{
+	if(rx_.size() > 0)
+		return true;
+	pollfd p = { rx_event_, POLLIN, 0 };
+	if(poll(&p, 1, timeout_ms) <= 0)
+		return false;
+	clear_event(rx_event_);
+	return rx_.size() > 0;
+}
+
+
+bool NxtLink::send(const uint8_t* payload, size_t bytes)
+{
+	if(!running() || bytes == 0 || bytes > sizeof(LinkPacket::payload))
+		return false;
+	LinkPacket packet;
+	packet.host_ns = link_now_ns();
+	packet.bytes = (uint8_t)bytes;
+	memcpy(packet.payload, payload, bytes);
+	if(!tx_.push(packet))
+	{
+		tx_overflows_.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+	signal_event(tx_event_);
+	return true;
+}
+
+
+void NxtLink::close()
+{
+	if(thread_.joinable())
+	{
+		stop_.store(true, std::memory_order_release);
+		signal_event(tx_event_);
+		thread_.join();
+	}
+	running_.store(false, std::memory_order_release);
+	for(int* fd : { &fd_, &rx_event_, &tx_event_ })
+	{
+		if(*fd >= 0)
+			::close(*fd);
+		*fd = -1;
+	}
+}
+
+
+std::string NxtLink::error() const
+{
+	std::lock_guard<std::mutex> lock(error_lock_);
+	return error_;
+}
+
+
+NxtLink::Stats NxtLink::stats() const
+{
+	Stats s;
+	s.rx_bytes = rx_bytes_.load(std::memory_order_relaxed);
+	s.rx_packets = rx_packets_.load(std::memory_order_relaxed);
+	s.rx_resyncs = rx_resyncs_.load(std::memory_order_relaxed);
+	s.rx_overflows = rx_overflows_.load(std::memory_order_relaxed);
+	s.tx_packets = tx_packets_.load(std::memory_order_relaxed);
+	s.tx_overflows = tx_overflows_.load(std::memory_order_relaxed);
+	return s;
+}
+
+
+void NxtLink::fail(const std::string& why)
+{
+	{
+		std::lock_guard<std::mutex> lock(error_lock_);
+		error_ = why;
+	}
+	running_.store(false, std::memory_order_release);
+	signal_event(rx_event_);			// Wakes a consumer in wait()
+}
+
+
+// I/O thread. Reads are split into packets in rx_buf; packets taken from tx_ are written from tx_buf.
+void NxtLink::run()
+{
+	std::vector<uint8_t> rx_buf, tx_buf;
+	rx_buf.reserve(2*LINK_READ_BYTES);
+	size_t tx_sent = 0;
+	uint8_t chunk[LINK_READ_BYTES];
+	bool stopping = false;
+
+	for(;;)
+	{
+		// Everything queued for NXT1 goes in one write where possible
+		LinkPacket out;
+		while(tx_.pop(out))
+		{
+			tx_buf.push_back(out.bytes);
+			tx_buf.push_back(0);
+			tx_buf.insert(tx_buf.end(), out.payload, out.payload + out.bytes);
+			tx_packets_.fetch_add(1, std::memory_order_relaxed);
+		}
+		if(!stopping && stop_.load(std::memory_order_acquire))
+			stopping = true;
+		if(stopping && tx_sent == tx_buf.size())
+			return;
+
+		pollfd p[2] = { { fd_, (short)(POLLIN | (tx_sent < tx_buf.size() ? POLLOUT : 0)), 0 }, { tx_event_, POLLIN, 0 } };
+		if(poll(p, 2, stopping ? 100 : -1) < 0)
+		{
+			if(errno == EINTR)
+				continue;
+			return fail(std::string("poll: ") + std::strerror(errno));
+		}
+		if(stopping && p[0].revents == 0)
+			return;				// NXT1 is not taking the last packets. Give up on them.
+		if(p[1].revents & POLLIN)
+			clear_event(tx_event_);
+
+		if(p[0].revents & POLLOUT)
+		{
+			ssize_t n = write(fd_, tx_buf.data() + tx_sent, tx_buf.size() - tx_sent);
+			if(n < 0 && errno != EAGAIN && errno != EINTR)
+				return fail(std::string("write: ") + std::strerror(errno));
+			if(n > 0)
+				tx_sent += n;
+			if(tx_sent == tx_buf.size())
+			{
+				tx_buf.clear();
+				tx_sent = 0;
+			}
+		}
+
+		if(p[0].revents & (POLLIN | POLLHUP | POLLERR))
+		{
+			ssize_t n = read(fd_, chunk, sizeof(chunk));
+			if(n == 0 || (n < 0 && errno == EIO))		// EIO: the other end of a pty closed
+				return fail("Connection closed by NXT1");
+			if(n < 0 && errno != EAGAIN && errno != EINTR)
+				return fail(std::string("read: ") + std::strerror(errno));
+			if(n <= 0)
+				continue;
+			int64_t now = link_now_ns();
+			rx_bytes_.fetch_add(n, std::memory_order_relaxed);
+			rx_buf.insert(rx_buf.end(), chunk, chunk + n);
+
+			// Split into packets. As in NXTConnection.readPacket(), a byte is dropped at a time until the next two
+			// are a header of a length NXT1 sends.
+			size_t pos = 0, received = 0;
+			while(rx_buf.size() - pos >= LINK_HEADER_BYTES)
+			{
+				uint8_t bytes = rx_buf[pos];
+				if(rx_buf[pos+1] != 0 || !link_rx_length(bytes))
+				{
+					pos++;
+					rx_resyncs_.fetch_add(1, std::memory_order_relaxed);
+					continue;
+				}
+				if(rx_buf.size() - pos < LINK_HEADER_BYTES + bytes)
+					break;
+				LinkPacket in;
+				in.host_ns = now;
+				in.bytes = bytes;
+				memcpy(in.payload, &rx_buf[pos + LINK_HEADER_BYTES], bytes);
+				pos += LINK_HEADER_BYTES + bytes;
+				if(rx_.push(in))
+					received++;
+				else
+					rx_overflows_.fetch_add(1, std::memory_order_relaxed);
+			}
+			rx_buf.erase(rx_buf.begin(), rx_buf.begin() + pos);
+			if(received > 0)
+			{
+				rx_packets_.fetch_add(received, std::memory_order_relaxed);
+				signal_event(rx_event_);
+			}
+		}
+	}
+}
+
+}
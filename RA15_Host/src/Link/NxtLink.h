@@ -0,0 +1,110 @@
+/*
+ * NxtLink.h
+ *
+ *	Bluetooth link to NXT1 without MATLAB. An I/O thread owns the connection: it reads the byte stream, splits it
+ *	into packets at their ecrobot headers (payload length, 0), stamps each with the host time, and hands them to
+ *	the consumer through an SpscRing. Packets for NXT1 go the other way through a second ring. Neither thread ever
+ *	waits for the other, so a slow consumer (a log write, MATLAB) cannot stall the reads, and a full ring is
+ *	counted rather than blocked on.
+ *
+ *	device is either a serial device (/dev/rfcomm0 bound with rfcomm, or a pty standing in for NXT1), or NXT1's
+ *	Bluetooth address, "00:16:53:0A:0B:0C" or "00:16:53:0A:0B:0C@1" for RFCOMM channel 1 (the default).
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Daniel
+ */
+
+#ifndef SRC_LINK_NXTLINK_H_
+#define SRC_LINK_NXTLINK_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "SpscRing.h"
+
+namespace ra15 {
+
+static const size_t LINK_HEADER_BYTES = 2;			// ecrobot header: payload length, 0
+static const size_t LINK_RX_PACKETS = 1024;			// ~10 s of every packet NXT1 sends at once
+static const size_t LINK_TX_PACKETS = 64;
+
+// One Bluetooth packet, without its header
+struct LinkPacket
+{
+	int64_t host_ns;					// Received (steady clock, see link_now_ns()) or queued
+	uint8_t bytes;
+	uint8_t payload[255];
+};
+
+// Steady clock of the PC, ns. Shared by every timestamp the link takes.
+int64_t link_now_ns();
+
+// pcStamp of a PC_BT or CLOCK_BT sent at host_ns: link_now_ns() in ms, low 32 bits, never 0 (unstamped)
+uint32_t link_stamp_ms(int64_t host_ns);
+
+// True for the payload lengths NXT1 sends (PacketSchema.h)
+bool link_rx_length(size_t bytes);
+
+class NxtLink
+{
+public:
+	// Counters. rx_* and tx_packets are the I/O thread's; tx_overflows the consumer's.
+	struct Stats
+	{
+		uint64_t rx_bytes, rx_packets;
+		uint64_t rx_resyncs;			// Bytes dropped looking for a header
+		uint64_t rx_overflows;			// Packets dropped because the consumer fell LINK_RX_PACKETS behind
+		uint64_t tx_packets, tx_overflows;
+	};
+
+	// Connects, and starts the I/O thread. Throws std::runtime_error on failure.
+	explicit NxtLink(const std::string& device);
+	~NxtLink();								// close()
+	NxtLink(const NxtLink&) = delete;
+	NxtLink& operator=(const NxtLink&) = delete;
+
+	// Consumer. Next packet received, if any.
+	bool receive(LinkPacket& packet)		{ return rx_.pop(packet); }
+
+	// Consumer. Waits up to timeout_ms for a packet to arrive. Returns false on timeout.
+	bool wait(int timeout_ms);
+
+	// Consumer. Queues a packet for NXT1 (payload, without its header). Returns false if the queue is full or the
+	// link is closed.
+	bool send(const uint8_t* payload, size_t bytes);
+
+	// Stops the I/O thread and closes the connection. Packets still queued for NXT1 are written first.
+	void close();
+
+	// False once the connection closed or failed. error() then says why (empty after close()).
+	bool running() const					{ return running_.load(std::memory_order_acquire); }
+	std::string error() const;
+
+	Stats stats() const;
+
+private:
+	void run();
+	void fail(const std::string& why);
+
+	int fd_ = -1;
+	int rx_event_ = -1;						// eventfd: I/O thread -> consumer, packets arrived
+	int tx_event_ = -1;						// eventfd: consumer -> I/O thread, packets to send, or stop
+	std::thread thread_;
+	std::atomic<bool> running_{false};
+	std::atomic<bool> stop_{false};
+	mutable std::mutex error_lock_;
+	std::string error_;
+
+	SpscRing<LinkPacket, LINK_RX_PACKETS> rx_;
+	SpscRing<LinkPacket, LINK_TX_PACKETS> tx_;
+
+	std::atomic<uint64_t> rx_bytes_{0}, rx_packets_{0}, rx_resyncs_{0}, rx_overflows_{0}, tx_packets_{0}, tx_overflows_{0};
+};
+
+}
+
+#endif /* SRC_LINK_NXTLINK_H_ */
@@ -0,0 +1,311 @@
+/*
+ * NxtLinkApi.cpp
+ *
+ *	libnxtlink.so: nxt_link_api.h over NxtLink and LinkRecorder. The consumer thread drains the link into the
+ *	recorder under lock; callers only take the lock to read the recorder's state or to queue a packet, so they
+ *	never wait on Bluetooth, and the I/O thread never waits on either of them. The consumer thread also sends the
+ *	CLOCK_BT probes that keep the recorder's ClockSync fed, so logs get nxt_host_ns without any targets being sent.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Daniel
+ */
+
+#include "nxt_link_api.h"
+
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "../Common/Waypoint.h"
+#include "LinkRecorder.h"
+#include "NxtLink.h"
+
+using namespace ra15;
+
+static const int32_t FIX16_DISABLE = 0x7FFFFFFF;		// DISABLE_PT, DISABLE_VT (fix16_maximum)
+static const uint16_t DEFAULT_TX_INTERVAL_MS = 100;		// BT_DEFAULT_TX_INTERVAL
+
+struct nxt_link
+{
+	std::unique_ptr<NxtLink> link;
+	std::unique_ptr<LinkRecorder> recorder;
+	std::mutex lock;					// recorder, and the producer end of the link's TX ring
+	std::thread consumer;
+	std::atomic<bool> stop{false};
+	PcBtPacket last_pc;					// Latest targets sent, the base of the disconnect packet
+	bool sent_pc = false;
+};
+
+static thread_local std::string last_error;
+
+static int fail(const std::string& why)
+{
+	last_error = why;
+	return -1;
+}
+
+static void consume(nxt_link* h)
+{
+	LinkPacket packet;
+	int64_t next_probe = 0;
+	while(!h->stop.load(std::memory_order_acquire))
+	{
+		h->link->wait(100);
+		std::lock_guard<std::mutex> guard(h->lock);
+		while(h->link->receive(packet))
+			h->recorder->handle(packet);
+
+		int64_t now = link_now_ns();
+		if(h->recorder->have_nxt1() && now >= next_probe)		// NXT1 is listening
+		{
+			std::vector<uint8_t> probe = h->recorder->clock_probe(now);
+			h->link->send(probe.data(), probe.size());
+			next_probe = now + CLOCK_PROBE_INTERVAL_NS;
+		}
+	}
+}
+
+static int send_payload(nxt_link* h, const uint8_t* payload, size_t bytes)
+{
+	if(!h->link->send(payload, bytes))
+		return fail(h->link->running() ? "Queue to NXT1 full" : "Not connected: " + h->link->error());
+	return 0;
+}
+
+extern "C" {
+
+nxt_link* nxt_link_open(const char* device, const char* log_dir)
+{
+	try
+	{
+		std::unique_ptr<nxt_link> h(new nxt_link);
+		h->recorder.reset(new LinkRecorder(log_dir ? log_dir : ""));
+		h->link.reset(new NxtLink(device ? device : ""));
+		h->last_pc.nxtTransmitInterval = DEFAULT_TX_INTERVAL_MS;
+		h->consumer = std::thread(consume, h.get());
+		return h.release();
+	}
+	catch(const std::exception& e)
+	{
+		fail(e.what());
+		return nullptr;
+	}
+}
+
+
+void nxt_link_close(nxt_link* h)
+{
+	if(!h)
+		return;
+	if(h->sent_pc)					// As NXTConnection.bluetoothDisconnect()
+	{
+		PcBtPacket packet = h->last_pc;
+		packet.nxtTransmitInterval = 0;
+		int64_t now = link_now_ns();
+		packet.pcStamp = link_stamp_ms(now);
+		uint8_t payload[PcBtPacket::BYTES];
+		packet.encode(payload);
+		std::lock_guard<std::mutex> guard(h->lock);
+		h->recorder->command_sent(packet, now);
+		h->link->send(payload, sizeof(payload));
+	}
+	h->stop.store(true, std::memory_order_release);
+	h->consumer.join();
+	h->link->close();
+	LinkPacket packet;
+	while(h->link->receive(packet))
+		h->recorder->handle(packet);
+	try { h->recorder->close(); }
+	catch(const std::exception& e) { fail(e.what()); }
+	delete h;
+}
+
+
+const char* nxt_link_error(void)
+{
+	return last_error.c_str();
+}
+
+
+int nxt_link_get_stats(nxt_link* h, nxt_link_stats* stats)
+{
+	NxtLink::Stats l = h->link->stats();
+	std::lock_guard<std::mutex> guard(h->lock);
+	LinkRecorder::Stats r = h->recorder->stats();
+	stats->connected = h->link->running();
+	stats->layout = h->recorder->subscription().complete() ? h->recorder->subscription().layout : -1;
+	stats->rx_bytes = l.rx_bytes;
+	stats->rx_packets = l.rx_packets;
+	stats->rx_resyncs = l.rx_resyncs;
+	stats->rx_overflows = l.rx_overflows;
+	stats->tx_packets = l.tx_packets;
+	stats->tx_overflows = l.tx_overflows;
+	stats->nxt1 = r.nxt1;
+	stats->samples = r.samples;
+	stats->samples_lost = r.samples_lost;
+	stats->records = r.records;
+	stats->records_lost = r.records_lost;
+	stats->param_replies = r.param_replies;
+	stats->echoes = r.echoes;
+	if(!stats->connected)
+		last_error = h->link->error();
+	return 0;
+}
+
+
+int nxt_link_get_joints(nxt_link* h, nxt_link_joints* joints)
+{
+	std::lock_guard<std::mutex> guard(h->lock);
+	if(!h->recorder->have_nxt1())
+		return fail("No NXT1_BT packet yet");
+	const Nxt1BtPacket& n = h->recorder->nxt1();
+	const int32_t p[6] = { n.j1p, n.j2p, n.j3p, n.j4p, n.j5p, n.j6p };
+	const int32_t v[6] = { n.j1v, n.j2v, n.j3v, n.j4v, n.j5v, n.j6v };
+	const int8_t pwm[6] = { n.j1pwm, n.j2pwm, n.j3pwm, n.j4pwm, n.j5pwm, n.j6pwm };
+	joints->systick = n.systick;
+	for(int ji=0; ji<6; ji++)
+	{
+		joints->p[ji] = fix16_to_double(p[ji]);
+		joints->v[ji] = fix16_to_double(v[ji]);
+		joints->pwm[ji] = pwm[ji];
+	}
+	return 0;
+}
+
+
+int nxt_link_send_targets(nxt_link* h, const double pt[6], const double vt[6], uint16_t interval_ms, uint8_t compress)
+{
+	std::lock_guard<std::mutex> guard(h->lock);
+	PcBtPacket& packet = h->last_pc;
+	int32_t* const targets[12] = { &packet.j1pt, &packet.j1vt, &packet.j2pt, &packet.j2vt, &packet.j3pt, &packet.j3vt,
+								   &packet.j4pt, &packet.j4vt, &packet.j5pt, &packet.j5vt, &packet.j6pt, &packet.j6vt };
+	for(int ji=0; ji<6; ji++)
+	{
+		*targets[2*ji] = std::isnan(pt[ji]) ? FIX16_DISABLE : fix16_from_double(pt[ji]);
+		*targets[2*ji+1] = std::isnan(vt[ji]) ? FIX16_DISABLE : fix16_from_double(vt[ji]);
+	}
+	packet.nxtTransmitInterval = interval_ms;
+	packet.compressSamples = compress;
+	int64_t now = link_now_ns();
+	packet.pcStamp = link_stamp_ms(now);
+	uint8_t payload[PcBtPacket::BYTES];
+	packet.encode(payload);
+	h->sent_pc = interval_ms != 0;		// After a disconnect, there is nothing left to disconnect
+	h->recorder->command_sent(packet, now);
+	return send_payload(h, payload, sizeof(payload));
+}
+
+
+int nxt_link_list_signals(nxt_link* h)
+{
+	std::lock_guard<std::mutex> guard(h->lock);
+	std::vector<uint8_t> payload = h->recorder->subscribe_payload({}, 0);
+	return send_payload(h, payload.data(), payload.size());
+}
+
+
+int nxt_link_signal_count(nxt_link* h)
+{
+	std::lock_guard<std::mutex> guard(h->lock);
+	const TelemetryLayout& registry = h->recorder->registry();
+	return registry.complete() ? (int)registry.signals.size() : -1;
+}
+
+
+int nxt_link_signal(nxt_link* h, int index, char* name, int32_t* type)
+{
+	std::lock_guard<std::mutex> guard(h->lock);
+	const TelemetryLayout& registry = h->recorder->registry();
+	if(!registry.complete() || index < 0 || index >= (int)registry.signals.size())
+		return fail("No signal " + std::to_string(index));
+	const TelemetrySignal& signal = registry.signals[index];
+	std::strncpy(name, signal.name.c_str(), TELEMETRY_NAME_CHARS);
+	name[TELEMETRY_NAME_CHARS] = 0;
+	*type = signal.type;
+	return 0;
+}
+
+
+int nxt_link_subscribe(nxt_link* h, const char* names, int decimation)
+{
+	try
+	{
+		if(decimation < 1 || decimation > 255)
+			return fail("Decimation must be 1 to 255");
+		std::lock_guard<std::mutex> guard(h->lock);
+		std::vector<uint8_t> payload = h->recorder->subscribe_payload(split_names(names ? names : ""), (uint8_t)decimation);
+		return send_payload(h, payload.data(), payload.size());
+	}
+	catch(const std::exception& e)
+	{
+		return fail(e.what());
+	}
+}
+
+
+int nxt_link_param(nxt_link* h, int op, int joint, int param, double value, int version)
+{
+	ParamBtPacket packet;
+	packet.op = (uint8_t)op;
+	packet.joint = (uint8_t)joint;
+	packet.param = (uint8_t)param;
+	packet.value = fix16_from_double(value);
+	packet.version = (uint16_t)version;
+	uint8_t payload[ParamBtPacket::BYTES];
+	packet.encode(payload);
+	std::lock_guard<std::mutex> guard(h->lock);
+	return send_payload(h, payload, sizeof(payload));
+}
+
+
+int nxt_link_get_clock(nxt_link* h, nxt_link_clock* clock)
+{
+	std::lock_guard<std::mutex> guard(h->lock);
+	const ClockSync& sync = h->recorder->clock();
+	if(!sync.valid())
+		return fail("No clock probe echoed yet");
+	int64_t now = link_now_ns();
+	clock->host_ns = now;
+	clock->offset_ms = sync.offset_ns(now) / 1e6;
+	clock->drift_ppm = sync.estimate().drift * 1e6;
+	clock->delay_ms = sync.estimate().delay_ns / 1e6;
+	clock->exchanges = sync.exchanges();
+	return 0;
+}
+
+
+int nxt_link_to_host_ns(nxt_link* h, uint32_t systick, int64_t* host_ns)
+{
+	std::lock_guard<std::mutex> guard(h->lock);
+	if(!h->recorder->clock().valid())
+		return fail("No clock probe echoed yet");
+	*host_ns = h->recorder->clock().to_host_ns(systick);
+	return 0;
+}
+
+
+int64_t nxt_link_now_ns(void)
+{
+	return link_now_ns();
+}
+
+
+int nxt_link_get_param_reply(nxt_link* h, nxt_link_param_reply* reply, uint64_t* replies)
+{
+	std::lock_guard<std::mutex> guard(h->lock);
+	const ParamReplyBtPacket& r = h->recorder->param_reply();
+	reply->op = r.op;
+	reply->joint = r.joint;
+	reply->param = r.param;
+	reply->result = r.result;
+	reply->version = r.version;
+	reply->value = fix16_to_double(r.value);
+	*replies = h->recorder->stats().param_replies;
+	return 0;
+}
+
+}
@@ -0,0 +1,77 @@
+/*
+ * SpscRing.h
+ *
+ *	Lock-free ring between exactly one producer thread and one consumer thread. Each index is written by one
+ *	side only, as with the sample ring in Bluetooth.c: the producer publishes a slot by storing head with release
+ *	order after filling it, and the consumer frees it by storing tail after reading it. N must be a power of two.
+ *	Neither side ever blocks or allocates.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Daniel
+ */
+
+#ifndef SRC_LINK_SPSCRING_H_
+#define SRC_LINK_SPSCRING_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace ra15 {
+
+template<typename T, size_t N>
+class SpscRing
+{
+	static_assert(N >= 2 && (N & (N - 1)) == 0, "SpscRing size must be a power of two");
+
+public:
+	// Producer. Returns false, leaving the ring as it was, if it is full.
+	bool push(const T& item)
+	{
+		size_t head = head_.load(std::memory_order_relaxed);
+		if(head - tail_cache_ == N)
+		{
+			tail_cache_ = tail_.load(std::memory_order_acquire);
+			if(head - tail_cache_ == N)
+				return false;
+		}
+		slot_[head & (N - 1)] = item;
+		head_.store(head + 1, std::memory_order_release);
+		return true;
+	}
+
+	// Consumer. Returns false if the ring is empty.
+	bool pop(T& item)
+	{
+		size_t tail = tail_.load(std::memory_order_relaxed);
+		if(tail == head_cache_)
+		{
+			head_cache_ = head_.load(std::memory_order_acquire);
+			if(tail == head_cache_)
+				return false;
+		}
+		item = slot_[tail & (N - 1)];
+		tail_.store(tail + 1, std::memory_order_release);
+		return true;
+	}
+
+	// Items waiting. Exact from either side for its own end, a snapshot of the other.
+	size_t size() const
+	{
+		return head_.load(std::memory_order_acquire) - tail_.load(std::memory_order_acquire);
+	}
+
+	static constexpr size_t capacity() { return N; }
+
+private:
+	// Producer and consumer ends on separate cache lines, so neither side's stores slow the other's loads
+	alignas(64) std::atomic<size_t> head_{0};
+	size_t tail_cache_ = 0;						// Producer's last look at tail_
+	alignas(64) std::atomic<size_t> tail_{0};
+	size_t head_cache_ = 0;						// Consumer's last look at head_
+	alignas(64) T slot_[N];
+};
+
+}
+
+#endif /* SRC_LINK_SPSCRING_H_ */
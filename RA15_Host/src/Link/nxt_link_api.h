@@ -0,0 +1,106 @@
+/*
+ * nxt_link_api.h
+ *
+ *	C interface of libnxtlink.so, for MATLAB (loadlibrary, matlab/NXTLink.m) and Python (ctypes, python/ra15link.py).
+ *	A handle owns an NxtLink and a thread that passes everything it receives to a LinkRecorder, which writes the
+ *	logs (see LinkRecorder.h). The calls below are thread-safe, and none of them waits on Bluetooth.
+ *
+ *	Functions returning int return 0 on success and -1 on failure; nxt_link_error() then says why.
+ *	Angles and velocities are in deg and deg/s.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Daniel
+ */
+
+#ifndef SRC_LINK_NXT_LINK_API_H_
+#define SRC_LINK_NXT_LINK_API_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct nxt_link nxt_link;
+
+typedef struct nxt_link_stats
+{
+	int32_t connected;						/* 0 once the connection closed or failed */
+	int32_t layout;							/* Current subscription, -1 if none */
+	uint64_t rx_bytes, rx_packets, rx_resyncs, rx_overflows, tx_packets, tx_overflows;
+	uint64_t nxt1, samples, samples_lost, records, records_lost, param_replies;
+	uint64_t echoes;						/* Clock probes echoed */
+} nxt_link_stats;
+
+typedef struct nxt_link_joints
+{
+	uint32_t systick;						/* NXT1's time of the latest NXT1_BT, ms */
+	double p[6], v[6];
+	int32_t pwm[6];
+} nxt_link_joints;
+
+typedef struct nxt_link_param_reply
+{
+	int32_t op, joint, param, result, version;	/* enum param_op, 0-5, enum joint_param_id, enum param_result */
+	double value;
+} nxt_link_param_reply;
+
+typedef struct nxt_link_clock
+{
+	int64_t host_ns;						/* PC time (nxt_link_now_ns()) the offset is given at */
+	double offset_ms;						/* NXT1's systick minus the PC's clock */
+	double drift_ppm;						/* Positive: NXT1's clock runs fast */
+	double delay_ms;						/* Least round trip of the probes fitted, without NXT1's processing */
+	uint64_t exchanges;						/* Probes echoed */
+} nxt_link_clock;
+
+/* Connects to device (see NxtLink.h) and logs to log_dir, which must exist (NULL or "": no logs). NULL on failure. */
+nxt_link* nxt_link_open(const char* device, const char* log_dir);
+
+/* Sends the disconnect packet if targets were ever sent, closes the logs and the connection, and frees link. */
+void nxt_link_close(nxt_link* link);
+
+/* Why the last call on this thread failed, or why the connection closed */
+const char* nxt_link_error(void);
+
+int nxt_link_get_stats(nxt_link* link, nxt_link_stats* stats);
+
+/* Latest NXT1_BT. Fails if none arrived yet. */
+int nxt_link_get_joints(nxt_link* link, nxt_link_joints* joints);
+
+/* PC_BT: joint targets (DISABLE_PT/DISABLE_VT are NaN), NXT1_BT interval (ms, 0 disconnects) and sample compression */
+int nxt_link_send_targets(nxt_link* link, const double pt[6], const double vt[6], uint16_t interval_ms, uint8_t compress);
+
+/* Ends any subscription and asks NXT1 for its telemetry registry */
+int nxt_link_list_signals(nxt_link* link);
+
+/* Signals in the registry, or -1 if it has not fully arrived */
+int nxt_link_signal_count(nxt_link* link);
+
+/* Name and type (enum telemetry_type) of registry entry index. name holds TELEMETRY_NAME_CHARS+1 chars. */
+int nxt_link_signal(nxt_link* link, int index, char* name, int32_t* type);
+
+/* Subscribes to the comma separated signal names, every decimation TASK_MOTORREG cycles. Needs the registry. */
+int nxt_link_subscribe(nxt_link* link, const char* names, int decimation);
+
+/* PARAM_BT request. The answer arrives in nxt_link_get_param_reply(), and params.ra15log. */
+int nxt_link_param(nxt_link* link, int op, int joint, int param, double value, int version);
+
+/* Estimate of NXT1's clock (see ClockSync.h), from the CLOCK_BT probes sent every CLOCK_PROBE_INTERVAL_NS and the
+ * PC_BT packets. Fails until the first probe is echoed, about a second after connecting. */
+int nxt_link_get_clock(nxt_link* link, nxt_link_clock* clock);
+
+/* PC time of NXT1's systick, as nxt_host_ns in the logs. Fails until the first probe is echoed. */
+int nxt_link_to_host_ns(nxt_link* link, uint32_t systick, int64_t* host_ns);
+
+/* The PC's clock of host_ns in the logs and nxt_link_to_host_ns(): steady_clock (CLOCK_MONOTONIC on Linux), ns */
+int64_t nxt_link_now_ns(void);
+
+/* Latest PARAM_REPLY_BT, and how many have arrived in all (0: reply is unchanged) */
+int nxt_link_get_param_reply(nxt_link* link, nxt_link_param_reply* reply, uint64_t* replies);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SRC_LINK_NXT_LINK_API_H_ */
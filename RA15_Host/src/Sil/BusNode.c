@@ -0,0 +1,247 @@
+/*
+ * BusNode.c
+ *
+ *	One NXT on the simulated RS485 bus (Rs485Bus.h), run as its own process by bus_sim. Built once per NXT with
+ *	-DNXT=n, together with the firmware's RS485.c, Messages.c, Framing.c, Timing.c and Globals.c, unchanged.
+ *	The ecrobot RS485 driver is replaced by the shared bus, and the rest of the firmware by FirmwareStubs.c.
+ *
+ *	The node runs what the firmware runs for the bus: init_rs485() at power-up, then update_rs485() in a loop
+ *	like TASK_BACKGROUND's, which sleeps bus.loop_us plus a random 0..bus.jitter_us per iteration. Instead of
+ *	the motor regulator, ALARM_MOTORREG runs a stand-in for TASK_MOTORREG between two iterations, which starts
+ *	the cycle and stamps this NXT's joint states, as MotorRegulator.c does. systick runs off the PC's clock,
+ *	bus.drift_ppm fast, from 0 at power-up.
+ *
+ *	After each update_rs485() the node looks at the joint states of the other NXTs to see which frames were
+ *	accepted, and publishes the firmware counters with what it measured in bus_node.stats.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Daniel
+ */
+
+#include "Rs485Bus.h"
+#include "FirmwareStubs.h"
+#include "../../../RA15_Master/src/Comms/RS485.h"
+#include "../../../RA15_Master/src/Control/Timing.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#if NXT < 1 || NXT > BUS_NODES
+	#error "Compile a bus node with -DNXT=1, 2 or 3"
+#endif
+
+
+// PRIVATE VARIABLES
+
+static struct bus* bus;
+static struct bus_node* self;
+static int64_t boot_ns;					// Power-up, on the bus clock
+static uint32_t next_motorreg_ms;		// systick at which ALARM_MOTORREG next expires
+static int64_t cycle_start_ns;			// When the current TASK_MOTORREG cycle started
+static uint8_t heard;					// Bit per NXT number whose frame was accepted this cycle
+static uint32_t complete_run;			// Complete cycles in a row
+static int64_t complete_run_ns;			// Start of the first of them
+static uint32_t last_t[6];				// j[].t after the previous update
+static uint64_t jitter_rng = 0x2545F4914F6CDD1DULL * NXT;
+
+
+// ECROBOT AND KERNEL STUBS
+
+U32 systick_get_ms(void)
+{
+	int64_t t = bus_now_ns(bus) - boot_ns;
+	return (U32)((t + t / 1000000 * bus->drift_ppm[NXT-1]) / 1000000);		// ppm of a ms is a ns
+}
+
+
+void ecrobot_init_rs485(U32 baud_rate)
+{
+	bus_set_baud(bus, NXT, baud_rate);
+}
+
+
+void ecrobot_term_rs485(void)
+{
+	bus_set_baud(bus, NXT, 0);
+}
+
+
+U32 ecrobot_send_rs485(U8* buf, U32 off, U32 len)
+{
+	bus_send(bus, NXT, buf + off, len);
+	return len;
+}
+
+
+U32 ecrobot_read_rs485(U8* buf, U32 off, U32 len)
+{
+	return bus_read(bus, NXT, buf + off, len);
+}
+
+
+StatusType SetRelAlarm(AlarmType alarm, TickType increment, TickType cycle)
+{
+	(void)cycle;						// Always MOTORREG_PERIOD_MS
+	if(alarm == ALARM_MOTORREG)
+		next_motorreg_ms = systick_get_ms() + increment;
+	return E_OK;
+}
+
+
+StatusType CancelAlarm(AlarmType alarm)
+{
+	(void)alarm;
+	return E_OK;
+}
+
+
+// PRIVATE FUNCTIONS
+
+static void end_cycle(int64_t now_ns)		// Counts the cycle that just ended
+{
+	struct bus_node_stats* s = &self->stats;
+	uint8_t others = 0x0E & ~(1 << NXT);
+	s->cycles++;
+	if((heard & others) != others)
+		complete_run = 0;
+	else
+	{
+		s->complete_cycles++;
+		if(complete_run++ == 0)
+			complete_run_ns = cycle_start_ns;
+		if(complete_run >= BUS_COMPLETE_RUN && s->settled_ns == 0 && complete_run_ns >= bus->settle_from_ns)
+			s->settled_ns = complete_run_ns;
+	}
+	heard = 0;
+	cycle_start_ns = now_ns;
+}
+
+
+static void task_motorreg(void)			// What TASK_MOTORREG does for the bus
+{
+	uint32_t now = systick_get_ms();
+	uint32_t sampled_at = global_time_ms();
+	task_motorreg_start_ms = now;
+	for(int i=0; i<NUM_CONTROLLERS; i++)
+		j[joint_list[i]].t = sampled_at;
+
+	int64_t now_ns = bus_now_ns(bus);
+	self->sample_ns = now_ns;
+	end_cycle(now_ns);
+}
+
+
+static void check_frames(void)			// Frames the last update_rs485() accepted, seen from the joint states they stamped
+{
+	int64_t now_ns = bus_now_ns(bus);
+	uint8_t seen = 0;
+	for(int ji=0; ji<6; ji++)
+	{
+		uint8_t from = joint_nxt[ji];
+		if(from == NXT || j[ji].t == last_t[ji])
+			continue;
+		last_t[ji] = j[ji].t;
+		if(j[ji].t == JOINT_STATE_UPDATING || ((seen >> from) & 0x01))
+			continue;
+		seen |= (1 << from);
+
+		struct bus_link* l = &self->stats.link[from-1];
+		int64_t sample_ns = self->rx_sample_ns[from-1];
+		if(sample_ns == 0)				// Sent before the sender's first TASK_MOTORREG
+			continue;
+		int64_t latency_ns = now_ns - sample_ns;
+		l->frames++;
+		l->latency_sum_ns += latency_ns;
+		if(latency_ns > l->latency_max_ns)
+			l->latency_max_ns = latency_ns;
+	}
+	heard |= seen;
+}
+
+
+static void publish(void)
+{
+	struct bus_node_stats* s = &self->stats;
+	s->update_cycles = rs485_update_cycles;
+	s->crc_errors = rs485_crc_errors;
+	s->frame_errors = rs485_frame_errors;
+	s->lost_frames = rs485_lost_frames;
+	s->slot_overruns = rs485_slot_overruns;
+	s->slot_late_max_ms = rs485_slot_late_max_ms;
+	s->sync_shifts = rs485_sync_shifts;
+	s->baud_index = rs485_baud_index;
+	s->baud_fallbacks = rs485_baud_fallbacks;
+	s->baud_state = (uint8_t)get_rs485_baud_state();
+	s->state = (uint8_t)get_rs485_state();
+	s->msg_resends = msg_resends;
+	s->waypoints_forwarded = stub_stream_forwarded;
+	s->waypoints_received = stub_waypoints;
+	s->waypoints_missed = stub_stream_missed;
+	s->waypoints_repeated = stub_stream_repeated;
+	#if NXT == 1
+		if(s->baud_running_ns == 0 && s->baud_state == RS485_BAUD_RUNNING)
+			s->baud_running_ns = bus_now_ns(bus);
+	#endif
+}
+
+
+static void background_delay(void)		// The rest of a TASK_BACKGROUND iteration, and preemption by the other tasks
+{
+	jitter_rng ^= jitter_rng << 13;
+	jitter_rng ^= jitter_rng >> 7;
+	jitter_rng ^= jitter_rng << 17;
+	uint32_t us = bus->loop_us + (bus->jitter_us > 0 ? (uint32_t)(jitter_rng % (bus->jitter_us + 1)) : 0);
+	struct timespec ts = { us / 1000000, (long)(us % 1000000) * 1000 };
+	while(nanosleep(&ts, &ts) != 0 && errno == EINTR);
+}
+
+
+// MAIN
+
+int main(int argc, char** argv)
+{
+	if(argc != 2)
+	{
+		fprintf(stderr, "Usage: %s SHM_NAME\nStarted by bus_sim.\n", argv[0]);
+		return 2;
+	}
+	bus = bus_attach(argv[1]);
+	if(bus == NULL)
+	{
+		fprintf(stderr, "bus_node%d: cannot attach to %s: %s\n", NXT, argv[1], strerror(errno));
+		return 1;
+	}
+	self = &bus->node[NXT-1];
+
+	while(!bus->stop && bus_now_ns(bus) < bus->start_ns[NXT-1])		// Powered up later than the others
+		usleep(1000);
+	boot_ns = bus_now_ns(bus);
+	cycle_start_ns = boot_ns;
+	self->pid = getpid();
+
+	stub_stream = 1;					// NXT1 forwards a waypoint in every frame
+	init_rs485();						// Device startup hook
+	next_motorreg_ms = 1;				// ALARMTIME in MotorRegulator.oil
+	while(!bus->stop)
+	{
+		if((int32_t)(systick_get_ms() - next_motorreg_ms) >= 0)
+		{
+			next_motorreg_ms += MOTORREG_PERIOD_MS;
+			if((int32_t)(systick_get_ms() - next_motorreg_ms) >= 0)		// Missed whole periods: OSEK drops the extra activations
+				next_motorreg_ms = systick_get_ms() + MOTORREG_PERIOD_MS;
+			task_motorreg();
+		}
+		update_rs485();
+		check_frames();
+		publish();
+		background_delay();
+	}
+
+	term_rs485();
+	publish();
+	bus_detach(bus);
+	return 0;
+}
@@ -0,0 +1,161 @@
+/*
+ * ClearanceSil.c
+ *
+ *	Software-in-the-loop check of NXT1's clearance limit, run by make clearance. Built with -DNXT=1 together with
+ *	the firmware's Targeting.c, Trajectory.c, Collision.c, Kinematics.c, Timing.c and Globals.c, unchanged, and
+ *	libfixmath/libfixmatrix.
+ *
+ *	A stand-in for TASK_MOTORREG plays J2's spline (J2 and J6 are NXT1's own joints) or follows its pt/vt at the
+ *	speed vmax allows, and measures its velocity from the change in position, one tick late like the encoder
+ *	estimate. NXT2/3's joints hold the pose they report. update_targets() runs once between two ticks.
+ *	Within the joint limits only the wrist can reach the rest of the arm, not the table, so the pose folds J3
+ *	and J5 and the knots lower J2 until the wrist would touch the upper arm.
+ *
+ *	Each step prints PASS or FAIL, and the exit status is the number that failed.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Daniel
+ */
+
+#include "../../../RA15_Master/src/Control/Targeting.h"
+#include "../../../RA15_Master/src/Control/Trajectory.h"
+
+#include <stdio.h>
+
+
+#define J2	1					// Joint index of the joint under test
+
+static const fix16_t PERIOD_S = F16(MOTORREG_PERIOD_MS/1000.0f);
+
+
+// PRIVATE VARIABLES
+
+static U32 rttc_rtvr, rttc_rtmr;	// Real-time timer registers, for Timing.c
+static uint32_t now_ms = 0;
+static int32_t lowest_mm;			// Lowest clearance the arm reached in the current step
+static int failures = 0;
+
+
+// ECROBOT AND FIRMWARE STUBS
+
+volatile U32* AT91C_RTTC_RTVR = &rttc_rtvr;
+volatile U32* AT91C_RTTC_RTMR = &rttc_rtmr;
+
+U32 systick_get_ms(void)
+{
+	return now_ms;
+}
+
+
+void update_homing_sequence(void)
+{
+}
+
+
+// PRIVATE FUNCTIONS
+
+static void task_motorreg(void)		// What TASK_MOTORREG does for NXT1's joints, with perfect tracking
+{
+	for(int ci=0; ci<NUM_CONTROLLERS; ci++)
+	{
+		uint8_t ji = joint_list[ci];
+		fix16_t jp = j[ji].p, jv, ja;
+
+		if(!get_spline_reference(ji, now_ms, &jp, &jv, &ja))
+		{
+			fix16_t step = fix16_mul(jpmtr[ji].vmax, PERIOD_S);
+			if(j[ji].vt != DISABLE_VT)
+				step = fix16_min(fix16_mul(fix16_abs(j[ji].vt), PERIOD_S), step);
+
+			if(j[ji].pt == DISABLE_PT)
+				jp = (j[ji].vt < 0) ? fix16_sub(j[ji].p, step) : fix16_add(j[ji].p, step);
+			else
+				jp = fix16_clamp(fix16_clamp(j[ji].pt, jpmtr[ji].pmin, jpmtr[ji].pmax), fix16_sub(j[ji].p, step), fix16_add(j[ji].p, step));
+		}
+
+		j[ji].v = fix16_div(fix16_sub(jp, j[ji].p), PERIOD_S);
+		j[ji].p = jp;
+		j[ji].t = now_ms;
+	}
+}
+
+
+static void run(uint32_t ms)
+{
+	for(uint32_t end_ms = now_ms + ms; now_ms != end_ms; now_ms += MOTORREG_PERIOD_MS)
+	{
+		task_motorreg();
+		update_targets();
+
+		fix16_t q[6];
+		for(int ji=0; ji<6; ji++)
+			q[ji] = j[ji].p;
+		lowest_mm = min_int(lowest_mm, min_clearance_mm(q));
+	}
+}
+
+
+static void lower_j2(const float* p, int knots)		// Queues J2 knots 250ms apart, as the PC would
+{
+	for(int k=0; k<knots; k++)
+	{
+		struct waypoint w = { .dt_ms = 250, .joint_mask = (0x01 << J2) };
+		w.p[J2] = fix16_from_float(p[k]);
+		add_waypoint(CTRL_BT, &w);
+	}
+}
+
+
+static void report(const char* step, BOOL pass)
+{
+	printf("%-58s J2 %6.1f deg, lowest clearance %4d mm, clamps %u  %s\n", step, fix16_to_dbl(j[J2].p), lowest_mm,
+		   collision_clamps, pass ? "PASS" : "FAIL");
+	if(!pass)
+		failures++;
+	lowest_mm = INT32_MAX;
+}
+
+
+// MAIN
+
+int main(void)
+{
+	init_joint_states();				// pt = prest, vt = 0, as after power-up
+	j[2].p = F16(-52.0f);				// J3 and J5 folded, as NXT3 and NXT2 report them
+	j[4].p = F16(55.0f);
+	lowest_mm = INT32_MAX;
+	printf("MIN_CLEARANCE_MM %d, J2 vmax %.0f deg/s, %d ms ticks\n", MIN_CLEARANCE_MM, fix16_to_dbl(jpmtr[J2].vmax), MOTORREG_PERIOD_MS);
+
+	// A trajectory into the upper arm is stopped, although pt/vt say stand still
+	static const float down[] = { 80.0f, 65.0f, 50.0f, 38.0f };
+	lower_j2(down, 4);
+	run(2000);
+	report("Knots into the arm: trajectory stopped", collision_clamps == 1 && !(get_trajectory_joints() & (0x01 << J2))
+		   && lowest_mm >= 0);
+	fix16_t stopped_at = j[J2].p;
+
+	// Targets further down arrive after the stop (a PC_BT packet over the clamp)
+	set_targets(CTRL_BT, J2, F16(38.0f), DISABLE_VT);
+	run(1000);
+	report("Position target further in: held", j[J2].p >= stopped_at && lowest_mm >= 0);
+	set_targets(CTRL_BT, J2, DISABLE_PT, F16(-20.0f));
+	run(1000);
+	report("Velocity target further in: held", j[J2].p >= stopped_at && lowest_mm >= 0);
+
+	// Knots queued after the stop start a new trajectory, which is stopped again
+	static const float again[] = { 38.0f };
+	lower_j2(again, 1);
+	run(1000);
+	report("Knots into the arm after the stop: stopped again", !(get_trajectory_joints() & (0x01 << J2)) && lowest_mm >= 0);
+
+	// Backing out is allowed, and releases the clamp
+	set_targets(CTRL_BT, J2, F16(90.0f), DISABLE_VT);
+	run(2000);
+	report("Position target back out: followed", j[J2].p == F16(90.0f));
+
+	lower_j2(down, 4);
+	run(2000);
+	report("Knots into the arm once released: stopped", collision_clamps == 2 && lowest_mm >= 0);
+
+	return failures;
+}
@@ -0,0 +1,116 @@
+/*
+ * FirmwareStubs.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Daniel
+ */
+
+#include "FirmwareStubs.h"
+#include "../../../RA15_Master/src/Comms/RS485.h"
+
+
+// PUBLIC VARIABLES
+
+uint32_t stub_waypoints = 0;
+int stub_stream = 0;
+uint32_t stub_stream_forwarded = 0;
+uint32_t stub_stream_missed = 0;
+uint32_t stub_stream_repeated = 0;
+
+
+// PRIVATE VARIABLES
+
+static U32 rttc_rtvr, rttc_rtmr;	// Real-time timer registers, for Timing.c
+static uint16_t stream_last = 0;	// NXT2/3: number of the latest stream waypoint received, 0 before the first
+#if NXT == 1
+	static uint16_t stream_next = 1;	// Number of the one at the head of the forward queue
+#endif
+
+
+// ECROBOT STUBS
+
+volatile U32* AT91C_RTTC_RTVR = &rttc_rtvr;
+volatile U32* AT91C_RTTC_RTMR = &rttc_rtmr;
+
+void display_goto_xy(int x, int y)				{ (void)x; (void)y; }
+void display_string(const char* str)			{ (void)str; }
+void display_unsigned(U32 val, U32 places)		{ (void)val; (void)places; }
+
+
+// FIRMWARE STUBS
+
+BOOL set_targets(enum control_source source, uint8_t ji, fix16_t jpt, fix16_t jvt)
+{
+	(void)source; (void)ji; (void)jpt; (void)jvt;
+	return TRUE;
+}
+
+
+BOOL add_waypoint(enum control_source source, const struct waypoint* w)
+{
+	(void)source;
+	stub_waypoints++;
+	if(w->dt_ms == stream_last)
+		stub_stream_repeated++;
+	else if(stream_last != 0)
+		stub_stream_missed += (uint16_t)(w->dt_ms - stream_last - 1);
+	stream_last = w->dt_ms;
+	return TRUE;
+}
+
+
+#if NXT == 1
+BOOL peek_forward_waypoint(struct waypoint* w)
+{
+	if(!stub_stream)
+		return FALSE;
+	memset(w, 0, sizeof(*w));
+	w->dt_ms = stream_next;
+	w->joint_mask = 0x1D;			// J1, J3, J4, J5
+	return TRUE;
+}
+
+
+void release_forward_waypoint(void)
+{
+	stub_stream_forwarded++;
+	stream_next = (stream_next == UINT16_MAX) ? 1 : stream_next + 1;
+}
+#endif
+
+
+BOOL begin_homing_sequence(uint8_t joint_index)
+{
+	(void)joint_index;
+	return FALSE;
+}
+
+
+void end_homing_sequence(void)
+{
+}
+
+
+uint8_t get_homing_joint_mask(void)
+{
+	return 0;
+}
+
+
+enum param_result set_parameter(uint8_t ji, uint8_t id, fix16_t value)
+{
+	(void)ji; (void)id; (void)value;
+	return PARAM_OK;
+}
+
+
+enum param_result schedule_parameters(uint16_t version, uint32_t at_ms)
+{
+	(void)version; (void)at_ms;
+	return PARAM_OK;
+}
+
+
+void beep(void)
+{
+}
@@ -0,0 +1,35 @@
+/*
+ * FirmwareStubs.h
+ *
+ *	Public interface for FirmwareStubs.c.
+ *	Stand-ins for the parts of the firmware outside the bus that RS485.c and Messages.c call: targeting, the
+ *	trajectory buffer, homing, sound and the display. Shared by the software-in-the-loop builds (Rs485Sil.h and
+ *	BusSim.h). They accept everything and record only what the tools report.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Daniel
+ */
+
+#ifndef SRC_SIL_FIRMWARESTUBS_H_
+#define SRC_SIL_FIRMWARESTUBS_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern uint32_t stub_waypoints;		// add_waypoint() calls
+
+// Waypoint stream, for bus_sim: while stub_stream is set, NXT1's forward queue never runs dry. Its waypoints are
+// numbered in dt_ms, so that NXT2/3 can tell which ones never arrived or arrived twice.
+extern int stub_stream;
+extern uint32_t stub_stream_forwarded;	// NXT1: stream waypoints released from the forward queue
+extern uint32_t stub_stream_missed;		// NXT2/3: stream waypoints skipped, after the first one received
+extern uint32_t stub_stream_repeated;	// NXT2/3: stream waypoints received again
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SRC_SIL_FIRMWARESTUBS_H_ */
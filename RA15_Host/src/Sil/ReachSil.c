@@ -0,0 +1,141 @@
+/*
+ * ReachSil.c
+ *
+ *	Software-in-the-loop check of the reachability table, run by make reach. Built with -DNXT=1 together with the
+ *	firmware's Reachability.c, ReachabilityTable.c, Kinematics.c and Globals.c, unchanged, and libfixmath/libfixmatrix.
+ *	RA15 does not link the table yet (see Reachability.h), so this keeps it compiling and checks it against the
+ *	firmware's own forward kinematics until something takes Cartesian targets.
+ *
+ *	Random J1-J3 within pmin/pmax (J4-J6 at prest) give wrist centers that must be reachable, with an IK seed
+ *	whose wrist center lies within a voxel diagonal of the target. Points beyond the arm's reach must not be.
+ *	The tool flange and approach vector of each pose must give back its wrist center.
+ *
+ *	Prints the results, and the exit status is the number of checks that failed.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Daniel
+ */
+
+#include "../../../RA15_Master/src/Control/Reachability.h"
+#include "../../../RA15_Master/src/Control/Kinematics.h"
+
+#include <stdio.h>
+
+
+#define SAMPLES		20000
+
+static const int32_t SEED_ERROR_MAX_MM = REACH_VOXEL_MM*173/100;		// Voxel diagonal
+static const int32_t TOOL_ERROR_MAX_MM = 1;
+
+
+// PRIVATE VARIABLES
+
+static U32 rttc_rtvr, rttc_rtmr;	// Real-time timer registers, declared by ecrobot_interface.h
+static uint32_t rng = 1;
+static int failures = 0;
+
+
+// ECROBOT STUBS
+
+volatile U32* AT91C_RTTC_RTVR = &rttc_rtvr;
+volatile U32* AT91C_RTTC_RTMR = &rttc_rtmr;
+
+
+// PRIVATE FUNCTIONS
+
+static fix16_t random_between(fix16_t lo, fix16_t hi)
+{
+	rng = rng*1103515245 + 12345;
+	return lo + (fix16_t)(((int64_t)(hi - lo) * (rng >> 8)) >> 24);
+}
+
+
+static int32_t distance_mm(struct point3d a, struct point3d b)
+{
+	int64_t dx = fix16_to_int(a.x - b.x), dy = fix16_to_int(a.y - b.y), dz = fix16_to_int(a.z - b.z);
+	int64_t d2 = dx*dx + dy*dy + dz*dz, d = 0;
+	while((d+1)*(d+1) <= d2)
+		d++;
+	return (int32_t)d;
+}
+
+
+static void report(const char* check, uint32_t failed, uint32_t total, const char* detail)
+{
+	printf("%-44s %5u of %5u failed %s  %s\n", check, failed, total, detail, failed == 0 ? "PASS" : "FAIL");
+	if(failed != 0)
+		failures++;
+}
+
+
+// MAIN
+
+int main(void)
+{
+	printf("%dx%dx%d voxels of %d mm, %u bytes\n", REACH_NX, REACH_NY, REACH_NZ, REACH_VOXEL_MM, (unsigned)sizeof(reach_seed));
+
+	uint32_t unreachable = 0, bad_seeds = 0, bad_tools = 0;
+	int32_t seed_error_max = 0, tool_error_max = 0;
+	for(int i=0; i<SAMPLES; i++)
+	{
+		fix16_t q[6];
+		for(int ji=0; ji<6; ji++)
+			q[ji] = (ji < REACH_SEED_JOINTS) ? random_between(jpmtr[ji].pmin, jpmtr[ji].pmax) : jpmtr[ji].prest;
+		struct point3d o[7];
+		forward_kinematics(q, o);
+		struct point3d wc = o[4];		// O4 == O5
+
+		fix16_t seed[6];
+		if(!get_ik_seed(wc.x, wc.y, wc.z, seed) || !is_wrist_center_reachable(wc.x, wc.y, wc.z))
+		{
+			unreachable++;
+			continue;
+		}
+		for(int ji=REACH_SEED_JOINTS; ji<6; ji++)
+			seed[ji] = jpmtr[ji].prest;
+		struct point3d o_seed[7];
+		forward_kinematics(seed, o_seed);
+		int32_t seed_error = distance_mm(o_seed[4], wc);
+		seed_error_max = max_int(seed_error_max, seed_error);
+		if(seed_error > SEED_ERROR_MAX_MM)
+			bad_seeds++;
+
+		fix16_t p[3] = { o[6].x, o[6].y, o[6].z };
+		fix16_t approach[3] = { fix16_div(o[6].x - o[4].x, jpmtr[5].d), fix16_div(o[6].y - o[4].y, jpmtr[5].d),
+								fix16_div(o[6].z - o[4].z, jpmtr[5].d) };
+		fix16_t w[3];
+		wrist_center_from_tool(p, approach, w);
+		struct point3d from_tool = { w[0], w[1], w[2] };
+		int32_t tool_error = distance_mm(from_tool, wc);
+		tool_error_max = max_int(tool_error_max, tool_error);
+		if(tool_error > TOOL_ERROR_MAX_MM)
+			bad_tools++;
+	}
+
+	char detail[64];
+	report("Wrist centers of random poses: reachable", unreachable, SAMPLES, "");
+	snprintf(detail, sizeof(detail), "(max %d mm, limit %d)", seed_error_max, SEED_ERROR_MAX_MM);
+	report("IK seeds near the target", bad_seeds, SAMPLES - unreachable, detail);
+	snprintf(detail, sizeof(detail), "(max %d mm)", tool_error_max);
+	report("Wrist center from tool flange", bad_tools, SAMPLES - unreachable, detail);
+
+	// Beyond the arm's reach: further from the shoulder (O1) than the upper arm and forearm together, by more than a
+	// voxel, which counts as reachable if any part of it is. Half of them below the table.
+	uint32_t reachable = 0, outside = 0;
+	struct point3d shoulder = { 0, 0, jpmtr[0].d };
+	int32_t reach_mm = fix16_to_int(jpmtr[1].r + jpmtr[2].r + jpmtr[3].d) + SEED_ERROR_MAX_MM;
+	for(int i=0; i<SAMPLES; i++)
+	{
+		struct point3d pt = { random_between(-fix16_from_int(1000), fix16_from_int(1000)),
+							  random_between(-fix16_from_int(1000), fix16_from_int(1000)),
+							  (i % 2) ? random_between(-fix16_from_int(500), 0) : random_between(0, fix16_from_int(1000)) };
+		if((i % 2) == 0 && distance_mm(pt, shoulder) <= reach_mm)
+			continue;
+		outside++;
+		if(is_wrist_center_reachable(pt.x, pt.y, pt.z))
+			reachable++;
+	}
+	report("Points out of reach: unreachable", reachable, outside, "");
+
+	return failures;
+}
@@ -0,0 +1,286 @@
+/*
+ * Rs485Bus.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Daniel
+ */
+
+#include "Rs485Bus.h"
+
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <unistd.h>
+
+
+#define USART_CLOCK		(48000000 / 16)		// The USART runs at USART_CLOCK/n baud, n rounded from the rate asked for
+#define BITS_PER_BYTE	10					// Start, 8 data, stop
+#define COLLISION_LOOKBACK	16				// Earlier transmissions checked for overlap with a new one
+
+
+// PRIVATE FUNCTIONS
+
+static int64_t monotonic_ns(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+
+static uint64_t next_random(struct bus_node* n)		// xorshift64
+{
+	uint64_t x = n->rng;
+	x ^= x << 13;
+	x ^= x >> 7;
+	x ^= x << 17;
+	n->rng = x;
+	return x;
+}
+
+
+static double random_unit(struct bus_node* n)		// Uniform in [0, 1)
+{
+	return (double)(next_random(n) >> 11) / 9007199254740992.0;
+}
+
+
+static void receive_byte(struct bus* b, struct bus_node* n, const struct bus_tx* t, uint32_t k, int64_t end_ns)
+{
+	struct bus_node_stats* s = &n->stats;
+	uint8_t v = t->data[k];
+	if(n->baud == 0)								// Driver off
+	{
+		n->rx_intact = 0;
+		return;
+	}
+	if(end_ns >= b->outage_start_ns && end_ns < b->outage_end_ns)
+	{
+		s->outage_losses++;
+		n->rx_intact = 0;
+		return;
+	}
+
+	if(t->collided[k] || t->baud != n->baud)
+	{
+		v = (uint8_t)next_random(n);
+		s->bytes_garbled++;
+		n->rx_intact = 0;
+	}
+	else if(b->ber > 0)
+	{
+		uint8_t flipped = v;
+		for(int bit=0; bit<BITS_PER_BYTE; bit++)
+		{
+			if(random_unit(n) >= b->ber)
+				continue;
+			if(bit == 0 || bit == BITS_PER_BYTE-1)	// Start or stop bit
+			{
+				s->framing_losses++;
+				n->rx_intact = 0;
+				return;
+			}
+			flipped ^= (uint8_t)(1 << (bit-1));
+		}
+		if(flipped != v)
+		{
+			v = flipped;
+			s->bytes_corrupted++;
+			n->rx_intact = 0;
+		}
+	}
+
+	if(n->rx_head - n->rx_tail >= BUS_HW_BUFFER)
+	{
+		s->overrun_losses++;
+		n->rx_intact = 0;
+		return;
+	}
+	n->rx_buf[(n->rx_head++) % BUS_HW_BUFFER] = v;
+	s->bytes_received++;
+}
+
+
+static void deliver(struct bus* b, uint8_t nxt, int64_t now_ns)	// Receives every byte that has finished arriving by now_ns
+{
+	struct bus_node* n = &b->node[nxt-1];
+	if(b->tx_count - n->rx_next > BUS_TX_RING)		// Not read for so long that the ring moved on
+	{
+		n->rx_next = b->tx_count - BUS_TX_RING;
+		n->rx_byte = 0;
+	}
+
+	while(n->rx_next < b->tx_count)
+	{
+		const struct bus_tx* t = &b->tx[n->rx_next % BUS_TX_RING];
+		if(t->sender != nxt)
+		{
+			if(n->rx_byte == 0)
+				n->rx_intact = 1;
+			for(; n->rx_byte < t->len; n->rx_byte++)
+			{
+				int64_t end_ns = t->start_ns + (int64_t)(n->rx_byte + 1) * t->byte_ns;
+				if(end_ns > now_ns)
+					return;
+				receive_byte(b, n, t, n->rx_byte, end_ns);
+			}
+			if(n->rx_intact)
+				n->rx_sample_ns[t->sender-1] = t->sample_ns;
+		}
+		n->rx_next++;
+		n->rx_byte = 0;
+	}
+}
+
+
+static uint32_t mark_overlap(struct bus_tx* t, int64_t from_ns, int64_t to_ns)	// Marks the bytes of t that overlap [from_ns, to_ns). Returns how many were not marked before.
+{
+	uint32_t marked = 0;
+	for(uint32_t k=0; k<t->len; k++)
+	{
+		int64_t start = t->start_ns + (int64_t)k * t->byte_ns;
+		if(start < to_ns && start + t->byte_ns > from_ns && !t->collided[k])
+		{
+			t->collided[k] = 1;
+			marked++;
+		}
+	}
+	return marked;
+}
+
+
+// PUBLIC FUNCTIONS
+
+struct bus* bus_create(const char* name)
+{
+	int fd = shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0600);
+	if(fd < 0)
+		return NULL;
+	if(ftruncate(fd, sizeof(struct bus)) != 0)
+	{
+		close(fd);
+		shm_unlink(name);
+		return NULL;
+	}
+	struct bus* b = (struct bus*)mmap(NULL, sizeof(struct bus), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	if(b == MAP_FAILED)
+	{
+		shm_unlink(name);
+		return NULL;
+	}
+
+	memset(b, 0, sizeof(*b));
+	pthread_mutexattr_t attr;
+	pthread_mutexattr_init(&attr);
+	pthread_mutexattr_setpshared(&attr, PTHREAD_PROCESS_SHARED);
+	pthread_mutex_init(&b->lock, &attr);
+	pthread_mutexattr_destroy(&attr);
+	for(int k=0; k<BUS_NODES; k++)
+		b->node[k].rng = 0x9E3779B97F4A7C15ULL * (uint64_t)(k + 1);
+	b->epoch_ns = monotonic_ns();
+	return b;
+}
+
+
+struct bus* bus_attach(const char* name)
+{
+	int fd = shm_open(name, O_RDWR, 0600);
+	if(fd < 0)
+		return NULL;
+	struct bus* b = (struct bus*)mmap(NULL, sizeof(struct bus), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	return (b == MAP_FAILED) ? NULL : b;
+}
+
+
+void bus_detach(struct bus* b)
+{
+	munmap(b, sizeof(struct bus));
+}
+
+
+void bus_unlink(const char* name)
+{
+	shm_unlink(name);
+}
+
+
+int64_t bus_now_ns(const struct bus* b)
+{
+	return monotonic_ns() - b->epoch_ns;
+}
+
+
+uint32_t bus_usart_baud(uint32_t baud)
+{
+	uint32_t n = (USART_CLOCK + baud/2) / baud;
+	return USART_CLOCK / (n < 1 ? 1 : n);
+}
+
+
+void bus_set_baud(struct bus* b, uint8_t nxt, uint32_t baud)
+{
+	struct bus_node* n = &b->node[nxt-1];
+	pthread_mutex_lock(&b->lock);
+	deliver(b, nxt, bus_now_ns(b));					// What arrived so far, at the old rate
+	n->baud = baud;
+	n->rx_tail = n->rx_head;
+	pthread_mutex_unlock(&b->lock);
+}
+
+
+void bus_send(struct bus* b, uint8_t nxt, const uint8_t* buf, uint32_t len)
+{
+	struct bus_node* n = &b->node[nxt-1];
+	if(len > BUS_TX_MAX)
+		len = BUS_TX_MAX;
+	pthread_mutex_lock(&b->lock);
+	if(n->baud == 0 || len == 0)
+	{
+		pthread_mutex_unlock(&b->lock);
+		return;
+	}
+
+	int64_t now_ns = bus_now_ns(b);
+	struct bus_tx* t = &b->tx[b->tx_count % BUS_TX_RING];
+	t->sender = nxt;
+	t->baud = n->baud;
+	t->start_ns = (n->tx_free_ns > now_ns) ? n->tx_free_ns : now_ns;
+	t->byte_ns = (int64_t)BITS_PER_BYTE * 1000000000 / bus_usart_baud(n->baud);
+	t->sample_ns = n->sample_ns;
+	t->len = len;
+	memcpy(t->data, buf, len);
+	memset(t->collided, 0, sizeof(t->collided));
+	int64_t end_ns = t->start_ns + (int64_t)len * t->byte_ns;
+
+	// Every other NXT's transmission still on the bus garbles the bytes it overlaps, both ways
+	for(uint64_t i=1; i<=COLLISION_LOOKBACK && i<=b->tx_count && i<BUS_TX_RING; i++)
+	{
+		struct bus_tx* o = &b->tx[(b->tx_count - i) % BUS_TX_RING];
+		int64_t o_end_ns = o->start_ns + (int64_t)o->len * o->byte_ns;
+		if(o->sender == nxt || o_end_ns <= t->start_ns || o->start_ns >= end_ns)
+			continue;
+		b->node[o->sender-1].stats.collided_bytes += mark_overlap(o, t->start_ns, end_ns);
+		n->stats.collided_bytes += mark_overlap(t, o->start_ns, o_end_ns);
+	}
+
+	b->tx_count++;
+	n->tx_free_ns = end_ns;
+	n->stats.bytes_sent += len;
+	pthread_mutex_unlock(&b->lock);
+}
+
+
+uint32_t bus_read(struct bus* b, uint8_t nxt, uint8_t* buf, uint32_t len)
+{
+	struct bus_node* n = &b->node[nxt-1];
+	uint32_t count = 0;
+	pthread_mutex_lock(&b->lock);
+	deliver(b, nxt, bus_now_ns(b));
+	while(count < len && n->rx_tail != n->rx_head)
+		buf[count++] = n->rx_buf[(n->rx_tail++) % BUS_HW_BUFFER];
+	pthread_mutex_unlock(&b->lock);
+	return count;
+}
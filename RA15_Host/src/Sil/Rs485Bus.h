@@ -0,0 +1,150 @@
+/*
+ * Rs485Bus.h
+ *
+ *	Public interface for Rs485Bus.c.
+ *	Simulated RS485 bus shared by the three bus_node processes (BusNode.c) and bus_sim (Tools/BusSim.cpp),
+ *	in POSIX shared memory under one process-shared mutex. Times are true times in ns since bus_create().
+ *
+ *	The bus is half duplex and shared. What one NXT sends goes on the bus after the end of its own previous
+ *	transmission, at 10 bit times per byte (8N1) at the rate the USART actually clocks, and every other NXT
+ *	receives each byte at the end of its stop bit. An NXT does not receive its own bytes. Each NXT's receive
+ *	buffer holds BUS_HW_BUFFER bytes, as the nxtOSEK driver's does: bytes that arrive while it is full are lost.
+ *	Delivery is worked out when the receiver reads, in the order the bytes arrived, so it does not depend on
+ *	when the processes happen to run.
+ *	 - Bytes that overlap another NXT's transmission on the bus are garbage to every receiver.
+ *	 - A receiver at another rate than the sender receives garbage, one byte per byte sent.
+ *	 - Each bit is flipped with probability ber. A flipped data bit corrupts the byte, a flipped start or stop
+ *	   bit loses it (a framing error in the USART).
+ *	 - During an outage every byte is lost.
+ *
+ *	Compiled as C. Usable from C++.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Daniel
+ */
+
+#ifndef SRC_SIL_RS485BUS_H_
+#define SRC_SIL_RS485BUS_H_
+
+#include <pthread.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define BUS_NODES			3			// NXT1..3, at index NXT - 1
+#define BUS_HW_BUFFER		64			// Receive buffer of each NXT
+#define BUS_TX_MAX			64			// Longest transmission. An RS485 frame is at most 64 bytes on the wire (PacketSchema.h).
+#define BUS_TX_RING			256			// Transmissions kept for receivers that have not read them yet
+#define BUS_COMPLETE_RUN	10			// Complete cycles in a row after which a node counts as settled (RS485_SETTLE_CYCLES)
+
+struct bus_tx {
+	uint8_t sender;						// NXT number
+	uint32_t baud;						// Rate it was sent at, as passed to ecrobot_init_rs485()
+	int64_t start_ns;					// Start bit of the first byte
+	int64_t byte_ns;					// Time per byte on the bus
+	int64_t sample_ns;					// When the sender's TASK_MOTORREG last sampled its joints
+	uint32_t len;
+	uint8_t data[BUS_TX_MAX];
+	uint8_t collided[BUS_TX_MAX];		// Another NXT sent during the byte
+};
+
+struct bus_link {						// Frames from one NXT to another, accepted by the receiver's RS485.c
+	uint32_t frames;
+	int64_t latency_sum_ns;				// From the sender's TASK_MOTORREG sample to the receiver's decode
+	int64_t latency_max_ns;
+};
+
+struct bus_node_stats {
+	// Firmware counters (RS485.h, Messages.h)
+	uint32_t update_cycles;
+	uint32_t crc_errors;
+	uint32_t frame_errors;
+	uint32_t lost_frames;
+	uint32_t slot_overruns;
+	uint32_t slot_late_max_ms;
+	uint32_t sync_shifts;
+	uint8_t baud_index;
+	uint32_t baud_fallbacks;
+	uint8_t baud_state;					// enum rs485_baud_state
+	uint8_t state;						// enum rs485_state
+	uint32_t msg_resends;
+	// Waypoint stream (FirmwareStubs.h)
+	uint32_t waypoints_forwarded;		// NXT1: acknowledged by NXT2 and NXT3, or given up on a silent one
+	uint32_t waypoints_received;		// NXT2/3
+	uint32_t waypoints_missed;
+	uint32_t waypoints_repeated;
+	// Counted by the bus
+	uint32_t bytes_sent;
+	uint32_t collided_bytes;			// Bytes sent that overlapped another NXT's
+	uint32_t bytes_received;			// Bytes put in the receive buffer, good or not
+	uint32_t bytes_corrupted;			// ... of which a bit flip changed
+	uint32_t bytes_garbled;				// ... of which were garbage: a collision, or another rate
+	uint32_t framing_losses;			// Bytes lost to a flipped start or stop bit
+	uint32_t outage_losses;				// Bytes lost to an outage
+	uint32_t overrun_losses;			// Bytes lost to a full receive buffer
+	// Counted by the node, per TASK_MOTORREG period
+	uint32_t cycles;
+	uint32_t complete_cycles;			// Cycles in which a frame from each other NXT was accepted
+	int64_t settled_ns;					// Start of the first run of BUS_COMPLETE_RUN complete cycles that began at or after bus.settle_from_ns. 0 until then.
+	int64_t baud_running_ns;			// NXT1: first time the rate negotiation was RS485_BAUD_RUNNING. 0 until then.
+	struct bus_link link[BUS_NODES];	// Indexed by sender NXT - 1
+};
+
+struct bus_node {
+	// Driver state, under the lock
+	uint32_t baud;						// 0 while the driver is off
+	int64_t tx_free_ns;					// End of this NXT's latest transmission
+	int64_t sample_ns;					// Latest TASK_MOTORREG sample, stamped on transmissions
+	uint64_t rx_next;					// Next transmission to deliver, counted like bus.tx_count
+	uint32_t rx_byte;					// Next byte of it
+	uint8_t rx_intact;					// Every byte of it so far arrived unchanged
+	int64_t rx_sample_ns[BUS_NODES];	// sample_ns of the latest intact transmission from each NXT
+	uint8_t rx_buf[BUS_HW_BUFFER];
+	uint32_t rx_head, rx_tail;			// Free running
+	uint64_t rng;						// xorshift64 state
+	// Set by bus_node only
+	volatile int32_t pid;				// 0 until the node is running
+	struct bus_node_stats stats;
+};
+
+struct bus {
+	pthread_mutex_t lock;
+	int64_t epoch_ns;					// CLOCK_MONOTONIC at bus_create()
+	// Set by bus_sim before the nodes start
+	double ber;							// Bit error rate
+	int64_t outage_start_ns;			// Every byte ending in [outage_start_ns, outage_end_ns) is lost
+	int64_t outage_end_ns;
+	int64_t settle_from_ns;				// bus_node_stats.settled_ns only counts runs from here
+	int64_t start_ns[BUS_NODES];		// When each node powers up
+	int32_t drift_ppm[BUS_NODES];		// Crystal error of each node's systick
+	uint32_t loop_us;					// TASK_BACKGROUND iteration, and the random extra 0..jitter_us on top
+	uint32_t jitter_us;
+	volatile int32_t stop;
+	// Bus contents, under the lock
+	uint64_t tx_count;					// Transmissions so far. tx[n % BUS_TX_RING] is the nth.
+	struct bus_tx tx[BUS_TX_RING];
+	struct bus_node node[BUS_NODES];
+};
+
+// Creates and maps the shared bus under name (starting with '/'), zeroed. NULL on failure, with errno set.
+struct bus* bus_create(const char* name);
+// Maps an existing bus. NULL on failure, with errno set.
+struct bus* bus_attach(const char* name);
+void bus_detach(struct bus* b);
+void bus_unlink(const char* name);
+
+int64_t bus_now_ns(const struct bus* b);
+uint32_t bus_usart_baud(uint32_t baud);		// Rate the USART clocks for a rate asked for
+
+// Calls from the driver of NXT number nxt
+void bus_set_baud(struct bus* b, uint8_t nxt, uint32_t baud);		// 0 turns the driver off. Empties the receive buffer.
+void bus_send(struct bus* b, uint8_t nxt, const uint8_t* buf, uint32_t len);
+uint32_t bus_read(struct bus* b, uint8_t nxt, uint8_t* buf, uint32_t len);	// Returns the bytes read, 0 if none have arrived
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SRC_SIL_RS485BUS_H_ */
@@ -0,0 +1,118 @@
+/*
+ * Rs485Sil.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Daniel
+ */
+
+#include "Rs485Sil.h"
+#include "FirmwareStubs.h"
+#include "../../../RA15_Master/src/Comms/RS485.h"
+
+#if NXT != 1
+	#error "The SIL build replays NXT1. Compile it with -DNXT=1."
+#endif
+
+
+// PRIVATE VARIABLES
+
+static uint32_t now_ms;
+static uint8_t rx_buf[SIL_RX_BYTES];
+static uint32_t rx_head, rx_tail;			// Free running
+static BOOL rs485_initialized = FALSE;
+static struct sil_counters seen;
+
+
+// ECROBOT AND KERNEL STUBS
+
+U32 systick_get_ms(void)
+{
+	return now_ms;
+}
+
+
+void ecrobot_init_rs485(U32 baud_rate)
+{
+	(void)baud_rate;
+	if(rs485_initialized)
+		seen.baud_switches++;
+	rs485_initialized = TRUE;
+}
+
+
+void ecrobot_term_rs485(void)
+{
+}
+
+
+U32 ecrobot_send_rs485(U8* buf, U32 off, U32 len)
+{
+	(void)buf; (void)off;
+	seen.frames_sent++;
+	seen.bytes_sent += len;
+	seen.last_sent_ms = now_ms;
+	return len;
+}
+
+
+U32 ecrobot_read_rs485(U8* buf, U32 off, U32 len)
+{
+	U32 n = 0;
+	while(n < len && rx_tail != rx_head)
+		buf[off + n++] = rx_buf[(rx_tail++) % SIL_RX_BYTES];
+	return n;
+}
+
+
+// PUBLIC FUNCTIONS
+
+void sil_set_time(uint32_t ms)
+{
+	if((int32_t)(ms - now_ms) > 0)
+		now_ms = ms;
+}
+
+
+void sil_start_cycle(uint32_t ms)
+{
+	task_motorreg_start_ms = ms;
+}
+
+
+void sil_receive(const uint8_t* buf, uint32_t len)
+{
+	for(uint32_t i=0; i<len; i++)
+	{
+		if(rx_head - rx_tail >= SIL_RX_BYTES)
+			seen.rx_dropped++;
+		else
+			rx_buf[(rx_head++) % SIL_RX_BYTES] = buf[i];
+	}
+}
+
+
+void sil_update(void)
+{
+	if(!rs485_initialized)
+		init_rs485();
+	update_rs485();
+}
+
+
+void sil_get_counters(struct sil_counters* c)
+{
+	*c = seen;
+	c->update_cycles = rs485_update_cycles;
+	c->crc_errors = rs485_crc_errors;
+	c->frame_errors = rs485_frame_errors;
+	c->lost_frames = rs485_lost_frames;
+	c->slot_overruns = rs485_slot_overruns;
+	c->slot_late_max_ms = rs485_slot_late_max_ms;
+	c->baud_index = rs485_baud_index;
+	c->baud_ceiling = rs485_baud_ceiling;
+	c->baud_fallbacks = rs485_baud_fallbacks;
+	c->baud_state = (uint8_t)get_rs485_baud_state();
+	c->msg_resends = msg_resends;
+	c->msg_no_replies = msg_no_replies;
+	c->waypoints = stub_waypoints;
+}
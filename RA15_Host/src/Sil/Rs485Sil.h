@@ -0,0 +1,60 @@
+/*
+ * Rs485Sil.h
+ *
+ *	Public interface for Rs485Sil.c.
+ *	Software-in-the-loop build of NXT1's RS485 driver: RA15_Master/src/Comms/RS485.c and Messages.c, compiled
+ *	for the PC unchanged, with the kernel, the ecrobot RS485 driver and the rest of the firmware replaced by
+ *	stubs. Time only moves when the caller sets it, so a bus capture can be fed through update_rs485() as fast
+ *	as the PC runs, and the same capture always gives the same result.
+ *
+ *	Compiled as C with the firmware. Usable from C++.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Daniel
+ */
+
+#ifndef SRC_SIL_RS485SIL_H_
+#define SRC_SIL_RS485SIL_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SIL_RX_BYTES	4096		// Receive buffer. Bytes that do not fit are dropped, as the USART would.
+
+struct sil_counters {
+	// Firmware counters (RS485.h, Messages.h)
+	uint32_t update_cycles;
+	uint32_t crc_errors;
+	uint32_t frame_errors;
+	uint32_t lost_frames;
+	uint32_t slot_overruns;
+	uint32_t slot_late_max_ms;
+	uint8_t baud_index;
+	uint8_t baud_ceiling;
+	uint32_t baud_fallbacks;
+	uint8_t baud_state;				// enum rs485_baud_state
+	uint32_t msg_resends;
+	uint32_t msg_no_replies;
+	// Seen by the stubs
+	uint32_t frames_sent;			// ecrobot_send_rs485() calls
+	uint32_t bytes_sent;
+	uint32_t last_sent_ms;
+	uint32_t baud_switches;			// ecrobot_init_rs485() calls after the first
+	uint32_t rx_dropped;			// Bytes that did not fit in the receive buffer
+	uint32_t waypoints;				// add_waypoint() calls
+};
+
+void sil_set_time(uint32_t ms);						// systick_get_ms() from now on. Never goes backwards.
+void sil_start_cycle(uint32_t ms);					// TASK_MOTORREG started at ms: sets task_motorreg_start_ms
+void sil_receive(const uint8_t* buf, uint32_t len);	// Bytes arriving on the bus, read by the next update
+void sil_update(void);								// One pass of TASK_BACKGROUND's update_rs485()
+void sil_get_counters(struct sil_counters* c);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SRC_SIL_RS485SIL_H_ */
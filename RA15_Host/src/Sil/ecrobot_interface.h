@@ -0,0 +1,64 @@
+/*
+ * ecrobot_interface.h
+ *
+ *	The parts of the nxtOSEK ecrobot API that the firmware headers name, for the software-in-the-loop build.
+ *	Rs485Sil.c or BusNode.c, and FirmwareStubs.c, implement the ones RS485.c and Timing.c call, and
+ *	ClearanceSil.c the ones Timing.c calls. The rest are only declared.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Daniel
+ */
+
+#ifndef SRC_SIL_ECROBOT_INTERFACE_H_
+#define SRC_SIL_ECROBOT_INTERFACE_H_
+
+#include "kernel.h"
+
+#define NXT_PORT_A		0
+#define NXT_PORT_B		1
+#define NXT_PORT_C		2
+#define NXT_PORT_S1		0
+#define NXT_PORT_S2		1
+#define NXT_PORT_S3		2
+#define NXT_PORT_S4		3
+
+#define DEFAULT_BAUD_RATE_RS485	921600
+#define LOWSPEED		1
+
+enum { BT_NO_INIT, BT_INITIALIZED, BT_CONNECTED, BT_STREAM };
+
+extern volatile U32* AT91C_RTTC_RTVR;
+extern volatile U32* AT91C_RTTC_RTMR;
+#define AT91C_SYSC_RTPRES	0xFFFF
+#define AT91C_SYSC_RTTRST	(1 << 18)
+
+// Implemented by Rs485Sil.c or BusNode.c, and FirmwareStubs.c (display)
+U32 systick_get_ms(void);
+void ecrobot_init_rs485(U32 baud_rate);
+void ecrobot_term_rs485(void);
+U32 ecrobot_send_rs485(U8* buf, U32 off, U32 len);
+U32 ecrobot_read_rs485(U8* buf, U32 off, U32 len);
+void display_goto_xy(int x, int y);
+void display_string(const char* str);
+void display_unsigned(U32 val, U32 places);
+
+// Declared only
+void systick_wait_ms(U32 ms);
+void ecrobot_init_bt_slave(const char* pin);
+void ecrobot_term_bt_connection(void);
+U8 ecrobot_get_bt_status(void);
+U32 ecrobot_send_bt_packet(U8* buf, U32 len);
+U32 ecrobot_read_bt_packet(U8* buf, U32 len);
+U32 ecrobot_read_bt(void* buf, U32 off, U32 len);
+void display_clear(U32 update);
+void display_int(int val, U32 places);
+void display_hex(U32 val, U32 places);
+void display_update(void);
+void nxt_motor_set_count(U32 port, int count);
+int nxt_motor_get_count(U32 port);
+void nxt_motor_set_speed(U32 port, int speed, int brake);
+U8 ecrobot_is_ENTER_button_pressed(void);
+U8 ecrobot_get_touch_sensor(U8 port);
+void ecrobot_sound_tone(U32 freq, U32 ms, U32 volume);
+
+#endif /* SRC_SIL_ECROBOT_INTERFACE_H_ */
@@ -0,0 +1,53 @@
+/*
+ * kernel.h
+ *
+ *	The parts of the TOPPERS/OSEK kernel API that the firmware headers name, for the software-in-the-loop
+ *	builds of RS485.c. Only declarations: BusNode.c implements the alarm calls RS485.c makes on NXT2/3, and
+ *	neither build runs a task.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Daniel
+ */
+
+#ifndef SRC_SIL_KERNEL_H_
+#define SRC_SIL_KERNEL_H_
+
+#include <stdint.h>
+
+typedef uint8_t		U8;
+typedef int8_t		S8;
+typedef uint16_t	U16;
+typedef int16_t		S16;
+typedef uint32_t	U32;
+typedef int32_t		S32;
+typedef int			BOOL;
+
+#define TRUE	1
+#define FALSE	0
+
+typedef int StatusType;
+typedef int TaskType;
+typedef int AlarmType;
+typedef int ResourceType;
+typedef int CounterType;
+typedef U32 TickType;
+
+#define E_OK	0
+
+#define DeclareTask(name)		extern int name##_id
+#define DeclareResource(name)	extern int name##_id
+#define DeclareAlarm(name)		extern int name##_id
+#define DeclareCounter(name)	extern int name##_id
+#define DeclareEvent(name)		extern int name##_id
+#define TASK(name)				void name##_task(void)
+
+StatusType ActivateTask(TaskType task);
+StatusType TerminateTask(void);
+StatusType GetResource(ResourceType res);
+StatusType ReleaseResource(ResourceType res);
+StatusType SignalCounter(CounterType counter);
+StatusType SetRelAlarm(AlarmType alarm, TickType increment, TickType cycle);
+StatusType CancelAlarm(AlarmType alarm);
+StatusType GetAlarm(AlarmType alarm, TickType* tick);
+
+#endif /* SRC_SIL_KERNEL_H_ */
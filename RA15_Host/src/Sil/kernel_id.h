@@ -0,0 +1,28 @@
+/*
+ * kernel_id.h
+ *
+ *	Object ids that the OSEK configurator generates from RA15.oil, for the software-in-the-loop build.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Daniel
+ */
+
+#ifndef SRC_SIL_KERNEL_ID_H_
+#define SRC_SIL_KERNEL_ID_H_
+
+#define TASK_MOTORREG		1
+#define TASK_LCD			2
+#define TASK_SENSORS		3
+#define TASK_BACKGROUND		4
+
+#define RES_MOTORS			1
+#define RES_LCD				2
+#define RES_SENSORS			3
+
+#define ALARM_MOTORREG		1
+#define ALARM_LCD			2
+#define ALARM_SENSORS		3
+
+#define SysTimerCnt			1
+
+#endif /* SRC_SIL_KERNEL_ID_H_ */
@@ -0,0 +1,246 @@
+/*
+ * BtLatency.cpp
+ *
+ *	bt_latency: measures the PC -> NXT1 -> PC round trip over Bluetooth. Sends CLOCK_BT probes stamped with the PC's
+ *	time (pcStamp), and times the NXT1_BT that echoes the stamp back with NXT1's systick at receiving the probe
+ *	(echoRxMs) and at sending the echo (txMs). Four timestamps per probe:
+ *		t1 PC sends the probe (link_now_ns() when queued)		t2 NXT1 decodes it (echoRxMs)
+ *		t4 PC receives the echo (LinkPacket.host_ns)			t3 NXT1 sends the echo (txMs)
+ *	The round trip is t4 - t1, and NXT1's processing t3 - t2: the wait for the next NXT1_BT slot, so pass a short
+ *	--interval. Uplink and downlink need the offset of the two clocks, which LinkRecorder's ClockSync estimates from
+ *	the same probes; with its estimate at the end of the run, uplink = t2 - t1 and downlink = t4 - t3 on the PC's clock.
+ *
+ *	NXT1 stamps in whole ms, so uplink and downlink are each up to 1ms off, and the processing time up to 1ms.
+ *	The queueing in the PC's own I/O thread and Bluetooth stack is part of the link.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Daniel
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../Link/LinkRecorder.h"
+#include "../Link/NxtLink.h"
+
+using namespace ra15;
+
+static const int32_t FIX16_DISABLE = 0x7FFFFFFF;		// DISABLE_VT (fix16_maximum)
+static const int64_t NS_PER_S = 1000000000LL;
+static const double NS_PER_MS = 1e6;
+static const int HISTOGRAM_BINS = 20;
+static const int HISTOGRAM_WIDTH = 50;
+
+struct Options
+{
+	std::string device;
+	std::string log_dir;			// Empty: no logs
+	double secs = 30;
+	double rate = 10;				// Probes per second
+	int interval = 0;				// nxtTransmitInterval asked for, ms. 0: leave NXT1's and send no targets.
+};
+
+static volatile std::sig_atomic_t interrupted = 0;
+
+static void on_interrupt(int)
+{
+	interrupted = 1;
+}
+
+static void usage(const char* prog)
+{
+	std::printf("Usage: %s --device D [options]\n"
+				"  --device D            /dev/rfcommN, a pty, or NXT1's address XX:XX:XX:XX:XX:XX[@channel]\n"
+				"  --secs S              Length of the run (default 30)\n"
+				"  --rate R              Probes per second (default 10)\n"
+				"  --interval MS         NXT1_BT interval to ask for, which bounds NXT1's processing time. Sends joint\n"
+				"                        targets that hold each joint where it is. Default: NXT1's, and no targets.\n"
+				"  --log DIR             Also write the column logs of nxt_link to DIR, which must exist\n", prog);
+}
+
+static Options parse_args(int argc, char** argv)
+{
+	Options opt;
+	for(int i=1; i<argc; i++)
+	{
+		std::string arg = argv[i];
+		if(arg == "-h" || arg == "--help")	{ usage(argv[0]); std::exit(0); }
+		if(i+1 >= argc)						throw std::runtime_error("Missing value for " + arg);
+		if(arg == "--device")				opt.device = argv[++i];
+		else if(arg == "--log")				opt.log_dir = argv[++i];
+		else if(arg == "--secs")			opt.secs = std::atof(argv[++i]);
+		else if(arg == "--rate")			opt.rate = std::atof(argv[++i]);
+		else if(arg == "--interval")		opt.interval = std::atoi(argv[++i]);
+		else								throw std::runtime_error("Unknown option " + arg);
+	}
+	if(opt.device.empty())
+		throw std::runtime_error("--device is required");
+	if(opt.secs <= 0)
+		throw std::runtime_error("--secs must be positive");
+	if(opt.rate <= 0 || opt.rate > 200)		// Stamps are in ms, and must differ
+		throw std::runtime_error("--rate must be more than 0 and at most 200");
+	if(opt.interval < 0 || opt.interval > 65535)
+		throw std::runtime_error("--interval must be 0 to 65535");
+	return opt;
+}
+
+// PC_BT that holds every joint at the position NXT1 last reported
+static PcBtPacket hold_packet(const Nxt1BtPacket& n, uint16_t interval)
+{
+	PcBtPacket pc;
+	pc.j1pt = n.j1p;	pc.j2pt = n.j2p;	pc.j3pt = n.j3p;	pc.j4pt = n.j4p;	pc.j5pt = n.j5p;	pc.j6pt = n.j6p;
+	pc.j1vt = pc.j2vt = pc.j3vt = pc.j4vt = pc.j5vt = pc.j6vt = FIX16_DISABLE;
+	pc.nxtTransmitInterval = interval;
+	pc.compressSamples = 0;
+	return pc;
+}
+
+static bool send_payload(NxtLink& link, const uint8_t* payload, size_t bytes)
+{
+	if(link.send(payload, bytes))
+		return true;
+	std::fprintf(stderr, "bt_latency: could not queue a packet for NXT1\n");
+	return false;
+}
+
+static bool send_packet(NxtLink& link, LinkRecorder& recorder, PcBtPacket& pc)
+{
+	uint8_t payload[PcBtPacket::BYTES];
+	int64_t now = link_now_ns();
+	pc.pcStamp = link_stamp_ms(now);
+	pc.encode(payload);
+	recorder.command_sent(pc, now);
+	return send_payload(link, payload, sizeof(payload));
+}
+
+static double percentile(std::vector<double> v, double p)
+{
+	std::sort(v.begin(), v.end());
+	return v[(size_t)(p * (v.size()-1))];
+}
+
+static void print_histogram(const char* name, const std::vector<double>& v)
+{
+	double lo = *std::min_element(v.begin(), v.end()), hi = *std::max_element(v.begin(), v.end());
+	std::printf("\n%s (ms): n %zu  min %.1f  p50 %.1f  p90 %.1f  p99 %.1f  max %.1f\n", name, v.size(), lo,
+				percentile(v, 0.5), percentile(v, 0.9), percentile(v, 0.99), hi);
+
+	double width = std::max((hi - lo) / HISTOGRAM_BINS, 0.5);
+	int bins = std::min(HISTOGRAM_BINS, (int)((hi - lo) / width) + 1);
+	std::vector<size_t> count(bins, 0);
+	for(double x : v)
+		count[std::min(bins-1, (int)((x - lo) / width))]++;
+	size_t most = *std::max_element(count.begin(), count.end());
+	for(int b=0; b<bins; b++)
+		std::printf("  %7.1f .. %7.1f  %6zu  %s\n", lo + b*width, lo + (b+1)*width, count[b],
+					std::string((count[b] * HISTOGRAM_WIDTH + most - 1) / most, '#').c_str());
+}
+
+
+int main(int argc, char** argv)
+{
+	try
+	{
+		Options opt = parse_args(argc, argv);
+		std::signal(SIGINT, on_interrupt);
+		std::signal(SIGTERM, on_interrupt);
+
+		LinkRecorder recorder(opt.log_dir);
+		NxtLink link(opt.device);
+		std::printf("Connected to %s. Probing at %.1f/s for %.0f s", opt.device.c_str(), opt.rate, opt.secs);
+		if(opt.interval > 0)
+			std::printf(", NXT1_BT every %d ms", opt.interval);
+		std::printf(".\n");
+
+		std::vector<LinkRecorder::Echo> echoes;
+		bool sent_pc = false;
+		uint64_t probes = 0;
+		uint32_t last_stamp = 0;
+		PcBtPacket pc;
+		int64_t start = link_now_ns(), next_probe = start, period = (int64_t)(NS_PER_S / opt.rate);
+		LinkPacket packet;
+
+		while(!interrupted && link.running() && link_now_ns() - start < (int64_t)(opt.secs * NS_PER_S))
+		{
+			link.wait(1);
+			while(link.receive(packet))
+			{
+				uint64_t echoed = recorder.stats().echoes;
+				recorder.handle(packet);
+				if(recorder.stats().echoes != echoed)
+					echoes.push_back(recorder.last_echo());
+			}
+
+			if(!recorder.have_nxt1())
+				continue;
+			if(opt.interval > 0 && !sent_pc)
+			{
+				pc = hold_packet(recorder.nxt1(), (uint16_t)opt.interval);		// Held where the first NXT1_BT found them
+				sent_pc = send_packet(link, recorder, pc);
+				probes += sent_pc;								// Its pcStamp is echoed too
+			}
+			int64_t now = link_now_ns();
+			if(now >= next_probe)
+			{
+				if(link_stamp_ms(now) != last_stamp)
+				{
+					std::vector<uint8_t> probe = recorder.clock_probe(now);
+					if(send_payload(link, probe.data(), probe.size()))
+					{
+						last_stamp = link_stamp_ms(now);
+						probes++;
+					}
+				}
+				next_probe = std::max(next_probe + period, now);
+			}
+		}
+
+		std::string why = link.error();
+		if(sent_pc && link.running())		// As NXTConnection.bluetoothDisconnect()
+		{
+			pc.nxtTransmitInterval = 0;
+			send_packet(link, recorder, pc);
+		}
+		link.close();
+		recorder.close();
+		if(!why.empty())
+			std::printf("Link closed: %s\n", why.c_str());
+
+		std::printf("Sent %llu probes, %zu echoed, %llu lost or not echoed before the end\n", (unsigned long long)probes,
+					echoes.size(), (unsigned long long)(probes - std::min<uint64_t>(probes, echoes.size())));
+		if(echoes.empty())
+			return 1;
+
+		const ClockSync& clock = recorder.clock();
+		std::vector<double> rtt, uplink, downlink, processing, link_time;
+		for(const LinkRecorder::Echo& e : echoes)
+		{
+			double round_trip = (e.host_ns - e.sent_ns) / NS_PER_MS, held = (double)(int32_t)(e.tx_ms - e.rx_ms);
+			rtt.push_back(round_trip);
+			processing.push_back(held);
+			link_time.push_back(round_trip - held);
+			uplink.push_back((clock.to_host_ns(e.rx_ms) - e.sent_ns) / NS_PER_MS);
+			downlink.push_back((e.host_ns - clock.to_host_ns(e.tx_ms)) / NS_PER_MS);
+		}
+		std::printf("Clock drift of NXT1 to the PC: %.1f ppm, from %zu windows of %d probes\n", clock.estimate().drift * 1e6,
+					std::max<size_t>(clock.estimate().windows, 1), CLOCK_SYNC_WINDOW);
+
+		print_histogram("Round trip", rtt);
+		print_histogram("Uplink, PC -> NXT1", uplink);
+		print_histogram("NXT1 processing, until the next NXT1_BT", processing);
+		print_histogram("Downlink, NXT1 -> PC", downlink);
+		print_histogram("Link (round trip - processing)", link_time);
+	}
+	catch(const std::exception& e)
+	{
+		std::fprintf(stderr, "bt_latency: %s\n", e.what());
+		return 1;
+	}
+	return 0;
+}
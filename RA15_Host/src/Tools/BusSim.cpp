@@ -0,0 +1,325 @@
+/*
+ * BusSim.cpp
+ *
+ *	Runs all three NXTs' RS485 stacks against each other on the PC. Each NXT is the firmware's own RS485.c,
+ *	Messages.c, Framing.c and Timing.c, built with -DNXT=n into bus_node1..3 (src/Sil/BusNode.c), and runs as its
+ *	own process, concurrently, in real time. They share a simulated bus (src/Sil/Rs485Bus.h): half duplex, byte
+ *	timing at the rate the USART clocks, the 64 byte receive buffer, collisions, and bit errors at --ber.
+ *
+ *	Where RingSim.cpp models the schedule, this runs the code: the slot timing, the beacon sync, the rate
+ *	negotiation and its fallbacks, the clock sync and the message channel all play out as on the arm. Use it
+ *	to check a change to the bus code before it goes on three NXTs.
+ *
+ *	Prints a line per second (rates in use, complete cycles, errors), then per NXT the firmware's counters and
+ *	what the bus did to its bytes, the state age on each link (from the sender's TASK_MOTORREG sample to the
+ *	receiver's decode), and how long the bus took to settle after power-up, or to recover from --outage.
+ *
+ *	The motor regulator is not run, only a stand-in for TASK_MOTORREG that starts each cycle, so the bus code
+ *	is never preempted halfway through an update_rs485(): --jitter-us delays the next one instead. The NXTs
+ *	run at the PC's scheduling, so two runs with the same options differ a little.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Daniel
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+extern "C" {
+#include "../../../RA15_Master/src/Comms/PacketSchema.h"
+}
+#include "../Sil/Rs485Bus.h"
+
+static const uint32_t BAUD_RATES[RS485_NUM_BAUDS] = RS485_BAUD_RATES;
+static const char* const BAUD_STATE_NAME[] = { "SETTLING", "ANNOUNCING", "PROBING", "REPORTING", "RUNNING" };
+static const double CYCLES_PER_S = 50;		// 1000 / MOTORREG_PERIOD_MS
+
+struct Options
+{
+	double secs = 20;
+	double ber = 0;
+	double outage_at_s = -1;		// No outage
+	double outage_ms = 0;
+	int drift_ppm = 50;
+	uint32_t loop_us = 100;
+	uint32_t jitter_us = 200;
+	uint32_t stagger_ms = 537;			// Not a multiple of MOTORREG_PERIOD_MS, so NXT2/3 start out of phase
+	uint64_t seed = 1;
+};
+
+static void usage(const char* prog)
+{
+	std::printf("Usage: %s [options]\n"
+				"  --secs S         Length of the run (default 20)\n"
+				"  --ber B          Bit error rate on every link (default 0)\n"
+				"  --outage T,MS    Cut the bus T seconds into the run for MS ms\n"
+				"  --drift-ppm D    NXT2's systick runs D ppm fast, NXT3's D ppm slow (default 50)\n"
+				"  --loop-us L      TASK_BACKGROUND iteration time (default 100)\n"
+				"  --jitter-us J    Extra random 0..J us per iteration from preemption (default 200)\n"
+				"  --stagger-ms M   NXT2 powers up M ms after NXT1, NXT3 2*M ms after (default 537)\n"
+				"  --seed S         Seed of the bit errors (default 1)\n"
+				"bus_node1..3 must be in the same directory as this program.\n", prog);
+}
+
+static Options parse_args(int argc, char** argv)
+{
+	Options opt;
+	for(int i=1; i<argc; i++)
+	{
+		std::string arg = argv[i];
+		if(arg == "-h" || arg == "--help")	{ usage(argv[0]); std::exit(0); }
+		if(i+1 >= argc)						throw std::runtime_error("Missing value for " + arg);
+		if(arg == "--secs")				opt.secs = std::atof(argv[++i]);
+		else if(arg == "--ber")			opt.ber = std::atof(argv[++i]);
+		else if(arg == "--outage")
+		{
+			if(std::sscanf(argv[++i], "%lf,%lf", &opt.outage_at_s, &opt.outage_ms) != 2)
+				throw std::runtime_error("--outage takes T,MS");
+		}
+		else if(arg == "--drift-ppm")	opt.drift_ppm = std::atoi(argv[++i]);
+		else if(arg == "--loop-us")		opt.loop_us = (uint32_t)std::atoi(argv[++i]);
+		else if(arg == "--jitter-us")	opt.jitter_us = (uint32_t)std::atoi(argv[++i]);
+		else if(arg == "--stagger-ms")	opt.stagger_ms = (uint32_t)std::atoi(argv[++i]);
+		else if(arg == "--seed")		opt.seed = std::strtoull(argv[++i], nullptr, 10);
+		else							throw std::runtime_error("Unknown option " + arg);
+	}
+	if(opt.secs <= 0)
+		throw std::runtime_error("--secs must be positive");
+	if(opt.ber < 0 || opt.ber >= 1)
+		throw std::runtime_error("--ber must be in [0, 1)");
+	if(opt.outage_at_s >= 0 && (opt.outage_ms <= 0 || opt.outage_at_s * 1000 + opt.outage_ms >= opt.secs * 1000))
+		throw std::runtime_error("--outage must be positive and end before the run does");
+	if(opt.seed == 0)
+		throw std::runtime_error("--seed must not be 0");
+	return opt;
+}
+
+static int64_t ns_from_s(double s)	{ return (int64_t)(s * 1e9); }
+static double ms_from_ns(int64_t ns)	{ return ns / 1e6; }
+
+static uint32_t bus_errors(const bus_node_stats& s)
+{
+	return s.crc_errors + s.frame_errors + s.lost_frames;
+}
+
+// Removes the shared bus and stops the nodes however the run ends
+class BusRun
+{
+public:
+	BusRun(const std::string& name) : name_(name)
+	{
+		bus_ = bus_create(name.c_str());
+		if(bus_ == nullptr)
+			throw std::runtime_error("Cannot create shared memory " + name);
+	}
+	~BusRun()
+	{
+		bus_->stop = 1;
+		for(pid_t pid : pids_)
+			waitpid(pid, nullptr, 0);
+		bus_detach(bus_);
+		bus_unlink(name_.c_str());
+	}
+	bus* get() { return bus_; }
+	void start_node(const std::string& path)
+	{
+		pid_t pid = fork();
+		if(pid < 0)
+			throw std::runtime_error("fork failed");
+		if(pid == 0)
+		{
+			execl(path.c_str(), path.c_str(), name_.c_str(), (char*)nullptr);
+			std::fprintf(stderr, "bus_sim: cannot run %s\n", path.c_str());
+			_exit(127);
+		}
+		pids_.push_back(pid);
+	}
+	bool wait_nodes()		// True if every node exited cleanly
+	{
+		bus_->stop = 1;
+		bool ok = true;
+		for(pid_t pid : pids_)
+		{
+			int status = 0;
+			waitpid(pid, &status, 0);
+			ok = ok && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+		}
+		pids_.clear();
+		return ok;
+	}
+	bool node_died()
+	{
+		for(pid_t pid : pids_)
+		{
+			int status;
+			if(waitpid(pid, &status, WNOHANG) == pid)
+				return true;
+		}
+		return false;
+	}
+
+private:
+	std::string name_;
+	bus* bus_;
+	std::vector<pid_t> pids_;
+};
+
+
+int main(int argc, char** argv)
+{
+	try
+	{
+		Options opt = parse_args(argc, argv);
+		std::string dir = argv[0];
+		dir = (dir.find('/') == std::string::npos) ? "." : dir.substr(0, dir.rfind('/'));
+
+		BusRun run("/ra15_bus_" + std::to_string(getpid()));
+		bus* b = run.get();
+		b->ber = opt.ber;
+		if(opt.outage_at_s >= 0)
+		{
+			b->outage_start_ns = ns_from_s(opt.outage_at_s);
+			b->outage_end_ns = b->outage_start_ns + ns_from_s(opt.outage_ms / 1000);
+			b->settle_from_ns = b->outage_end_ns;
+		}
+		for(int k=0; k<BUS_NODES; k++)
+		{
+			b->start_ns[k] = ns_from_s(k * opt.stagger_ms / 1000.0);
+			b->node[k].rng ^= opt.seed * 0xBF58476D1CE4E5B9ULL;
+		}
+		b->drift_ppm[1] = opt.drift_ppm;
+		b->drift_ppm[2] = -opt.drift_ppm;
+		b->loop_us = opt.loop_us;
+		b->jitter_us = opt.jitter_us;
+		for(int n=1; n<=BUS_NODES; n++)
+			run.start_node(dir + "/bus_node" + std::to_string(n));
+
+		// Timeline, once a second
+		std::printf("   t    kBaud NXT1/2/3     state NXT1   complete cycles/s   errors/s  collided bytes/s\n");
+		bus_node_stats prev[BUS_NODES] = {};
+		std::vector<uint32_t> complete_per_s[BUS_NODES];
+		for(int t=1; t<=(int)opt.secs; t++)
+		{
+			while(bus_now_ns(b) < ns_from_s(t))
+			{
+				if(run.node_died())
+					throw std::runtime_error("A bus node stopped early");
+				std::this_thread::sleep_for(std::chrono::milliseconds(10));
+			}
+			bus_node_stats now[BUS_NODES];
+			for(int k=0; k<BUS_NODES; k++)
+				now[k] = b->node[k].stats;
+
+			std::printf("%4d ", t);
+			for(int k=0; k<BUS_NODES; k++)
+				std::printf(" %5u", b->node[k].pid ? BAUD_RATES[now[k].baud_index] / 1000 : 0);
+			std::printf("  %-11s ", BAUD_STATE_NAME[now[0].baud_state]);
+			uint32_t errors = 0, collided = 0;
+			for(int k=0; k<BUS_NODES; k++)
+			{
+				complete_per_s[k].push_back(now[k].complete_cycles - prev[k].complete_cycles);
+				std::printf(" %5u", complete_per_s[k].back());
+				errors += bus_errors(now[k]) - bus_errors(prev[k]);
+				collided += now[k].collided_bytes - prev[k].collided_bytes;
+				prev[k] = now[k];
+			}
+			std::printf("  %9u  %15u\n", errors, collided);
+		}
+		while(bus_now_ns(b) < ns_from_s(opt.secs))
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		if(!run.wait_nodes())
+			throw std::runtime_error("A bus node failed");
+
+		// Summary
+		const bus_node_stats* s[BUS_NODES] = { &b->node[0].stats, &b->node[1].stats, &b->node[2].stats };
+		std::printf("\nRun: %.1f s, BER %g, drift +-%d ppm, loop %u+0..%u us", opt.secs, opt.ber, opt.drift_ppm, opt.loop_us, opt.jitter_us);
+		if(opt.outage_at_s >= 0)
+			std::printf(", outage at %.1f s for %.0f ms", opt.outage_at_s, opt.outage_ms);
+		std::printf("\n\n                              NXT1       NXT2       NXT3\n");
+		auto row = [&](const char* name, auto field)
+		{
+			std::printf("%-26s", name);
+			for(int k=0; k<BUS_NODES; k++)
+				std::printf(" %10llu", (unsigned long long)field(*s[k]));
+			std::printf("\n");
+		};
+		row("Rate at the end (kBaud)",	[](const bus_node_stats& x) { return BAUD_RATES[x.baud_index] / 1000; });
+		row("Rate fallbacks",			[](const bus_node_stats& x) { return x.baud_fallbacks; });
+		row("Frames sent",				[](const bus_node_stats& x) { return x.update_cycles; });
+		row("Cycles",					[](const bus_node_stats& x) { return x.cycles; });
+		row("Complete cycles",			[](const bus_node_stats& x) { return x.complete_cycles; });
+		row("CRC errors",				[](const bus_node_stats& x) { return x.crc_errors; });
+		row("Frame errors",				[](const bus_node_stats& x) { return x.frame_errors; });
+		row("Lost frames",				[](const bus_node_stats& x) { return x.lost_frames; });
+		row("Slot overruns",			[](const bus_node_stats& x) { return x.slot_overruns; });
+		row("Latest slot start (ms)",	[](const bus_node_stats& x) { return x.slot_late_max_ms; });
+		row("Sync shifts",				[](const bus_node_stats& x) { return x.sync_shifts; });
+		row("Message resends",			[](const bus_node_stats& x) { return x.msg_resends; });
+		row("Waypoints forwarded",		[](const bus_node_stats& x) { return x.waypoints_forwarded; });
+		row("  received",				[](const bus_node_stats& x) { return x.waypoints_received; });
+		row("  missed",					[](const bus_node_stats& x) { return x.waypoints_missed; });
+		row("  repeated",				[](const bus_node_stats& x) { return x.waypoints_repeated; });
+		row("Bytes sent",				[](const bus_node_stats& x) { return x.bytes_sent; });
+		row("  collided",				[](const bus_node_stats& x) { return x.collided_bytes; });
+		row("Bytes received",			[](const bus_node_stats& x) { return x.bytes_received; });
+		row("  corrupted (bit flip)",	[](const bus_node_stats& x) { return x.bytes_corrupted; });
+		row("  garbled",				[](const bus_node_stats& x) { return x.bytes_garbled; });
+		row("Bytes lost: framing",		[](const bus_node_stats& x) { return x.framing_losses; });
+		row("  outage",					[](const bus_node_stats& x) { return x.outage_losses; });
+		row("  receive buffer full",	[](const bus_node_stats& x) { return x.overrun_losses; });
+
+		int tail_s = std::max(1, std::min(5, (int)opt.secs / 2));
+		std::printf("\nComplete cycles/s over the last %d s (of %.0f):", tail_s, CYCLES_PER_S);
+		for(int k=0; k<BUS_NODES; k++)
+		{
+			const std::vector<uint32_t>& c = complete_per_s[k];
+			uint32_t sum = 0;
+			for(size_t i=c.size() - std::min(c.size(), (size_t)tail_s); i<c.size(); i++)
+				sum += c[i];
+			std::printf("  NXT%d %.1f", k+1, c.empty() ? 0.0 : (double)sum / std::min(c.size(), (size_t)tail_s));
+		}
+
+		std::printf("\n\nState age on the bus, sample to decode (ms):   frames     avg     max\n");
+		for(int rx=0; rx<BUS_NODES; rx++)
+			for(int tx=0; tx<BUS_NODES; tx++)
+			{
+				if(tx == rx)
+					continue;
+				const bus_link& l = s[rx]->link[tx];
+				std::printf("  NXT%d -> NXT%d %40u %7.2f %7.2f\n", tx+1, rx+1, l.frames,
+					l.frames ? ms_from_ns(l.latency_sum_ns / l.frames) : 0.0, ms_from_ns(l.latency_max_ns));
+			}
+
+		std::printf("\n");
+		if(s[0]->baud_running_ns != 0)
+			std::printf("Rate negotiation done at %.2f s, at %u kBaud.\n", s[0]->baud_running_ns / 1e9, BAUD_RATES[s[0]->baud_index] / 1000);
+		else
+			std::printf("Rate negotiation not done (NXT1 %s).\n", BAUD_STATE_NAME[s[0]->baud_state]);
+		int64_t settled_ns = 0;
+		for(int k=0; k<BUS_NODES; k++)
+			settled_ns = (s[k]->settled_ns == 0 || settled_ns < 0) ? -1 : std::max(settled_ns, s[k]->settled_ns);
+		if(settled_ns < 0)
+			std::printf("Not every NXT had %d complete cycles in a row%s.\n", BUS_COMPLETE_RUN, opt.outage_at_s >= 0 ? " after the outage" : "");
+		else if(opt.outage_at_s >= 0)
+			std::printf("Recovered %.0f ms after the outage ended: every NXT had %d complete cycles in a row from then.\n",
+				ms_from_ns(settled_ns - b->outage_end_ns), BUS_COMPLETE_RUN);
+		else
+			std::printf("Settled %.0f ms after NXT3 powered up: every NXT had %d complete cycles in a row from then.\n",
+				ms_from_ns(settled_ns - b->start_ns[BUS_NODES-1]), BUS_COMPLETE_RUN);
+	}
+	catch(const std::exception& e)
+	{
+		std::fprintf(stderr, "bus_sim: %s\n", e.what());
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,364 @@
+/*
+ * DHCalibrate.cpp
+ *
+ *	Fits corrections to the DH params (d, r, a) and encoder zero offsets of every joint so that
+ *	forward kinematics matches externally measured tool positions, using Levenberg-Marquardt.
+ *
+ *	Input is a CSV with one pose per line: q1,q2,q3,q4,q5,q6,x,y,z
+ *	Joint angles (deg) are as reported by the NXTs after homing (j[].p). The tool position (mm) is the
+ *	flange (O6) measured in the base frame. Blank lines, lines starting with '#' and a header line are ignored.
+ *
+ *	An encoder zero offset dq means the true joint angle is j[].p + dq. Homing defines the encoder zero,
+ *	so it is corrected by moving phome by +dq (and pmin/pmax with it, for joints homed against an end stop).
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Daniel
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../Common/JointParameters.h"
+#include "../Common/Kinematics.h"
+
+using namespace ra15;
+
+// Parameters fitted per joint, in this order
+enum { FIT_D, FIT_R, FIT_A, FIT_ZERO, FITS_PER_JOINT };
+static const char* const FIT_NAME[FITS_PER_JOINT] = { "d", "r", "a", "zero" };
+static const char* const FIT_UNIT[FITS_PER_JOINT] = { "mm", "mm", "deg", "deg" };
+
+static const int NUM_FIT_JOINT_PARAMS = NUM_JOINTS * FITS_PER_JOINT;
+static const int NUM_BASE_PARAMS = 3;				// Optional x, y, z offset of the measurement frame
+
+struct Options
+{
+	std::string globals_path = DEFAULT_GLOBALS_PATH;
+	std::string csv_path;
+	bool fit_base = false;			// Also fit a translation between the measurement frame and the base frame
+	bool write = false;				// Write the fitted values back into Globals.h
+	double prior = 0.01;			// Weight pulling each correction towards zero. Resolves parameters the data cannot tell apart.
+	int max_iterations = 200;
+};
+
+struct Sample
+{
+	double q[NUM_JOINTS];
+	Vec3 tool;
+};
+
+static void usage(const char* prog)
+{
+	std::printf("Usage: %s [options] poses.csv\n"
+				"  --globals PATH   Globals.h to read jpmtr[] from (default %s)\n"
+				"  --base           Also fit an x/y/z offset between the measurement frame and the arm base\n"
+				"  --prior W        Weight pulling each correction towards zero (default 0.01)\n"
+				"  --iterations N   Maximum Levenberg-Marquardt iterations (default 200)\n"
+				"  --write          Update d, r, a and phome in Globals.h instead of only printing them\n", prog, DEFAULT_GLOBALS_PATH);
+}
+
+static Options parse_args(int argc, char** argv)
+{
+	Options opt;
+	for(int i=1; i<argc; i++)
+	{
+		std::string arg = argv[i];
+		if(arg == "-h" || arg == "--help")	{ usage(argv[0]); std::exit(0); }
+		if(arg == "--base")				{ opt.fit_base = true; continue; }
+		if(arg == "--write")			{ opt.write = true; continue; }
+		if(arg[0] != '-')
+		{
+			if(!opt.csv_path.empty())	throw std::runtime_error("More than one CSV file given");
+			opt.csv_path = arg;
+			continue;
+		}
+		if(i+1 >= argc)						throw std::runtime_error("Missing value for " + arg);
+		if(arg == "--globals")			opt.globals_path = argv[++i];
+		else if(arg == "--prior")		opt.prior = std::atof(argv[++i]);
+		else if(arg == "--iterations")	opt.max_iterations = std::atoi(argv[++i]);
+		else							throw std::runtime_error("Unknown option " + arg);
+	}
+	if(opt.csv_path.empty())
+		throw std::runtime_error("No CSV file given (see --help)");
+	if(opt.prior < 0)
+		throw std::runtime_error("--prior must not be negative");
+	return opt;
+}
+
+static std::vector<Sample> load_samples(const std::string& path)
+{
+	std::ifstream in(path);
+	if(!in)
+		throw std::runtime_error("Cannot open " + path);
+
+	std::vector<Sample> samples;
+	std::string line;
+	for(int line_no=1; std::getline(in, line); line_no++)
+	{
+		size_t first = line.find_first_not_of(" \t\r");
+		if(first == std::string::npos || line[first] == '#')
+			continue;
+		if(!std::isdigit((unsigned char)line[first]) && line[first] != '-' && line[first] != '+' && line[first] != '.')
+		{
+			if(samples.empty())			// Header line
+				continue;
+			throw std::runtime_error(path + ":" + std::to_string(line_no) + ": not a number");
+		}
+
+		double v[NUM_JOINTS+3];
+		const char* p = line.c_str();
+		for(int k=0; k<NUM_JOINTS+3; k++)
+		{
+			char* end;
+			v[k] = std::strtod(p, &end);
+			if(end == p)
+				throw std::runtime_error(path + ":" + std::to_string(line_no) + ": expected 9 values");
+			p = end;
+			while(*p == ' ' || *p == '\t' || *p == ',' || *p == ';') p++;
+		}
+
+		Sample s;
+		std::copy(v, v+NUM_JOINTS, s.q);
+		s.tool = { v[NUM_JOINTS], v[NUM_JOINTS+1], v[NUM_JOINTS+2] };
+		samples.push_back(s);
+	}
+	if(samples.empty())
+		throw std::runtime_error("No poses in " + path);
+	return samples;
+}
+
+// Nominal parameters with the corrections in x applied
+static JointParameters corrected(const JointParameters& nominal, const std::vector<double>& x)
+{
+	JointParameters params = nominal;
+	for(int ji=0; ji<NUM_JOINTS; ji++)
+	{
+		params[ji].d += x[ji*FITS_PER_JOINT + FIT_D];
+		params[ji].r += x[ji*FITS_PER_JOINT + FIT_R];
+		params[ji].a += x[ji*FITS_PER_JOINT + FIT_A];
+	}
+	return params;
+}
+
+// Measured minus predicted tool position for every sample (3 per sample), followed by the prior terms
+static std::vector<double> residuals(const JointParameters& nominal, const std::vector<Sample>& samples,
+									 const std::vector<double>& x, double prior)
+{
+	JointParameters params = corrected(nominal, x);
+	std::vector<double> res;
+	res.reserve(samples.size()*3 + x.size());
+
+	Mat4 frames[NUM_JOINTS+1];
+	for(const Sample& s : samples)
+	{
+		double q[NUM_JOINTS];
+		for(int ji=0; ji<NUM_JOINTS; ji++)
+			q[ji] = s.q[ji] + x[ji*FITS_PER_JOINT + FIT_ZERO];
+		forward_kinematics(params, q, frames);
+		Vec3 tool = mat4_origin(frames[NUM_JOINTS]);
+		if(x.size() > (size_t)NUM_FIT_JOINT_PARAMS)
+		{
+			tool.x += x[NUM_FIT_JOINT_PARAMS+0];
+			tool.y += x[NUM_FIT_JOINT_PARAMS+1];
+			tool.z += x[NUM_FIT_JOINT_PARAMS+2];
+		}
+		res.push_back(s.tool.x - tool.x);
+		res.push_back(s.tool.y - tool.y);
+		res.push_back(s.tool.z - tool.z);
+	}
+	for(double xi : x)
+		res.push_back(-prior * xi);
+	return res;
+}
+
+static double sum_sq(const std::vector<double>& v, size_t count)
+{
+	double s = 0;
+	for(size_t i=0; i<count; i++)
+		s += v[i]*v[i];
+	return s;
+}
+
+// Solves A*x = b for symmetric positive definite A (n x n, row-major) by Cholesky decomposition.
+// Returns false if A is not positive definite.
+static bool solve_spd(std::vector<double> A, std::vector<double> b, int n, std::vector<double>& x)
+{
+	for(int c=0; c<n; c++)
+	{
+		double diag = A[c*n+c];
+		for(int k=0; k<c; k++)
+			diag -= A[c*n+k]*A[c*n+k];
+		if(diag <= 0)
+			return false;
+		A[c*n+c] = std::sqrt(diag);
+		for(int r=c+1; r<n; r++)
+		{
+			double v = A[r*n+c];
+			for(int k=0; k<c; k++)
+				v -= A[r*n+k]*A[c*n+k];
+			A[r*n+c] = v / A[c*n+c];
+		}
+	}
+	for(int r=0; r<n; r++)				// L*y = b
+	{
+		for(int k=0; k<r; k++)
+			b[r] -= A[r*n+k]*b[k];
+		b[r] /= A[r*n+r];
+	}
+	x.assign(n, 0.0);
+	for(int r=n-1; r>=0; r--)			// L'*x = y
+	{
+		double v = b[r];
+		for(int k=r+1; k<n; k++)
+			v -= A[k*n+r]*x[k];
+		x[r] = v / A[r*n+r];
+	}
+	return true;
+}
+
+static std::string param_name(int k)
+{
+	if(k >= NUM_FIT_JOINT_PARAMS)
+		return std::string("base ") + "xyz"[k - NUM_FIT_JOINT_PARAMS];
+	return "J" + std::to_string(k/FITS_PER_JOINT + 1) + " " + FIT_NAME[k % FITS_PER_JOINT];
+}
+
+int main(int argc, char** argv)
+{
+	try
+	{
+		Options opt = parse_args(argc, argv);
+		JointParameters nominal = load_joint_parameters(opt.globals_path);
+		std::vector<Sample> samples = load_samples(opt.csv_path);
+
+		const int n = NUM_FIT_JOINT_PARAMS + (opt.fit_base ? NUM_BASE_PARAMS : 0);
+		const size_t num_meas = samples.size()*3;
+		if(num_meas < (size_t)n)
+			std::fprintf(stderr, "Warning: %zu poses for %d parameters. Use at least %d well spread poses.\n",
+						 samples.size(), n, (n+2)/3 * 2);
+
+		std::vector<double> x(n, 0.0);
+		std::vector<double> res = residuals(nominal, samples, x, opt.prior);
+		double cost = sum_sq(res, res.size());
+		double rms_before = std::sqrt(sum_sq(res, num_meas) / samples.size());
+
+		// Levenberg-Marquardt on the normal equations with a numerical Jacobian
+		const double h = 1e-4;			// mm or deg
+		std::vector<double> J(res.size() * n), A(n*n), g(n), step;
+		std::vector<bool> frozen(n, false);		// Parameters the poses do not constrain are left at zero
+		double lambda = 1e-3;
+		int iter;
+		for(iter=0; iter<opt.max_iterations; iter++)
+		{
+			for(int k=0; k<n; k++)
+			{
+				std::vector<double> xp = x, xm = x;
+				xp[k] += h;		xm[k] -= h;
+				std::vector<double> rp = residuals(nominal, samples, xp, opt.prior);
+				std::vector<double> rm = residuals(nominal, samples, xm, opt.prior);
+				for(size_t i=0; i<res.size(); i++)
+					J[i*n+k] = (rp[i] - rm[i]) / (2*h);
+			}
+			if(iter == 0)
+			{
+				for(int k=0; k<n; k++)
+				{
+					double sensitivity = 0;		// RMS tool displacement per unit of parameter change
+					for(size_t i=0; i<num_meas; i++)
+						sensitivity += J[i*n+k]*J[i*n+k];
+					frozen[k] = std::sqrt(sensitivity / samples.size()) < 0.01;
+				}
+			}
+			for(int r=0; r<n; r++)		// A = J'J, g = -J'res
+			{
+				for(int c=0; c<n; c++)
+				{
+					double v = 0;
+					for(size_t i=0; i<res.size(); i++)
+						v += J[i*n+r]*J[i*n+c];
+					A[r*n+c] = (frozen[r] || frozen[c]) ? (r == c) : v;
+				}
+				double v = 0;
+				for(size_t i=0; i<res.size(); i++)
+					v -= J[i*n+r]*res[i];
+				g[r] = frozen[r] ? 0 : v;
+			}
+
+			bool improved = false;
+			while(lambda < 1e12)
+			{
+				std::vector<double> damped = A;
+				for(int k=0; k<n; k++)
+					damped[k*n+k] += lambda * std::max(A[k*n+k], 1e-9);
+				if(solve_spd(damped, g, n, step))
+				{
+					std::vector<double> x_new(n);
+					for(int k=0; k<n; k++)
+						x_new[k] = x[k] + step[k];
+					std::vector<double> res_new = residuals(nominal, samples, x_new, opt.prior);
+					double cost_new = sum_sq(res_new, res_new.size());
+					if(cost_new < cost)
+					{
+						improved = (cost - cost_new) > 1e-12 * cost;
+						x = x_new;	res = res_new;	cost = cost_new;
+						lambda = std::max(lambda / 3.0, 1e-9);
+						break;
+					}
+				}
+				lambda *= 4.0;
+			}
+			if(!improved)
+				break;
+		}
+
+		double rms_after = std::sqrt(sum_sq(res, num_meas) / samples.size());
+		double worst = 0;
+		for(size_t i=0; i<samples.size(); i++)
+			worst = std::max(worst, std::sqrt(sum_sq(std::vector<double>(res.begin()+i*3, res.begin()+i*3+3), 3)));
+
+		std::printf("%zu poses, %d parameters, %d iterations\n", samples.size(), n, iter+1);
+		std::printf("RMS tool position error: %.2f mm before, %.2f mm after (worst pose %.2f mm)\n\n", rms_before, rms_after, worst);
+
+		std::printf("%-10s %12s\n", "Parameter", "Correction");
+		for(int k=0; k<n; k++)
+		{
+			const char* unit = (k >= NUM_FIT_JOINT_PARAMS) ? "mm" : FIT_UNIT[k % FITS_PER_JOINT];
+			std::printf("%-10s %+9.3f %-3s%s\n", param_name(k).c_str(), x[k], unit,
+						frozen[k] ? "  (does not move the tool, left unchanged)" : "");
+		}
+
+		// Homing treats phome == pmin or pmax as a limit switch at the end stop, so that limit moves with it
+		JointParameters params = corrected(nominal, x);
+		for(int ji=0; ji<NUM_JOINTS; ji++)
+		{
+			double dq = x[ji*FITS_PER_JOINT + FIT_ZERO];
+			if(params[ji].phome == params[ji].pmin)	params[ji].pmin += dq;
+			if(params[ji].phome == params[ji].pmax)	params[ji].pmax += dq;
+			params[ji].phome += dq;
+		}
+
+		std::printf("\nUpdated jpmtr[] values:\n");
+		for(int ji=0; ji<NUM_JOINTS; ji++)
+			std::printf("  J%d: .d = F16(%.3ff), .r = F16(%.3ff), .a = F16(%.3ff), .pmin = F16(%.3ff), .pmax = F16(%.3ff), .phome = F16(%.3ff)\n",
+						ji+1, params[ji].d, params[ji].r, params[ji].a, params[ji].pmin, params[ji].pmax, params[ji].phome);
+
+		if(opt.write)
+		{
+			update_joint_parameters(opt.globals_path, params, { "d", "r", "a", "pmin", "pmax", "phome" });
+			std::printf("\nWrote %s. Rebuild RA15_Master and regenerate the reachability table.\n", opt.globals_path.c_str());
+		}
+		return 0;
+	}
+	catch(const std::exception& e)
+	{
+		std::fprintf(stderr, "dh_calibrate: %s\n", e.what());
+		return 1;
+	}
+}
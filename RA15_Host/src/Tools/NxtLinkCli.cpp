@@ -0,0 +1,238 @@
+/*
+ * NxtLinkCli.cpp
+ *
+ *	nxt_link: records NXT1's Bluetooth telemetry without MATLAB. Connects through NxtLink (src/Link/), decodes and
+ *	logs every packet with LinkRecorder into memory-mappable column logs, and prints a line per second of what
+ *	arrived and what was lost. Can list NXT1's telemetry registry, subscribe to signals by name, and ask for the
+ *	delta coded samples. Sends a CLOCK_BT probe every CLOCK_PROBE_INTERVAL_NS, so the logs carry NXT1's times on the
+ *	PC's clock (nxt_host_ns).
+ *
+ *	The I/O thread only reads and splits packets; this thread decodes and writes the logs. A stall here (a slow
+ *	disk) shows up as rx overflows rather than as a stalled link.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Daniel
+ */
+
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../Common/Waypoint.h"
+#include "../Link/LinkRecorder.h"
+#include "../Link/NxtLink.h"
+
+using namespace ra15;
+
+static const int32_t FIX16_DISABLE = 0x7FFFFFFF;		// DISABLE_VT (fix16_maximum)
+static const uint16_t DEFAULT_TX_INTERVAL_MS = 100;		// BT_DEFAULT_TX_INTERVAL
+static const int64_t NS_PER_S = 1000000000LL;
+static const char* const TYPE_NAME[TLM_NUM_TYPES] = { "uint8", "int8", "uint16", "int16", "uint32", "int32", "fix16" };
+
+struct Options
+{
+	std::string device;
+	std::string log_dir;			// Empty: no logs
+	double secs = 0;				// 0: until Ctrl-C
+	bool list = false;
+	std::vector<std::string> subscribe;
+	int decimation = 1;
+	bool compress = false;
+};
+
+static volatile std::sig_atomic_t interrupted = 0;
+
+static void on_interrupt(int)
+{
+	interrupted = 1;
+}
+
+static void usage(const char* prog)
+{
+	std::printf("Usage: %s --device D [options]\n"
+				"  --device D            /dev/rfcommN, a pty, or NXT1's address XX:XX:XX:XX:XX:XX[@channel]\n"
+				"  --log DIR             Write the column logs to DIR, which must exist\n"
+				"  --secs S              Length of the run (default: until Ctrl-C)\n"
+				"  --list                Print NXT1's telemetry registry\n"
+				"  --subscribe A,B,...   Record these registry signals\n"
+				"  --decimation N        ... every N TASK_MOTORREG cycles (default 1)\n"
+				"  --compress            Ask for delta coded samples. Sends joint targets: each joint holds its position.\n", prog);
+}
+
+static Options parse_args(int argc, char** argv)
+{
+	Options opt;
+	for(int i=1; i<argc; i++)
+	{
+		std::string arg = argv[i];
+		if(arg == "-h" || arg == "--help")	{ usage(argv[0]); std::exit(0); }
+		if(arg == "--list")					{ opt.list = true; continue; }
+		if(arg == "--compress")				{ opt.compress = true; continue; }
+		if(i+1 >= argc)						throw std::runtime_error("Missing value for " + arg);
+		if(arg == "--device")				opt.device = argv[++i];
+		else if(arg == "--log")				opt.log_dir = argv[++i];
+		else if(arg == "--secs")			opt.secs = std::atof(argv[++i]);
+		else if(arg == "--subscribe")		opt.subscribe = split_names(argv[++i]);
+		else if(arg == "--decimation")		opt.decimation = std::atoi(argv[++i]);
+		else								throw std::runtime_error("Unknown option " + arg);
+	}
+	if(opt.device.empty())
+		throw std::runtime_error("--device is required");
+	if(opt.secs < 0)
+		throw std::runtime_error("--secs must not be negative");
+	if(opt.decimation < 1 || opt.decimation > 255)
+		throw std::runtime_error("--decimation must be 1 to 255");
+	return opt;
+}
+
+template<typename P> static std::vector<uint8_t> encode(const P& packet)
+{
+	std::vector<uint8_t> payload(P::BYTES);
+	packet.encode(payload.data());
+	return payload;
+}
+
+// PC_BT that holds every joint at the position NXT1 last reported
+static PcBtPacket hold_packet(const Nxt1BtPacket& n, uint8_t compress, uint16_t interval)
+{
+	PcBtPacket pc;
+	pc.j1pt = n.j1p;	pc.j2pt = n.j2p;	pc.j3pt = n.j3p;	pc.j4pt = n.j4p;	pc.j5pt = n.j5p;	pc.j6pt = n.j6p;
+	pc.j1vt = pc.j2vt = pc.j3vt = pc.j4vt = pc.j5vt = pc.j6vt = FIX16_DISABLE;
+	pc.nxtTransmitInterval = interval;
+	pc.compressSamples = compress;
+	return pc;
+}
+
+static void send_packet(NxtLink& link, const std::vector<uint8_t>& payload)
+{
+	if(!link.send(payload.data(), payload.size()))
+		std::fprintf(stderr, "nxt_link: could not queue a packet for NXT1\n");
+}
+
+// Stamps a PC_BT as it is sent, and logs it
+static void send_packet(NxtLink& link, LinkRecorder& recorder, PcBtPacket& pc)
+{
+	int64_t now = link_now_ns();
+	pc.pcStamp = link_stamp_ms(now);
+	recorder.command_sent(pc, now);
+	send_packet(link, encode(pc));
+}
+
+
+int main(int argc, char** argv)
+{
+	try
+	{
+		Options opt = parse_args(argc, argv);
+		std::signal(SIGINT, on_interrupt);
+		std::signal(SIGTERM, on_interrupt);
+
+		LinkRecorder recorder(opt.log_dir);
+		NxtLink link(opt.device);
+		std::printf("Connected to %s.%s\n", opt.device.c_str(), opt.log_dir.empty() ? "" : (" Logging to " + opt.log_dir + ".").c_str());
+
+		bool want_registry = opt.list || !opt.subscribe.empty();
+		bool listed = false, subscribed = false, sent_pc = false;
+		PcBtPacket last_pc;
+		int64_t start = link_now_ns(), next_print = start + NS_PER_S, next_registry = start, next_probe = start;
+		NxtLink::Stats last_link = link.stats();
+		LinkRecorder::Stats last = recorder.stats();
+		LinkPacket packet;
+
+		std::printf("   t  NXT1_BT/s  samples/s  lost  records/s  lost   kB/s  resyncs  overflows\n");
+		while(!interrupted && link.running())
+		{
+			int64_t now = link_now_ns();
+			if(opt.secs > 0 && now - start >= (int64_t)(opt.secs * NS_PER_S))
+				break;
+			link.wait(50);
+			while(link.receive(packet))
+				recorder.handle(packet);
+
+			// Ask for the registry until it arrives, then list it and subscribe
+			now = link_now_ns();
+			if(want_registry && !recorder.registry().complete() && now >= next_registry)
+			{
+				send_packet(link, recorder.subscribe_payload({}, 0));
+				next_registry = now + 2*NS_PER_S;
+			}
+			if(recorder.registry().complete() && opt.list && !listed)
+			{
+				std::printf("NXT1 telemetry registry:\n");
+				for(const TelemetrySignal& s : recorder.registry().signals)
+					std::printf("  %3u  %-12s  %s\n", s.id, s.name.c_str(), s.type < TLM_NUM_TYPES ? TYPE_NAME[s.type] : "?");
+				listed = true;
+			}
+			if(recorder.registry().complete() && !opt.subscribe.empty() && !subscribed)
+			{
+				send_packet(link, recorder.subscribe_payload(opt.subscribe, (uint8_t)opt.decimation));
+				subscribed = true;
+			}
+			if(opt.compress && !sent_pc && recorder.have_nxt1())
+			{
+				last_pc = hold_packet(recorder.nxt1(), 1, DEFAULT_TX_INTERVAL_MS);
+				send_packet(link, recorder, last_pc);
+				sent_pc = true;
+			}
+			if(recorder.have_nxt1() && now >= next_probe)
+			{
+				send_packet(link, recorder.clock_probe(now));
+				next_probe = now + CLOCK_PROBE_INTERVAL_NS;
+			}
+
+			if(now >= next_print)
+			{
+				NxtLink::Stats l = link.stats();
+				LinkRecorder::Stats r = recorder.stats();
+				if(r.records < last.records)		// A new subscription started its counts over
+					last.records = last.records_lost = 0;
+				std::printf("%4d  %9llu  %9llu  %4llu  %9llu  %4llu  %5.1f  %7llu  %9llu\n", (int)((now - start) / NS_PER_S),
+							(unsigned long long)(r.nxt1 - last.nxt1), (unsigned long long)(r.samples - last.samples),
+							(unsigned long long)(r.samples_lost - last.samples_lost), (unsigned long long)(r.records - last.records),
+							(unsigned long long)(r.records_lost - last.records_lost), (l.rx_bytes - last_link.rx_bytes) / 1000.0,
+							(unsigned long long)(l.rx_resyncs - last_link.rx_resyncs), (unsigned long long)(l.rx_overflows - last_link.rx_overflows));
+				std::fflush(stdout);
+				last_link = l;
+				last = r;
+				next_print += NS_PER_S;
+			}
+		}
+
+		std::string why = link.error();
+		if(sent_pc && link.running())		// As NXTConnection.bluetoothDisconnect()
+		{
+			last_pc.nxtTransmitInterval = 0;
+			send_packet(link, recorder, last_pc);
+		}
+		link.close();
+		while(link.receive(packet))
+			recorder.handle(packet);
+		recorder.close();
+
+		NxtLink::Stats l = link.stats();
+		LinkRecorder::Stats r = recorder.stats();
+		if(!why.empty())
+			std::printf("Link closed: %s\n", why.c_str());
+		std::printf("\nReceived %llu bytes in %llu packets (%llu resync bytes, %llu overflows), sent %llu packets\n",
+					(unsigned long long)l.rx_bytes, (unsigned long long)l.rx_packets, (unsigned long long)l.rx_resyncs,
+					(unsigned long long)l.rx_overflows, (unsigned long long)l.tx_packets);
+		std::printf("NXT1_BT %llu, samples %llu (%llu lost), records %llu (%llu lost), parameter replies %llu, capture %llu, other %llu\n",
+					(unsigned long long)r.nxt1, (unsigned long long)r.samples, (unsigned long long)r.samples_lost,
+					(unsigned long long)r.records, (unsigned long long)r.records_lost, (unsigned long long)r.param_replies,
+					(unsigned long long)r.captures, (unsigned long long)r.ignored);
+		const ClockSync& clock = recorder.clock();
+		if(clock.valid())
+			std::printf("NXT1's systick - PC's clock: %.1f ms, drift %.1f ppm, from %llu probes (least delay %.1f ms)\n",
+						clock.offset_ns(link_now_ns()) / 1e6, clock.estimate().drift * 1e6,
+						(unsigned long long)clock.exchanges(), clock.estimate().delay_ns / 1e6);
+	}
+	catch(const std::exception& e)
+	{
+		std::fprintf(stderr, "nxt_link: %s\n", e.what());
+		return 1;
+	}
+	return 0;
+}
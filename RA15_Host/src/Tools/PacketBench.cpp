@@ -0,0 +1,302 @@
+/*
+ * PacketBench.cpp
+ *
+ *	Times the firmware packet codec generated by DEFINE_PACKET_CODEC (one fixed-size memcpy per field,
+ *	straight-line) against the pointer_size_pair table walk it replaced (one memcpy of runtime size per
+ *	table entry). Both are built from the same field lists in PacketSchema.h, against host copies of the
+ *	firmware variables they name.
+ *
+ *	The RS485 packets are quantized (PacketSchema.h), so for those the codec also does the int16_t conversion
+ *	and writes fewer bytes than the table, which still sends full fix16_t values.
+ *
+ *	Host timings only show the relative cost. On the NXT's ARM7 the table walk also pays for a call into
+ *	memcpy per field, so the gap is wider there.
+ *
+ *	Also packs simulated TASK_MOTORREG samples into delta coded TELEMETRY_Z_BT packets the way Bluetooth.c does,
+ *	checks that every packet decodes back to the same samples, and reports how many fit in a packet.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Daniel
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../Common/Packets.h"
+
+using ra15::fix16_t;
+
+
+// Host copies of the firmware variables named in the field lists
+
+struct joint_state { fix16_t p, v, pt, vt; int8_t pwm; };
+static joint_state j[6];
+static struct { fix16_t pt, vt; } jtgt[6];
+static struct { uint16_t dt_ms; uint8_t joint_mask; fix16_t p[6]; } wpt;
+static uint8_t wpt_seq, wpt_ack[2];
+static struct { uint16_t sample_ms; uint32_t tx_ms; uint8_t seq[2], hold_ms[2]; } sync;
+static struct { uint8_t next, countdown, probe; } baud;
+static struct { uint8_t probe, frames; } probe_report[2];
+static uint8_t enable_joint_limits, tmux, rcx, ea1, ea2, ea3, queued_waypoints, free_waypoints;
+static uint16_t traj_underruns_bt;
+static uint8_t compress_samples;
+static uint32_t pc_stamp;
+static struct { uint32_t stamp, rx_ms, tx_ms; } echo;
+static uint32_t systick_ms, sample_ms;
+static struct { uint16_t seq; uint8_t count; } frame;
+static uint16_t nxt_bt_tx_interval;
+
+
+// New: generated straight-line codec, as in RS485.c and Bluetooth.c
+DEFINE_PACKET_CODEC(nxt1, PACKET_NXT1_FIELDS)
+DEFINE_PACKET_CODEC(nxt2, PACKET_NXT2_FIELDS)
+DEFINE_PACKET_CODEC(nxt3, PACKET_NXT3_FIELDS)
+DEFINE_PACKET_CODEC(nxt1_bt, NXT1_BT_FIELDS)
+DEFINE_PACKET_CODEC(pc_bt, PC_BT_FIELDS)
+DEFINE_PACKET_CODEC(waypoint_bt, WAYPOINT_BT_FIELDS)
+DEFINE_PACKET_CODEC(telemetry_sample, TELEMETRY_SAMPLE_FIELDS)
+DEFINE_PACKET_CODEC(telemetry_frame, TELEMETRY_FRAME_FIELDS)
+
+
+// Old: table of pointer/size pairs, walked with memcpy
+struct pointer_size_pair { uint8_t* val; size_t size; };
+#define TABLE_ENTRY(name, type, wire, shift, expr)	{ (uint8_t*)&(expr), sizeof(type) },
+#define DEFINE_PACKET_TABLE(packet, FIELDS)	static const pointer_size_pair table_##packet[] = { FIELDS(TABLE_ENTRY) };
+DEFINE_PACKET_TABLE(nxt1, PACKET_NXT1_FIELDS)
+DEFINE_PACKET_TABLE(nxt2, PACKET_NXT2_FIELDS)
+DEFINE_PACKET_TABLE(nxt3, PACKET_NXT3_FIELDS)
+DEFINE_PACKET_TABLE(nxt1_bt, NXT1_BT_FIELDS)
+DEFINE_PACKET_TABLE(pc_bt, PC_BT_FIELDS)
+DEFINE_PACKET_TABLE(waypoint_bt, WAYPOINT_BT_FIELDS)
+DEFINE_PACKET_TABLE(telemetry_sample, TELEMETRY_SAMPLE_FIELDS)
+
+__attribute__((noinline)) static void table_encode(const pointer_size_pair* table, size_t count, uint8_t* packet)
+{
+	uint8_t offset = 0;
+	for(size_t i=0; i<count; i++)
+	{
+		memcpy(packet+offset, table[i].val, table[i].size);
+		offset += table[i].size;
+	}
+}
+
+__attribute__((noinline)) static void table_decode(const pointer_size_pair* table, size_t count, const uint8_t* packet)
+{
+	uint8_t offset = 0;
+	for(size_t i=0; i<count; i++)
+	{
+		memcpy(table[i].val, packet+offset, table[i].size);
+		offset += table[i].size;
+	}
+}
+
+
+struct Options
+{
+	long iterations = 2000000;
+};
+
+static void usage(const char* prog)
+{
+	std::printf("Usage: %s [options]\n"
+				"  --iterations N   Encode+decode round trips per packet and method (default 2000000)\n", prog);
+}
+
+static Options parse_args(int argc, char** argv)
+{
+	Options opt;
+	for(int i=1; i<argc; i++)
+	{
+		std::string arg = argv[i];
+		if(arg == "-h" || arg == "--help")	{ usage(argv[0]); std::exit(0); }
+		if(i+1 >= argc)						throw std::runtime_error("Missing value for " + arg);
+		if(arg == "--iterations")		opt.iterations = std::atol(argv[++i]);
+		else							throw std::runtime_error("Unknown option " + arg);
+	}
+	if(opt.iterations < 1)
+		throw std::runtime_error("--iterations must be positive");
+	return opt;
+}
+
+// Average ns per encode+decode. Changes one variable per iteration so the work cannot be hoisted out of the loop.
+template<typename Encode, typename Decode>
+static double time_round_trip(long iterations, Encode encode, Decode decode)
+{
+	uint8_t buf[128];
+	auto start = std::chrono::steady_clock::now();
+	for(long i=0; i<iterations; i++)
+	{
+		j[0].p += 1;
+		encode(buf);
+		buf[0] ^= (uint8_t)i;
+		decode(buf);
+	}
+	auto end = std::chrono::steady_clock::now();
+	return std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+}
+
+// Delta coding
+
+static const size_t SAMPLE_BYTES = PACKET_BYTES(TELEMETRY_SAMPLE_FIELDS);
+static const size_t FRAME_BYTES = PACKET_BYTES(TELEMETRY_FRAME_FIELDS);
+static const uint8_t sample_field_bytes[] = { TELEMETRY_SAMPLE_FIELDS(PACKET_FIELD_WIRE_BYTES) };
+typedef std::vector<uint8_t> Bytes;
+
+// TASK_MOTORREG samples of every joint swinging through amplitude (deg) at its own period, or at rest if 0
+static std::vector<Bytes> simulate_samples(size_t count, double amplitude)
+{
+	std::vector<Bytes> samples;
+	for(size_t n=0; n<count; n++)
+	{
+		double t = n * 0.020;
+		sample_ms = 1000 + (uint32_t)n*20;
+		for(int ji=0; ji<6; ji++)
+		{
+			double w = 2*M_PI / (2.0 + ji*0.7);
+			double p = 10.0*ji + amplitude*std::sin(w*t), v = amplitude*w*std::cos(w*t);
+			j[ji].p = (fix16_t)std::lround(p * 65536);
+			j[ji].v = (fix16_t)std::lround(v * 65536);
+			j[ji].pwm = (int8_t)std::lround(std::fmax(-100, std::fmin(100, v)));
+		}
+		Bytes b(SAMPLE_BYTES);
+		encode_telemetry_sample(b.data());
+		samples.push_back(b);
+	}
+	return samples;
+}
+
+// Packs samples the way Bluetooth.c add_sample() does: a whole sample, then deltas while they fit
+static std::vector<Bytes> pack_samples(const std::vector<Bytes>& samples)
+{
+	std::vector<Bytes> packets;
+	size_t k = 0;
+	while(k < samples.size())
+	{
+		Bytes packet(TELEMETRY_Z_BT_BYTES, 0);
+		frame.seq = (uint16_t)k;
+		frame.count = 1;
+		memcpy(&packet[FRAME_BYTES], samples[k].data(), SAMPLE_BYTES);
+		size_t used = FRAME_BYTES + SAMPLE_BYTES;
+		for(k++; k < samples.size() && frame.count < TELEMETRY_Z_MAX; k++, frame.count++)
+		{
+			uint8_t delta[PACKET_DELTA_BYTES(TELEMETRY_SAMPLE_FIELDS)];
+			size_t len = 0, offset = 0;
+			for(uint8_t n : sample_field_bytes)
+			{
+				len += packet_put_delta(delta + len, &samples[k][offset], &samples[k-1][offset], n);
+				offset += n;
+			}
+			if(used + len > TELEMETRY_Z_BT_BYTES)
+				break;
+			memcpy(&packet[used], delta, len);
+			used += len;
+		}
+		encode_telemetry_frame(packet.data());
+		packets.push_back(packet);
+	}
+	return packets;
+}
+
+static std::vector<Bytes> unpack_samples(const std::vector<Bytes>& packets)
+{
+	std::vector<Bytes> samples;
+	for(const Bytes& packet : packets)
+	{
+		decode_telemetry_frame(packet.data());
+		Bytes cur(packet.begin() + FRAME_BYTES, packet.begin() + FRAME_BYTES + SAMPLE_BYTES);
+		samples.push_back(cur);
+		size_t pos = FRAME_BYTES + SAMPLE_BYTES;
+		for(int i=1; i<frame.count; i++)
+		{
+			Bytes prev = cur;
+			size_t offset = 0;
+			for(uint8_t n : sample_field_bytes)
+			{
+				pos += packet_get_delta(&packet[pos], &cur[offset], &prev[offset], n);
+				offset += n;
+			}
+			samples.push_back(cur);
+		}
+	}
+	return samples;
+}
+
+static void delta_report(const char* label, double amplitude, long iterations)
+{
+	std::vector<Bytes> samples = simulate_samples(3000, amplitude);
+	std::vector<Bytes> packets = pack_samples(samples);
+	if(unpack_samples(packets) != samples)
+		throw std::runtime_error("Delta coded samples do not decode back to the originals");
+
+	long rounds = std::max(1L, iterations / (long)samples.size());
+	auto start = std::chrono::steady_clock::now();
+	for(long i=0; i<rounds; i++)
+		packets = pack_samples(samples);
+	auto end = std::chrono::steady_clock::now();
+	double ns = std::chrono::duration<double, std::nano>(end - start).count() / rounds / packets.size();
+
+	double per_packet = (double)samples.size() / packets.size();
+	std::printf("%-16s %8.2f %9.0f%% %10.0f\n", label, per_packet,
+				100.0 * samples.size() * SAMPLE_BYTES / (packets.size() * TELEMETRY_Z_BT_BYTES), ns);
+}
+
+
+#define BENCH(packet, FIELDS)																			\
+	{																									\
+		const size_t count = sizeof(table_##packet)/sizeof(table_##packet[0]);							\
+		double t_old = time_round_trip(opt.iterations,													\
+			[](uint8_t* b) { table_encode(table_##packet, count, b); },									\
+			[](const uint8_t* b) { table_decode(table_##packet, count, b); });							\
+		double t_new = time_round_trip(opt.iterations,													\
+			[](uint8_t* b) { encode_##packet(b); }, [](const uint8_t* b) { decode_##packet(b); });		\
+		std::printf("%-16s %5zu %7zu %11.1f %11.1f %8.1fx\n", #packet, count, (size_t)PACKET_BYTES(FIELDS), t_old, t_new, t_old/t_new);	\
+	}
+
+
+int main(int argc, char** argv)
+{
+	try
+	{
+		Options opt = parse_args(argc, argv);
+
+		// The two methods must produce identical bytes
+		uint8_t a[128], b[128];
+		for(size_t i=0; i<sizeof(j); i++)	((uint8_t*)j)[i] = (uint8_t)(i*7 + 3);
+		for(size_t i=0; i<sizeof(jtgt); i++)	((uint8_t*)jtgt)[i] = (uint8_t)(i*5 + 1);
+		systick_ms = 0x12345678;	free_waypoints = 27;	traj_underruns_bt = 3;	nxt_bt_tx_interval = 100;
+		table_encode(table_nxt1_bt, sizeof(table_nxt1_bt)/sizeof(table_nxt1_bt[0]), a);
+		encode_nxt1_bt(b);
+		if(memcmp(a, b, PACKET_BYTES(NXT1_BT_FIELDS)) != 0)
+			throw std::runtime_error("Generated codec does not match the table walk");
+
+		std::printf("Packet           fields  bytes  table (ns)  codec (ns)  speedup\n");
+		BENCH(nxt1, PACKET_NXT1_FIELDS)
+		BENCH(nxt2, PACKET_NXT2_FIELDS)
+		BENCH(nxt3, PACKET_NXT3_FIELDS)
+		BENCH(nxt1_bt, NXT1_BT_FIELDS)
+		BENCH(pc_bt, PC_BT_FIELDS)
+		BENCH(waypoint_bt, WAYPOINT_BT_FIELDS)
+		BENCH(telemetry_sample, TELEMETRY_SAMPLE_FIELDS)
+		std::printf("Times are per encode+decode round trip.\n\n");
+
+		std::printf("Delta coded TELEMETRY_Z_BT (%d bytes; TELEMETRY_BT carries %d samples at %.0f%%)\n",
+					TELEMETRY_Z_BT_BYTES, TELEMETRY_BATCH, 100.0 * TELEMETRY_BATCH * SAMPLE_BYTES / TELEMETRY_BT_BYTES);
+		std::printf("Motion           samples     ratio  ns/packet\n");
+		delta_report("at rest", 0.0, opt.iterations);
+		delta_report("+-5 deg", 5.0, opt.iterations);
+		delta_report("+-45 deg", 45.0, opt.iterations);
+		std::printf("Ratio is the samples' TELEMETRY_SAMPLE size in percent of the packets they took.\n");
+	}
+	catch(const std::exception& e)
+	{
+		std::fprintf(stderr, "packet_bench: %s\n", e.what());
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,312 @@
+/*
+ * PacketGen.cpp
+ *
+ *	Writes matlab/NXTPackets.m: sizes, empty structs and encode/decode functions for every packet in
+ *	RA15_Master/src/Comms/PacketSchema.h, so that the MATLAB side never drifts from the firmware.
+ *	fix16_t fields become doubles (deg, deg/s), including quantized ones. Integer fields keep their MATLAB
+ *	integer class.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Daniel
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../Common/Packets.h"
+#include "../Common/SourceFile.h"
+
+using namespace ra15;
+
+static const char DEFAULT_MATLAB_PATH[] = "../matlab/NXTPackets.m";
+
+struct Options
+{
+	std::string output_path = DEFAULT_MATLAB_PATH;
+};
+
+struct Field
+{
+	std::string name;
+	std::string type;		// C type of the firmware variable, e.g. "fix16_t"
+	std::string wire;		// C type on the wire, e.g. "int16_t" for a quantized fix16_t
+	int shift;				// Quantized fields: the wire value is the fix16_t divided by 2^PACKET_SHIFT(shift)
+	bool quantized() const	{ return wire != type; }
+	std::string quantizer(const char* op) const		// e.g. "NXTPackets.dequantizeTarget(", a target keeps its sentinels
+		{ return std::string("NXTPackets.") + op + ((shift & PACKET_SENTINELS) ? "Target(" : "("); }
+};
+
+struct PacketInfo
+{
+	std::string constant;	// e.g. NXT1_BT
+	std::string function;	// e.g. Nxt1Bt
+	std::string comment;
+	size_t bytes;
+	std::vector<Field> fields;
+};
+
+static void usage(const char* prog)
+{
+	std::printf("Usage: %s [options]\n"
+				"  -o PATH          Output file (default %s)\n", prog, DEFAULT_MATLAB_PATH);
+}
+
+static Options parse_args(int argc, char** argv)
+{
+	Options opt;
+	for(int i=1; i<argc; i++)
+	{
+		std::string arg = argv[i];
+		if(arg == "-h" || arg == "--help")	{ usage(argv[0]); std::exit(0); }
+		if(i+1 >= argc)						throw std::runtime_error("Missing value for " + arg);
+		if(arg == "-o")					opt.output_path = argv[++i];
+		else							throw std::runtime_error("Unknown option " + arg);
+	}
+	return opt;
+}
+
+template<typename Packet>
+static PacketInfo describe(const char* constant, const char* function, const char* comment)
+{
+	PacketInfo info { constant, function, comment, Packet::BYTES, {} };
+	Packet().for_each_field([&](const char* name, const char* type, const char* wire, int shift, auto) {
+		info.fields.push_back({ name, type, wire, shift });
+	});
+	return info;
+}
+
+// MATLAB integer class and byte count for a wire type
+static void matlab_type(const std::string& type, std::string& cls, int& bytes)
+{
+	if(type == "fix16_t")		{ cls = "int32";	bytes = 4; }
+	else if(type == "uint32_t")	{ cls = "uint32";	bytes = 4; }
+	else if(type == "int32_t")	{ cls = "int32";	bytes = 4; }
+	else if(type == "uint16_t")	{ cls = "uint16";	bytes = 2; }
+	else if(type == "int16_t")	{ cls = "int16";	bytes = 2; }
+	else if(type == "uint8_t")	{ cls = "uint8";	bytes = 1; }
+	else if(type == "int8_t")	{ cls = "int8";		bytes = 1; }
+	else throw std::runtime_error("No MATLAB mapping for wire type " + type);
+}
+
+static size_t longest_name(const PacketInfo& p)
+{
+	size_t n = 0;
+	for(const Field& f : p.fields)
+		n = std::max(n, f.name.size());
+	return n;
+}
+
+static std::string pad(const std::string& s, size_t width)
+{
+	return s + std::string(width > s.size() ? width - s.size() : 0, ' ');
+}
+
+static void write_constants(std::ostringstream& out, const PacketInfo& p)
+{
+	size_t w = longest_name(p) + 4;		// Quotes, comma and a space
+	out << "        % " << p.comment << "\n";
+	out << "        " << p.constant << "_BYTES = " << p.bytes << ";\n";
+	out << "        " << p.constant << "_EMPTY = struct( ...\n";
+	for(size_t i=0; i<p.fields.size(); i++)
+	{
+		const Field& f = p.fields[i];
+		std::string cls; int bytes;
+		matlab_type(f.type, cls, bytes);
+		out << "            " << pad("'" + f.name + "',", w) << (f.type == "fix16_t" ? "double" : cls) << "(0)"
+			<< (i+1 < p.fields.size() ? ", ..." : " );") << "\n";
+	}
+	out << "\n";
+}
+
+static void write_functions(std::ostringstream& out, const PacketInfo& p)
+{
+	size_t w = longest_name(p);
+	out << "        function packet = decode" << p.function << "(payload)\n";
+	out << "            payload = uint8(payload(:)');\n";
+	out << "            packet = NXTPackets." << p.constant << "_EMPTY;\n";
+	size_t offset = 1;
+	for(const Field& f : p.fields)
+	{
+		std::string cls; int bytes;
+		matlab_type(f.wire, cls, bytes);
+		std::string raw = "typecast(payload(" + std::to_string(offset) + ":" + std::to_string(offset+bytes-1) + "), '" + cls + "')";
+		std::string value = raw;
+		if(f.quantized())				value = f.quantizer("dequantize") + raw + ", " + std::to_string(PACKET_SHIFT(f.shift)) + ")";
+		else if(f.type == "fix16_t")	value = "fix16_to_dbl(" + raw + ")";
+		out << "            packet." << pad(f.name, w) << " = " << value << ";\n";
+		offset += bytes;
+	}
+	out << "        end\n\n";
+
+	out << "        function payload = encode" << p.function << "(packet)\n";
+	out << "            payload = zeros(1, NXTPackets." << p.constant << "_BYTES, 'uint8');\n";
+	offset = 1;
+	for(const Field& f : p.fields)
+	{
+		std::string cls; int bytes;
+		matlab_type(f.wire, cls, bytes);
+		std::string value = cls + "(packet." + f.name + ")";
+		if(f.quantized())				value = f.quantizer("quantize") + "packet." + f.name + ", " + std::to_string(PACKET_SHIFT(f.shift)) + ")";
+		else if(f.type == "fix16_t")	value = "fix16_from_dbl(packet." + f.name + ")";
+		out << "            payload(" << offset << ":" << offset+bytes-1 << ") = typecast(" << value << ", 'uint8');\n";
+		offset += bytes;
+	}
+	out << "        end\n\n";
+}
+
+
+int main(int argc, char** argv)
+{
+	try
+	{
+		Options opt = parse_args(argc, argv);
+
+		std::vector<PacketInfo> packets = {
+			describe<Nxt1BtPacket>("NXT1_BT", "Nxt1Bt", "NXT1 -> PC telemetry"),
+			describe<PcBtPacket>("PC_BT", "PcBt", "PC -> NXT1 joint targets"),
+			describe<ClockBtPacket>("CLOCK_BT", "ClockBt", "PC -> NXT1 clock probe, echoed in NXT1_BT"),
+			describe<WaypointBtPacket>("WAYPOINT_BT", "WaypointBt", "PC -> NXT1 spline knot"),
+			describe<CaptureCmdBtPacket>("CAPTURE_CMD_BT", "CaptureCmdBt", "PC -> NXT1 RS485 bus capture on (1) or off (0)"),
+			describe<TelemetryFramePacket>("TELEMETRY_FRAME", "TelemetryFrame", "NXT1 -> PC sample frame header: first sample's seq, samples used"),
+			describe<TelemetrySamplePacket>("TELEMETRY_SAMPLE", "TelemetrySample", "NXT1 -> PC joint states of one TASK_MOTORREG cycle"),
+			describe<SubscribeBtPacket>("SUBSCRIBE", "Subscribe", "PC -> NXT1 subscription header: record every decimation cycles (0: list the registry), ids used"),
+			describe<TelemetrySchemaPacket>("TELEMETRY_SCHEMA", "TelemetrySchema", "NXT1 -> PC description header: layout (0: the registry), entries in all, first entry here"),
+			describe<TelemetrySubPacket>("TELEMETRY_SUB", "TelemetrySub", "NXT1 -> PC subscribed records header: layout, first record's seq, records used"),
+			describe<ParamBtPacket>("PARAM_BT", "ParamBt", "PC -> NXT1 parameter get, set or commit"),
+			describe<ParamReplyBtPacket>("PARAM_REPLY_BT", "ParamReplyBt", "NXT1 -> PC answer to a PARAM_BT"),
+			describe<Nxt1Packet>("RS485_NXT1", "Rs485Nxt1", "RS485 packet from NXT1 (for bus captures)"),
+			describe<Nxt2Packet>("RS485_NXT2", "Rs485Nxt2", "RS485 packet from NXT2 (for bus captures)"),
+			describe<Nxt3Packet>("RS485_NXT3", "Rs485Nxt3", "RS485 packet from NXT3 (for bus captures)"),
+		};
+
+		std::string telemetry_types;
+		const char* type_names[TLM_NUM_TYPES] = {};
+		type_names[TLM_UINT8] = "uint8";	type_names[TLM_INT8] = "int8";
+		type_names[TLM_UINT16] = "uint16";	type_names[TLM_INT16] = "int16";
+		type_names[TLM_UINT32] = "uint32";	type_names[TLM_INT32] = "int32";
+		type_names[TLM_FIX16] = "fix16";
+		for(const char* t : type_names)
+			telemetry_types += std::string(telemetry_types.empty() ? "" : ", ") + "'" + t + "'";
+
+		std::string param_names;
+		std::ostringstream param_min, param_max;
+		#define PARAM_NAME(name, field, min, max)	param_names += std::string(param_names.empty() ? "" : ", ") + "'" #name "'";	\
+													param_min << (param_min.tellp() > 0 ? " " : "") << (min);						\
+													param_max << (param_max.tellp() > 0 ? " " : "") << (max);
+		JOINT_PARAMETERS(PARAM_NAME)
+		#undef PARAM_NAME
+
+		std::string param_results;
+		const char* result_names[PARAM_FAILED+1] = {};
+		result_names[PARAM_OK] = "ok";					result_names[PARAM_UNKNOWN] = "unknown";
+		result_names[PARAM_OUT_OF_RANGE] = "out_of_range";	result_names[PARAM_INCONSISTENT] = "inconsistent";
+		result_names[PARAM_BUSY] = "busy";				result_names[PARAM_PENDING] = "pending";
+		result_names[PARAM_FAILED] = "failed";
+		for(const char* r : result_names)
+			param_results += std::string(param_results.empty() ? "" : ", ") + "'" + r + "'";
+
+		std::string sample_field_bytes;
+		for(int n : { TELEMETRY_SAMPLE_FIELDS(PACKET_FIELD_WIRE_BYTES) })
+			sample_field_bytes += (sample_field_bytes.empty() ? "" : " ") + std::to_string(n);
+
+		std::ostringstream out;
+		out << "% NXTPackets.m\n"
+			<< "%\n"
+			<< "%   Packet layouts, generated from RA15_Master/src/Comms/PacketSchema.h by RA15_Host packet_gen.\n"
+			<< "%   Do not edit. Change the schema, then run ./build/packet_gen from RA15_Host.\n"
+			<< "%   Payloads exclude the 2 byte ecrobot Bluetooth header and the 1 byte RS485 header.\n"
+			<< "\n"
+			<< "classdef NXTPackets\n"
+			<< "\n"
+			<< "    properties (Constant)\n"
+			<< "\n";
+		for(const PacketInfo& p : packets)
+			write_constants(out, p);
+		out << "        % NXT1 -> PC RS485 bus capture: [uint32 stream position][CAPTURE_BT_DATA bytes of the stream].\n"
+			<< "        % Saved by NXTConnection.startCapture() and replayed by RA15_Host rs485_replay.\n"
+			<< "        CAPTURE_BT_BYTES = " << CAPTURE_BT_BYTES << ";\n"
+			<< "        CAPTURE_BT_DATA = " << CAPTURE_BT_DATA << ";\n"
+			<< "\n"
+			<< "        % PC -> NXT1 batch of spline knots: [count][WAYPOINT_BATCH WAYPOINT_BT payloads], the unused ones zero.\n"
+			<< "        WAYPOINT_BATCH = " << WAYPOINT_BATCH << ";\n"
+			<< "        WAYPOINT_BATCH_BT_BYTES = " << WAYPOINT_BATCH_BT_BYTES << ";\n"
+			<< "\n"
+			<< "        % NXT1 -> PC samples: [TELEMETRY_FRAME][TELEMETRY_BATCH TELEMETRY_SAMPLEs], the unused ones zero.\n"
+			<< "        TELEMETRY_BATCH = " << TELEMETRY_BATCH << ";\n"
+			<< "        TELEMETRY_BT_BYTES = " << TELEMETRY_BT_BYTES << ";\n"
+			<< "\n"
+			<< "        % NXT1 -> PC delta coded samples: [TELEMETRY_FRAME][first TELEMETRY_SAMPLE][the others, each field's\n"
+			<< "        % wire bytes as a zig-zag varint difference from the previous sample's], up to TELEMETRY_Z_MAX.\n"
+			<< "        TELEMETRY_Z_BT_BYTES = " << TELEMETRY_Z_BT_BYTES << ";\n"
+			<< "        TELEMETRY_Z_MAX = " << TELEMETRY_Z_MAX << ";\n"
+			<< "        TELEMETRY_SAMPLE_FIELD_BYTES = [" << sample_field_bytes << "];\n"
+			<< "\n"
+			<< "        % Telemetry subscriptions. PC -> NXT1: [SUBSCRIBE][TELEMETRY_SUB_MAX signal ids]. NXT1 -> PC:\n"
+			<< "        % [TELEMETRY_SCHEMA][TELEMETRY_SCHEMA_ENTRIES (id uint8, type uint8, name char[TELEMETRY_NAME_CHARS])]\n"
+			<< "        % and [TELEMETRY_SUB][records of the layout's signals, in entry order]. Type t is TELEMETRY_TYPES{t+1}.\n"
+			<< "        SUBSCRIBE_BT_BYTES = " << SUBSCRIBE_BT_BYTES << ";\n"
+			<< "        TELEMETRY_SUB_MAX = " << TELEMETRY_SUB_MAX << ";\n"
+			<< "        TELEMETRY_NAME_CHARS = " << TELEMETRY_NAME_CHARS << ";\n"
+			<< "        TELEMETRY_SCHEMA_ENTRIES = " << TELEMETRY_SCHEMA_ENTRIES << ";\n"
+			<< "        TELEMETRY_SCHEMA_ENTRY_BYTES = " << TELEMETRY_SCHEMA_ENTRY_BYTES << ";\n"
+			<< "        TELEMETRY_SCHEMA_BT_BYTES = " << TELEMETRY_SCHEMA_BT_BYTES << ";\n"
+			<< "        TELEMETRY_SUB_BT_BYTES = " << TELEMETRY_SUB_BT_BYTES << ";\n"
+			<< "        TELEMETRY_TYPES = {" << telemetry_types << "};    % fix16 is int32, scaled by 2^-16\n"
+			<< "\n"
+			<< "        % Live joint parameters. Parameter id k is PARAM_NAMES{k+1}, a field of jpmtr[] limited to\n"
+			<< "        % [PARAM_MIN(k+1), PARAM_MAX(k+1)]. op is PARAM_GET, PARAM_SET or PARAM_COMMIT, and result r is PARAM_RESULTS{r+1}.\n"
+			<< "        PARAM_NAMES = {" << param_names << "};\n"
+			<< "        PARAM_MIN = [" << param_min.str() << "];\n"
+			<< "        PARAM_MAX = [" << param_max.str() << "];\n"
+			<< "        PARAM_GET = " << PARAM_GET << ";\n"
+			<< "        PARAM_SET = " << PARAM_SET << ";\n"
+			<< "        PARAM_COMMIT = " << PARAM_COMMIT << ";\n"
+			<< "        PARAM_RESULTS = {" << param_results << "};\n"
+			<< "\n";
+		out << "    end\n"
+			<< "\n"
+			<< "    methods (Static)\n"
+			<< "\n";
+		for(const PacketInfo& p : packets)
+			write_functions(out, p);
+		out << "        % Quantized fix16_t fields (int16_t on the wire, see PacketSchema.h). Out of range values\n"
+			<< "        % clamp to +-(intmax('int16')-1). Targets saturate instead: saturated values stand for\n"
+			<< "        % DISABLE_PT/DISABLE_VT and decode to +-Inf.\n"
+			<< "        function x = dequantize(q, shift)\n"
+			<< "            x = double(q) * 2^(shift-16);\n"
+			<< "        end\n"
+			<< "\n"
+			<< "        function q = quantize(x, shift)\n"
+			<< "            q = int16(max(min(x * 2^(16-shift), double(intmax('int16'))-1), 1-double(intmax('int16'))));\n"
+			<< "        end\n"
+			<< "\n"
+			<< "        function x = dequantizeTarget(q, shift)\n"
+			<< "            x = NXTPackets.dequantize(q, shift);\n"
+			<< "            x(q == intmax('int16')) = Inf;\n"
+			<< "            x(q == intmin('int16')) = -Inf;\n"
+			<< "        end\n"
+			<< "\n"
+			<< "        function q = quantizeTarget(x, shift)\n"
+			<< "            q = int16(x * 2^(16-shift));\n"
+			<< "        end\n"
+			<< "\n";
+		out << "    end\n"
+			<< "\n"
+			<< "end\n";
+
+		write_source_file(opt.output_path, out.str());
+		std::printf("Wrote %zu packets to %s\n", packets.size(), opt.output_path.c_str());
+	}
+	catch(const std::exception& e)
+	{
+		std::fprintf(stderr, "packet_gen: %s\n", e.what());
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,243 @@
+/*
+ * ReachabilityGen.cpp
+ *
+ *	Sweeps J1-J3 within pmin/pmax and writes a voxel map of the wrist center workspace to
+ *	RA15_Master/src/Control/ReachabilityTable.h/.c, to be compiled into flash.
+ *
+ *	The wrist is spherical (J5 has d=r=0), so the wrist center O4 depends only on J1-J3.
+ *	Each voxel stores the J1-J3 sample whose wrist center lies closest to the voxel center,
+ *	which the NXT uses to reject unreachable targets and to seed the IK.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Daniel
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../Common/JointParameters.h"
+#include "../Common/Kinematics.h"
+#include "../Common/SourceFile.h"
+
+using namespace ra15;
+
+static const int SEED_JOINTS = 3;				// Only J1-J3 affect the wrist center
+static const int SEED_UNREACHABLE = -128;		// Seed value marking a voxel with no solution
+static const double SEED_STEP_DEG = 1.0;		// Seed quantization (deg per LSB)
+
+struct Options
+{
+	std::string globals_path = DEFAULT_GLOBALS_PATH;
+	std::string xml_path;						// If set, DH params come from the kinematic model instead of Globals.h
+	std::string out_dir = "../RA15_Master/src/Control";
+	double voxel_mm = 25.0;
+	double step_deg = 0.5;
+	size_t rom_budget = 224*1024;				// App flash limit (see RA15_Joint_Test/README.txt)
+	size_t rom_reserve = 96*1024;				// Left over for the firmware itself
+};
+
+struct Voxel
+{
+	double best_dist2 = INFINITY;
+	int seed[SEED_JOINTS] = { SEED_UNREACHABLE, SEED_UNREACHABLE, SEED_UNREACHABLE };
+};
+
+static void usage(const char* prog)
+{
+	std::printf("Usage: %s [options]\n"
+				"  --globals PATH   Globals.h to read jpmtr[] from (default %s)\n"
+				"  --xml PATH       Take DH params from the kinematic model XML instead of Globals.h\n"
+				"  --out DIR        Output directory for ReachabilityTable.h/.c (default ../RA15_Master/src/Control)\n"
+				"  --voxel MM       Voxel edge length (default 25)\n"
+				"  --step DEG       Joint sweep step (default 0.5)\n"
+				"  --reserve BYTES  ROM kept free for firmware code (default 98304)\n", prog, DEFAULT_GLOBALS_PATH);
+}
+
+static Options parse_args(int argc, char** argv)
+{
+	Options opt;
+	for(int i=1; i<argc; i++)
+	{
+		std::string arg = argv[i];
+		if(arg == "-h" || arg == "--help")	{ usage(argv[0]); std::exit(0); }
+		if(i+1 >= argc)						throw std::runtime_error("Missing value for " + arg);
+		if(arg == "--globals")			opt.globals_path = argv[++i];
+		else if(arg == "--xml")			opt.xml_path = argv[++i];
+		else if(arg == "--out")			opt.out_dir = argv[++i];
+		else if(arg == "--voxel")		opt.voxel_mm = std::atof(argv[++i]);
+		else if(arg == "--step")		opt.step_deg = std::atof(argv[++i]);
+		else if(arg == "--reserve")		opt.rom_reserve = std::strtoul(argv[++i], nullptr, 0);
+		else							throw std::runtime_error("Unknown option " + arg);
+	}
+	if(opt.voxel_mm <= 0 || opt.step_deg <= 0)
+		throw std::runtime_error("--voxel and --step must be positive");
+	return opt;
+}
+
+// Calls fn(q) for every J1-J3 combination on the sweep grid. J4-J6 are held at prest.
+template<typename Fn>
+static void sweep(const JointParameters& params, double step, Fn fn)
+{
+	double q[NUM_JOINTS];
+	for(int ji=0; ji<NUM_JOINTS; ji++)
+		q[ji] = params[ji].prest;
+
+	for(q[0]=params[0].pmin; q[0]<=params[0].pmax+1e-9; q[0]+=step)
+		for(q[1]=params[1].pmin; q[1]<=params[1].pmax+1e-9; q[1]+=step)
+			for(q[2]=params[2].pmin; q[2]<=params[2].pmax+1e-9; q[2]+=step)
+				fn(q);
+}
+
+int main(int argc, char** argv)
+{
+	try
+	{
+		Options opt = parse_args(argc, argv);
+
+		JointParameters params = load_joint_parameters(opt.globals_path);
+		if(!opt.xml_path.empty())
+			load_dh_from_xml(opt.xml_path, params);
+
+		// Seed quantization is centered on each joint's range so that it fits in an int8
+		int seed_center[SEED_JOINTS];
+		for(int ji=0; ji<SEED_JOINTS; ji++)
+		{
+			seed_center[ji] = (int)std::lround((params[ji].pmin + params[ji].pmax) / 2.0);
+			double half_range = std::max(params[ji].pmax - seed_center[ji], seed_center[ji] - params[ji].pmin);
+			if(half_range / SEED_STEP_DEG > 127.0)
+				throw std::runtime_error("Joint " + std::to_string(ji+1) + " range does not fit in an int8 seed");
+		}
+
+		// Pass 1: bounding box of the wrist center workspace, snapped outward to the voxel grid
+		Vec3 lo = { INFINITY, INFINITY, INFINITY }, hi = { -INFINITY, -INFINITY, -INFINITY };
+		sweep(params, opt.step_deg, [&](const double* q)
+		{
+			Vec3 w = wrist_center(params, q);
+			lo.x = std::min(lo.x, w.x);	hi.x = std::max(hi.x, w.x);
+			lo.y = std::min(lo.y, w.y);	hi.y = std::max(hi.y, w.y);
+			lo.z = std::min(lo.z, w.z);	hi.z = std::max(hi.z, w.z);
+		});
+
+		int x0 = (int)std::floor(lo.x / opt.voxel_mm) * (int)opt.voxel_mm;
+		int y0 = (int)std::floor(lo.y / opt.voxel_mm) * (int)opt.voxel_mm;
+		int z0 = (int)std::floor(lo.z / opt.voxel_mm) * (int)opt.voxel_mm;
+		int nx = (int)std::floor((hi.x - x0) / opt.voxel_mm) + 1;
+		int ny = (int)std::floor((hi.y - y0) / opt.voxel_mm) + 1;
+		int nz = (int)std::floor((hi.z - z0) / opt.voxel_mm) + 1;
+		size_t num_voxels = (size_t)nx * ny * nz;
+		size_t table_bytes = num_voxels * SEED_JOINTS;
+
+		std::printf("Workspace: x[%d,%d) y[%d,%d) z[%d,%d) mm, %dx%dx%d voxels of %g mm\n",
+					x0, x0+nx*(int)opt.voxel_mm, y0, y0+ny*(int)opt.voxel_mm, z0, z0+nz*(int)opt.voxel_mm, nx, ny, nz, opt.voxel_mm);
+
+		if(table_bytes + opt.rom_reserve > opt.rom_budget)
+			throw std::runtime_error("Table is " + std::to_string(table_bytes) + " bytes; only " +
+									 std::to_string(opt.rom_budget - opt.rom_reserve) + " available. Increase --voxel.");
+
+		// Pass 2: nearest sample to each voxel center
+		std::vector<Voxel> voxels(num_voxels);
+		sweep(params, opt.step_deg, [&](const double* q)
+		{
+			Vec3 w = wrist_center(params, q);
+			int ix = (int)std::floor((w.x - x0) / opt.voxel_mm);
+			int iy = (int)std::floor((w.y - y0) / opt.voxel_mm);
+			int iz = (int)std::floor((w.z - z0) / opt.voxel_mm);
+			if(ix < 0 || ix >= nx || iy < 0 || iy >= ny || iz < 0 || iz >= nz)
+				return;
+
+			double cx = x0 + (ix + 0.5) * opt.voxel_mm;
+			double cy = y0 + (iy + 0.5) * opt.voxel_mm;
+			double cz = z0 + (iz + 0.5) * opt.voxel_mm;
+			double dist2 = (w.x-cx)*(w.x-cx) + (w.y-cy)*(w.y-cy) + (w.z-cz)*(w.z-cz);
+
+			Voxel& v = voxels[((size_t)iz*ny + iy)*nx + ix];
+			if(dist2 < v.best_dist2)
+			{
+				v.best_dist2 = dist2;
+				for(int ji=0; ji<SEED_JOINTS; ji++)
+					v.seed[ji] = (int)std::lround((q[ji] - seed_center[ji]) / SEED_STEP_DEG);
+			}
+		});
+
+		size_t reachable = 0;
+		for(const Voxel& v : voxels)
+			if(v.seed[0] != SEED_UNREACHABLE)
+				reachable++;
+
+		// Emit header
+		std::string h_path = opt.out_dir + "/ReachabilityTable.h";
+		std::ostringstream h;
+		h <<	"/*\n"
+				" * ReachabilityTable.h\n"
+				" *\n"
+				" *	GENERATED FILE - DO NOT EDIT. Regenerate with RA15_Host/build/reachability_gen.\n"
+				" *\n"
+				" *	Voxel map of the wrist center workspace. See Reachability.h for the lookup functions.\n"
+				" */\n\n"
+				"#ifndef SRC_CONTROL_REACHABILITYTABLE_H_\n"
+				"#define SRC_CONTROL_REACHABILITYTABLE_H_\n\n"
+				"#include \"stdint.h\"\n\n";
+		h << "#define REACH_VOXEL_MM\t\t" << (int)opt.voxel_mm << "\t\t// Voxel edge length (mm)\n";
+		h << "#define REACH_X0_MM\t\t\t" << x0 << "\t\t// Corner of voxel (0,0,0) in the base frame (mm)\n";
+		h << "#define REACH_Y0_MM\t\t\t" << y0 << "\n";
+		h << "#define REACH_Z0_MM\t\t\t" << z0 << "\n";
+		h << "#define REACH_NX\t\t\t" << nx << "\t\t// Number of voxels along each axis\n";
+		h << "#define REACH_NY\t\t\t" << ny << "\n";
+		h << "#define REACH_NZ\t\t\t" << nz << "\n";
+		h << "#define REACH_SEED_JOINTS\t" << SEED_JOINTS << "\t\t// Seeds are stored for J1-J3 only\n";
+		h << "#define REACH_SEED_STEP_DEG\t" << (int)SEED_STEP_DEG << "\t\t// Degrees per seed LSB\n";
+		h << "#define REACH_UNREACHABLE\t(" << SEED_UNREACHABLE << ")\t// Seed value for a voxel with no solution\n\n";
+		h << "static const int16_t reach_seed_center[REACH_SEED_JOINTS] = {";
+		for(int ji=0; ji<SEED_JOINTS; ji++)
+			h << (ji ? ", " : "") << seed_center[ji];
+		h << "};\t// Joint angle (deg) represented by a seed of 0\n\n";
+		h << "// Indexed by ((iz*REACH_NY + iy)*REACH_NX + ix). Joint angle = reach_seed_center + seed*REACH_SEED_STEP_DEG\n";
+		h << "extern const int8_t reach_seed[REACH_NX*REACH_NY*REACH_NZ][REACH_SEED_JOINTS];\n\n";
+		h << "#endif /* SRC_CONTROL_REACHABILITYTABLE_H_ */\n";
+		write_source_file(h_path, h.str());
+
+		// Emit table, one x-row per line
+		std::string c_path = opt.out_dir + "/ReachabilityTable.c";
+		std::ostringstream c;
+		c <<	"/*\n"
+				" * ReachabilityTable.c\n"
+				" *\n"
+				" *	GENERATED FILE - DO NOT EDIT. Regenerate with RA15_Host/build/reachability_gen.\n"
+				" *\n";
+		c << " *	" << reachable << " of " << num_voxels << " voxels reachable, " << table_bytes << " bytes.\n";
+		c <<	" */\n\n"
+				"#include \"ReachabilityTable.h\"\n\n"
+				"const int8_t reach_seed[REACH_NX*REACH_NY*REACH_NZ][REACH_SEED_JOINTS] = {\n";
+		for(int iz=0; iz<nz; iz++)
+		{
+			c << "\t// z = " << z0 + iz*(int)opt.voxel_mm << " mm\n";
+			for(int iy=0; iy<ny; iy++)
+			{
+				c << "\t";
+				for(int ix=0; ix<nx; ix++)
+				{
+					const Voxel& v = voxels[((size_t)iz*ny + iy)*nx + ix];
+					c << "{" << v.seed[0] << "," << v.seed[1] << "," << v.seed[2] << "},";
+				}
+				c << "\n";
+			}
+		}
+		c << "};\n";
+		write_source_file(c_path, c.str());
+
+		std::printf("%zu of %zu voxels reachable. Table: %zu bytes (budget %zu). Wrote %s and %s\n",
+					reachable, num_voxels, table_bytes, opt.rom_budget - opt.rom_reserve, h_path.c_str(), c_path.c_str());
+		return 0;
+	}
+	catch(const std::exception& e)
+	{
+		std::fprintf(stderr, "reachability_gen: %s\n", e.what());
+		return 1;
+	}
+}
@@ -0,0 +1,533 @@
+/*
+ * RingSim.cpp
+ *
+ *	Timing model of the RS485 bus in RA15_Master/src/Comms/RS485.c, used to compare packet layouts and
+ *	schedules without three NXTs on the bench. Packet sizes come from PacketSchema.h: once as sent
+ *	(quantized) and once with every field at its full width, as before quantization.
+ *
+ *	Two schedules are modelled:
+ *	 - The free-running token ring that update_rs485() used to be: each NXT sends as soon as the previous
+ *	   one has been received, one state per TASK_BACKGROUND iteration.
+ *	 - The TDMA schedule it is now: each NXT sends in a fixed slot after its TASK_MOTORREG starts, and the
+ *	   regulators of NXT2/3 are locked to NXT1's within --sync-us.
+ *	A TASK_BACKGROUND iteration takes --loop-us plus a random 0..--jitter-us for preemption by the periodic
+ *	tasks. Bytes take 10 bit times on the bus (8N1), and every NXT except the sender receives every byte.
+ *	Frames are sized for the worst case of the framing with a full message budget (RS485_WIRE_BYTES).
+ *	Bus errors are not modelled.
+ *
+ *	Both are also run at every rate the startup negotiation in RS485.c may pick (RS485_BAUD_RATES), as the
+ *	USART actually clocks them, for the sustained ring cycles per second and the TDMA airtime at each.
+ *
+ *	State age is reported twice: on the bus, from the sender's send_packet() to the receiver's decode, and
+ *	end to end, from the TASK_MOTORREG that sampled a joint state to the first TASK_MOTORREG on the
+ *	receiver that can use it. The regulators of the token ring run at unrelated phases.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Daniel
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../Common/Packets.h"
+
+using namespace ra15;
+
+static const int NUM_NXTS = 3;
+static const int RS485_HW_BUFFER = 64;
+static const int BITS_PER_BYTE = 10;		// Start, 8 data, stop
+static const double USART_CLOCK = 48e6 / 16;	// The USART runs at USART_CLOCK/n baud, n rounded from the rate asked for
+
+struct Options
+{
+	double baud = 921600;					// DEFAULT_BAUD_RATE_RS485 in nxtOSEK
+	double loop_us = 100;
+	double jitter_us = 200;
+	long cycles = 20000;
+	unsigned seed = 1;
+	double period_ms = 20;					// MOTORREG_PERIOD_MS
+	int slot_ms[3] = { 1, 6, 11 };			// RS485_SLOT_NXTx_MS
+	double slot_len_ms = 5;					// RS485_SLOT_MS
+	double sync_us = 1000;					// RS485_SYNC_TOLERANCE_MS, plus a systick
+};
+
+static void usage(const char* prog)
+{
+	std::printf("Usage: %s [options]\n"
+				"  --baud B         Bus baud rate (default 921600)\n"
+				"  --loop-us L      TASK_BACKGROUND iteration time without preemption (default 100)\n"
+				"  --jitter-us J    Extra random 0..J us per iteration from preemption (default 200)\n"
+				"  --cycles N       Ring cycles to simulate per layout (default 20000)\n"
+				"  --seed S         Random seed (default 1)\n"
+				"TDMA schedule (defaults as in RS485.h):\n"
+				"  --period-ms P    Bus cycle, the TASK_MOTORREG period (default 20)\n"
+				"  --slots A,B,C    Slot start of NXT1, NXT2 and NXT3 after TASK_MOTORREG starts (default 1,6,11)\n"
+				"  --slot-ms S      Slot length (default 5)\n"
+				"  --sync-us U      Largest regulator phase error of NXT2/3 against NXT1 (default 1000)\n", prog);
+}
+
+static Options parse_args(int argc, char** argv)
+{
+	Options opt;
+	for(int i=1; i<argc; i++)
+	{
+		std::string arg = argv[i];
+		if(arg == "-h" || arg == "--help")	{ usage(argv[0]); std::exit(0); }
+		if(i+1 >= argc)						throw std::runtime_error("Missing value for " + arg);
+		if(arg == "--baud")				opt.baud = std::atof(argv[++i]);
+		else if(arg == "--loop-us")		opt.loop_us = std::atof(argv[++i]);
+		else if(arg == "--jitter-us")	opt.jitter_us = std::atof(argv[++i]);
+		else if(arg == "--cycles")		opt.cycles = std::atol(argv[++i]);
+		else if(arg == "--seed")		opt.seed = (unsigned)std::atol(argv[++i]);
+		else if(arg == "--period-ms")	opt.period_ms = std::atof(argv[++i]);
+		else if(arg == "--slot-ms")		opt.slot_len_ms = std::atof(argv[++i]);
+		else if(arg == "--sync-us")		opt.sync_us = std::atof(argv[++i]);
+		else if(arg == "--slots")
+		{
+			if(std::sscanf(argv[++i], "%d,%d,%d", &opt.slot_ms[0], &opt.slot_ms[1], &opt.slot_ms[2]) != 3)
+				throw std::runtime_error("--slots takes three comma separated offsets, e.g. 1,6,11");
+		}
+		else							throw std::runtime_error("Unknown option " + arg);
+	}
+	if(opt.baud <= 0 || opt.loop_us <= 0 || opt.jitter_us < 0 || opt.cycles < 1)
+		throw std::runtime_error("--baud, --loop-us and --cycles must be positive, --jitter-us not negative");
+	for(int i=0; i<NUM_NXTS; i++)
+		if(opt.slot_ms[i] < 0 || opt.slot_ms[i] + opt.slot_len_ms > (i+1 < NUM_NXTS ? opt.slot_ms[i+1] : opt.period_ms))
+			throw std::runtime_error("Slots must be in order, not overlap and end within --period-ms");
+	if(opt.sync_us < 0)
+		throw std::runtime_error("--sync-us must not be negative");
+	return opt;
+}
+
+
+// BUS
+
+struct Transmission
+{
+	int sender;
+	double start;		// us
+	int bytes;
+};
+
+struct Bus
+{
+	double byte_us;
+	double free_at = 0;
+	std::deque<Transmission> active;
+	long delivered[NUM_NXTS] = {};		// Bytes of retired transmissions, per receiver
+
+	// Bytes that have arrived at NXT rx by time t, since the start
+	long arrived(int rx, double t) const
+	{
+		long n = delivered[rx];
+		for(const Transmission& tx : active)
+			if(tx.sender != rx && t > tx.start)
+				n += std::min<long>(tx.bytes, (long)((t - tx.start) / byte_us));
+		return n;
+	}
+
+	double send(int sender, double t, int bytes)
+	{
+		Transmission tx { sender, std::max(t, free_at), bytes };
+		free_at = tx.start + bytes*byte_us;
+		active.push_back(tx);
+		return tx.start;
+	}
+
+	// Transmissions that have fully arrived by time t no longer need to be walked
+	void retire(double t)
+	{
+		while(!active.empty() && active.front().start + active.front().bytes*byte_us <= t)
+		{
+			for(int rx=0; rx<NUM_NXTS; rx++)
+				if(rx != active.front().sender)
+					delivered[rx] += active.front().bytes;
+			active.pop_front();
+		}
+	}
+};
+
+
+// REGULATORS. TASK_MOTORREG starts every period, offset by phase.
+
+static double regulator_before(double t, double period, double phase)		// Latest start at or before t
+{
+	return phase + std::floor((t - phase) / period) * period;
+}
+
+static double regulator_after(double t, double period, double phase)		// First start at or after t
+{
+	return phase + std::ceil((t - phase) / period) * period;
+}
+
+static double mean(const std::vector<double>& v)
+{
+	double total = 0;
+	for(double x : v)	total += x;
+	return total / v.size();
+}
+
+static double percentile(std::vector<double> v, double p)
+{
+	std::sort(v.begin(), v.end());
+	return v[(size_t)(p * (v.size()-1))];
+}
+
+
+// TOKEN RING. Steps in the order update_rs485() used to visit them on each NXT.
+
+enum StepType { SEND, WAIT, RECEIVE };
+struct Step { StepType type; int from; };
+
+static const std::vector<Step> STEPS[NUM_NXTS] = {
+	{ {SEND,0}, {WAIT,1}, {RECEIVE,1}, {WAIT,2}, {RECEIVE,2} },		// NXT1
+	{ {WAIT,0}, {RECEIVE,0}, {SEND,1}, {WAIT,2}, {RECEIVE,2} },		// NXT2
+	{ {WAIT,0}, {RECEIVE,0}, {WAIT,1}, {RECEIVE,1}, {SEND,2} },		// NXT3
+};
+
+struct Node
+{
+	int step = 0;
+	double next_tick = 0;
+	long consumed = 0;
+	int bytes_remaining = 0;
+};
+
+struct Result
+{
+	double cycles_per_s;
+	double period_mean, period_p99, period_max;		// us
+	double age_mean, age_max;						// us
+	double e2e_min, e2e_mean, e2e_max;				// us
+	double bus_load;								// Share of time the bus is transmitting
+};
+
+// Packet sizes here exclude the header, as PACKET_BYTES does
+static int wire_bytes(int packet_bytes)
+{
+	return (int)RS485_WIRE_BYTES(packet_bytes);
+}
+
+static Result simulate(const Options& opt, const int packet_bytes[NUM_NXTS])
+{
+	std::mt19937 rng(opt.seed);
+	std::uniform_real_distribution<double> jitter(0.0, opt.jitter_us);
+
+	Bus bus;
+	bus.byte_us = 1e6 * BITS_PER_BYTE / opt.baud;
+	Node nodes[NUM_NXTS];
+	for(Node& n : nodes)
+		n.next_tick = jitter(rng);		// The NXTs start out of phase
+
+	double period = opt.period_ms * 1000;
+	std::uniform_real_distribution<double> any_phase(0.0, period);
+	double phase[NUM_NXTS];
+	for(double& ph : phase)
+		ph = any_phase(rng);			// Nothing relates the regulators of the NXTs
+
+	double sent_at[NUM_NXTS] = {};		// send_packet() time of the latest packet from each NXT
+	std::vector<double> periods, ages, e2e;
+	double last_cycle = -1, busy_us = 0;
+
+	while((long)periods.size() < opt.cycles)
+	{
+		// Run whichever NXT iterates next
+		int ni = 0;
+		for(int i=1; i<NUM_NXTS; i++)
+			if(nodes[i].next_tick < nodes[ni].next_tick)
+				ni = i;
+		Node& n = nodes[ni];
+		double t = n.next_tick;
+		const Step& s = STEPS[ni][n.step];
+		long available = bus.arrived(ni, t) - n.consumed;
+
+		bool done = false;
+		switch(s.type)
+		{
+			case SEND:
+				sent_at[ni] = bus.send(ni, t, wire_bytes(packet_bytes[ni]));
+				busy_us += wire_bytes(packet_bytes[ni]) * bus.byte_us;
+				done = true;
+				break;
+			case WAIT:
+				if(available >= 1)
+				{
+					n.consumed++;
+					n.bytes_remaining = wire_bytes(packet_bytes[s.from]) - 1;
+					done = true;
+				}
+				break;
+			case RECEIVE:
+			{
+				int take = (int)std::min<long>(available, n.bytes_remaining);
+				n.consumed += take;
+				n.bytes_remaining -= take;
+				if(n.bytes_remaining == 0)
+				{
+					ages.push_back(t - sent_at[s.from]);
+					e2e.push_back(regulator_after(t, period, phase[ni]) - regulator_before(sent_at[s.from], period, phase[s.from]));
+					done = true;
+				}
+				break;
+			}
+		}
+
+		if(done && ++n.step == (int)STEPS[ni].size())
+		{
+			n.step = 0;
+			if(ni == 0)				// NXT1 counts rs485_update_cycles after receiving NXT3
+			{
+				if(last_cycle >= 0)
+					periods.push_back(t - last_cycle);
+				last_cycle = t;
+			}
+		}
+		n.next_tick = t + opt.loop_us + jitter(rng);
+
+		double oldest = std::min({ nodes[0].next_tick, nodes[1].next_tick, nodes[2].next_tick });
+		bus.retire(oldest);
+	}
+
+	Result r;
+	double total = 0;
+	for(double p : periods)	total += p;
+	r.period_mean = total / periods.size();
+	r.cycles_per_s = 1e6 / r.period_mean;
+	std::sort(periods.begin(), periods.end());
+	r.period_p99 = periods[(size_t)(0.99 * (periods.size()-1))];
+	r.period_max = periods.back();
+	r.age_mean = mean(ages);
+	r.age_max = *std::max_element(ages.begin(), ages.end());
+	r.e2e_min = *std::min_element(e2e.begin(), e2e.end());
+	r.e2e_mean = mean(e2e);
+	r.e2e_max = *std::max_element(e2e.begin(), e2e.end());
+	r.bus_load = busy_us / total;
+	return r;
+}
+
+
+// TDMA. Each NXT sends in its slot after its TASK_MOTORREG starts, as update_slot() does.
+
+// TASK_BACKGROUND iterations of one NXT, generated as far ahead as they are asked for
+struct Background
+{
+	std::deque<double> times;
+	double next = 0;
+
+	template<typename Jitter>
+	double first_after(double t, double loop_us, Jitter jitter)
+	{
+		while(times.empty() || times.back() < t)
+		{
+			times.push_back(next);
+			next += loop_us + jitter();
+		}
+		return *std::lower_bound(times.begin(), times.end(), t);
+	}
+
+	void forget_before(double t)
+	{
+		while(times.size() > 1 && times.front() < t)
+			times.pop_front();
+	}
+};
+
+struct TdmaResult
+{
+	double late_p99, late_max;				// us from slot start to send_packet()
+	double overruns, skipped;				// Share of frames
+	double age_mean, age_max;				// us
+	double e2e_min, e2e_mean, e2e_max;		// us
+	double bus_load;
+};
+
+static TdmaResult simulate_tdma(const Options& opt, const int packet_bytes[NUM_NXTS])
+{
+	std::mt19937 rng(opt.seed);
+	std::uniform_real_distribution<double> jitter_dist(0.0, opt.jitter_us);
+	auto jitter = [&]() { return jitter_dist(rng); };
+	std::uniform_real_distribution<double> sync(-opt.sync_us, opt.sync_us);
+
+	double byte_us = 1e6 * BITS_PER_BYTE / opt.baud;
+	double period = opt.period_ms * 1000, slot_len = opt.slot_len_ms * 1000;
+	double phase[NUM_NXTS] = { 0, sync(rng), sync(rng) };		// NXT2/3 are locked to NXT1
+	Background bg[NUM_NXTS];
+	for(Background& b : bg)
+		b.next = jitter();
+
+	std::vector<double> late, ages, e2e;
+	long overruns = 0, skipped = 0;
+	double busy_us = 0;
+	for(long k=0; k<opt.cycles; k++)
+	{
+		for(int i=0; i<NUM_NXTS; i++)
+		{
+			double cycle = k*period + phase[i];
+			double slot = cycle + opt.slot_ms[i]*1000;
+			double send = bg[i].first_after(slot, opt.loop_us, jitter);
+			double frame_us = wire_bytes(packet_bytes[i]) * byte_us;
+			late.push_back(send - slot);
+
+			double late_ms = std::floor((send - slot) / 1000);		// update_slot() only sees the systick
+			if(late_ms*1000 + frame_us > slot_len)
+				overruns++;
+			if(late_ms*1000 >= slot_len)
+			{
+				skipped++;
+				continue;
+			}
+
+			busy_us += frame_us;
+			for(int r=0; r<NUM_NXTS; r++)
+			{
+				if(r == i)
+					continue;
+				double decoded = bg[r].first_after(send + frame_us, opt.loop_us, jitter);
+				ages.push_back(decoded - send);
+				e2e.push_back(regulator_after(decoded, period, phase[r]) - cycle);
+			}
+		}
+		for(Background& b : bg)
+			b.forget_before((k-1) * period);
+	}
+
+	TdmaResult r;
+	r.late_p99 = percentile(late, 0.99);
+	r.late_max = *std::max_element(late.begin(), late.end());
+	r.overruns = (double)overruns / late.size();
+	r.skipped = (double)skipped / late.size();
+	r.age_mean = mean(ages);
+	r.age_max = *std::max_element(ages.begin(), ages.end());
+	r.e2e_min = *std::min_element(e2e.begin(), e2e.end());
+	r.e2e_mean = mean(e2e);
+	r.e2e_max = *std::max_element(e2e.begin(), e2e.end());
+	r.bus_load = busy_us / (opt.cycles * period);
+	return r;
+}
+
+
+// Rate the AT91SAM7 USART really runs at when asked for baud
+static double usart_baud(double baud)
+{
+	return USART_CLOCK / std::max(1.0, std::round(USART_CLOCK / baud));
+}
+
+
+// QUANTIZATION ERROR
+
+// Round trips random values across the whole range of every quantized field, through the same
+// packet_quantize()/packet_dequantize() as the firmware.
+template<typename Packet>
+static void print_quantization(const char* packet_name, std::mt19937& rng)
+{
+	Packet().for_each_field([&](const char* name, const char* type, const char* wire, int shift, auto) {
+		if(std::string(type) == wire)
+			return;
+		double step = (double)(1 << PACKET_SHIFT(shift)) / 65536.0;
+		double range = (INT16_MAX - 1) * step;
+		std::uniform_int_distribution<int32_t> value((int32_t)(-range * 65536), (int32_t)(range * 65536));
+		double max_error = 0;
+		for(int i=0; i<100000; i++)
+		{
+			int32_t v = value(rng);
+			int32_t back = packet_dequantize(packet_quantize(v, shift), shift);
+			max_error = std::max(max_error, std::abs((double)(back - v)) / 65536.0);
+		}
+		std::printf("%-6s %-18s %4d %10.5f %10.5f %9.2f\n", packet_name, name, PACKET_SHIFT(shift), step, max_error, range);
+	});
+}
+
+
+int main(int argc, char** argv)
+{
+	try
+	{
+		Options opt = parse_args(argc, argv);
+
+		const int quantized[NUM_NXTS] = {
+			(int)PACKET_BYTES(PACKET_NXT1_FIELDS), (int)PACKET_BYTES(PACKET_NXT2_FIELDS), (int)PACKET_BYTES(PACKET_NXT3_FIELDS) };
+		const int raw[NUM_NXTS] = {
+			(int)PACKET_RAW_BYTES(PACKET_NXT1_FIELDS), (int)PACKET_RAW_BYTES(PACKET_NXT2_FIELDS), (int)PACKET_RAW_BYTES(PACKET_NXT3_FIELDS) };
+
+		std::printf("RS485 bus at %.0f baud, loop %.0f us + 0-%.0f us preemption, %ld cycles\n\n",
+					opt.baud, opt.loop_us, opt.jitter_us, opt.cycles);
+		std::printf("Token ring  NXT1 NXT2 NXT3  bytes/cycle  cycles/s  period mean/p99/max (us)  bus age mean/max (us)"
+					"  e2e age mean/max (ms)  bus load\n");
+		Result base {}, ring {};
+		for(int layout=0; layout<2; layout++)
+		{
+			const int* bytes = layout ? quantized : raw;
+			Result r = simulate(opt, bytes);
+			if(layout == 0)
+				base = r;
+			else
+				ring = r;
+			int total = wire_bytes(bytes[0]) + wire_bytes(bytes[1]) + wire_bytes(bytes[2]);
+			std::printf("%-10s %5d %4d %4d %12d %9.0f %8.0f %6.0f %6.0f %12.0f %8.0f %14.1f %6.1f %9.0f%%\n",
+						layout ? "int16" : "fix16",	bytes[0]+1, bytes[1]+1, bytes[2]+1, total,
+						r.cycles_per_s, r.period_mean, r.period_p99, r.period_max, r.age_mean, r.age_max,
+						r.e2e_mean/1000, r.e2e_max/1000, 100*r.bus_load);
+			for(int i=0; i<NUM_NXTS; i++)
+				if(wire_bytes(bytes[i]) > RS485_HW_BUFFER)
+					std::printf("  NXT%d frame does not fit the %d byte hardware buffer\n", i+1, RS485_HW_BUFFER);
+			if(layout == 1)
+				std::printf("\nint16 layout: %.0f%% more ring cycles per second, %.0f%% lower mean state age\n",
+							100*(r.cycles_per_s/base.cycles_per_s - 1), 100*(1 - r.age_mean/base.age_mean));
+		}
+
+		std::printf("\nTDMA: %.0f ms cycle, slots at %d/%d/%d ms, %.0f ms long, regulators within +-%.0f us\n",
+					opt.period_ms, opt.slot_ms[0], opt.slot_ms[1], opt.slot_ms[2], opt.slot_len_ms, opt.sync_us);
+		std::printf("Layout     start late p99/max (us)  overruns  skipped  bus age mean/max (us)  e2e age mean/max (ms)  bus load\n");
+		TdmaResult tdma {};
+		for(int layout=0; layout<2; layout++)
+		{
+			const int* bytes = layout ? quantized : raw;
+			TdmaResult r = simulate_tdma(opt, bytes);
+			if(layout == 1)
+				tdma = r;
+			std::printf("%-10s %12.0f %8.0f %8.2f%% %7.2f%% %12.0f %8.0f %14.1f %6.1f %9.0f%%\n",
+						layout ? "int16" : "fix16", r.late_p99, r.late_max, 100*r.overruns, 100*r.skipped,
+						r.age_mean, r.age_max, r.e2e_mean/1000, r.e2e_max/1000, 100*r.bus_load);
+		}
+		std::printf("\nint16, end to end state age: TDMA %.1f-%.1f ms, token ring %.1f-%.1f ms\n",
+					tdma.e2e_min/1000, tdma.e2e_max/1000, ring.e2e_min/1000, ring.e2e_max/1000);
+
+		const uint32_t rates[RS485_NUM_BAUDS] = RS485_BAUD_RATES;
+		std::printf("\nNegotiated rates (RS485_BAUD_RATES), int16 layout\n");
+		std::printf("Asked for  Runs at  ring cycles/s  ring period p99 (us)  TDMA airtime/cycle (us)  TDMA late+frame max (us)\n");
+		for(uint32_t rate : rates)
+		{
+			Options at = opt;
+			at.baud = usart_baud(rate);
+			Result r = simulate(at, quantized);
+			TdmaResult t = simulate_tdma(at, quantized);
+			double airtime = 0, longest = 0;
+			for(int i=0; i<NUM_NXTS; i++)
+			{
+				double frame_us = wire_bytes(quantized[i]) * 1e6 * BITS_PER_BYTE / at.baud;
+				airtime += frame_us;
+				longest = std::max(longest, frame_us);
+			}
+			std::printf("%9u %8.0f %14.0f %21.0f %24.0f %25.0f\n", rate, at.baud, r.cycles_per_s, r.period_p99, airtime, t.late_max + longest);
+		}
+
+		std::mt19937 rng(opt.seed);
+		std::printf("\nPacket Field             Shift        Step  Max error  Range (+-)\n");
+		print_quantization<Nxt1Packet>("NXT1", rng);
+		print_quantization<Nxt2Packet>("NXT2", rng);
+		print_quantization<Nxt3Packet>("NXT3", rng);
+	}
+	catch(const std::exception& e)
+	{
+		std::fprintf(stderr, "ring_sim: %s\n", e.what());
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,298 @@
+/*
+ * Rs485Replay.cpp
+ *
+ *	Replays an RS485 bus capture from NXT1 (RS485.h, saved by NXTConnection.startCapture()) through the
+ *	firmware's own update_rs485(), built for the PC (src/Sil/Rs485Sil.h). The captured bytes arrive at their
+ *	captured times, and TASK_MOTORREG starts its cycles at the captured cycle starts. Simulated time advances
+ *	in steps between records, so a capture of minutes replays in milliseconds and always gives the same result.
+ *
+ *	Prints what the capture shows (frames from each NXT, stalls, where frames land in the TDMA cycle) next to
+ *	what the replayed firmware made of it (its error counters, frames sent, rate negotiation). Use it to
+ *	reproduce a ring stall seen on the arm, and to check that a change to RS485.c still keeps up with the
+ *	same traffic.
+ *
+ *	The capture holds no firmware state, so the replay starts as NXT1 does at power on: at RS485_BAUD_RATES[0],
+ *	negotiating. A capture taken after a rate switch shows up as frames the replay keeps receiving anyway.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Daniel
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+extern "C" {
+#include "../../../RA15_Master/src/Comms/PacketSchema.h"
+}
+#include "../Sil/Rs485Sil.h"
+
+struct Options
+{
+	std::string capture_path;
+	uint32_t step_ms = 1;		// update_rs485() calls between records. TASK_BACKGROUND loops faster than this.
+	bool dump = false;
+};
+
+struct Record
+{
+	size_t offset;				// In the capture file
+	uint8_t type;
+	uint32_t t;
+	std::vector<uint8_t> data;
+};
+
+struct NxtStats					// Frames one NXT put on the bus, as captured
+{
+	uint32_t frames = 0;
+	uint32_t first_ms = 0, last_ms = 0;
+	uint32_t silence_max_ms = 0;	// Longest time between two of its frames
+	uint32_t silence_end_ms = 0;	// When that silence ended
+	int32_t slot_min_ms = 0, slot_max_ms = 0;	// Last byte of its frames after the cycle start
+};
+
+static const char* const BAUD_STATE_NAME[] = { "SETTLING", "ANNOUNCING", "PROBING", "REPORTING", "RUNNING" };
+static const uint32_t BAUD_RATES[RS485_NUM_BAUDS] = RS485_BAUD_RATES;
+
+static void usage(const char* prog)
+{
+	std::printf("Usage: %s [options] capture.bin\n"
+				"  --step-ms N      Time between update_rs485() calls when no record is due (default 1)\n"
+				"  --dump           Print every record\n", prog);
+}
+
+static Options parse_args(int argc, char** argv)
+{
+	Options opt;
+	for(int i=1; i<argc; i++)
+	{
+		std::string arg = argv[i];
+		if(arg == "-h" || arg == "--help")	{ usage(argv[0]); std::exit(0); }
+		if(arg == "--dump")				{ opt.dump = true; continue; }
+		if(arg[0] != '-')
+		{
+			if(!opt.capture_path.empty())	throw std::runtime_error("More than one capture file given");
+			opt.capture_path = arg;
+			continue;
+		}
+		if(i+1 >= argc)						throw std::runtime_error("Missing value for " + arg);
+		if(arg == "--step-ms")			opt.step_ms = (uint32_t)std::atoi(argv[++i]);
+		else							throw std::runtime_error("Unknown option " + arg);
+	}
+	if(opt.capture_path.empty())
+		throw std::runtime_error("No capture file given (see --help)");
+	if(opt.step_ms < 1)
+		throw std::runtime_error("--step-ms must be positive");
+	return opt;
+}
+
+// Splits the capture into records. A capture cut short (e.g. by a disconnect) ends at its last whole record.
+static std::vector<Record> load_capture(const std::string& path)
+{
+	std::ifstream in(path, std::ios::binary);
+	if(!in)
+		throw std::runtime_error("Cannot open " + path);
+	std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+	std::vector<Record> records;
+	size_t i = 0;
+	while(i < bytes.size())
+	{
+		if(bytes[i] == CAPTURE_PAD)
+		{
+			i++;
+			continue;
+		}
+		if(bytes[i] > CAPTURE_GAP)
+			throw std::runtime_error("Unknown record type " + std::to_string(bytes[i]) + " at byte " + std::to_string(i) + ". Not a capture, or damaged.");
+		if(i + CAPTURE_RECORD_HEADER > bytes.size() || i + CAPTURE_RECORD_HEADER + bytes[i+5] > bytes.size())
+		{
+			std::fprintf(stderr, "Warning: capture ends inside a record at byte %zu\n", i);
+			break;
+		}
+		Record r;
+		r.offset = i;
+		r.type = bytes[i];
+		r.t = (uint32_t)bytes[i+1] | (uint32_t)bytes[i+2] << 8 | (uint32_t)bytes[i+3] << 16 | (uint32_t)bytes[i+4] << 24;
+		r.data.assign(bytes.begin() + i + CAPTURE_RECORD_HEADER, bytes.begin() + i + CAPTURE_RECORD_HEADER + bytes[i+5]);
+		records.push_back(r);
+		i += CAPTURE_RECORD_HEADER + r.data.size();
+	}
+	if(records.empty() || records[0].type != CAPTURE_START)
+		throw std::runtime_error("Capture does not begin with a start record");
+	return records;
+}
+
+// Header of a captured frame, or 0 if it is not a valid frame
+static uint8_t frame_header(const std::vector<uint8_t>& wire)
+{
+	uint8_t frame[256];
+	uint32_t len = cobs_decode(wire.data(), (uint32_t)wire.size(), frame);
+	if(len < RS485_FRAME_OVERHEAD)
+		return 0;
+	if(crc16(frame, len - 2) != (uint16_t)(frame[len-2] | (frame[len-1] << 8)))
+		return 0;
+	return (frame[0] >= PACKET_NXT1_HEADER && frame[0] <= PACKET_NXT3_HEADER) ? frame[0] : 0;
+}
+
+static const char* record_name(uint8_t type)
+{
+	switch(type)
+	{
+		case CAPTURE_START:			return "START";
+		case CAPTURE_CYCLE:			return "CYCLE";
+		case CAPTURE_RX:			return "RX";
+		case CAPTURE_RX_TIMEOUT:	return "RX_TIMEOUT";
+		case CAPTURE_RX_OVERFLOW:	return "RX_OVERFLOW";
+		case CAPTURE_TX:			return "TX";
+		case CAPTURE_GAP:			return "GAP";
+	}
+	return "?";
+}
+
+
+int main(int argc, char** argv)
+{
+	try
+	{
+		Options opt = parse_args(argc, argv);
+		std::vector<Record> records = load_capture(opt.capture_path);
+
+		const uint32_t start_ms = records[0].t;
+		uint32_t now = start_ms;
+		uint32_t cycle_ms = start_ms;
+		bool cycle_seen = false;
+		NxtStats nxt[4];
+		uint32_t cycles = 0, bad_frames = 0, timeouts = 0, overflows = 0, tx_frames = 0, gaps = 0, dropped = 0;
+
+		sil_set_time(now);
+		sil_start_cycle(now);
+		auto wall_start = std::chrono::steady_clock::now();
+
+		for(const Record& r : records)
+		{
+			while((int32_t)(r.t - now) > 0)		// update_rs485() keeps running between records
+			{
+				now = ((int32_t)(r.t - now) > (int32_t)opt.step_ms) ? now + opt.step_ms : r.t;
+				sil_set_time(now);
+				sil_update();
+			}
+			if(opt.dump)
+			{
+				std::printf("%10u %-11s", r.t - start_ms, record_name(r.type));
+				for(uint8_t b : r.data)
+					std::printf(" %02X", b);
+				std::printf("\n");
+			}
+
+			// Frames start with a delimiter on the wire (RS485.c send_packet()), which the capture leaves out
+			std::vector<uint8_t> wire;
+			wire.push_back(FRAME_DELIMITER);
+			wire.insert(wire.end(), r.data.begin(), r.data.end());
+			switch(r.type)
+			{
+				case CAPTURE_CYCLE:
+					cycles++;
+					cycle_ms = r.t;
+					cycle_seen = true;
+					sil_start_cycle(r.t);
+					break;
+
+				case CAPTURE_RX:
+				{
+					uint8_t h = frame_header(r.data);
+					if(h == 0)
+						bad_frames++;
+					else
+					{
+						NxtStats& s = nxt[h];
+						if(s.frames > 0 && r.t - s.last_ms > s.silence_max_ms)
+						{
+							s.silence_max_ms = r.t - s.last_ms;
+							s.silence_end_ms = r.t - start_ms;
+						}
+						if(s.frames == 0)
+							s.first_ms = r.t;
+						s.last_ms = r.t;
+						if(cycle_seen)
+						{
+							int32_t offset = (int32_t)(r.t - cycle_ms);
+							if(s.frames == 0 || offset < s.slot_min_ms)	s.slot_min_ms = offset;
+							if(s.frames == 0 || offset > s.slot_max_ms)	s.slot_max_ms = offset;
+						}
+						s.frames++;
+					}
+					wire.push_back(FRAME_DELIMITER);
+					sil_receive(wire.data(), (uint32_t)wire.size());
+					break;
+				}
+
+				case CAPTURE_RX_TIMEOUT:			// No delimiter: the replay drops it after RS485_FRAME_TIMEOUT_MS too
+					timeouts++;
+					sil_receive(wire.data(), (uint32_t)wire.size());
+					break;
+
+				case CAPTURE_RX_OVERFLOW:			// Only the start was kept. One more byte overflows the replay's buffer.
+					overflows++;
+					wire.push_back(0x01);
+					wire.push_back(FRAME_DELIMITER);
+					sil_receive(wire.data(), (uint32_t)wire.size());
+					break;
+
+				case CAPTURE_TX:
+					tx_frames++;
+					break;
+
+				case CAPTURE_GAP:
+					gaps++;
+					dropped += (uint32_t)r.data[0] | (uint32_t)r.data[1] << 8;
+					break;
+			}
+			sil_update();
+		}
+		double wall_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - wall_start).count();
+
+		const uint32_t duration_ms = now - start_ms;
+		const double seconds = duration_ms / 1000.0;
+		const uint8_t start_baud = records[0].data.empty() ? 0 : records[0].data[0];
+		std::printf("Capture: %zu records, %.3f s, started at %u baud\n", records.size(), seconds,
+					BAUD_RATES[std::min<uint8_t>(start_baud, RS485_NUM_BAUDS-1)]);
+		std::printf("  cycles %u, NXT1 frames sent %u\n", cycles, tx_frames);
+		std::printf("  invalid frames %u, partial frames %u, overlong frames %u\n", bad_frames, timeouts, overflows);
+		if(gaps > 0)
+			std::printf("  WARNING: %u records were dropped in %u gaps (NXT1's buffer was full). The replay is incomplete.\n", dropped, gaps);
+		std::printf("\nFrom   frames  frames/s  longest silence (ms, ends at s)  last byte after cycle start (ms)\n");
+		for(uint8_t h=PACKET_NXT2_HEADER; h<=PACKET_NXT3_HEADER; h++)
+		{
+			const NxtStats& s = nxt[h];
+			std::printf("NXT%u %8u %9.1f %9u %10.3f %20d..%d\n", h, s.frames, seconds > 0 ? s.frames / seconds : 0.0,
+						s.silence_max_ms, s.silence_end_ms / 1000.0, s.slot_min_ms, s.slot_max_ms);
+		}
+
+		sil_counters c;
+		sil_get_counters(&c);
+		std::printf("\nReplayed NXT1 (update_rs485() from RA15_Master)\n");
+		std::printf("  frames sent %u (%.1f/s), %u bytes, slot overruns %u, latest slot start +%u ms\n",
+					c.update_cycles, seconds > 0 ? c.update_cycles / seconds : 0.0, c.bytes_sent, c.slot_overruns, c.slot_late_max_ms);
+		std::printf("  crc errors %u, frame errors %u, lost frames %u, receive buffer overruns %u bytes\n",
+					c.crc_errors, c.frame_errors, c.lost_frames, c.rx_dropped);
+		std::printf("  rate %u baud (%s), %u switches, %u fallbacks, fastest usable rate index < %u\n",
+					BAUD_RATES[c.baud_index], c.baud_state < 5 ? BAUD_STATE_NAME[c.baud_state] : "?",
+					c.baud_switches, c.baud_fallbacks, c.baud_ceiling);
+		std::printf("  message resends %u, no replies %u, waypoints received %u\n", c.msg_resends, c.msg_no_replies, c.waypoints);
+		std::printf("\nReplayed %.3f s of bus time in %.1f ms (%.0fx real time)\n", seconds, wall_ms,
+					wall_ms > 0 ? duration_ms / wall_ms : 0.0);
+	}
+	catch(const std::exception& e)
+	{
+		std::fprintf(stderr, "rs485_replay: %s\n", e.what());
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,370 @@
+/*
+ * ToppPlan.cpp
+ *
+ *	Time-optimal path parameterization: takes a geometric joint path and finds the fastest way to
+ *	follow it without exceeding any joint's vmax, or the acceleration its motors can deliver.
+ *	The timed trajectory is resampled into spline knots and written as a .wpt file for the
+ *	NXT trajectory buffer (see Waypoint.h).
+ *
+ *	Input is a CSV with one path point per line: q1,q2,q3,q4,q5,q6 (deg). Points only give the shape
+ *	of the path, so they can be as dense as needed (a few thousand is typical). Blank lines, lines
+ *	starting with '#' and a header line are ignored.
+ *
+ *	The path is parameterized by s = point index, and the profile is found in the phase plane x = (ds/dt)^2.
+ *	Each joint must satisfy |q' sdot| <= vmax and amin(v) <= q' sddot + q'' x <= amax(v), which bounds sddot
+ *	for a given x. The maximum velocity curve is the largest feasible x at each point. A backward pass at
+ *	maximum deceleration from rest at the end, then a forward pass at maximum acceleration from rest at the
+ *	start, gives the time-optimal profile under that curve.
+ *
+ *	Acceleration limits come from the motor model in jpmtr: pwm = f(v) + ka*a, with f the regression in b[].
+ *	Keeping |pwm| <= the pwm budget gives a = (+-budget - f(v)) / ka. Joints whose ka has not been identified
+ *	(ka == 0) use a fixed acceleration limit instead.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Daniel
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../Common/JointParameters.h"
+#include "../Common/Waypoint.h"
+
+using namespace ra15;
+
+static const double PWM_MAX = 100.0;
+static const double X_UNBOUNDED = 1e12;			// sdot^2 where no joint moves along the path
+static const double FLAT_DERIVATIVE = 1e-9;		// q' below which a joint is taken as not moving
+
+struct Options
+{
+	std::string globals_path = DEFAULT_GLOBALS_PATH;
+	std::string csv_path;
+	std::string wpt_path;
+	double pwm_budget = 80.0;		// Share of PWM_MAX the feedforward may use. The rest is left to the feedback controllers.
+	double accel = 500.0;			// deg/s^2, for joints with ka == 0
+	int knot_ms = 100;				// Time between output knots
+};
+
+using Point = std::array<double, NUM_JOINTS>;
+
+static void usage(const char* prog)
+{
+	std::printf("Usage: %s [options] path.csv trajectory.wpt\n"
+				"  --globals PATH   Globals.h to read jpmtr[] from (default %s)\n"
+				"  --pwm P          PWM the acceleration and velocity feedforward may use, 0-100 (default 80)\n"
+				"  --accel A        Acceleration limit (deg/s^2) for joints without a motor model ka (default 500)\n"
+				"  --knot-ms T      Time between knots in the output (default 100)\n", prog, DEFAULT_GLOBALS_PATH);
+}
+
+static Options parse_args(int argc, char** argv)
+{
+	Options opt;
+	std::vector<std::string> positional;
+	for(int i=1; i<argc; i++)
+	{
+		std::string arg = argv[i];
+		if(arg == "-h" || arg == "--help")	{ usage(argv[0]); std::exit(0); }
+		if(arg[0] != '-')
+		{
+			positional.push_back(arg);
+			continue;
+		}
+		if(i+1 >= argc)						throw std::runtime_error("Missing value for " + arg);
+		if(arg == "--globals")			opt.globals_path = argv[++i];
+		else if(arg == "--pwm")			opt.pwm_budget = std::atof(argv[++i]);
+		else if(arg == "--accel")		opt.accel = std::atof(argv[++i]);
+		else if(arg == "--knot-ms")		opt.knot_ms = std::atoi(argv[++i]);
+		else							throw std::runtime_error("Unknown option " + arg);
+	}
+	if(positional.size() != 2)
+		throw std::runtime_error("Expected a path CSV and an output .wpt file (see --help)");
+	opt.csv_path = positional[0];
+	opt.wpt_path = positional[1];
+	if(opt.pwm_budget <= 0 || opt.pwm_budget > PWM_MAX)
+		throw std::runtime_error("--pwm must be in (0, 100]");
+	if(opt.accel <= 0)
+		throw std::runtime_error("--accel must be positive");
+	if(opt.knot_ms < 1 || opt.knot_ms > UINT16_MAX)
+		throw std::runtime_error("--knot-ms must be between 1 and 65535");
+	return opt;
+}
+
+static std::vector<Point> load_path(const std::string& path)
+{
+	std::ifstream in(path);
+	if(!in)
+		throw std::runtime_error("Cannot open " + path);
+
+	std::vector<Point> points;
+	std::string line;
+	for(int line_no=1; std::getline(in, line); line_no++)
+	{
+		size_t first = line.find_first_not_of(" \t\r");
+		if(first == std::string::npos || line[first] == '#')
+			continue;
+		if(!std::isdigit((unsigned char)line[first]) && line[first] != '-' && line[first] != '+' && line[first] != '.')
+		{
+			if(points.empty())			// Header line
+				continue;
+			throw std::runtime_error(path + ":" + std::to_string(line_no) + ": not a number");
+		}
+
+		Point q;
+		const char* p = line.c_str();
+		for(int ji=0; ji<NUM_JOINTS; ji++)
+		{
+			char* end;
+			q[ji] = std::strtod(p, &end);
+			if(end == p)
+				throw std::runtime_error(path + ":" + std::to_string(line_no) + ": expected 6 values");
+			p = end;
+			while(*p == ' ' || *p == '\t' || *p == ',' || *p == ';') p++;
+		}
+		if(points.empty() || q != points.back())		// Repeated points add nothing to the path
+			points.push_back(q);
+	}
+	if(points.size() < 2)
+		throw std::runtime_error(path + " needs at least 2 distinct points");
+	return points;
+}
+
+
+// Joint acceleration limits (deg/s^2) at joint velocity v
+class AccelLimits
+{
+public:
+	AccelLimits(const JointParameters& params, const Options& opt) : params(params), opt(opt) {}
+
+	void at(int ji, double v, double& lo, double& hi) const
+	{
+		const JointParameter& jp = params[ji];
+		if(jp.ka <= 0)
+		{
+			lo = -opt.accel;
+			hi = opt.accel;
+			return;
+		}
+		double f = jp.b[0] + jp.b[1]*v + jp.b[3]*v*v;		// x2 taken as 0
+		lo = (-opt.pwm_budget - f) / jp.ka;
+		hi = ( opt.pwm_budget - f) / jp.ka;
+	}
+
+private:
+	const JointParameters& params;
+	const Options& opt;
+};
+
+
+// Path derivatives with respect to s (the point index), by finite differences
+struct PathDerivatives
+{
+	std::vector<Point> d1, d2;
+};
+
+static PathDerivatives differentiate(const std::vector<Point>& q)
+{
+	const size_t n = q.size();
+	PathDerivatives d;
+	d.d1.resize(n);
+	d.d2.resize(n);
+	for(size_t k=0; k<n; k++)
+	{
+		size_t a = (k == 0) ? 0 : k-1;
+		size_t b = (k == n-1) ? n-1 : k+1;
+		size_t c = std::min(std::max(k, (size_t)1), n-2);		// Centre of the second difference. Ends reuse their neighbour's.
+		for(int ji=0; ji<NUM_JOINTS; ji++)
+		{
+			d.d1[k][ji] = (q[b][ji] - q[a][ji]) / (double)(b - a);
+			d.d2[k][ji] = (n < 3) ? 0.0 : q[c+1][ji] - 2*q[c][ji] + q[c-1][ji];
+		}
+	}
+	return d;
+}
+
+// Range [lo, hi] of sddot allowed at path point k with x = sdot^2. Returns false if no sddot satisfies every joint.
+static bool sddot_range(const PathDerivatives& d, const AccelLimits& limits, size_t k, double x, double& lo, double& hi)
+{
+	lo = -std::numeric_limits<double>::infinity();
+	hi = std::numeric_limits<double>::infinity();
+	double sdot = std::sqrt(x);
+	for(int ji=0; ji<NUM_JOINTS; ji++)
+	{
+		double q1 = d.d1[k][ji], q2 = d.d2[k][ji];
+		double amin, amax;
+		limits.at(ji, q1*sdot, amin, amax);
+		double centripetal = q2*x;
+		if(std::fabs(q1) < FLAT_DERIVATIVE)
+		{
+			if(centripetal < amin || centripetal > amax)
+				return false;
+			continue;
+		}
+		double a = (amin - centripetal) / q1, b = (amax - centripetal) / q1;
+		if(a > b) std::swap(a, b);
+		lo = std::max(lo, a);
+		hi = std::min(hi, b);
+	}
+	return lo <= hi;
+}
+
+// Largest sdot^2 at point k allowed by vmax and by the acceleration limits
+static double max_velocity_curve(const PathDerivatives& d, const AccelLimits& limits, const JointParameters& params, size_t k)
+{
+	double x_max = X_UNBOUNDED;
+	for(int ji=0; ji<NUM_JOINTS; ji++)
+	{
+		double q1 = std::fabs(d.d1[k][ji]);
+		if(q1 >= FLAT_DERIVATIVE)
+			x_max = std::min(x_max, (params[ji].vmax/q1) * (params[ji].vmax/q1));
+	}
+
+	double lo, hi;
+	if(sddot_range(d, limits, k, x_max, lo, hi))
+		return x_max;
+	if(!sddot_range(d, limits, k, 0.0, lo, hi))
+		throw std::runtime_error("Path point " + std::to_string(k+1) + ": the motor model cannot hold this pose within the pwm budget");
+
+	double feasible = 0.0, infeasible = x_max;		// Bisect for the edge of the feasible region
+	for(int i=0; i<60 && infeasible - feasible > 1e-9*infeasible; i++)
+	{
+		double mid = 0.5*(feasible + infeasible);
+		if(sddot_range(d, limits, k, mid, lo, hi))	feasible = mid;
+		else										infeasible = mid;
+	}
+	return feasible;
+}
+
+// sdot^2 at every path point, for the time-optimal profile starting and ending at rest
+static std::vector<double> optimal_profile(const PathDerivatives& d, const AccelLimits& limits, const JointParameters& params)
+{
+	const size_t n = d.d1.size();
+	std::vector<double> mvc(n), x(n);
+	for(size_t k=0; k<n; k++)
+		mvc[k] = max_velocity_curve(d, limits, params, k);
+
+	double lo, hi;
+	x[n-1] = 0.0;					// Backward pass: latest point at which braking must start
+	for(size_t k=n-1; k>0; k--)
+	{
+		if(!sddot_range(d, limits, k, x[k], lo, hi))
+			lo = 0.0;
+		x[k-1] = std::min(mvc[k-1], std::max(0.0, x[k] - 2.0*lo));
+	}
+
+	x[0] = 0.0;						// Forward pass: accelerate as hard as possible below the braking curve
+	for(size_t k=0; k+1<n; k++)
+	{
+		if(!sddot_range(d, limits, k, x[k], lo, hi))
+			hi = 0.0;
+		x[k+1] = std::min(x[k+1], std::max(0.0, x[k] + 2.0*hi));
+	}
+	return x;
+}
+
+// Time (s) at which each path point is reached. sddot is constant between points.
+static std::vector<double> point_times(const std::vector<double>& x)
+{
+	std::vector<double> t(x.size(), 0.0);
+	for(size_t k=0; k+1<x.size(); k++)
+	{
+		double sum = std::sqrt(x[k]) + std::sqrt(x[k+1]);
+		if(sum <= 0)
+			throw std::runtime_error("Path stalls at point " + std::to_string(k+1) + ": the limits allow no motion there");
+		t[k+1] = t[k] + 2.0/sum;
+	}
+	return t;
+}
+
+// Joint positions at time time_s along the profile
+static Point sample(const std::vector<Point>& q, const std::vector<double>& x, const std::vector<double>& t, double time_s)
+{
+	size_t k = std::upper_bound(t.begin(), t.end(), time_s) - t.begin();
+	if(k >= t.size())
+		return q.back();
+	k = (k == 0) ? 0 : k-1;
+
+	double tau = time_s - t[k];
+	double sdd = 0.5*(x[k+1] - x[k]);
+	double u = std::min(1.0, std::sqrt(x[k])*tau + 0.5*sdd*tau*tau);		// Fraction of the way to point k+1
+	Point p;
+	for(int ji=0; ji<NUM_JOINTS; ji++)
+		p[ji] = q[k][ji] + u*(q[k+1][ji] - q[k][ji]);
+	return p;
+}
+
+
+int main(int argc, char** argv)
+{
+	try
+	{
+		Options opt = parse_args(argc, argv);
+		JointParameters params = load_joint_parameters(opt.globals_path);
+		std::vector<Point> path = load_path(opt.csv_path);
+
+		for(size_t k=0; k<path.size(); k++)
+			for(int ji=0; ji<NUM_JOINTS; ji++)
+				if(path[k][ji] < params[ji].pmin || path[k][ji] > params[ji].pmax)
+				{
+					std::fprintf(stderr, "Warning: point %zu: J%d = %.2f is outside [%.2f, %.2f] and will be clamped on the NXT\n",
+								 k+1, ji+1, path[k][ji], params[ji].pmin, params[ji].pmax);
+					k = path.size()-1;		// Only the first one
+					break;
+				}
+
+		auto start = std::chrono::steady_clock::now();
+		AccelLimits limits(params, opt);
+		PathDerivatives d = differentiate(path);
+		std::vector<double> x = optimal_profile(d, limits, params);
+		std::vector<double> t = point_times(x);
+		double duration = t.back();
+
+		// Resample into knots every knot_ms. The last knot lands exactly on the end of the path.
+		std::vector<Waypoint> knots;
+		int elapsed_ms = 0;
+		int total_ms = std::max(1, (int)std::ceil(duration*1000.0));
+		while(elapsed_ms < total_ms)
+		{
+			int dt = std::min(opt.knot_ms, total_ms - elapsed_ms);
+			if(total_ms - elapsed_ms - dt > 0 && total_ms - elapsed_ms - dt < opt.knot_ms/2)
+				dt = total_ms - elapsed_ms;			// Merge a short final segment into this one
+			elapsed_ms += dt;
+			Waypoint w;
+			w.dt_ms = (uint16_t)dt;
+			Point p = sample(path, x, t, elapsed_ms/1000.0);
+			std::copy(p.begin(), p.end(), w.p);
+			knots.push_back(w);
+		}
+		double plan_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+		write_waypoint_file(opt.wpt_path, knots);
+
+		// Peak joint speed along the profile, as a check against vmax
+		std::printf("%zu path points, planned in %.1f ms\n", path.size(), plan_ms);
+		std::printf("Duration %.3f s, %zu knots (%zu bytes) written to %s\n", duration, knots.size(), knots.size()*WAYPOINT_BYTES, opt.wpt_path.c_str());
+		std::printf("Joint  peak speed  vmax (deg/s)\n");
+		for(int ji=0; ji<NUM_JOINTS; ji++)
+		{
+			double peak = 0;
+			for(size_t k=0; k<path.size(); k++)
+				peak = std::max(peak, std::fabs(d.d1[k][ji])*std::sqrt(x[k]));
+			std::printf("J%d     %8.2f  %8.2f\n", ji+1, peak, params[ji].vmax);
+		}
+		std::printf("Move the arm to the first path point before sending the knots.\n");
+	}
+	catch(const std::exception& e)
+	{
+		std::fprintf(stderr, "topp_plan: %s\n", e.what());
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,2 @@
+echo Executing appflash to upload RA15_rom.bin...
+ ../../ecrobot/../bin/appflash.exe ./RA15_rom.bin
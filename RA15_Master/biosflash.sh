@@ -0,0 +1,2 @@
+echo Executing NeXTTool to upload ../../ecrobot/../ecrobot/bios/nxt_bios_rom.rfw...
+ /nxtOSEK2.18/NeXTTool.exe /COM=usb -firmware=../../ecrobot/../ecrobot/bios/nxt_bios_rom.rfw
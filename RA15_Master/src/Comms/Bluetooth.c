@@ -35,121 +35,150 @@ static BOOL promote_targets_to_global_state()
 	return success;
 }
 
-// PACKET DEFINITIONS
-
-struct pointer_size_pair { uint8_t* val; size_t size;	};
-
-
-#define NXT1_BT_VAL0	systick_ms	//4
-#define NXT1_BT_VAL1	j[0].p
-#define NXT1_BT_VAL2	j[0].v
-#define NXT1_BT_VAL3	j[0].pwm	//13
-#define NXT1_BT_VAL4	j[1].p
-#define NXT1_BT_VAL5	j[1].v
-#define NXT1_BT_VAL6	j[1].pwm	//22
-#define NXT1_BT_VAL7	j[2].p
-#define NXT1_BT_VAL8	j[2].v
-#define NXT1_BT_VAL9	j[2].pwm	//31
-#define NXT1_BT_VAL10	j[3].p
-#define NXT1_BT_VAL11	j[3].v
-#define NXT1_BT_VAL12	j[3].pwm	//40
-#define NXT1_BT_VAL13	j[4].p
-#define NXT1_BT_VAL14	j[4].v
-#define NXT1_BT_VAL15	j[4].pwm	//49
-#define NXT1_BT_VAL16	j[5].p
-#define NXT1_BT_VAL17	j[5].v
-#define NXT1_BT_VAL18	j[5].pwm	//58
-#define NXT1_BT_VAL19	tmux		//59
-#define NXT1_BT_VAL20	ea1
-#define NXT1_BT_VAL21	ea2
-#define NXT1_BT_VAL22	ea3			//62
-#define NXT1_BT_VALS  23
-#define NXT1_BT_BYTES (sizeof(NXT1_BT_VAL0)+sizeof(NXT1_BT_VAL1)+sizeof(NXT1_BT_VAL2)+sizeof(NXT1_BT_VAL3)+sizeof(NXT1_BT_VAL4)+sizeof(NXT1_BT_VAL5)+sizeof(NXT1_BT_VAL6)+sizeof(NXT1_BT_VAL7)+sizeof(NXT1_BT_VAL8)+sizeof(NXT1_BT_VAL9)+sizeof(NXT1_BT_VAL10)+sizeof(NXT1_BT_VAL11)+sizeof(NXT1_BT_VAL12)+sizeof(NXT1_BT_VAL13)+sizeof(NXT1_BT_VAL14)+sizeof(NXT1_BT_VAL15)+sizeof(NXT1_BT_VAL16)+sizeof(NXT1_BT_VAL17)+sizeof(NXT1_BT_VAL18)+sizeof(NXT1_BT_VAL19)+sizeof(NXT1_BT_VAL20)+sizeof(NXT1_BT_VAL21)+sizeof(NXT1_BT_VAL22))
-static const struct pointer_size_pair packet_definition_nxt1[NXT1_BT_VALS] = {
-	{ .val=(uint8_t*)&( NXT1_BT_VAL0  ),	.size=sizeof( NXT1_BT_VAL0	)	},
-	{ .val=(uint8_t*)&( NXT1_BT_VAL1  ),	.size=sizeof( NXT1_BT_VAL1	)	},
-	{ .val=(uint8_t*)&( NXT1_BT_VAL2  ),	.size=sizeof( NXT1_BT_VAL2	)	},
-	{ .val=(uint8_t*)&( NXT1_BT_VAL3  ),	.size=sizeof( NXT1_BT_VAL3	)	},
-	{ .val=(uint8_t*)&( NXT1_BT_VAL4  ),	.size=sizeof( NXT1_BT_VAL4	)	},
-	{ .val=(uint8_t*)&( NXT1_BT_VAL5  ),	.size=sizeof( NXT1_BT_VAL5	)	},
-	{ .val=(uint8_t*)&( NXT1_BT_VAL6  ),	.size=sizeof( NXT1_BT_VAL6	)	},
-	{ .val=(uint8_t*)&( NXT1_BT_VAL7  ),	.size=sizeof( NXT1_BT_VAL7	)	},
-	{ .val=(uint8_t*)&( NXT1_BT_VAL8  ),	.size=sizeof( NXT1_BT_VAL8	)	},
-	{ .val=(uint8_t*)&( NXT1_BT_VAL9  ),	.size=sizeof( NXT1_BT_VAL9	)	},
-	{ .val=(uint8_t*)&( NXT1_BT_VAL10 ),	.size=sizeof( NXT1_BT_VAL10	)	},
-	{ .val=(uint8_t*)&( NXT1_BT_VAL11 ),	.size=sizeof( NXT1_BT_VAL11	)	},
-	{ .val=(uint8_t*)&( NXT1_BT_VAL12 ),	.size=sizeof( NXT1_BT_VAL12	)	},
-	{ .val=(uint8_t*)&( NXT1_BT_VAL13 ),	.size=sizeof( NXT1_BT_VAL13	)	},
-	{ .val=(uint8_t*)&( NXT1_BT_VAL14 ),	.size=sizeof( NXT1_BT_VAL14	)	},
-	{ .val=(uint8_t*)&( NXT1_BT_VAL15 ),	.size=sizeof( NXT1_BT_VAL15	)	},
-	{ .val=(uint8_t*)&( NXT1_BT_VAL16 ),	.size=sizeof( NXT1_BT_VAL16	)	},
-	{ .val=(uint8_t*)&( NXT1_BT_VAL17 ),	.size=sizeof( NXT1_BT_VAL17	)	},
-	{ .val=(uint8_t*)&( NXT1_BT_VAL18 ),	.size=sizeof( NXT1_BT_VAL18	)	},
-	{ .val=(uint8_t*)&( NXT1_BT_VAL19 ),	.size=sizeof( NXT1_BT_VAL19	)	},
-	{ .val=(uint8_t*)&( NXT1_BT_VAL20 ),	.size=sizeof( NXT1_BT_VAL20	)	},
-	{ .val=(uint8_t*)&( NXT1_BT_VAL21 ),	.size=sizeof( NXT1_BT_VAL21	)	},
-	{ .val=(uint8_t*)&( NXT1_BT_VAL22 ),	.size=sizeof( NXT1_BT_VAL22	)	}
-};
-
-
-#define PC_BT_VAL0		jtgt[0].pt
-#define PC_BT_VAL1		jtgt[0].vt			//8
-#define PC_BT_VAL2		jtgt[1].pt
-#define PC_BT_VAL3		jtgt[1].vt			//16
-#define PC_BT_VAL4		jtgt[2].pt
-#define PC_BT_VAL5		jtgt[2].vt			//24
-#define PC_BT_VAL6		jtgt[3].pt
-#define PC_BT_VAL7		jtgt[3].vt			//32
-#define PC_BT_VAL8		jtgt[4].pt
-#define PC_BT_VAL9		jtgt[4].vt			//40
-#define PC_BT_VAL10		jtgt[5].pt
-#define PC_BT_VAL11		jtgt[5].vt			//48
-#define PC_BT_VAL12		rcx					//49
-#define PC_BT_VAL13		nxt_bt_tx_interval		//51
-#define PC_BT_VALS    14
-#define PC_BT_BYTES (sizeof(PC_BT_VAL0)+sizeof(PC_BT_VAL1)+sizeof(PC_BT_VAL2)+sizeof(PC_BT_VAL3)+sizeof(PC_BT_VAL4)+sizeof(PC_BT_VAL5)+sizeof(PC_BT_VAL6)+sizeof(PC_BT_VAL7)+sizeof(PC_BT_VAL8)+sizeof(PC_BT_VAL9)+sizeof(PC_BT_VAL10)+sizeof(PC_BT_VAL11)+sizeof(PC_BT_VAL12)+sizeof(PC_BT_VAL13))
-static const struct pointer_size_pair packet_definition_pc[PC_BT_VALS] = {
-	{ .val=(uint8_t*)&( PC_BT_VAL0	),	.size=sizeof( PC_BT_VAL0	)	},
-	{ .val=(uint8_t*)&( PC_BT_VAL1	),	.size=sizeof( PC_BT_VAL1	)	},
-	{ .val=(uint8_t*)&( PC_BT_VAL2	),	.size=sizeof( PC_BT_VAL2	)	},
-	{ .val=(uint8_t*)&( PC_BT_VAL3	),	.size=sizeof( PC_BT_VAL3	)	},
-	{ .val=(uint8_t*)&( PC_BT_VAL4	),	.size=sizeof( PC_BT_VAL4	)	},
-	{ .val=(uint8_t*)&( PC_BT_VAL5	),	.size=sizeof( PC_BT_VAL5	)	},
-	{ .val=(uint8_t*)&( PC_BT_VAL6	),	.size=sizeof( PC_BT_VAL6	)	},
-	{ .val=(uint8_t*)&( PC_BT_VAL7	),	.size=sizeof( PC_BT_VAL7	)	},
-	{ .val=(uint8_t*)&( PC_BT_VAL8	),	.size=sizeof( PC_BT_VAL8	)	},
-	{ .val=(uint8_t*)&( PC_BT_VAL9	),	.size=sizeof( PC_BT_VAL9	)	},
-	{ .val=(uint8_t*)&( PC_BT_VAL10	),	.size=sizeof( PC_BT_VAL10	)	},
-	{ .val=(uint8_t*)&( PC_BT_VAL11	),	.size=sizeof( PC_BT_VAL11	)	},
-	{ .val=(uint8_t*)&( PC_BT_VAL12	),	.size=sizeof( PC_BT_VAL12	)	},
-	{ .val=(uint8_t*)&( PC_BT_VAL13	),	.size=sizeof( PC_BT_VAL13	)	}
-};
+static struct waypoint wpt;				// Last waypoint received from the PC
+static uint8_t queued_waypoints;		// Waypoint ring (Trajectory.h), reported to the PC for flow control
+static uint8_t free_waypoints;
+static uint16_t traj_underruns_bt;
+static uint8_t compress_samples = 0;	// Set by the PC: delta code the TASK_MOTORREG samples (TELEMETRY_Z_BT)
+static uint32_t pc_stamp;				// PC's stamp of the last PC_BT or CLOCK_BT, returned in the next NXT1_BT
+static struct { uint32_t stamp, rx_ms, tx_ms; } echo;	// ... with when it was read, and when that NXT1_BT was encoded
+static struct { uint8_t decimation; uint8_t count; } subscribe;			// Last subscription request (Telemetry.h)
+static struct { uint8_t layout, decimation, total, first, record_bytes; } schema;	// Description being sent
+static struct { uint8_t layout; uint16_t seq; uint8_t count; } sub_frame;		// Subscribed records being sent
+static struct { uint8_t op, joint, param; fix16_t value; uint16_t version; } param_req;	// Parameter request (Parameters.h)
+static struct { uint8_t op, joint, param; fix16_t value; uint8_t result; uint16_t version; } param_reply;	// ... and its answer
+
+// PACKET DEFINITIONS (see PacketSchema.h)
+
+#define NXT1_BT_BYTES		PACKET_BYTES(NXT1_BT_FIELDS)
+#define PC_BT_BYTES			PACKET_BYTES(PC_BT_FIELDS)
+#define CLOCK_BT_BYTES		PACKET_BYTES(CLOCK_BT_FIELDS)
+#define WAYPOINT_BT_BYTES	PACKET_BYTES(WAYPOINT_BT_FIELDS)
+#define CAPTURE_CMD_BT_BYTES	PACKET_BYTES(CAPTURE_CMD_BT_FIELDS)
+#define TELEMETRY_FRAME_BYTES	PACKET_BYTES(TELEMETRY_FRAME_FIELDS)
+#define TELEMETRY_SAMPLE_BYTES	PACKET_BYTES(TELEMETRY_SAMPLE_FIELDS)
+#define TELEMETRY_DELTA_BYTES	PACKET_DELTA_BYTES(TELEMETRY_SAMPLE_FIELDS)
+#define SUBSCRIBE_HEADER_BYTES	PACKET_BYTES(SUBSCRIBE_BT_FIELDS)
+#define SCHEMA_HEADER_BYTES		PACKET_BYTES(TELEMETRY_SCHEMA_FIELDS)
+#define SUB_HEADER_BYTES		PACKET_BYTES(TELEMETRY_SUB_FIELDS)
+#define PARAM_BT_BYTES			PACKET_BYTES(PARAM_BT_FIELDS)
+#define PARAM_REPLY_BT_BYTES	PACKET_BYTES(PARAM_REPLY_BT_FIELDS)
+#define MAX_BYTES(a, b)		(((a) > (b)) ? (a) : (b))
+#define PC_BT_MAX_BYTES		MAX_BYTES(MAX_BYTES(MAX_BYTES(PC_BT_BYTES, WAYPOINT_BT_BYTES), WAYPOINT_BATCH_BT_BYTES), SUBSCRIBE_BT_BYTES)
+
+DEFINE_PACKET_CODEC(nxt1_bt, NXT1_BT_FIELDS)
+DEFINE_PACKET_CODEC(pc_bt, PC_BT_FIELDS)
+DEFINE_PACKET_CODEC(clock_bt, CLOCK_BT_FIELDS)
+DEFINE_PACKET_CODEC(waypoint_bt, WAYPOINT_BT_FIELDS)
+DEFINE_PACKET_CODEC(subscribe_bt, SUBSCRIBE_BT_FIELDS)
+DEFINE_PACKET_CODEC(telemetry_schema, TELEMETRY_SCHEMA_FIELDS)
+DEFINE_PACKET_CODEC(telemetry_sub, TELEMETRY_SUB_FIELDS)
+DEFINE_PACKET_CODEC(param_bt, PARAM_BT_FIELDS)
+DEFINE_PACKET_CODEC(param_reply_bt, PARAM_REPLY_BT_FIELDS)
+#if RS485_CAPTURE
+	DEFINE_PACKET_CODEC(capture_cmd_bt, CAPTURE_CMD_BT_FIELDS)
+#endif
 
 
 // PUBLIC VARIABLES
 uint32_t bt_packets_sent = 0;
 uint32_t bt_packets_received = 0;
 uint32_t bt_incomplete_sent = 0;
+uint32_t bt_rx_resync_bytes = 0;
 uint16_t nxt_bt_tx_interval = 0;
+uint16_t bt_tx_interval = 0;
+uint16_t bt_tx_rate = 0;
+uint32_t bt_samples_dropped = 0;
+uint16_t bt_sample_encode_max_us = 0;
 static const uint16_t BT_DEFAULT_TX_INTERVAL = 100;
 static const uint16_t BT_TX_TIMEOUT_DELAY = 5000;
 
 // PRIVATE FUNCTIONS
 static void flush_buffer(void);
+static BOOL send_bt(uint8_t* packet, uint32_t bytes);
 static uint32_t send_packet(void);
-static uint32_t read_packet(void);
+static void send_samples(void);
+static void send_schema(void);
+static void send_subscribed(void);
+static void send_param_replies(void);
+static void receive_packets(void);
 
 static enum bt_state{
 	BT_READY,
 	BT_STREAMING
 } state;
 
+enum bt_event{
+	BT_EV_NONE,
+	BT_EV_CONNECTED,		// The PC opened the link
+	BT_EV_LINK_LOST,		// ... or the link dropped
+	BT_EV_PC_DISCONNECT,	// The PC asked to disconnect (nxtTransmitInterval 0)
+	BT_EV_TX_TIMEOUT		// Nothing could be sent for BT_TX_TIMEOUT_DELAY
+};
+
 // PRIVATE VARIABLES
-static uint32_t bytes_remaining = 0;
-static uint8_t packet_pc[PC_BT_BYTES];
+static uint8_t packet_pc[PC_BT_MAX_BYTES];
+
+// Bytes from the PC, as they arrive, until they make up a packet: [payload length, 16 bit LE][payload], the
+// header ecrobot_send_bt_packet() and the PC's side use. uint8_t indices wrap at BT_RX_RING (256).
+static uint8_t rx_ring[BT_RX_RING];
+static uint8_t rx_head = 0;
+static uint8_t rx_tail = 0;
 static uint8_t packet_nxt1[NXT1_BT_BYTES];
 static uint32_t last_send_time = 0;
 
+// Rate control (see BT_RATE_WINDOW_MS), measured over the current window
+static struct { uint32_t start_ms, bytes, dropped; uint8_t backlog_max; } rate_window;
+
+// Every TASK_MOTORREG cycle's joint states, encoded by record_bt_sample() (TASK_MOTORREG) and sent by send_samples()
+// (background task). Each index is written by only one side, so no resource is needed.
+static struct sample_record{
+	uint16_t seq;
+	uint8_t bytes[TELEMETRY_SAMPLE_BYTES];
+} sample_ring[BT_SAMPLE_RING];
+static volatile uint8_t sample_head = 0;	// Written by record_bt_sample() only
+static volatile uint8_t sample_tail = 0;	// Written by send_samples() only
+static uint16_t sample_seq = 0;				// Number of the next sample, dropped or not
+static uint32_t sample_ms;					// Encoded with the sample, see TELEMETRY_SAMPLE_FIELDS
+static struct { uint16_t seq; uint8_t count; } frame;
+static const uint8_t sample_field_bytes[] = { TELEMETRY_SAMPLE_FIELDS(PACKET_FIELD_WIRE_BYTES) };
+
+// Sample packets are built a sample at a time, as they are recorded
+static uint8_t packet_samples[MAX_BYTES(TELEMETRY_BT_BYTES, TELEMETRY_Z_BT_BYTES)];
+static uint8_t frame_bytes = TELEMETRY_BT_BYTES;	// Length of the packet being built: TELEMETRY_BT_BYTES or TELEMETRY_Z_BT_BYTES
+static uint8_t frame_used = TELEMETRY_FRAME_BYTES;	// ... and how much of it is filled
+static uint8_t frame_prev[TELEMETRY_SAMPLE_BYTES];	// Last sample added, which the next one is delta coded from
+static uint32_t frame_us = 0;						// Time spent building it so far
+static uint32_t frame_started_ms;					// ... and when its first sample was added
+static BOOL samples_pending = FALSE;		// packet_samples is filled, and waits for the link
+static uint32_t sample_raw_bytes = 0;		// Samples sent, at TELEMETRY_SAMPLE_BYTES each, since the PC last switched compressSamples
+static uint32_t sample_packet_bytes = 0;	// ... and the packets they took
+
+DEFINE_PACKET_CODEC(telemetry_frame, TELEMETRY_FRAME_FIELDS)
+DEFINE_PACKET_CODEC(telemetry_sample, TELEMETRY_SAMPLE_FIELDS)
+
+// Subscriptions (Telemetry.h). The PC's request is answered with its description, a packet at a time.
+static uint8_t schema_ids[TELEMETRY_SUB_MAX];	// Signals described, unless schema.layout is 0: then the whole registry
+static BOOL schema_requested = FALSE;			// Entries from schema.first on are still to be sent
+static BOOL schema_ready = FALSE;				// packet_schema holds them, and waits for the link
+static uint8_t packet_schema[TELEMETRY_SCHEMA_BT_BYTES];
+static uint8_t packet_sub[TELEMETRY_SUB_BT_BYTES];
+static uint8_t sub_used = SUB_HEADER_BYTES;		// Bytes of packet_sub filled
+static uint32_t sub_started_ms = 0;				// When its first record was added
+static BOOL sub_pending = FALSE;				// packet_sub is filled, and waits for the link
+
+// Parameter replies, sent in the order the requests came
+static uint8_t param_replies[BT_PARAM_REPLIES][PARAM_REPLY_BT_BYTES];
+static uint8_t param_reply_head = 0;
+static uint8_t param_reply_tail = 0;
+static BOOL commit_reply_due = FALSE;			// A commit was answered PARAM_PENDING, and its outcome is still to be sent
+static uint16_t commit_version_bt;
+
+#if RS485_CAPTURE
+	static uint8_t packet_capture[CAPTURE_BT_BYTES];
+	static BOOL capture_pending = FALSE;	// packet_capture is filled, and waits for the link
+#endif
+
 // FUNCTION DEFINITIONS
 
 void init_bt(void)
@@ -161,6 +190,11 @@ void init_bt(void)
 void term_bt(void)
 {
 	last_send_time = 0;
+	#if RS485_CAPTURE
+		rs485_capture = 0;
+		capture_pending = FALSE;
+	#endif
+	subscribe_telemetry(NULL, 0, 0);	// Stops TASK_MOTORREG recording for a PC that is gone
 	release_control(source);
 	flush_buffer();
 	ecrobot_term_bt_connection();
@@ -183,7 +217,7 @@ void disp_bt_rx(int starty)
 	char byte_str[3]; byte_str[2] = '\0';
 	int pos_x = 0, pos_y = starty;
 
-	for(int i=0; i<PC_BT_BYTES; i++)
+	for(size_t i=0; i<PC_BT_BYTES; i++)
 	{
 		if (pos_x >= 16)	//Max number of characters in a line is 16 (enough space for 8 bytes in hex)
 		{
@@ -199,116 +233,554 @@ void disp_bt_rx(int starty)
 
 static void flush_buffer(void)
 {
-	uint8_t temp;
-	while(ecrobot_read_bt_packet(&temp, 1) != 0);
-	bytes_remaining = 0;
+	while(ecrobot_read_bt(rx_ring, 0, BT_RX_RING) != 0);
+	rx_head = rx_tail = 0;
+}
+
+static BOOL send_bt(uint8_t* packet, uint32_t bytes)	// Sends packet unless the link is still transmitting the previous one
+{
+	if(ecrobot_send_bt_packet(packet, bytes) == bytes)		// 0 while the link is busy
+	{
+		rate_window.bytes += bytes;
+		return TRUE;
+	}
+	bt_incomplete_sent++;
+	return FALSE;
+}
+
+static void start_rate_window(uint32_t now)
+{
+	rate_window.start_ms = now;
+	rate_window.bytes = 0;
+	rate_window.dropped = bt_samples_dropped;
+	rate_window.backlog_max = 0;
+}
+
+static void update_rate(uint32_t now)	// Adapts bt_tx_interval to the last window
+{
+	uint32_t window_ms = elapsed_ticks_between(rate_window.start_ms, now);
+	if(window_ms < BT_RATE_WINDOW_MS)
+		return;
+
+	uint32_t rate = rate_window.bytes * 1000 / window_ms;
+	bt_tx_rate = (rate > UINT16_MAX) ? UINT16_MAX : (uint16_t)rate;
+
+	uint32_t interval = bt_tx_interval;
+	if(bt_samples_dropped != rate_window.dropped || rate_window.backlog_max > BT_BACKLOG_HIGH)	// The link fell behind
+		interval = (2*interval < BT_TX_INTERVAL_MAX) ? 2*interval : BT_TX_INTERVAL_MAX;
+	else if(rate_window.backlog_max <= BT_BACKLOG_LOW)		// It kept up with room to spare
+		interval = (interval > BT_TX_INTERVAL_STEP) ? interval - BT_TX_INTERVAL_STEP : 0;
+	bt_tx_interval = (uint16_t)((interval > nxt_bt_tx_interval) ? interval : nxt_bt_tx_interval);	// Never faster than the PC asked
+	start_rate_window(now);
 }
 
 static uint32_t send_packet(void)
 {
 	get_targets_from_global_state();	// Read global targets into local variables, in case any targets are about to be transmitted.
+	queued_waypoints = get_queued_waypoints();
+	free_waypoints = get_free_waypoints();
+	traj_underruns_bt = (uint16_t)traj_underruns;
+	echo.tx_ms = systick_get_ms();
+
+	encode_nxt1_bt(packet_nxt1);
 
-	uint8_t offset = 0;
-	for(int i=0; i<NXT1_BT_VALS; i++)
+	if(!send_bt(packet_nxt1, NXT1_BT_BYTES))	// The previous packet is still transmitting
+		return 0;
+
+	bt_packets_sent++;
+	echo.stamp = 0;						// Echoed once
+	return NXT1_BT_BYTES;
+}
+
+void record_bt_sample(uint32_t now)
+{
+	if(state != BT_STREAMING)
+		return;
+
+	uint16_t seq = sample_seq++;
+	uint8_t next = (sample_head+1) % BT_SAMPLE_RING;
+	if(next == sample_tail)		// The link has fallen behind. The PC sees the gap in seq.
 	{
-		uint8_t* val = packet_definition_nxt1[i].val;
-		size_t size = packet_definition_nxt1[i].size;
-		memcpy(packet_nxt1+offset, val, size);
-		offset+=size;
+		bt_samples_dropped++;
+		return;
 	}
+	sample_ms = now;
+	sample_ring[sample_head].seq = seq;
+	encode_telemetry_sample(sample_ring[sample_head].bytes);
+	sample_head = next;
+}
 
-	uint32_t bytes_sent = ecrobot_send_bt_packet(packet_nxt1, NXT1_BT_BYTES);	// Returns 0 if can't send a new packet right now (previous packet still transmitting)
+static BOOL add_sample(const struct sample_record* s)	// Appends s to the packet being built. Returns FALSE if it does not fit.
+{
+	if(frame.count == 0)					// Every packet starts with a whole sample, so that it decodes on its own
+	{
+		uint8_t bytes = compress_samples ? TELEMETRY_Z_BT_BYTES : TELEMETRY_BT_BYTES;
+		if(bytes != frame_bytes)			// The PC switched: measure the new encoding from scratch
+		{
+			sample_raw_bytes = 0;
+			sample_packet_bytes = 0;
+			bt_sample_encode_max_us = 0;
+			frame_bytes = bytes;
+		}
+		frame.seq = s->seq;
+		frame_started_ms = systick_get_ms();
+		memcpy(packet_samples + frame_used, s->bytes, TELEMETRY_SAMPLE_BYTES);
+		frame_used += TELEMETRY_SAMPLE_BYTES;
+	}
+	else if(frame_bytes == TELEMETRY_BT_BYTES)
+	{
+		memcpy(packet_samples + frame_used, s->bytes, TELEMETRY_SAMPLE_BYTES);
+		frame_used += TELEMETRY_SAMPLE_BYTES;
+	}
+	else
+	{
+		uint8_t delta[TELEMETRY_DELTA_BYTES];
+		uint8_t len = 0, offset = 0;
+		for(int f=0; f<(int)sizeof(sample_field_bytes); f++)
+		{
+			len += packet_put_delta(delta + len, s->bytes + offset, frame_prev + offset, sample_field_bytes[f]);
+			offset += sample_field_bytes[f];
+		}
+		if(frame_used + len > frame_bytes)
+			return FALSE;
+		memcpy(packet_samples + frame_used, delta, len);
+		frame_used += len;
+	}
+	memcpy(frame_prev, s->bytes, TELEMETRY_SAMPLE_BYTES);
+	frame.count++;
+	return TRUE;
+}
 
-	if(bytes_sent == NXT1_BT_BYTES)		// Check if successful.
-		bt_packets_sent++;
+static void finish_frame(void)
+{
+	encode_telemetry_frame(packet_samples);
+	memset(packet_samples + frame_used, 0, frame_bytes - frame_used);
+	sample_raw_bytes += frame.count * TELEMETRY_SAMPLE_BYTES;
+	sample_packet_bytes += frame_bytes;
+	frame.count = 0;
+	frame_used = TELEMETRY_FRAME_BYTES;
+	samples_pending = TRUE;
+}
 
-	return bytes_sent;
+static void send_samples(void)	// Sends consecutive samples as a packet once it is full, once a gap ends the run, or after BT_SAMPLE_LATENCY_MS
+{
+	if(!samples_pending)
+	{
+		uint32_t start = SYSTICK_TIMER_HIRES;
+		while(!samples_pending && sample_tail != sample_head)
+		{
+			const struct sample_record* s = &sample_ring[sample_tail];
+			if((frame.count > 0 && s->seq != (uint16_t)(frame.seq + frame.count)) || !add_sample(s))
+			{
+				finish_frame();				// s starts the next packet
+				break;
+			}
+			sample_tail = (sample_tail+1) % BT_SAMPLE_RING;
+			if(frame.count == ((frame_bytes == TELEMETRY_BT_BYTES) ? TELEMETRY_BATCH : TELEMETRY_Z_MAX))
+				finish_frame();
+		}
+		if(!samples_pending && frame.count > 0 && elapsed_ticks_between(frame_started_ms, systick_get_ms()) >= BT_SAMPLE_LATENCY_MS)
+			finish_frame();				// A partial packet costs as many bytes as a full one, so only latency closes it
+
+		frame_us += elapsed_time_us_between(start, SYSTICK_TIMER_HIRES);
+		if(samples_pending)
+		{
+			if(frame_us > bt_sample_encode_max_us)
+				bt_sample_encode_max_us = (uint16_t)frame_us;
+			frame_us = 0;
+		}
+	}
+	if(samples_pending && send_bt(packet_samples, frame_bytes))
+		samples_pending = FALSE;
+
+	uint8_t backlog = (uint8_t)((sample_head - sample_tail + BT_SAMPLE_RING) % BT_SAMPLE_RING);
+	if(backlog > rate_window.backlog_max)
+		rate_window.backlog_max = backlog;
 }
 
-static uint32_t read_packet()	//Attempts to read and parse the packet specified by header. Returns 0 when completed.
+uint32_t get_bt_sample_ratio_pct(void)
 {
-	uint32_t bytes_received = ecrobot_read_bt_packet(packet_pc, PC_BT_BYTES);	// blocks until all bytes are available
+	return (sample_packet_bytes == 0) ? 0 : (uint32_t)((uint64_t)sample_raw_bytes * 100 / sample_packet_bytes);
+}
 
-	if(bytes_received == PC_BT_BYTES)	//If the packet is finished being read, parse accordingly.
+static void send_schema(void)	// Sends the description the PC asked for, TELEMETRY_SCHEMA_ENTRIES entries per packet
+{
+	if(!schema_ready)
 	{
-		get_targets_from_global_state();	// Read global targets into local variables. Possibly not all local targets will be set via this transmission.
+		if(!schema_requested)
+			return;
+		memset(packet_schema, 0, TELEMETRY_SCHEMA_BT_BYTES);
+		encode_telemetry_schema(packet_schema);
+		uint8_t* entry = packet_schema + SCHEMA_HEADER_BYTES;
+		for(int i=schema.first; i<schema.total && i<schema.first+TELEMETRY_SCHEMA_ENTRIES; i++)
+		{
+			entry[0] = (schema.layout == 0) ? (uint8_t)i : schema_ids[i];
+			entry[1] = describe_telemetry_signal(entry[0], (char*)entry + 2);
+			entry += TELEMETRY_SCHEMA_ENTRY_BYTES;
+		}
+		schema_ready = TRUE;
+	}
+	if(send_bt(packet_schema, TELEMETRY_SCHEMA_BT_BYTES))
+	{
+		schema_ready = FALSE;
+		if(schema.total - schema.first <= TELEMETRY_SCHEMA_ENTRIES)
+			schema_requested = FALSE;
+		else
+			schema.first += TELEMETRY_SCHEMA_ENTRIES;
+	}
+}
+
+static void request_subscription(void)	// Applies the subscription in packet_pc and starts describing it
+{
+	decode_subscribe_bt(packet_pc);
+	const struct telemetry_subscription* s = subscribe_telemetry(packet_pc + SUBSCRIBE_HEADER_BYTES,
+																 subscribe.count, subscribe.decimation);
+	if(subscribe.decimation == 0)
+	{
+		schema.layout = 0;
+		schema.total = get_telemetry_signal_count();
+		schema.record_bytes = 0;
+	}
+	else
+	{
+		schema.layout = s->layout;
+		schema.total = s->count;
+		schema.record_bytes = s->record_bytes;
+		memcpy(schema_ids, s->ids, s->count);
+	}
+	schema.decimation = s->decimation;
+	schema.first = 0;
+	schema_requested = TRUE;
+	schema_ready = FALSE;
+	sub_frame.count = 0;				// Drop the records of the old subscription that are not sent yet
+	sub_used = SUB_HEADER_BYTES;
+}
+
+static void finish_sub_frame(void)
+{
+	encode_telemetry_sub(packet_sub);
+	memset(packet_sub + sub_used, 0, TELEMETRY_SUB_BT_BYTES - sub_used);
+	sub_frame.count = 0;
+	sub_used = SUB_HEADER_BYTES;
+	sub_pending = TRUE;
+}
+
+static void send_subscribed(void)	// Sends consecutive records as a packet once it is full, once a gap or a new layout ends the run, or after BT_SUB_LATENCY_MS
+{
+	uint8_t layout, len;
+	uint16_t seq;
+	while(!sub_pending && (len = peek_telemetry_record(&layout, &seq)) != 0)
+	{
+		if(sub_frame.count > 0 && (layout != sub_frame.layout || seq != (uint16_t)(sub_frame.seq + sub_frame.count)
+								   || sub_used + len > TELEMETRY_SUB_BT_BYTES))
+		{
+			finish_sub_frame();			// This record starts the next packet
+			break;
+		}
+		if(sub_frame.count == 0)
+		{
+			sub_frame.layout = layout;
+			sub_frame.seq = seq;
+			sub_started_ms = systick_get_ms();
+		}
+		pop_telemetry_record(packet_sub + sub_used);
+		sub_used += len;
+		sub_frame.count++;
+		if(sub_used + len > TELEMETRY_SUB_BT_BYTES)	// The next one will not fit
+			finish_sub_frame();
+	}
+	if(!sub_pending && sub_frame.count > 0 && elapsed_ticks_between(sub_started_ms, systick_get_ms()) >= BT_SUB_LATENCY_MS)
+		finish_sub_frame();				// Slow subscriptions are not held back until a packet fills
+	if(sub_pending && send_bt(packet_sub, TELEMETRY_SUB_BT_BYTES))
+		sub_pending = FALSE;
+}
+
+static void queue_param_reply(void)
+{
+	if((uint8_t)(param_reply_head - param_reply_tail) >= BT_PARAM_REPLIES)
+		return;
+	encode_param_reply_bt(param_replies[param_reply_head % BT_PARAM_REPLIES]);
+	param_reply_head++;
+}
+
+static void request_parameter(void)	// Answers the parameter request in packet_pc
+{
+	decode_param_bt(packet_pc);
+	param_reply.op = param_req.op;
+	param_reply.joint = param_req.joint;
+	param_reply.param = param_req.param;
+	param_reply.value = 0;
+	param_reply.version = param_version;
+	switch(param_req.op)
+	{
+		case PARAM_GET:
+			param_reply.result = get_parameter(param_req.joint, param_req.param, &param_reply.value);
+			break;
+		case PARAM_SET:
+			param_reply.result = set_parameter(param_req.joint, param_req.param, param_req.value);
+			get_parameter(param_req.joint, param_req.param, &param_reply.value);	// The value staged, whether or not it changed
+			break;
+		#if NXT == 1
+			case PARAM_COMMIT:
+				param_reply.result = commit_parameters(param_req.version);
+				param_reply.version = param_req.version;
+				if(param_reply.result == PARAM_PENDING)
+				{
+					commit_reply_due = TRUE;
+					commit_version_bt = param_req.version;
+				}
+				break;
+		#endif
+		default:
+			param_reply.result = PARAM_UNKNOWN;
+			break;
+	}
+	queue_param_reply();
+}
 
-		uint8_t offset = 0;
-		for(int i=0; i<PC_BT_VALS; i++)
+static void send_param_replies(void)
+{
+	#if NXT == 1
+		if(commit_reply_due && get_commit_result() != PARAM_PENDING
+		   && (uint8_t)(param_reply_head - param_reply_tail) < BT_PARAM_REPLIES)
 		{
-			uint8_t* val = packet_definition_pc[i].val;
-			size_t size = packet_definition_pc[i].size;
-			memcpy(val, packet_pc+offset, size);
-			offset+=size;
+			param_reply.op = PARAM_COMMIT;
+			param_reply.joint = 0;
+			param_reply.param = 0;
+			param_reply.value = 0;
+			param_reply.result = get_commit_result();
+			param_reply.version = commit_version_bt;
+			queue_param_reply();
+			commit_reply_due = FALSE;
 		}
+	#endif
+	if(param_reply_head != param_reply_tail
+	   && send_bt(param_replies[param_reply_tail % BT_PARAM_REPLIES], PARAM_REPLY_BT_BYTES))
+		param_reply_tail++;
+}
+
+#if RS485_CAPTURE
+static void send_capture(void)	// Streams the RS485 capture in full packets. The last one is padded once the capture stops.
+{
+	if(!capture_pending)
+	{
+		uint32_t available = get_rs485_capture_bytes();
+		if(available == 0 || (available < CAPTURE_BT_DATA && rs485_capture))
+			return;
+		uint32_t pos;
+		uint32_t n = read_rs485_capture(packet_capture + 4, CAPTURE_BT_DATA, &pos);
+		memset(packet_capture + 4 + n, CAPTURE_PAD, CAPTURE_BT_DATA - n);
+		for(int i=0; i<4; i++)
+			packet_capture[i] = (uint8_t)(pos >> (8*i));
+		capture_pending = TRUE;
+	}
+	if(send_bt(packet_capture, CAPTURE_BT_BYTES))
+		capture_pending = FALSE;
+}
+#endif
+
+static BOOL is_pc_length(uint32_t bytes)	// A payload length the PC sends
+{
+	return bytes == PC_BT_BYTES || bytes == CLOCK_BT_BYTES || bytes == WAYPOINT_BT_BYTES || bytes == WAYPOINT_BATCH_BT_BYTES
+		|| bytes == SUBSCRIBE_BT_BYTES || bytes == PARAM_BT_BYTES
+	#if RS485_CAPTURE
+		|| bytes == CAPTURE_CMD_BT_BYTES
+	#endif
+		;
+}
+
+static void handle_packet(uint32_t bytes_received)	// Parses the packet in packet_pc, told apart by its length
+{
+	if(bytes_received == PC_BT_BYTES)
+	{
+		echo.rx_ms = systick_get_ms();
+		get_targets_from_global_state();	// Read global targets into local variables. Possibly not all local targets will be set via this transmission.
+
+		uint16_t requested_interval = nxt_bt_tx_interval;
+		decode_pc_bt(packet_pc);
+		echo.stamp = pc_stamp;
+		if(nxt_bt_tx_interval != requested_interval)	// A new request starts the rate control over from it
+			bt_tx_interval = nxt_bt_tx_interval;
 
 		promote_targets_to_global_state();	// Write updated local targets to global targets (using the target control priority system)
 		bt_packets_received++;
 	}
+	else if(bytes_received == CLOCK_BT_BYTES)
+	{
+		echo.rx_ms = systick_get_ms();
+		decode_clock_bt(packet_pc);
+		echo.stamp = pc_stamp;
+		bt_packets_received++;
+	}
+	else if(bytes_received == WAYPOINT_BT_BYTES)
+	{
+		decode_waypoint_bt(packet_pc);
+		queue_waypoint(source, &wpt);	// Played on this NXT's joints and forwarded to NXT2/3 once the knot buffers have room
+		bt_packets_received++;
+	}
+	else if(bytes_received == WAYPOINT_BATCH_BT_BYTES)
+	{
+		uint8_t count = (packet_pc[0] < WAYPOINT_BATCH) ? packet_pc[0] : WAYPOINT_BATCH;
+		for(int i=0; i<count; i++)
+		{
+			decode_waypoint_bt(packet_pc + 1 + i*WAYPOINT_BT_BYTES);
+			queue_waypoint(source, &wpt);
+		}
+		bt_packets_received++;
+	}
+	else if(bytes_received == SUBSCRIBE_BT_BYTES)
+	{
+		request_subscription();
+		bt_packets_received++;
+	}
+	else if(bytes_received == PARAM_BT_BYTES)
+	{
+		request_parameter();
+		bt_packets_received++;
+	}
+	#if RS485_CAPTURE
+		else if(bytes_received == CAPTURE_CMD_BT_BYTES)
+		{
+			decode_capture_cmd_bt(packet_pc);
+			bt_packets_received++;
+		}
+	#endif
+}
 
-	return bytes_received;
+static void receive_packets(void)	// Reads what has arrived without waiting, and handles every packet it completes
+{
+	// Into the free part of the ring, in up to two pieces where it wraps
+	uint8_t space = (uint8_t)(rx_tail - rx_head - 1);
+	while(space > 0)
+	{
+		uint32_t chunk = BT_RX_RING - rx_head;
+		if(chunk > space)
+			chunk = space;
+		uint32_t n = ecrobot_read_bt(rx_ring, rx_head, chunk);
+		rx_head = (uint8_t)(rx_head + n);
+		space -= (uint8_t)n;
+		if(n < chunk)
+			break;
+	}
+
+	while(nxt_bt_tx_interval != 0)	// Nothing after a disconnect request is for this connection
+	{
+		uint8_t available = (uint8_t)(rx_head - rx_tail);
+		if(available < 2)
+			break;
+		uint8_t bytes = rx_ring[rx_tail];
+		if(rx_ring[(uint8_t)(rx_tail+1)] != 0 || !is_pc_length(bytes))	// Not a header. The PC's packets are shorter
+		{																	// than 256 bytes, so a 0 high byte marks one.
+			rx_tail++;
+			bt_rx_resync_bytes++;
+			continue;
+		}
+		if(available < 2 + bytes)	// The rest is still on its way
+			break;
+		for(int i=0; i<bytes; i++)
+			packet_pc[i] = rx_ring[(uint8_t)(rx_tail + 2 + i)];
+		rx_tail = (uint8_t)(rx_tail + 2 + bytes);
+		handle_packet(bytes);
+	}
 }
 
-void update_bt()
+static void start_streaming(uint32_t now)	// A new connection: nothing of the last one carries over
 {
-	uint32_t task_start_time = SYSTICK_TIMER_HIRES;
+	state = BT_STREAMING;
+	nxt_bt_tx_interval = BT_DEFAULT_TX_INTERVAL;
+	bt_tx_interval = BT_DEFAULT_TX_INTERVAL;
+	bt_tx_rate = 0;
+	start_rate_window(now);
+	bt_packets_sent = 0;
+	bt_packets_received = 0;
+	bt_incomplete_sent = 0;
+	bt_rx_resync_bytes = 0;
+	rx_head = rx_tail = 0;
+	sample_tail = sample_head;		// Samples from before the connection are stale
+	samples_pending = FALSE;
+	frame.count = 0;
+	frame_used = TELEMETRY_FRAME_BYTES;
+	frame_us = 0;
+	compress_samples = 0;
+	echo.stamp = 0;
+	subscribe_telemetry(NULL, 0, 0);
+	schema_requested = FALSE;
+	schema_ready = FALSE;
+	sub_frame.count = 0;
+	sub_used = SUB_HEADER_BYTES;
+	sub_pending = FALSE;
+	param_reply_tail = param_reply_head;	// Answers to a previous connection's requests
+	commit_reply_due = FALSE;
+	request_control(source);
+}
 
-	ecrobot_init_bt_slave(BT_PIN);
+static void transmit(uint32_t now)
+{
+	if((U16)elapsed_ticks_between(last_send_time, now) >= bt_tx_interval)	// bt_tx_interval has elapsed since the last (successful) send, so send a new packet
+	{
+		if(send_packet() == NXT1_BT_BYTES)
+			last_send_time = now;
+	}
+	send_param_replies();			// Small, and the PC waits for them
+	send_schema();
+	send_subscribed();
+	send_samples();
+	#if RS485_CAPTURE
+		send_capture();				// Telemetry goes first when both are due
+	#endif
+	update_rate(now);
+}
 
+void update_bt()
+{
+	uint32_t task_start_time = SYSTICK_TIMER_HIRES;
 	uint32_t now = systick_get_ms();
-	uint32_t bytes_sent = 0;
-	uint32_t bytes_received = 0;
 
+	// What happened since the last call, given the state
+	enum bt_event event = BT_EV_NONE;
 	switch(state)
 	{
 		case BT_READY:
-		{
-			if(ecrobot_get_bt_status() == BT_STREAM)		// on connect
-			{
-				state = BT_STREAMING;
-				nxt_bt_tx_interval = BT_DEFAULT_TX_INTERVAL;
-				bt_packets_sent = 0;
-				bt_packets_received = 0;
-				request_control(source);
-			}
+			ecrobot_init_bt_slave(BT_PIN);		// Accepts the PC's connection. Only needed until it has.
+			if(ecrobot_get_bt_status() == BT_STREAM)
+				event = BT_EV_CONNECTED;
 			break;
-		}
 
 		case BT_STREAMING:
-		{
-			if(ecrobot_get_bt_status() != BT_STREAM)		// on random disconnect
+			if(ecrobot_get_bt_status() != BT_STREAM)
 			{
-				error_buzz();
-				term_bt();
+				event = BT_EV_LINK_LOST;
 				break;
 			}
-
-			bytes_received = read_packet();
-
-			if(nxt_bt_tx_interval == 0) 	// 0 means disconnect
+			receive_packets();
+			if(nxt_bt_tx_interval == 0)			// 0 means disconnect
 			{
-				beep();
-				term_bt();
+				event = BT_EV_PC_DISCONNECT;
 				break;
 			}
-
-			if((U16)elapsed_ticks_between(last_send_time, now) >= nxt_bt_tx_interval)	// nxt_bt_tx_interval has elapsed since the last (successful) send, so send a new packet
-			{
-				bytes_sent = send_packet();
-				if(bytes_sent == NXT1_BT_BYTES)
-					last_send_time = now;
-			}
-
+			transmit(now);
 			if((U16)elapsed_ticks_between(last_send_time, now) >= BT_TX_TIMEOUT_DELAY)	// more than BT_TX_TIMEOUT_DELAY has elapsed since the last send, so an error has occurred
-			{
-				state = BT_READY;
-				error_buzz();
-				term_bt();
-				break;
-			}
+				event = BT_EV_TX_TIMEOUT;
+			break;
+	}
 
+	// ... and what it changes
+	switch(event)
+	{
+		case BT_EV_NONE:
+			break;
+		case BT_EV_CONNECTED:
+			start_streaming(now);
+			break;
+		case BT_EV_PC_DISCONNECT:
+			beep();
+			term_bt();
+			break;
+		case BT_EV_LINK_LOST:
+		case BT_EV_TX_TIMEOUT:
+			error_buzz();
+			term_bt();
 			break;
-		}
 	}
 
 	task_bluetooth_duration_us = (uint16_t)elapsed_time_us_between(task_start_time, SYSTICK_TIMER_HIRES);
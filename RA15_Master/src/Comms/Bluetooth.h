@@ -15,23 +15,52 @@
 
 #include <string.h>
 #include "../Globals.h"
+#include "PacketSchema.h"
+#include "RS485.h"
+#include "Telemetry.h"
 #include "../HumanInterface/LCD.h"
 #include "../HumanInterface/Sound.h"
 #include "../Control/Targeting.h"
+#include "../Control/Trajectory.h"
 #include "../Control/Timing.h"
+#include "../Control/Parameters.h"
 
 static const char BT_PIN[] = "1234";
 
+#define BT_SAMPLE_RING	32		// TASK_MOTORREG samples waiting to be sent (holds BT_SAMPLE_RING-1, 620ms)
+#define BT_SAMPLE_LATENCY_MS	100	// Longest a sample waits for more to fill its packet
+#define BT_SUB_LATENCY_MS	100	// Longest a subscribed record waits for more to fill its packet
+#define BT_PARAM_REPLIES	8	// Parameter replies waiting for the link. Requests beyond them are not answered.
+#define BT_RX_RING			256	// Bytes from the PC waiting to make up a packet (holds BT_RX_RING-1). Must be 256.
+
+// Rate control: every BT_RATE_WINDOW_MS, the NXT1_BT interval is adapted to what the link keeps up with. A window
+// that dropped samples or left more than BT_BACKLOG_HIGH of them waiting backs off at once: the interval doubles, up
+// to BT_TX_INTERVAL_MAX. A window that never left more than BT_BACKLOG_LOW waiting speeds up a step: the interval
+// shrinks by BT_TX_INTERVAL_STEP, down to the PC's nxtTransmitInterval. Sample packets have a fixed length, so they
+// are always filled, and only BT_SAMPLE_LATENCY_MS sends one early.
+#define BT_RATE_WINDOW_MS	500
+#define BT_BACKLOG_HIGH		(BT_SAMPLE_RING/2)
+#define BT_BACKLOG_LOW		1
+#define BT_TX_INTERVAL_MAX	1000
+#define BT_TX_INTERVAL_STEP	10
+
 // PUBLIC VARIABLES
 
 extern uint32_t bt_packets_sent;
 extern uint32_t bt_packets_received;
-extern uint32_t bt_incomplete_sent;
+extern uint32_t bt_incomplete_sent;	//Sends the link refused because the previous packet was still transmitting. Each is retried.
+extern uint32_t bt_rx_resync_bytes;	//Bytes from the PC skipped because they were not a packet header
 extern uint16_t nxt_bt_tx_interval;	//PC sets to 0 to initiate disconnect
+extern uint16_t bt_tx_interval;		//NXT1_BT interval in use, nxt_bt_tx_interval or slower (rate control)
+extern uint16_t bt_tx_rate;			//Bytes per second the link accepted, over the last BT_RATE_WINDOW_MS
+extern uint32_t bt_samples_dropped;	//TASK_MOTORREG samples lost because the ring was full
+extern uint16_t bt_sample_encode_max_us;	//Longest time spent building a sample packet, since the PC last switched compressSamples
 
 void init_bt(void);				//should be called in device startup hook
 void term_bt(void);				//should be called in device shutdown hook
 void update_bt(void);			//should be called in a loop.
+void record_bt_sample(uint32_t now);	//called by TASK_MOTORREG every cycle. Queues the joint states for the PC while streaming.
+uint32_t get_bt_sample_ratio_pct(void);	//size of the samples sent, uncompressed, in percent of the packets they took (0 before the first)
 
 void disp_bt_state(int starty);
 void disp_bt_rx(int starty);	//echos the bluetooth RX buffer to the screen
@@ -0,0 +1,77 @@
+/*
+ * Framing.c
+ *
+ *     Version: 1.0
+ *  Created on: Oct 19, 2026
+ *      Author: Daniel
+ */
+
+#include "Framing.h"
+
+
+// PRIVATE VARIABLES
+
+// CRC-16/CCITT of every 4 bit value, for a nibble at a time: 32 bytes of ROM instead of 512
+static const uint16_t crc16_nibble[16] = {
+	0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+	0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF
+};
+
+
+// PUBLIC FUNCTIONS
+
+uint16_t crc16(const uint8_t* data, uint32_t len)
+{
+	uint16_t crc = 0xFFFF;
+	for(uint32_t i=0; i<len; i++)
+	{
+		crc = (uint16_t)(crc << 4) ^ crc16_nibble[(crc >> 12) ^ (data[i] >> 4)];
+		crc = (uint16_t)(crc << 4) ^ crc16_nibble[(crc >> 12) ^ (data[i] & 0x0F)];
+	}
+	return crc;
+}
+
+
+uint32_t cobs_encode(const uint8_t* src, uint32_t len, uint8_t* dst)
+{
+	uint32_t code_at = 0;		// Where the length code of the current block goes
+	uint32_t out = 1;
+	uint8_t code = 1;			// 1 + bytes in the current block
+	for(uint32_t i=0; i<len; i++)
+	{
+		if(src[i] != 0)
+		{
+			dst[out++] = src[i];
+			code++;
+		}
+		if(src[i] == 0 || code == 0xFF)		// End the block at a zero, or when it is full
+		{
+			dst[code_at] = code;
+			code_at = out++;
+			code = 1;
+		}
+	}
+	dst[code_at] = code;
+	return out;
+}
+
+
+uint32_t cobs_decode(const uint8_t* src, uint32_t len, uint8_t* dst)
+{
+	uint32_t in = 0, out = 0;
+	while(in < len)
+	{
+		uint8_t code = src[in++];
+		if(code == 0 || in + code - 1 > len)
+			return 0;
+		for(uint8_t k=1; k<code; k++)
+		{
+			if(src[in] == 0)
+				return 0;
+			dst[out++] = src[in++];
+		}
+		if(code != 0xFF && in < len)		// A block shorter than 254 bytes stands for a zero, unless it is the last
+			dst[out++] = 0;
+	}
+	return out;
+}
@@ -0,0 +1,35 @@
+/*
+ * Framing.h
+ *
+ *	Public interface for Framing.c.
+ *	COBS byte stuffing and CRC-16 for packets on a byte stream. A COBS-encoded frame contains no 0x00 bytes,
+ *	so 0x00 can delimit frames: a receiver that loses its place resynchronizes at the next 0x00.
+ *
+ *	Also compiled by the host tools, so it must not include anything from nxtOSEK.
+ *
+ *     Version: 1.0
+ *  Created on: Oct 19, 2026
+ *      Author: Daniel
+ */
+
+#ifndef SRC_COMMS_FRAMING_H_
+#define SRC_COMMS_FRAMING_H_
+
+#include "stdint.h"
+
+
+#define FRAME_DELIMITER			0x00
+#define COBS_MAX_BYTES(n)		((n) + (n)/254 + 1)		// Longest encoding of n bytes
+
+// CRC-16/CCITT-FALSE (polynomial 0x1021, initial value 0xFFFF) of len bytes.
+uint16_t crc16(const uint8_t* data, uint32_t len);
+
+// Encodes len bytes of src into dst, which must hold COBS_MAX_BYTES(len). Returns the encoded length.
+// The delimiter is not added.
+uint32_t cobs_encode(const uint8_t* src, uint32_t len, uint8_t* dst);
+
+// Decodes len bytes of src (without the delimiter) into dst, which must hold len bytes.
+// Returns the decoded length, or 0 if src is not valid COBS.
+uint32_t cobs_decode(const uint8_t* src, uint32_t len, uint8_t* dst);
+
+#endif /* SRC_COMMS_FRAMING_H_ */
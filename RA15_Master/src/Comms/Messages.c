@@ -0,0 +1,321 @@
+/*
+ * Messages.c
+ *
+ *     Version: 1.0
+ *  Created on: Oct 19, 2026
+ *      Author: Daniel
+ */
+
+#include "Messages.h"
+
+
+#define MSG_HEADER_BYTES	3		// type, to, id
+#define MSG_ACK_BYTES		(MSG_HEADER_BYTES + 1)
+
+#if MSG_HEADER_BYTES + MSG_MAX_ARGS > RS485_MSG_BUDGET || MSG_ACK_BYTES > RS485_MSG_BUDGET
+	#error "RS485_MSG_BUDGET cannot hold the longest message"
+#endif
+
+
+// PUBLIC VARIABLES
+
+uint32_t msg_resends = 0;
+uint32_t msg_no_replies = 0;
+
+
+// PRIVATE VARIABLES
+
+enum request_state {
+	REQUEST_FREE,
+	REQUEST_WAITING,				// Queued or sent, no ack yet
+	REQUEST_DONE					// Answered or given up. Result kept until the slot is reused.
+};
+
+// Requests are posted by any task and sent by the background task. post_message() only takes FREE and DONE
+// slots and makes them WAITING last, the background task only touches WAITING slots, so no resource is needed.
+static struct request {
+	volatile uint8_t state;			// enum request_state
+	uint8_t to;
+	uint8_t type;
+	uint8_t priority;
+	uint8_t id;
+	uint8_t args[MSG_MAX_ARGS];
+	uint8_t order;					// Posting order, for requests of equal priority
+	uint8_t tries;					// Sends so far
+	uint32_t sent_ms;				// Latest send
+	uint8_t result;					// enum msg_result
+} request[MSG_QUEUE];
+
+static uint8_t next_id = 1;			// Ids are never 0
+static uint8_t next_order = 0;
+
+static struct ack {					// Acks waiting for this NXT's next frame
+	uint8_t to;
+	uint8_t id;
+	uint8_t result;
+} ack[MSG_QUEUE];
+static uint8_t num_acks = 0;
+
+static struct sender_history {		// Requests run for each other NXT, indexed by NXT number
+	BOOL any;						// newest is valid
+	uint8_t newest;					// Newest id run
+	uint8_t id[MSG_HISTORY];		// Id run at each index id % MSG_HISTORY, and its result
+	uint8_t result[MSG_HISTORY];
+	uint32_t heard_ms;				// Latest frame from this NXT
+} history[4];
+
+
+// PRIVATE FUNCTIONS
+
+static int32_t args_bytes(uint8_t type)		// Argument bytes of a message type, -1 if it is unknown
+{
+	switch(type)
+	{
+		case MSG_ACK:			return 1;
+		case MSG_BEGIN_HOMING:	return 1;
+		case MSG_END_HOMING:	return 0;
+		case MSG_SET_PARAM:		return 6;
+		case MSG_COMMIT_PARAMS:	return 6;
+	}
+	return -1;
+}
+
+
+static uint32_t get_le32(const uint8_t* b)
+{
+	return (uint32_t)b[0] | ((uint32_t)b[1] << 8) | ((uint32_t)b[2] << 16) | ((uint32_t)b[3] << 24);
+}
+
+
+static uint8_t run_request(uint8_t type, const uint8_t* args)
+{
+	switch(type)
+	{
+		case MSG_BEGIN_HOMING:
+			if(args[0] >= 6 || joint_nxt[args[0]] != NXT)		// Only the NXT that drives a joint reads its homing switch edges
+				return MSG_REFUSED;
+			return begin_homing_sequence(args[0]) ? MSG_OK : MSG_REFUSED;
+
+		case MSG_END_HOMING:
+			end_homing_sequence();
+			return MSG_OK;
+
+		case MSG_SET_PARAM:
+			return (set_parameter(args[0], args[1], (fix16_t)get_le32(args + 2)) == PARAM_OK) ? MSG_OK : MSG_REFUSED;
+
+		case MSG_COMMIT_PARAMS:
+			if(global_time_error_ms() == CLOCK_UNSYNCED)		// The switch would not be at the same time as the others'
+				return MSG_REFUSED;
+			return (schedule_parameters((uint16_t)(args[0] | (args[1] << 8)), get_le32(args + 2)) == PARAM_OK) ? MSG_OK : MSG_REFUSED;
+	}
+	return MSG_UNSUPPORTED;
+}
+
+
+static void queue_ack(uint8_t to, uint8_t id, uint8_t result)	// Dropped if the queue is full: the request comes again
+{
+	if(num_acks >= MSG_QUEUE)
+		return;
+	ack[num_acks].to = to;
+	ack[num_acks].id = id;
+	ack[num_acks].result = result;
+	num_acks++;
+}
+
+
+static void receive_request(uint8_t from, uint8_t type, uint8_t id, const uint8_t* args)	// Runs a request unless it already ran
+{
+	struct sender_history* h = &history[from];
+	uint8_t age = (uint8_t)(h->newest - id);			// How many ids before the newest one it is. >= 128 if it is newer.
+	uint8_t k = id % MSG_HISTORY;
+	if(h->any && age < 128)
+	{
+		if(age >= MSG_HISTORY)
+		{
+			queue_ack(from, id, MSG_EXPIRED);
+			return;
+		}
+		if(h->id[k] == id)								// A resend: its ack was lost
+		{
+			queue_ack(from, id, h->result[k]);
+			return;
+		}
+	}
+	else
+	{
+		h->any = TRUE;
+		h->newest = id;
+	}
+
+	uint8_t result = run_request(type, args);
+	h->id[k] = id;
+	h->result[k] = result;
+	queue_ack(from, id, result);
+}
+
+
+static void receive_ack(uint8_t from, uint8_t id, uint8_t result)
+{
+	for(int i=0; i<MSG_QUEUE; i++)
+		if(request[i].state == REQUEST_WAITING && request[i].to == from && request[i].id == id)
+		{
+			request[i].result = result;
+			request[i].state = REQUEST_DONE;
+		}
+}
+
+
+static int32_t next_due_request(uint32_t now)	// Highest priority request due to be sent, -1 if none
+{
+	int32_t best = -1;
+	for(int i=0; i<MSG_QUEUE; i++)
+	{
+		struct request* r = &request[i];
+		if(r->state != REQUEST_WAITING)
+			continue;
+		if(r->tries > 0 && now - r->sent_ms < MSG_RESEND_MS)
+			continue;
+		if(best < 0 || r->priority > request[best].priority
+			|| (r->priority == request[best].priority && (int8_t)(r->order - request[best].order) < 0))
+			best = i;
+	}
+	return best;
+}
+
+
+// PUBLIC FUNCTIONS
+
+BOOL post_message(uint8_t to, enum msg_type type, uint8_t priority, const uint8_t* args, uint8_t* id)
+{
+	if(args_bytes(type) < 0 || type == MSG_ACK)
+		return FALSE;
+
+	int32_t slot = -1;
+	for(int i=0; i<MSG_QUEUE; i++)		// A free slot, or else the oldest answered one
+	{
+		if(request[i].state == REQUEST_FREE)
+		{
+			slot = i;
+			break;
+		}
+		if(request[i].state == REQUEST_DONE && (slot < 0 || (int8_t)(request[i].order - request[slot].order) < 0))
+			slot = i;
+	}
+	if(slot < 0)
+		return FALSE;
+
+	struct request* r = &request[slot];
+	r->to = to;
+	r->type = type;
+	r->priority = priority;
+	r->id = next_id;
+	for(int k=0; k<args_bytes(type); k++)
+		r->args[k] = args[k];
+	r->order = next_order++;
+	r->tries = 0;
+	r->result = MSG_PENDING;
+	r->state = REQUEST_WAITING;
+
+	*id = next_id;
+	if(++next_id == 0)
+		next_id = 1;
+	return TRUE;
+}
+
+
+enum msg_result get_message_result(uint8_t id)
+{
+	for(int i=0; i<MSG_QUEUE; i++)
+		if(request[i].state != REQUEST_FREE && request[i].id == id)
+			return (enum msg_result)request[i].result;
+	return MSG_UNKNOWN_ID;
+}
+
+
+uint32_t encode_messages(uint8_t* buf, uint32_t budget, uint32_t now)
+{
+	uint32_t n = 0;
+
+	// Acks first: they are small, and the other NXT resends the request until one gets through
+	uint8_t sent_acks = 0;
+	while(sent_acks < num_acks && n + MSG_ACK_BYTES <= budget)
+	{
+		buf[n++] = MSG_ACK;
+		buf[n++] = ack[sent_acks].to;
+		buf[n++] = ack[sent_acks].id;
+		buf[n++] = ack[sent_acks].result;
+		sent_acks++;
+	}
+	for(int i=sent_acks; i<num_acks; i++)			// Keep the ones that did not fit
+		ack[i - sent_acks] = ack[i];
+	num_acks -= sent_acks;
+
+	// Give up on requests that used all their tries
+	for(int i=0; i<MSG_QUEUE; i++)
+		if(request[i].state == REQUEST_WAITING && request[i].tries >= MSG_TRIES && now - request[i].sent_ms >= MSG_RESEND_MS)
+		{
+			request[i].result = MSG_NO_REPLY;
+			request[i].state = REQUEST_DONE;
+			msg_no_replies++;
+		}
+
+	// Then requests by priority, until the next one does not fit
+	int32_t i;
+	while((i = next_due_request(now)) >= 0)		// A request just sent is not due again
+	{
+		struct request* r = &request[i];
+		uint32_t bytes = MSG_HEADER_BYTES + args_bytes(r->type);
+		if(n + bytes > budget)
+			break;
+		buf[n++] = r->type;
+		buf[n++] = r->to;
+		buf[n++] = r->id;
+		for(int k=0; k<args_bytes(r->type); k++)
+			buf[n++] = r->args[k];
+		if(r->tries > 0)
+			msg_resends++;
+		r->tries++;
+		r->sent_ms = now;
+	}
+	return n;
+}
+
+
+void decode_messages(uint8_t from, const uint8_t* buf, uint32_t len, uint32_t now)
+{
+	struct sender_history* h = &history[from];
+	if(now - h->heard_ms > MSG_FORGET_MS)		// It restarted, or has not been heard from yet. Its ids start afresh.
+	{
+		h->any = FALSE;
+		for(int k=0; k<MSG_HISTORY; k++)
+			h->id[k] = 0;
+	}
+	h->heard_ms = now;
+
+	uint32_t n = 0;
+	while(n + MSG_HEADER_BYTES <= len)
+	{
+		uint8_t type = buf[n];
+		uint8_t to = buf[n+1];
+		uint8_t id = buf[n+2];
+		int32_t args = args_bytes(type);
+		if(args < 0)								// Unknown type: its length, and so the rest of the frame, cannot be read
+		{
+			if(to == NXT)
+				queue_ack(from, id, MSG_UNSUPPORTED);
+			return;
+		}
+		if(n + MSG_HEADER_BYTES + args > len)
+			return;
+
+		const uint8_t* a = buf + n + MSG_HEADER_BYTES;
+		if(to == NXT)
+		{
+			if(type == MSG_ACK)
+				receive_ack(from, id, a[0]);
+			else
+				receive_request(from, type, id, a);
+		}
+		n += MSG_HEADER_BYTES + args;
+	}
+}
@@ -0,0 +1,85 @@
+/*
+ * Messages.h
+ *
+ *	Public interface for Messages.c.
+ *	Requests from one NXT to another, carried in the spare bytes of the cyclic RS485 frames (RS485_MSG_BUDGET
+ *	per frame, see PacketSchema.h and RA15_Int_Comms.txt). The receiver runs each request and answers it with an
+ *	ack that carries the result. The sender resends a request every MSG_RESEND_MS until the ack arrives, up to
+ *	MSG_TRIES times. The receiver remembers the ids it has run and answers a repeat with the stored result, so a
+ *	request runs at most once even when its ack is lost.
+ *	Each frame carries the due acks first, then the due requests in order of priority, while they fit. Whatever
+ *	does not fit waits for the next cycle, so messages never displace the cyclic state.
+ *
+ *     Version: 1.0
+ *  Created on: Oct 19, 2026
+ *      Author: Daniel
+ */
+
+#ifndef SRC_COMMS_MESSAGES_H_
+#define SRC_COMMS_MESSAGES_H_
+
+#include "kernel.h"
+#include "kernel_id.h"
+#include "ecrobot_interface.h"
+#include "stdint.h"
+
+#include "../Globals.h"
+#include "PacketSchema.h"
+#include "../Control/Homing.h"
+#include "../Control/MotorRegulator.h"
+#include "../Control/Parameters.h"
+
+
+#define MSG_QUEUE			4			// Requests this NXT can have waiting for an ack
+#define MSG_MAX_ARGS		6			// Argument bytes of the longest request
+#define MSG_RESEND_MS		(3 * MOTORREG_PERIOD_MS)	// Time to wait for an ack before sending a request again
+#define MSG_TRIES			5			// Sends of a request before it is given up as MSG_NO_REPLY
+#define MSG_HISTORY			16			// Request ids remembered per sender. Older repeats are answered MSG_EXPIRED, not run.
+#define MSG_FORGET_MS		1000		// Silence after which a sender is taken to have restarted, and its ids are forgotten
+
+// Message types. On the wire: [type][to (NXT number)][id][args], see RA15_Int_Comms.txt.
+enum msg_type {
+	MSG_ACK				= 1,			// Answer to request id. Args: result (enum msg_result).
+	MSG_BEGIN_HOMING	= 2,			// begin_homing_sequence() on the NXT that drives the joint. Args: joint index.
+	MSG_END_HOMING		= 3,			// end_homing_sequence(). No args.
+	MSG_SET_PARAM		= 4,			// set_parameter(). Args: joint index, parameter id, value (fix16_t, LSB first).
+	MSG_COMMIT_PARAMS	= 5				// schedule_parameters(). Args: version (LSB first), global time of the switch (LSB first).
+};
+
+enum msg_result {
+	MSG_PENDING,				// Not answered yet
+	MSG_OK,						// Ran, and succeeded
+	MSG_REFUSED,				// Ran, and failed, e.g. begin_homing_sequence() returned FALSE
+	MSG_UNSUPPORTED,			// The receiver does not know the type
+	MSG_EXPIRED,				// Too old for the receiver to tell whether it ran. It did not run again.
+	MSG_NO_REPLY,				// No ack after MSG_TRIES sends. It may or may not have run.
+	MSG_UNKNOWN_ID				// get_message_result(): no request with this id is queued any more
+};
+
+#define MSG_PRIORITY_LOW	0
+#define MSG_PRIORITY_HIGH	1
+
+extern uint32_t msg_resends;	// Requests sent again for want of an ack
+extern uint32_t msg_no_replies;	// Requests given up as MSG_NO_REPLY
+
+
+// Queues a request to NXT number to, with MSG_MAX_ARGS bytes of args (NULL if it has none). Higher priorities
+// are sent first. Writes the request's id to *id. Returns FALSE if the queue is full.
+// May be called from any task other than TASK_MOTORREG.
+BOOL post_message(uint8_t to, enum msg_type type, uint8_t priority, const uint8_t* args, uint8_t* id);
+
+// Result of the request with this id: MSG_PENDING until it is answered or given up. The result is kept until
+// the queue needs the slot for a new request, after which it is MSG_UNKNOWN_ID.
+enum msg_result get_message_result(uint8_t id);
+
+
+// Called by RS485.c only
+
+// Writes the due acks and requests into buf, up to budget bytes. Returns the number of bytes written.
+uint32_t encode_messages(uint8_t* buf, uint32_t budget, uint32_t now);
+
+// Handles the messages in a valid frame from NXT number from (len may be 0). Runs the requests to this NXT.
+void decode_messages(uint8_t from, const uint8_t* buf, uint32_t len, uint32_t now);
+
+
+#endif /* SRC_COMMS_MESSAGES_H_ */
@@ -0,0 +1,491 @@
+/*
+ * PacketSchema.h
+ *
+ *	Field lists of every RS485 and Bluetooth packet, in wire order. Everything that needs a packet layout
+ *	is generated from these lists: the firmware encode/decode routines below, the packet sizes, the host
+ *	decoders (RA15_Host/src/Common/Packets.h) and the MATLAB decoders (matlab/NXTPackets.m, written by
+ *	RA15_Host packet_gen). To change a packet, change it here only.
+ *
+ *	Each list is an X-macro. X(name, type, wire, shift, expr):
+ *	 - name: field name on the PC side (MATLAB struct field, host struct member)
+ *	 - type: type of the variable. fix16_t is its raw 16.16 int32.
+ *	 - wire: type on the wire, little-endian. Either the same as type, or int16_t for a quantized fix16_t.
+ *	 - shift: quantized fields only (0 otherwise). The wire value is the fix16_t divided by 2^shift. A target
+ *	   ORs in PACKET_SENTINELS, so that out of range values carry DISABLE_PT/DISABLE_VT (see packet_quantize).
+ *	 - expr: firmware variable the field is read from / written to. Only meaningful inside the .c file that
+ *	   owns the packet, where the static variables it names are in scope.
+ *
+ *	This header is also compiled by the host tools, so it must not include anything from nxtOSEK.
+ *
+ *     Version: 1.0
+ *  Created on: Oct 19, 2026
+ *      Author: Daniel
+ */
+
+#ifndef SRC_COMMS_PACKETSCHEMA_H_
+#define SRC_COMMS_PACKETSCHEMA_H_
+
+#include "stdint.h"
+#include "Framing.h"
+
+
+// RS485 PACKETS (see RA15_Int_Comms.txt)
+
+// Angles and velocities are quantized to int16_t, which cuts the airtime of a ring cycle (all three packets)
+// by 40%. Shift 9 = 1/128 deg (deg/s) steps, +-255.99 range.
+// The finest joint encoder resolution is 1/21 deg (J2), and no joint moves faster than 255 deg/s.
+#define RS485_ANGLE_SHIFT		9
+#define RS485_VELOCITY_SHIFT	9
+#define RS485_RANGE				255.0f		// Largest angle (deg) or velocity (deg/s) to set as a limit: beyond +-255.99 a
+											// target saturates, and arrives as DISABLE_PT/DISABLE_VT
+#define RS485_PT_SHIFT			(RS485_ANGLE_SHIFT | PACKET_SENTINELS)
+#define RS485_VT_SHIFT			(RS485_VELOCITY_SHIFT | PACKET_SENTINELS)
+
+// Each packet travels in a frame: [header, sequence number, packet, messages, CRC-16 (little-endian)], COBS-encoded
+// (Framing.h) between two delimiters. Messages (Messages.h) take 0 to RS485_MSG_BUDGET bytes, which keeps NXT1's
+// longest frame within the 64 byte RS485 buffer. RS485_WIRE_BYTES is the longest a frame can be on the bus.
+#define RS485_FRAME_OVERHEAD			4
+#define RS485_MSG_BUDGET				10
+#define RS485_WIRE_BYTES(packet_bytes)	(COBS_MAX_BYTES((packet_bytes) + RS485_FRAME_OVERHEAD + RS485_MSG_BUDGET) + 2)
+
+// Clock sync (Timing.h). sampleMs: low 16 bits of the sender's global_time_ms() when TASK_MOTORREG sampled the
+// joint states in the packet, or RS485_SAMPLE_UNSYNCED while the sender has no clock estimate yet (a stamp that
+// happens to be 0xFFFF goes as 0xFFFE). NXT1 also sends txMs, its systick when the frame was sent, and for each of
+// NXT2 and NXT3 the seq of its latest frame and how long NXT1 held it: ms from receiving it to txMs, 0xFF if none
+// arrived.
+#define RS485_SYNC_NO_HOLD		0xFF
+#define RS485_SAMPLE_UNSYNCED	0xFFFF
+
+// Waypoint forwarding (Trajectory.h). NXT1 sends the oldest waypoint of its forward queue, numbered wptSeq (1-255,
+// 0 while none is forwarded), in every frame until NXT2 and NXT3 both echo it in wptAck. A receiver adds a
+// waypoint when its wptSeq first arrives, so that a knot is neither lost with a frame nor played twice.
+
+// Baud rate negotiation (RS485.h). NXT1 announces a switch to rate index baudNext in baudCountdown cycles, 0 if
+// none is announced. baudProbe numbers a probe, which ends by itself, and is 0 for a permanent switch. NXT2/3 report
+// the fewest frames they received from any other NXT during probe probeNum.
+// The USART divides its 48MHz clock by 16*n, so only 3M/n baud is exact. The first rate is nxtOSEK's
+// DEFAULT_BAUD_RATE_RS485, which every NXT rounds the same way; the others are exact.
+#define RS485_BAUD_RATES	{ 921600, 1500000, 3000000 }
+#define RS485_NUM_BAUDS		3
+
+#define PACKET_NXT1_HEADER	0x01
+#define PACKET_NXT1_FIELDS(X)																		\
+	X(j1pt,					fix16_t,	int16_t,	RS485_PT_SHIFT,			jtgt[0].pt)				\
+	X(j1vt,					fix16_t,	int16_t,	RS485_VT_SHIFT,			jtgt[0].vt)				\
+	X(j3pt,					fix16_t,	int16_t,	RS485_PT_SHIFT,			jtgt[2].pt)				\
+	X(j3vt,					fix16_t,	int16_t,	RS485_VT_SHIFT,			jtgt[2].vt)				\
+	X(j4pt,					fix16_t,	int16_t,	RS485_PT_SHIFT,			jtgt[3].pt)				\
+	X(j4vt,					fix16_t,	int16_t,	RS485_VT_SHIFT,			jtgt[3].vt)				\
+	X(j5pt,					fix16_t,	int16_t,	RS485_PT_SHIFT,			jtgt[4].pt)				\
+	X(j5vt,					fix16_t,	int16_t,	RS485_VT_SHIFT,			jtgt[4].vt)				\
+	X(j2p,					fix16_t,	int16_t,	RS485_ANGLE_SHIFT,		j[1].p)					\
+	X(enableJointLimits,	uint8_t,	uint8_t,	0,						enable_joint_limits)	\
+	X(tmux,					uint8_t,	uint8_t,	0,						tmux)					\
+	X(rcx,					uint8_t,	uint8_t,	0,						rcx)					\
+	X(wptDtMs,				uint16_t,	uint16_t,	0,						wpt.dt_ms)				\
+	X(wptJointMask,			uint8_t,	uint8_t,	0,						wpt.joint_mask)			\
+	X(wptSeq,				uint8_t,	uint8_t,	0,						wpt_seq)				\
+	X(wptP1,				fix16_t,	int16_t,	RS485_ANGLE_SHIFT,		wpt.p[0])				\
+	X(wptP3,				fix16_t,	int16_t,	RS485_ANGLE_SHIFT,		wpt.p[2])				\
+	X(wptP4,				fix16_t,	int16_t,	RS485_ANGLE_SHIFT,		wpt.p[3])				\
+	X(wptP5,				fix16_t,	int16_t,	RS485_ANGLE_SHIFT,		wpt.p[4])				\
+	X(sampleMs,				uint16_t,	uint16_t,	0,						sync.sample_ms)			\
+	X(txMs,					uint32_t,	uint32_t,	0,						sync.tx_ms)				\
+	X(nxt2Seq,				uint8_t,	uint8_t,	0,						sync.seq[0])			\
+	X(nxt2HoldMs,			uint8_t,	uint8_t,	0,						sync.hold_ms[0])		\
+	X(nxt3Seq,				uint8_t,	uint8_t,	0,						sync.seq[1])			\
+	X(nxt3HoldMs,			uint8_t,	uint8_t,	0,						sync.hold_ms[1])		\
+	X(baudNext,				uint8_t,	uint8_t,	0,						baud.next)				\
+	X(baudCountdown,		uint8_t,	uint8_t,	0,						baud.countdown)			\
+	X(baudProbe,			uint8_t,	uint8_t,	0,						baud.probe)
+
+#define PACKET_NXT2_HEADER	0x02
+#define PACKET_NXT2_FIELDS(X)																		\
+	X(j1p,					fix16_t,	int16_t,	RS485_ANGLE_SHIFT,		j[0].p)					\
+	X(j1v,					fix16_t,	int16_t,	RS485_VELOCITY_SHIFT,	j[0].v)					\
+	X(j5p,					fix16_t,	int16_t,	RS485_ANGLE_SHIFT,		j[4].p)					\
+	X(j5v,					fix16_t,	int16_t,	RS485_VELOCITY_SHIFT,	j[4].v)					\
+	X(j1pwm,				int8_t,		int8_t,		0,						j[0].pwm)				\
+	X(j5pwm,				int8_t,		int8_t,		0,						j[4].pwm)				\
+	X(sampleMs,				uint16_t,	uint16_t,	0,						sync.sample_ms)			\
+	X(wptAck,				uint8_t,	uint8_t,	0,						wpt_ack[0])				\
+	X(probeNum,				uint8_t,	uint8_t,	0,						probe_report[0].probe)	\
+	X(probeFrames,			uint8_t,	uint8_t,	0,						probe_report[0].frames)
+
+#define PACKET_NXT3_HEADER	0x03
+#define PACKET_NXT3_FIELDS(X)																		\
+	X(j3p,					fix16_t,	int16_t,	RS485_ANGLE_SHIFT,		j[2].p)					\
+	X(j3v,					fix16_t,	int16_t,	RS485_VELOCITY_SHIFT,	j[2].v)					\
+	X(j4p,					fix16_t,	int16_t,	RS485_ANGLE_SHIFT,		j[3].p)					\
+	X(j4v,					fix16_t,	int16_t,	RS485_VELOCITY_SHIFT,	j[3].v)					\
+	X(j3pwm,				int8_t,		int8_t,		0,						j[2].pwm)				\
+	X(j4pwm,				int8_t,		int8_t,		0,						j[3].pwm)				\
+	X(ea1,					uint8_t,	uint8_t,	0,						ea1)					\
+	X(ea2,					uint8_t,	uint8_t,	0,						ea2)					\
+	X(ea3,					uint8_t,	uint8_t,	0,						ea3)					\
+	X(sampleMs,				uint16_t,	uint16_t,	0,						sync.sample_ms)			\
+	X(wptAck,				uint8_t,	uint8_t,	0,						wpt_ack[1])				\
+	X(probeNum,				uint8_t,	uint8_t,	0,						probe_report[1].probe)	\
+	X(probeFrames,			uint8_t,	uint8_t,	0,						probe_report[1].frames)
+
+
+// BLUETOOTH PACKETS. Preceded on the wire by the 2 byte ecrobot header (payload length, 0).
+
+// NXT1 -> PC telemetry. echoStamp is the pcStamp of the last PC_BT, echoRxMs NXT1's systick when it was read and
+// txMs when this packet was encoded, from which the PC takes the Bluetooth round trip apart (bt_latency). Only the
+// first NXT1_BT after a PC_BT echoes it; the others have echoStamp 0.
+#define NXT1_BT_FIELDS(X)																			\
+	X(systick,				uint32_t,	uint32_t,	0,						systick_ms)				\
+	X(j1p,					fix16_t,	fix16_t,	0,						j[0].p)					\
+	X(j1v,					fix16_t,	fix16_t,	0,						j[0].v)					\
+	X(j1pwm,				int8_t,		int8_t,		0,						j[0].pwm)				\
+	X(j2p,					fix16_t,	fix16_t,	0,						j[1].p)					\
+	X(j2v,					fix16_t,	fix16_t,	0,						j[1].v)					\
+	X(j2pwm,				int8_t,		int8_t,		0,						j[1].pwm)				\
+	X(j3p,					fix16_t,	fix16_t,	0,						j[2].p)					\
+	X(j3v,					fix16_t,	fix16_t,	0,						j[2].v)					\
+	X(j3pwm,				int8_t,		int8_t,		0,						j[2].pwm)				\
+	X(j4p,					fix16_t,	fix16_t,	0,						j[3].p)					\
+	X(j4v,					fix16_t,	fix16_t,	0,						j[3].v)					\
+	X(j4pwm,				int8_t,		int8_t,		0,						j[3].pwm)				\
+	X(j5p,					fix16_t,	fix16_t,	0,						j[4].p)					\
+	X(j5v,					fix16_t,	fix16_t,	0,						j[4].v)					\
+	X(j5pwm,				int8_t,		int8_t,		0,						j[4].pwm)				\
+	X(j6p,					fix16_t,	fix16_t,	0,						j[5].p)					\
+	X(j6v,					fix16_t,	fix16_t,	0,						j[5].v)					\
+	X(j6pwm,				int8_t,		int8_t,		0,						j[5].pwm)				\
+	X(tmux,					uint8_t,	uint8_t,	0,						tmux)					\
+	X(ea1,					uint8_t,	uint8_t,	0,						ea1)					\
+	X(ea2,					uint8_t,	uint8_t,	0,						ea2)					\
+	X(ea3,					uint8_t,	uint8_t,	0,						ea3)					\
+	X(queuedWaypoints,		uint8_t,	uint8_t,	0,						queued_waypoints)		\
+	X(freeWaypoints,		uint8_t,	uint8_t,	0,						free_waypoints)			\
+	X(trajUnderruns,		uint16_t,	uint16_t,	0,						traj_underruns_bt)		\
+	X(echoStamp,			uint32_t,	uint32_t,	0,						echo.stamp)				\
+	X(echoRxMs,				uint32_t,	uint32_t,	0,						echo.rx_ms)				\
+	X(txMs,					uint32_t,	uint32_t,	0,						echo.tx_ms)
+
+// PC -> NXT1 joint targets. pcStamp is the PC's time of sending (ms, on any clock of the PC's), echoed in NXT1_BT.
+// 0 if the PC does not stamp its packets.
+#define PC_BT_FIELDS(X)																				\
+	X(j1pt,					fix16_t,	fix16_t,	0,						jtgt[0].pt)				\
+	X(j1vt,					fix16_t,	fix16_t,	0,						jtgt[0].vt)				\
+	X(j2pt,					fix16_t,	fix16_t,	0,						jtgt[1].pt)				\
+	X(j2vt,					fix16_t,	fix16_t,	0,						jtgt[1].vt)				\
+	X(j3pt,					fix16_t,	fix16_t,	0,						jtgt[2].pt)				\
+	X(j3vt,					fix16_t,	fix16_t,	0,						jtgt[2].vt)				\
+	X(j4pt,					fix16_t,	fix16_t,	0,						jtgt[3].pt)				\
+	X(j4vt,					fix16_t,	fix16_t,	0,						jtgt[3].vt)				\
+	X(j5pt,					fix16_t,	fix16_t,	0,						jtgt[4].pt)				\
+	X(j5vt,					fix16_t,	fix16_t,	0,						jtgt[4].vt)				\
+	X(j6pt,					fix16_t,	fix16_t,	0,						jtgt[5].pt)				\
+	X(j6vt,					fix16_t,	fix16_t,	0,						jtgt[5].vt)				\
+	X(rcx,					uint8_t,	uint8_t,	0,						rcx)					\
+	X(nxtTransmitInterval,	uint16_t,	uint16_t,	0,						nxt_bt_tx_interval)		\
+	X(compressSamples,		uint8_t,	uint8_t,	0,						compress_samples)		\
+	X(pcStamp,				uint32_t,	uint32_t,	0,						pc_stamp)
+
+// PC -> NXT1 clock probe, echoed in NXT1_BT as a PC_BT's pcStamp is, but without taking control of the joints. Told
+// apart by its length. The PC estimates the offset of NXT1's systick to its own clock from the echoes.
+#define CLOCK_BT_FIELDS(X)																			\
+	X(pcStamp,				uint32_t,	uint32_t,	0,						pc_stamp)
+
+// PC -> NXT1 spline knot. Told apart from PC_BT by its length.
+#define WAYPOINT_BT_FIELDS(X)																		\
+	X(dtMs,					uint16_t,	uint16_t,	0,						wpt.dt_ms)				\
+	X(jointMask,			uint8_t,	uint8_t,	0,						wpt.joint_mask)			\
+	X(p1,					fix16_t,	fix16_t,	0,						wpt.p[0])				\
+	X(p2,					fix16_t,	fix16_t,	0,						wpt.p[1])				\
+	X(p3,					fix16_t,	fix16_t,	0,						wpt.p[2])				\
+	X(p4,					fix16_t,	fix16_t,	0,						wpt.p[3])				\
+	X(p5,					fix16_t,	fix16_t,	0,						wpt.p[4])				\
+	X(p6,					fix16_t,	fix16_t,	0,						wpt.p[5])
+
+// PC -> NXT1 batch of spline knots: [count][WAYPOINT_BATCH WAYPOINT_BT payloads], of which the first count are
+// used and the rest is padding. Told apart by its length. Fills NXT1's waypoint ring (Trajectory.h) with one
+// Bluetooth round trip per WAYPOINT_BATCH knots.
+#define WAYPOINT_BATCH				4
+#define WAYPOINT_BATCH_BT_BYTES		(1 + WAYPOINT_BATCH*PACKET_BYTES(WAYPOINT_BT_FIELDS))
+
+// PC -> NXT1 RS485 bus capture on (1) or off (0). Told apart by its length.
+#define CAPTURE_CMD_BT_FIELDS(X)																	\
+	X(capture,				uint8_t,	uint8_t,	0,						rs485_capture)
+
+// NXT1 -> PC RS485 bus capture, while it is on: [stream position, uint32_t][CAPTURE_BT_DATA bytes of the stream].
+// Told apart from NXT1_BT by its length. The position of the first byte counts from the start of the capture.
+#define CAPTURE_BT_DATA		120
+#define CAPTURE_BT_BYTES	(4 + CAPTURE_BT_DATA)
+
+// NXT1 -> PC joint states of every TASK_MOTORREG cycle, recorded in a ring and sent up to TELEMETRY_BATCH at a time
+// (fewer once the first has waited BT_SAMPLE_LATENCY_MS):
+// [TELEMETRY_FRAME][TELEMETRY_BATCH TELEMETRY_SAMPLEs], of which the first count are used and the rest is padding.
+// Told apart by its length. seq numbers the samples, and a frame holds consecutive ones only, so samples NXT1
+// had to drop show as gaps. Angles and velocities are quantized as on RS485. Remote joints are their latest
+// RS485 state at the sample time.
+#define TELEMETRY_BATCH		3
+#define TELEMETRY_FRAME_FIELDS(X)																	\
+	X(seq,					uint16_t,	uint16_t,	0,						frame.seq)				\
+	X(count,				uint8_t,	uint8_t,	0,						frame.count)
+
+#define TELEMETRY_SAMPLE_FIELDS(X)																	\
+	X(systick,				uint32_t,	uint32_t,	0,						sample_ms)				\
+	X(j1p,					fix16_t,	int16_t,	RS485_ANGLE_SHIFT,		j[0].p)					\
+	X(j1v,					fix16_t,	int16_t,	RS485_VELOCITY_SHIFT,	j[0].v)					\
+	X(j1pwm,				int8_t,		int8_t,		0,						j[0].pwm)				\
+	X(j2p,					fix16_t,	int16_t,	RS485_ANGLE_SHIFT,		j[1].p)					\
+	X(j2v,					fix16_t,	int16_t,	RS485_VELOCITY_SHIFT,	j[1].v)					\
+	X(j2pwm,				int8_t,		int8_t,		0,						j[1].pwm)				\
+	X(j3p,					fix16_t,	int16_t,	RS485_ANGLE_SHIFT,		j[2].p)					\
+	X(j3v,					fix16_t,	int16_t,	RS485_VELOCITY_SHIFT,	j[2].v)					\
+	X(j3pwm,				int8_t,		int8_t,		0,						j[2].pwm)				\
+	X(j4p,					fix16_t,	int16_t,	RS485_ANGLE_SHIFT,		j[3].p)					\
+	X(j4v,					fix16_t,	int16_t,	RS485_VELOCITY_SHIFT,	j[3].v)					\
+	X(j4pwm,				int8_t,		int8_t,		0,						j[3].pwm)				\
+	X(j5p,					fix16_t,	int16_t,	RS485_ANGLE_SHIFT,		j[4].p)					\
+	X(j5v,					fix16_t,	int16_t,	RS485_VELOCITY_SHIFT,	j[4].v)					\
+	X(j5pwm,				int8_t,		int8_t,		0,						j[4].pwm)				\
+	X(j6p,					fix16_t,	int16_t,	RS485_ANGLE_SHIFT,		j[5].p)					\
+	X(j6v,					fix16_t,	int16_t,	RS485_VELOCITY_SHIFT,	j[5].v)					\
+	X(j6pwm,				int8_t,		int8_t,		0,						j[5].pwm)
+
+#define TELEMETRY_BT_BYTES	(PACKET_BYTES(TELEMETRY_FRAME_FIELDS) + TELEMETRY_BATCH*PACKET_BYTES(TELEMETRY_SAMPLE_FIELDS))
+
+// The same samples delta coded, while the PC sets compressSamples (PC_BT): [TELEMETRY_FRAME][first sample, as a
+// TELEMETRY_SAMPLE][the others, delta coded][zero padding]. Told apart by its length. A delta coded sample is each
+// field in turn as packet_put_delta() of its wire value from the previous sample's. As many samples as fit go in a
+// frame, up to TELEMETRY_Z_MAX, which bounds NXT1's work per frame, or fewer after BT_SAMPLE_LATENCY_MS. Each frame decodes
+// on its own.
+#define TELEMETRY_Z_BT_BYTES	122
+#define TELEMETRY_Z_MAX			8
+
+// TELEMETRY SUBSCRIPTIONS (see Telemetry.h). The PC picks signals from NXT1's telemetry registry by id, and NXT1
+// records them every decimation TASK_MOTORREG cycles. Signals are sent as they are in memory, little-endian: their
+// wire type is one of telemetry_type. fix16_t is its raw int32.
+enum telemetry_type {
+	TLM_UINT8, TLM_INT8, TLM_UINT16, TLM_INT16, TLM_UINT32, TLM_INT32, TLM_FIX16, TLM_NUM_TYPES
+};
+#define TELEMETRY_TYPE_BYTES(type)	(((type) <= TLM_INT8) ? 1 : ((type) <= TLM_INT16) ? 2 : 4)
+#define TELEMETRY_NAME_CHARS		12		// Longest signal name. Shorter ones are padded with zeros.
+#define TELEMETRY_SUB_MAX			32		// Most signals in one subscription
+
+// PC -> NXT1 subscription: [SUBSCRIBE_BT][TELEMETRY_SUB_MAX signal ids], of which the first count are used and the rest
+// is padding. Told apart by its length. Replaces the previous subscription, and NXT1 answers with its layout.
+// decimation 0 ends the subscription, and NXT1 answers with the whole registry instead.
+#define SUBSCRIBE_BT_FIELDS(X)																		\
+	X(decimation,			uint8_t,	uint8_t,	0,						subscribe.decimation)	\
+	X(count,				uint8_t,	uint8_t,	0,						subscribe.count)
+
+#define SUBSCRIBE_BT_BYTES	(PACKET_BYTES(SUBSCRIBE_BT_FIELDS) + TELEMETRY_SUB_MAX)
+
+// NXT1 -> PC description of a subscription's record, or of the registry: [TELEMETRY_SCHEMA][TELEMETRY_SCHEMA_ENTRIES
+// entries of (id, type, name)]. Told apart by its length. The description has total entries, sent in as many packets
+// as they need: this one holds entry first and on, and is padded with zeros after the last. layout numbers the
+// subscription, 1 to 255 and round again, and is 0 for the registry. A record is the subscribed signals in entry
+// order, recordBytes in all.
+#define TELEMETRY_SCHEMA_FIELDS(X)																	\
+	X(layout,				uint8_t,	uint8_t,	0,						schema.layout)			\
+	X(decimation,			uint8_t,	uint8_t,	0,						schema.decimation)		\
+	X(total,				uint8_t,	uint8_t,	0,						schema.total)			\
+	X(first,				uint8_t,	uint8_t,	0,						schema.first)			\
+	X(recordBytes,			uint8_t,	uint8_t,	0,						schema.record_bytes)
+
+#define TELEMETRY_SCHEMA_ENTRY_BYTES	(2 + TELEMETRY_NAME_CHARS)
+#define TELEMETRY_SCHEMA_ENTRIES		8
+#define TELEMETRY_SCHEMA_BT_BYTES		(PACKET_BYTES(TELEMETRY_SCHEMA_FIELDS) + TELEMETRY_SCHEMA_ENTRIES*TELEMETRY_SCHEMA_ENTRY_BYTES)
+
+// NXT1 -> PC subscribed records: [TELEMETRY_SUB][count records][zero padding]. Told apart by its length. As with the
+// samples, seq numbers the records of a layout from 0, and a packet holds consecutive records of one layout only.
+// A subscription's record is at most TELEMETRY_SUB_RECORD_MAX bytes, so that at least one fits.
+#define TELEMETRY_SUB_FIELDS(X)																		\
+	X(layout,				uint8_t,	uint8_t,	0,						sub_frame.layout)		\
+	X(seq,					uint16_t,	uint16_t,	0,						sub_frame.seq)			\
+	X(count,				uint8_t,	uint8_t,	0,						sub_frame.count)
+
+#define TELEMETRY_SUB_BT_BYTES		120
+#define TELEMETRY_SUB_RECORD_MAX	((int)(TELEMETRY_SUB_BT_BYTES - PACKET_BYTES(TELEMETRY_SUB_FIELDS)))
+
+// LIVE PARAMETERS (see Parameters.h). The fields of jpmtr[] the PC may change without reflashing. X(name, field, min, max):
+// the parameter's id is PARAM_<name>, it is jpmtr[ji].field (a fix16_t), and values outside [min, max] are refused.
+// Angle and velocity limits stay within what RS485 carries, as targets are clamped to them.
+#define JOINT_PARAMETERS(X)											\
+	X(b0,		b[0],		-100.0f,	100.0f)						\
+	X(b1,		b[1],		-100.0f,	100.0f)						\
+	X(b2,		b[2],		-100.0f,	100.0f)						\
+	X(b3,		b[3],		-100.0f,	100.0f)						\
+	X(b4,		b[4],		-100.0f,	100.0f)						\
+	X(b5,		b[5],		-100.0f,	100.0f)						\
+	X(ka,		ka,			0.0f,		10.0f)						\
+	X(kp_p,		kp_p,		0.0f,		100.0f)						\
+	X(ki_p,		ki_p,		0.0f,		100.0f)						\
+	X(kd_p,		kd_p,		0.0f,		100.0f)						\
+	X(kp_v,		kp_v,		0.0f,		100.0f)						\
+	X(ki_v,		ki_v,		0.0f,		100.0f)						\
+	X(kd_v,		kd_v,		0.0f,		100.0f)						\
+	X(pmin,		pmin,		-RS485_RANGE,	RS485_RANGE)			\
+	X(pmax,		pmax,		-RS485_RANGE,	RS485_RANGE)			\
+	X(vmax,		vmax,		1.0f,		RS485_RANGE)				\
+	X(phome,	phome,		-RS485_RANGE,	RS485_RANGE)
+
+#define PARAM_ID(name, field, min, max)		PARAM_##name,
+enum joint_param_id { JOINT_PARAMETERS(PARAM_ID) PARAM_COUNT };
+
+enum param_op {
+	PARAM_GET,				// Staged value of a parameter
+	PARAM_SET,				// Stages a value
+	PARAM_COMMIT			// Switches all three NXTs to the staged table, as version
+};
+
+enum param_result {
+	PARAM_OK,
+	PARAM_UNKNOWN,			// No such joint, parameter or operation
+	PARAM_OUT_OF_RANGE,		// Outside the parameter's [min, max]
+	PARAM_INCONSISTENT,		// Commit: a joint's staged pmin, pmax and phome are out of order
+	PARAM_BUSY,				// A commit is still on its way to NXT2/3, or waiting for its switch time
+	PARAM_PENDING,			// Commit: accepted, and on its way to NXT2/3. Another reply follows.
+	PARAM_FAILED			// Commit: NXT2 or NXT3 refused it or did not answer. NXT1 did not switch.
+};
+
+// PC -> NXT1 parameter request. Told apart by its length. joint is the joint index (0-5). value is used by PARAM_SET,
+// version by PARAM_COMMIT. NXT1 answers every request with a PARAM_REPLY_BT.
+#define PARAM_BT_FIELDS(X)																			\
+	X(op,					uint8_t,	uint8_t,	0,						param_req.op)			\
+	X(joint,				uint8_t,	uint8_t,	0,						param_req.joint)		\
+	X(param,				uint8_t,	uint8_t,	0,						param_req.param)		\
+	X(value,				fix16_t,	fix16_t,	0,						param_req.value)		\
+	X(version,				uint16_t,	uint16_t,	0,						param_req.version)
+
+// NXT1 -> PC answer to a PARAM_BT: the request, with value the parameter's staged value, result an enum param_result
+// and version that of the table in use. A commit is answered PARAM_PENDING first, then PARAM_OK or PARAM_FAILED, with
+// version the one committed. After PARAM_OK the switch follows within PARAM_SWITCH_DELAY_MS.
+#define PARAM_REPLY_BT_FIELDS(X)																	\
+	X(op,					uint8_t,	uint8_t,	0,						param_reply.op)			\
+	X(joint,				uint8_t,	uint8_t,	0,						param_reply.joint)		\
+	X(param,				uint8_t,	uint8_t,	0,						param_reply.param)		\
+	X(value,				fix16_t,	fix16_t,	0,						param_reply.value)		\
+	X(result,				uint8_t,	uint8_t,	0,						param_reply.result)		\
+	X(version,				uint16_t,	uint16_t,	0,						param_reply.version)
+
+
+// RS485 BUS CAPTURE (see RS485.h). A stream of records, little-endian: [type][systick ms, uint32_t][length][data]
+#define CAPTURE_RECORD_HEADER	6
+#define CAPTURE_PAD				0		// A single byte with no header, filling the last CAPTURE_BT packet
+#define CAPTURE_START			1		// Capture started. Data: rate index in use.
+#define CAPTURE_CYCLE			2		// TASK_MOTORREG started a cycle at this time. No data.
+#define CAPTURE_RX				3		// Frame received, as it was on the wire: COBS bytes between two delimiters.
+										// The time is that of its last byte.
+#define CAPTURE_RX_TIMEOUT		4		// Partial frame, dropped RS485_FRAME_TIMEOUT_MS after this time, its last byte
+#define CAPTURE_RX_OVERFLOW		5		// Frame too long for the receive buffer. Data: its first bytes only.
+#define CAPTURE_TX				6		// This NXT sent a frame. Data: seq, then its length on the wire.
+#define CAPTURE_GAP				7		// The buffer was full, and records were dropped before this one. Data: how many (uint16_t).
+
+
+// GENERATORS
+
+// Size of a packet on the wire, e.g. PACKET_BYTES(PACKET_NXT1_FIELDS). A constant expression.
+// PACKET_RAW_BYTES is the size it would have without quantization.
+#define PACKET_FIELD_SIZE(name, type, wire, shift, expr)		+ sizeof(wire)
+#define PACKET_FIELD_RAW_SIZE(name, type, wire, shift, expr)	+ sizeof(type)
+#define PACKET_BYTES(FIELDS)									(0 FIELDS(PACKET_FIELD_SIZE))
+#define PACKET_RAW_BYTES(FIELDS)								(0 FIELDS(PACKET_FIELD_RAW_SIZE))
+
+// fix16_t -> int16_t in steps of 2^PACKET_SHIFT(shift) LSBs (>= 1), rounded to nearest. Out of range values
+// saturate. With PACKET_SENTINELS they saturate to INT16_MIN/MAX, which decode to fix16_minimum/maximum, so
+// DISABLE_PT and DISABLE_VT survive the trip. Without, e.g. a measured state, they clamp to +-(INT16_MAX-1)
+// and decode as that value: a velocity spike must not arrive as fix16_maximum and be extrapolated from.
+#define PACKET_SENTINELS		0x10
+#define PACKET_SHIFT(shift)		((shift) & 0x0F)
+
+static inline int16_t packet_quantize(int32_t v, int shift)
+{
+	int s = PACKET_SHIFT(shift);
+	int16_t hi = (shift & PACKET_SENTINELS) ? INT16_MAX : INT16_MAX-1;
+	int16_t lo = (shift & PACKET_SENTINELS) ? INT16_MIN : -(INT16_MAX-1);
+	int32_t q = (v >> s) + ((v >> (s-1)) & 1);
+	if(q >= hi)	return hi;
+	if(q <= lo)	return lo;
+	return (int16_t)q;
+}
+
+static inline int32_t packet_dequantize(int16_t q, int shift)
+{
+	if(shift & PACKET_SENTINELS)
+	{
+		if(q == INT16_MAX)	return INT32_MAX;
+		if(q == INT16_MIN)	return INT32_MIN;
+	}
+	return (int32_t)q * (1 << PACKET_SHIFT(shift));
+}
+
+// Firmware codec. DEFINE_PACKET_CODEC(nxt1, PACKET_NXT1_FIELDS) defines
+//	static inline void encode_nxt1(uint8_t* buf)		copies every field's variable into buf
+//	static inline void decode_nxt1(const uint8_t* buf)	copies buf into every field's variable
+// as straight-line code with one fixed-size memcpy per field (the quantized/raw choice is a constant and
+// folds away). Compilation fails if a variable's size does not match its type, or if a quantized field's
+// wire type is not 16 bits. Requires <string.h>.
+#define PACKET_QUANTIZED(type, wire)			(sizeof(wire) < sizeof(type))
+#define PACKET_SIZE_CHECK(type, wire, expr)		(sizeof(type) + 0*sizeof(char[(sizeof(expr) == sizeof(type) &&	\
+												(sizeof(wire) == sizeof(type) || sizeof(wire) == sizeof(int16_t))) ? 1 : -1]))
+#define PACKET_ENCODE_FIELD(name, type, wire, shift, expr)																\
+	if(PACKET_QUANTIZED(type, wire))	{ int16_t q = packet_quantize((int32_t)(expr), shift);	memcpy(buf, &q, sizeof(q)); }	\
+	else								memcpy(buf, &(expr), PACKET_SIZE_CHECK(type, wire, expr));						\
+	buf += sizeof(wire);
+#define PACKET_DECODE_FIELD(name, type, wire, shift, expr)																\
+	if(PACKET_QUANTIZED(type, wire))	{ int16_t q;	memcpy(&q, buf, sizeof(q));	(expr) = (type)packet_dequantize(q, shift); }	\
+	else								memcpy(&(expr), buf, PACKET_SIZE_CHECK(type, wire, expr));						\
+	buf += sizeof(wire);
+#define DEFINE_PACKET_CODEC(packet, FIELDS)															\
+	static inline void encode_##packet(uint8_t* buf)		{ FIELDS(PACKET_ENCODE_FIELD) }			\
+	static inline void decode_##packet(const uint8_t* buf)	{ FIELDS(PACKET_DECODE_FIELD) }
+
+// Delta coding. { FIELDS(PACKET_FIELD_WIRE_BYTES) } initializes an array of the wire size of each field.
+// A field's delta is the difference of its wire values (little-endian), sign-extended from the field's width,
+// zig-zag mapped (0, -1, 1, -2 ... to 0, 1, 2, 3 ...) and written as a varint: 7 bits per byte, low bits first,
+// the top bit set on every byte but the last. A field of n bytes takes 1 to PACKET_DELTA_MAX_BYTES(n) bytes.
+// PACKET_DELTA_BYTES(FIELDS) is the longest a delta coded packet can be.
+#define PACKET_FIELD_WIRE_BYTES(name, type, wire, shift, expr)	sizeof(wire),
+#define PACKET_DELTA_MAX_BYTES(n)								(((n)*8 + 6) / 7)
+#define PACKET_FIELD_DELTA_SIZE(name, type, wire, shift, expr)	+ PACKET_DELTA_MAX_BYTES(sizeof(wire))
+#define PACKET_DELTA_BYTES(FIELDS)								(0 FIELDS(PACKET_FIELD_DELTA_SIZE))
+
+static inline uint32_t packet_get_wire(const uint8_t* buf, uint8_t n)
+{
+	uint32_t v = 0;
+	for(int i=n-1; i>=0; i--)
+		v = (v << 8) | buf[i];
+	return v;
+}
+
+static inline void packet_set_wire(uint8_t* buf, uint8_t n, uint32_t v)
+{
+	for(int i=0; i<n; i++, v >>= 8)
+		buf[i] = (uint8_t)v;
+}
+
+// Writes the delta of the n byte field at cur from the one at prev to buf. Returns the bytes written.
+static inline uint8_t packet_put_delta(uint8_t* buf, const uint8_t* cur, const uint8_t* prev, uint8_t n)
+{
+	uint8_t unused = 32 - 8*n;
+	int32_t d = (int32_t)((packet_get_wire(cur, n) - packet_get_wire(prev, n)) << unused) >> unused;
+	uint32_t z = ((uint32_t)d << 1) ^ (uint32_t)(d >> 31);
+	uint8_t len = 0;
+	for(; z >= 0x80; z >>= 7)
+		buf[len++] = (uint8_t)(z | 0x80);
+	buf[len++] = (uint8_t)z;
+	return len;
+}
+
+// Reads a delta from buf and applies it to the n byte field at prev, writing the result to cur. Returns the bytes read.
+static inline uint8_t packet_get_delta(const uint8_t* buf, uint8_t* cur, const uint8_t* prev, uint8_t n)
+{
+	uint32_t z = 0;
+	uint8_t len = 0;
+	do
+		z |= (uint32_t)(buf[len] & 0x7F) << (7*len);
+	while((buf[len++] & 0x80) && len < PACKET_DELTA_MAX_BYTES(4));
+	uint32_t d = (z >> 1) ^ (0 - (z & 1));
+	packet_set_wire(cur, n, packet_get_wire(prev, n) + d);
+	return len;
+}
+
+
+#endif /* SRC_COMMS_PACKETSCHEMA_H_ */
@@ -36,102 +36,169 @@ static BOOL promote_targets_to_global_state()
 	return success;
 }
 
-// PACKET DEFINITIONS
+// WAYPOINT FORWARDING (see PacketSchema.h)
+
+static struct waypoint wpt;		// Waypoint being forwarded from NXT1 to NXT2/3. joint_mask == 0 if there is none this cycle.
+static uint8_t wpt_seq;			// Its wptSeq, 0 if there is none
+static uint8_t wpt_ack[2];		// wptSeq of the latest waypoint NXT2 and NXT3 received, indexed by header - PACKET_NXT2_HEADER
+
+#if NXT == 1
+	static uint8_t wpt_last_seq;	// wptSeq of the latest waypoint sent
+#endif
+
+// CLOCK SYNC (see PacketSchema.h and Timing.h)
+
+static struct clock_sync_fields{
+	uint16_t sample_ms;
+	uint32_t tx_ms;
+	uint8_t seq[2];					// Indexed by header - PACKET_NXT2_HEADER
+	uint8_t hold_ms[2];
+} sync;
+
+#if NXT == 1
+	static uint32_t sync_rx_ms[2];		// systick when the latest frames from NXT2 and NXT3 arrived
+	static BOOL sync_rx_valid[2];		// Arrived since the last beacon
+#else
+	static uint32_t sync_tx_ms[4];		// systick when this NXT's latest frames were sent, indexed by seq % 4
+	static uint8_t sync_tx_seq[4];
+#endif
+
+static uint16_t sample_stamp(uint32_t t)			// sampleMs of states sampled at global time t
+{
+	if(global_time_error_ms() == CLOCK_UNSYNCED)
+		return RS485_SAMPLE_UNSYNCED;
+	return ((uint16_t)t == RS485_SAMPLE_UNSYNCED) ? RS485_SAMPLE_UNSYNCED-1 : (uint16_t)t;
+}
+
+static uint32_t sample_time(uint16_t sample_ms)		// Global time of a sampleMs field, which is at most 65s old
+{
+	if(sample_ms == RS485_SAMPLE_UNSYNCED || global_time_error_ms() == CLOCK_UNSYNCED)
+		return JOINT_STATE_UNSYNCED;
+	uint32_t now = global_time_ms();
+	return now - (uint16_t)((uint16_t)now - sample_ms);
+}
+
+// BAUD RATE NEGOTIATION (see RS485.h)
+
+static const uint32_t baud_rates[RS485_NUM_BAUDS] = RS485_BAUD_RATES;
 
-struct pointer_size_pair { uint8_t* val; size_t size;	};
+static struct baud_command{			// Sent by NXT1
+	uint8_t next;					// Rate index of the announced switch
+	uint8_t countdown;				// Cycles until it, 0 if none is announced
+	uint8_t probe;					// Probe number, 0 for a permanent switch
+} baud;
 
+static struct probe_result{			// Sent by NXT2/3, indexed by header - PACKET_NXT2_HEADER
+	uint8_t probe;					// Probe number, 0 before the first
+	uint8_t frames;					// Fewest frames received from any other NXT during it
+} probe_report[2];
+
+// PACKET DEFINITIONS (see PacketSchema.h)
 
 #define NO_PACKET	0x00
 
+#define PACKET_NXT1_BYTES	PACKET_BYTES(PACKET_NXT1_FIELDS)
+#define PACKET_NXT2_BYTES	PACKET_BYTES(PACKET_NXT2_FIELDS)
+#define PACKET_NXT3_BYTES	PACKET_BYTES(PACKET_NXT3_FIELDS)
+
+DEFINE_PACKET_CODEC(nxt1, PACKET_NXT1_FIELDS)
+DEFINE_PACKET_CODEC(nxt2, PACKET_NXT2_FIELDS)
+DEFINE_PACKET_CODEC(nxt3, PACKET_NXT3_FIELDS)
+
+#if NXT == 1
+	#define OWN_HEADER	PACKET_NXT1_HEADER
+	#define OWN_BYTES	PACKET_NXT1_BYTES
+	#define OWN_SLOT_MS	RS485_SLOT_NXT1_MS
+#elif NXT == 2
+	#define OWN_HEADER	PACKET_NXT2_HEADER
+	#define OWN_BYTES	PACKET_NXT2_BYTES
+	#define OWN_SLOT_MS	RS485_SLOT_NXT2_MS
+#elif NXT == 3
+	#define OWN_HEADER	PACKET_NXT3_HEADER
+	#define OWN_BYTES	PACKET_NXT3_BYTES
+	#define OWN_SLOT_MS	RS485_SLOT_NXT3_MS
+#endif
 
-#define PACKET_NXT1_HEADER	0x01
-#define PACKET_NXT1_VAL0	jtgt[0].pt	// 4
-#define PACKET_NXT1_VAL1	jtgt[0].vt	// 4
-#define PACKET_NXT1_VAL2	jtgt[2].pt	// 4
-#define PACKET_NXT1_VAL3	jtgt[2].vt	// 4
-#define PACKET_NXT1_VAL4	jtgt[3].pt	// 4
-#define PACKET_NXT1_VAL5	jtgt[3].vt	// 4
-#define PACKET_NXT1_VAL6	jtgt[4].pt	// 4
-#define PACKET_NXT1_VAL7	jtgt[4].vt	// 4
-#define PACKET_NXT1_VAL8	j[1].p		// 4
-#define PACKET_NXT1_VAL9	enable_joint_limits		// 1
-#define PACKET_NXT1_VAL10	tmux		// 1
-#define PACKET_NXT1_VAL11	rcx			// 1
-#define PACKET_NXT1_VALS 12
-#define PACKET_NXT1_BYTES (sizeof(PACKET_NXT1_VAL0)+sizeof(PACKET_NXT1_VAL1)+sizeof(PACKET_NXT1_VAL2)+sizeof(PACKET_NXT1_VAL3)+sizeof(PACKET_NXT1_VAL4)+sizeof(PACKET_NXT1_VAL5)+sizeof(PACKET_NXT1_VAL6)+sizeof(PACKET_NXT1_VAL7)+sizeof(PACKET_NXT1_VAL8)+sizeof(PACKET_NXT1_VAL9)+sizeof(PACKET_NXT1_VAL10)+sizeof(PACKET_NXT1_VAL11))
-static const struct pointer_size_pair packet_definition_nxt1[PACKET_NXT1_VALS] = {
-	{ .val=(uint8_t*)&( PACKET_NXT1_VAL0	),	.size=sizeof( PACKET_NXT1_VAL0	)	},
-	{ .val=(uint8_t*)&( PACKET_NXT1_VAL1	),	.size=sizeof( PACKET_NXT1_VAL1	)	},
-	{ .val=(uint8_t*)&( PACKET_NXT1_VAL2	),	.size=sizeof( PACKET_NXT1_VAL2	)	},
-	{ .val=(uint8_t*)&( PACKET_NXT1_VAL3	),	.size=sizeof( PACKET_NXT1_VAL3	)	},
-	{ .val=(uint8_t*)&( PACKET_NXT1_VAL4	),	.size=sizeof( PACKET_NXT1_VAL4	)	},
-	{ .val=(uint8_t*)&( PACKET_NXT1_VAL5	),	.size=sizeof( PACKET_NXT1_VAL5	)	},
-	{ .val=(uint8_t*)&( PACKET_NXT1_VAL6	),	.size=sizeof( PACKET_NXT1_VAL6	)	},
-	{ .val=(uint8_t*)&( PACKET_NXT1_VAL7	),	.size=sizeof( PACKET_NXT1_VAL7	)	},
-	{ .val=(uint8_t*)&( PACKET_NXT1_VAL8	),	.size=sizeof( PACKET_NXT1_VAL8	)	},
-	{ .val=(uint8_t*)&( PACKET_NXT1_VAL9	),	.size=sizeof( PACKET_NXT1_VAL9	)	},
-	{ .val=(uint8_t*)&( PACKET_NXT1_VAL10),	.size=sizeof( PACKET_NXT1_VAL10	)	},
-	{ .val=(uint8_t*)&( PACKET_NXT1_VAL11),	.size=sizeof( PACKET_NXT1_VAL11	)	}
-};
-
-
-#define PACKET_NXT2_HEADER	0x02
-#define PACKET_NXT2_VAL0	j[0].p		// 4
-#define PACKET_NXT2_VAL1	j[0].v		// 4
-#define PACKET_NXT2_VAL2	j[4].p		// 4
-#define PACKET_NXT2_VAL3	j[4].v		// 4
-#define PACKET_NXT2_VAL4	j[0].pwm	// 1
-#define PACKET_NXT2_VAL5	j[4].pwm	// 1
-#define PACKET_NXT2_VALS 6
-#define PACKET_NXT2_BYTES (sizeof(PACKET_NXT2_VAL0)+sizeof(PACKET_NXT2_VAL1)+sizeof(PACKET_NXT2_VAL2)+sizeof(PACKET_NXT2_VAL3)+sizeof(PACKET_NXT2_VAL4)+sizeof(PACKET_NXT2_VAL5))
-static const struct pointer_size_pair packet_definition_nxt2[PACKET_NXT2_VALS] = {
-	{ .val=(uint8_t*)&( PACKET_NXT2_VAL0	),	.size=sizeof( PACKET_NXT2_VAL0	)	},
-	{ .val=(uint8_t*)&( PACKET_NXT2_VAL1	),	.size=sizeof( PACKET_NXT2_VAL1	)	},
-	{ .val=(uint8_t*)&( PACKET_NXT2_VAL2	),	.size=sizeof( PACKET_NXT2_VAL2	)	},
-	{ .val=(uint8_t*)&( PACKET_NXT2_VAL3	),	.size=sizeof( PACKET_NXT2_VAL3	)	},
-	{ .val=(uint8_t*)&( PACKET_NXT2_VAL4	),	.size=sizeof( PACKET_NXT2_VAL4	)	},
-	{ .val=(uint8_t*)&( PACKET_NXT2_VAL5	),	.size=sizeof( PACKET_NXT2_VAL5	)	}
-};
-
-
-#define PACKET_NXT3_HEADER	0x03
-#define PACKET_NXT3_VAL0	j[2].p		// 4
-#define PACKET_NXT3_VAL1	j[2].v		// 4
-#define PACKET_NXT3_VAL2	j[3].p		// 4
-#define PACKET_NXT3_VAL3	j[3].v		// 4
-#define PACKET_NXT3_VAL4	j[2].pwm	// 1
-#define PACKET_NXT3_VAL5	j[3].pwm	// 1
-#define PACKET_NXT3_VAL6	ea1			// 1
-#define PACKET_NXT3_VAL7	ea2			// 1
-#define PACKET_NXT3_VAL8	ea3			// 1
-#define PACKET_NXT3_VALS 9
-#define PACKET_NXT3_BYTES (sizeof(PACKET_NXT3_VAL0)+sizeof(PACKET_NXT3_VAL1)+sizeof(PACKET_NXT3_VAL2)+sizeof(PACKET_NXT3_VAL3)+sizeof(PACKET_NXT3_VAL4)+sizeof(PACKET_NXT3_VAL5)+sizeof(PACKET_NXT3_VAL6)+sizeof(PACKET_NXT3_VAL7)+sizeof(PACKET_NXT3_VAL8))
-static const struct pointer_size_pair packet_definition_nxt3[PACKET_NXT3_VALS] = {
-	{ .val=(uint8_t*)&( PACKET_NXT3_VAL0	),	.size=sizeof( PACKET_NXT3_VAL0	)	},
-	{ .val=(uint8_t*)&( PACKET_NXT3_VAL1	),	.size=sizeof( PACKET_NXT3_VAL1	)	},
-	{ .val=(uint8_t*)&( PACKET_NXT3_VAL2	),	.size=sizeof( PACKET_NXT3_VAL2	)	},
-	{ .val=(uint8_t*)&( PACKET_NXT3_VAL3	),	.size=sizeof( PACKET_NXT3_VAL3	)	},
-	{ .val=(uint8_t*)&( PACKET_NXT3_VAL4	),	.size=sizeof( PACKET_NXT3_VAL4	)	},
-	{ .val=(uint8_t*)&( PACKET_NXT3_VAL5	),	.size=sizeof( PACKET_NXT3_VAL5	)	},
-	{ .val=(uint8_t*)&( PACKET_NXT3_VAL6	),	.size=sizeof( PACKET_NXT3_VAL6	)	},
-	{ .val=(uint8_t*)&( PACKET_NXT3_VAL7	),	.size=sizeof( PACKET_NXT3_VAL7	)	},
-	{ .val=(uint8_t*)&( PACKET_NXT3_VAL8	),	.size=sizeof( PACKET_NXT3_VAL8	)	}
-};
+#define FRAME_MAX_BYTES		(PACKET_NXT1_BYTES + RS485_FRAME_OVERHEAD + RS485_MSG_BUDGET)	// NXT1's packet is the largest
+#define OWN_FRAME_BITS		(RS485_WIRE_BYTES(OWN_BYTES) * 10)			// 10 bits per byte
 
 
 // PUBLIC VARIABLES
 
 uint32_t rs485_update_cycles;
+uint32_t rs485_crc_errors;
+uint32_t rs485_frame_errors;
+uint32_t rs485_lost_frames;
+uint32_t rs485_slot_overruns;
+uint32_t rs485_slot_late_max_ms;
+uint32_t rs485_sync_shifts;
+uint8_t rs485_baud_index;
+uint8_t rs485_baud_ceiling = RS485_NUM_BAUDS;
+uint32_t rs485_baud_fallbacks;
+uint8_t rs485_baud_cycles_per_s[RS485_NUM_BAUDS];
+#if RS485_CAPTURE
+	uint8_t rs485_capture = 0;
+	uint32_t rs485_capture_dropped;
+#endif
 
 
 // PRIVATE VARIABLES
 
 static enum rs485_state state;
-
-static uint8_t header = NO_PACKET;
-static uint8_t packet_nxt1[PACKET_NXT1_BYTES];
-static uint8_t packet_nxt2[PACKET_NXT2_BYTES];
-static uint8_t packet_nxt3[PACKET_NXT3_BYTES];
+static uint32_t sent_cycle_ms;				// task_motorreg_start_ms of the cycle this NXT last sent in
+
+#if NXT != 1
+	static BOOL synced = FALSE;				// TASK_MOTORREG is in phase with NXT1's
+	static uint32_t beacon_ms;				// systick when the latest beacon arrived
+	static int32_t phase_err_max;			// Largest regulator phase error in the current window (ms)
+	static uint8_t phase_samples;			// Beacons in the current window
+#endif
+
+static uint8_t tx_seq;
+static uint8_t rx_seq[4];					// Last sequence number received, indexed by header
+static BOOL rx_seq_valid[4];
+
+static uint8_t frame[FRAME_MAX_BYTES];					// Unencoded frame, being sent or received
+static uint8_t tx_wire[RS485_WIRE_BYTES(PACKET_NXT1_BYTES)];
+static uint8_t rx_wire[RS485_WIRE_BYTES(PACKET_NXT1_BYTES)];
+static uint32_t rx_len = 0;					// Encoded bytes of the frame being received. 0 between frames.
+static BOOL rx_overflow = FALSE;			// The frame being received is too long, and is dropped at its delimiter
+static uint32_t rx_last_byte_ms;
+
+static enum rs485_baud_state baud_state;
+static uint32_t cycle_ms;					// task_motorreg_start_ms of the cycle update_rs485() is in
+static uint32_t last_valid_ms;				// systick of the latest valid frame from another NXT
+static BOOL switch_pending = FALSE;
+static uint32_t switch_ms;					// The pending switch happens at the first cycle starting at or after this
+static uint8_t switch_index;
+static uint8_t switch_probe;
+static uint8_t committed_index;				// Rate to return to when a probe ends
+static uint8_t probe_num;					// Current or latest probe
+static uint8_t probe_index;					// Rate index it is at
+static uint32_t probe_end_ms;				// RS485_BAUD_PROBING ends at the first cycle starting at or after this
+static uint8_t probe_frames[4];				// Valid frames received during the probe, indexed by header
+
+#if NXT == 1
+	static uint8_t heard;					// Bit per header of the frames received this cycle
+	static uint8_t probe_own_frames;		// NXT1's result for the latest probe
+	static uint8_t best_index;				// Fastest rate that passed its probe
+	static uint8_t state_cycles;			// Cycles in the current state (settled cycles in RS485_BAUD_SETTLING)
+	static uint8_t complete_cycles;			// Cycles with frames from both NXT2 and NXT3, in the probe or error window
+	static uint8_t silent_cycles[2];		// Cycles since the latest frame from NXT2 and NXT3
+	static uint16_t window_errors;			// Errors in the error window so far, not counting the bus error counters
+	static uint32_t window_bus_errors;		// rs485_crc_errors + rs485_frame_errors + rs485_lost_frames when the window started
+#endif
+
+#if RS485_CAPTURE
+	#if (RS485_CAPTURE_BYTES & (RS485_CAPTURE_BYTES - 1)) != 0
+		#error "RS485_CAPTURE_BYTES must be a power of 2"
+	#endif
+	static uint8_t capture_buf[RS485_CAPTURE_BYTES];
+	static uint32_t capture_head;			// Stream position of the next byte written. Both run freely and wrap in the buffer.
+	static uint32_t capture_tail;			// Stream position of the next byte read
+	static BOOL capturing = FALSE;
+	static uint16_t capture_gap;			// Records dropped since the last one written
+#endif
 
 
 // FUNCTION DEFINITIONS
@@ -139,7 +206,7 @@ static uint8_t packet_nxt3[PACKET_NXT3_BYTES];
 void init_rs485(void)
 {
 	state = RS485_UNINITIALIZED;
-	ecrobot_init_rs485(DEFAULT_BAUD_RATE_RS485);
+	ecrobot_init_rs485(baud_rates[0]);
 }
 
 
@@ -156,287 +223,661 @@ enum rs485_state get_rs485_state()
 }
 
 
+enum rs485_baud_state get_rs485_baud_state()
+{
+	return baud_state;
+}
+
+
 void disp_rs485_state(int starty)
 {
 	display_goto_xy(0, starty);
 	switch(state){
 		case RS485_UNINITIALIZED: 	display_string("RS: NO INIT");			break;
-		case RS485_SENDING_PACKET: 	display_string("RS: SENDING_PACKET");	break;
-		case RS485_WAITING_NXT1: 	display_string("RS: WAITING_NXT1");		break;
-		case RS485_RECEIVING_NXT1: 	display_string("RS: RECEIVING_NXT1");	break;
-		case RS485_WAITING_NXT2: 	display_string("RS: WAITING_NXT2");		break;
-		case RS485_RECEIVING_NXT2: 	display_string("RS: RECEIVING_NXT2");	break;
-		case RS485_WAITING_NXT3: 	display_string("RS: WAITING_NXT3");		break;
-		case RS485_RECEIVING_NXT3: 	display_string("RS: RECEIVING_NXT3");	break;
+		case RS485_SYNCING: 		display_string("RS: SYNCING");			break;
+		case RS485_WAITING_SLOT: 	display_string("RS: WAITING_SLOT");		break;
+		case RS485_RECEIVING: 		display_string("RS: RECEIVING");		break;
 	}
 }
 
 
-static void send_header(void)
+void disp_rs485_baud(int starty)
 {
-	uint8_t temp;
-	#if NXT == 1
-		temp = PACKET_NXT1_HEADER;
-	#elif NXT == 2
-		temp = PACKET_NXT2_HEADER;
-	#elif NXT == 3
-		temp = PACKET_NXT3_HEADER;
-	#endif
-	ecrobot_send_rs485(&temp, 0, 1);
+	display_goto_xy(0, starty);
+	switch(baud_state){
+		case RS485_BAUD_SETTLING:	display_string("BD: SETTLING");		break;
+		case RS485_BAUD_ANNOUNCING:	display_string("BD: ANNOUNCING");	break;
+		case RS485_BAUD_PROBING:	display_string("BD: PROBING");		break;
+		case RS485_BAUD_REPORTING:	display_string("BD: REPORTING");	break;
+		case RS485_BAUD_RUNNING:	display_string("BD: RUNNING");		break;
+	}
+	display_goto_xy(14, starty);	display_unsigned(rs485_baud_fallbacks, 2);
+	display_goto_xy(0, starty+1);	display_string("kBaud cyc/s");
+	for(int i=0; i<RS485_NUM_BAUDS; i++)
+	{
+		display_goto_xy(0, starty+2+i);		display_unsigned(baud_rates[i]/1000, 5);
+		display_goto_xy(7, starty+2+i);		display_unsigned(rs485_baud_cycles_per_s[i], 3);
+		display_goto_xy(11, starty+2+i);
+		if(i == rs485_baud_index)			display_string("<");		// In use
+		else if(i >= rs485_baud_ceiling)	display_string("x");		// Failed
+	}
 }
 
 
-static uint8_t read_header(void)
+static uint32_t packet_bytes(uint8_t header)	// Packet size for a header. 0 if the header is unknown.
 {
-	if(ecrobot_read_rs485(&header, 0, 1) == 0)			// If no new data has arrived,
-		header = NO_PACKET;								//  set header to indicate accordingly.
-	return header;
+	switch(header)
+	{
+		case PACKET_NXT1_HEADER: return PACKET_NXT1_BYTES;
+		case PACKET_NXT2_HEADER: return PACKET_NXT2_BYTES;
+		case PACKET_NXT3_HEADER: return PACKET_NXT3_BYTES;
+	}
+	return 0;
 }
 
 
 static void flush_buffer(void)
 {
-	header = NO_PACKET;
+	rx_len = 0;
+	rx_overflow = FALSE;
 	uint8_t temp;
 	while(ecrobot_read_rs485(&temp, 0, 1) != 0);
 }
 
 
-static void send_packet(void)
+#if RS485_CAPTURE
+static void capture_bytes(const uint8_t* data, uint32_t len)
 {
-	get_targets_from_global_state();	// Read global targets into local variables, in case any targets are about to be transmitted.
-
-	uint32_t offset = 0;
-	#if NXT == 1
-		for(int i=0; i<PACKET_NXT1_VALS; i++)
-		{
-			uint8_t* val = packet_definition_nxt1[i].val;
-			size_t size = packet_definition_nxt1[i].size;
-			memcpy(packet_nxt1+offset, val, size);
-			offset+=size;
-		}
-		ecrobot_send_rs485(packet_nxt1, 0, PACKET_NXT1_BYTES);
-	#elif NXT == 2
-		for(int i=0; i<PACKET_NXT2_VALS; i++)
-		{
-			uint8_t* val = packet_definition_nxt2[i].val;
-			size_t size = packet_definition_nxt2[i].size;
-			memcpy(packet_nxt2+offset, val, size);
-			offset+=size;
-		}
-		ecrobot_send_rs485(packet_nxt2, 0, PACKET_NXT2_BYTES);
-	#elif NXT == 3
-		for(int i=0; i<PACKET_NXT3_VALS; i++)
-		{
-			uint8_t* val = packet_definition_nxt3[i].val;
-			size_t size = packet_definition_nxt3[i].size;
-			memcpy(packet_nxt3+offset, val, size);
-			offset+=size;
-		}
-		ecrobot_send_rs485(packet_nxt3, 0, PACKET_NXT3_BYTES);
-	#endif
+	for(uint32_t i=0; i<len; i++)
+		capture_buf[(capture_head++) & (RS485_CAPTURE_BYTES - 1)] = data[i];
 }
 
 
-static uint32_t read_packet()	//Attempts to read and parse the packet specified by header. Returns 0 when completed.
+static void capture_record(uint8_t type, uint32_t t, const uint8_t* data, uint32_t len)	// Dropped if the buffer is full
 {
-	uint8_t* packet = packet_nxt1;
-	uint32_t size = 0;
-	static uint32_t bytes_remaining = 0;
-	switch(header)				//Assign packet based on last header that was received
+	if(!capturing)
+		return;
+	uint32_t bytes = CAPTURE_RECORD_HEADER + len + ((capture_gap > 0) ? CAPTURE_RECORD_HEADER + 2 : 0);
+	if(capture_head - capture_tail + bytes > RS485_CAPTURE_BYTES)
 	{
-		case PACKET_NXT1_HEADER: packet = packet_nxt1;	size = PACKET_NXT1_BYTES; break;
-		case PACKET_NXT2_HEADER: packet = packet_nxt2;	size = PACKET_NXT2_BYTES; break;
-		case PACKET_NXT3_HEADER: packet = packet_nxt3;	size = PACKET_NXT3_BYTES; break;
+		if(capture_gap < UINT16_MAX)
+			capture_gap++;
+		rs485_capture_dropped++;
+		return;
 	}
 
-	if(bytes_remaining == 0)	//If function starts out with bytes_remaining == 0, this is the start of a new packet.
-		bytes_remaining = size;
+	uint8_t header[CAPTURE_RECORD_HEADER] = { CAPTURE_GAP, (uint8_t)t, (uint8_t)(t >> 8), (uint8_t)(t >> 16), (uint8_t)(t >> 24), 2 };
+	if(capture_gap > 0)					// Marks where the stream is incomplete
+	{
+		uint8_t gap[2] = { (uint8_t)capture_gap, (uint8_t)(capture_gap >> 8) };
+		capture_bytes(header, CAPTURE_RECORD_HEADER);
+		capture_bytes(gap, 2);
+		capture_gap = 0;
+	}
+	header[0] = type;
+	header[5] = (uint8_t)len;
+	capture_bytes(header, CAPTURE_RECORD_HEADER);
+	capture_bytes(data, len);
+}
 
-	bytes_remaining -= ecrobot_read_rs485(packet, size-bytes_remaining, bytes_remaining);
 
-	if(bytes_remaining == 0)	//If bytes_remaining == 0 at this point, the packet is finished being read, so parse accordingly.
+static void update_capture(void)		// Starts or stops capturing when the PC asks
+{
+	if(rs485_capture && !capturing)
 	{
-		get_targets_from_global_state();	// Read global targets into local variables. Possibly not all local targets will be set via this transmission.
+		capture_head = 0;
+		capture_tail = 0;
+		capture_gap = 0;
+		rs485_capture_dropped = 0;
+		capturing = TRUE;
+		capture_record(CAPTURE_START, systick_get_ms(), &rs485_baud_index, 1);
+	}
+	else if(!rs485_capture && capturing)
+		capturing = FALSE;				// What is buffered can still be read
+}
 
-		uint8_t offset = 0;
-		switch(header)
-		{
-			case PACKET_NXT1_HEADER:
-				for(int i=0; i<PACKET_NXT1_VALS; i++)
-				{
-					uint8_t* val = packet_definition_nxt1[i].val;
-					size_t size = packet_definition_nxt1[i].size;
-					memcpy(val, packet_nxt1+offset, size);
-					offset+=size;
-				}
-				break;
-			case PACKET_NXT2_HEADER:
-				for(int i=0; i<PACKET_NXT2_VALS; i++)
-				{
-					uint8_t* val = packet_definition_nxt2[i].val;
-					size_t size = packet_definition_nxt2[i].size;
-					memcpy(val, packet_nxt2+offset, size);
-					offset+=size;
-				}
-				break;
-			case PACKET_NXT3_HEADER:
-				for(int i=0; i<PACKET_NXT3_VALS; i++)
-				{
-					uint8_t* val = packet_definition_nxt3[i].val;
-					size_t size = packet_definition_nxt3[i].size;
-					memcpy(val, packet_nxt3+offset, size);
-					offset+=size;
-				}
-				break;
-		}
 
-		promote_targets_to_global_state();	// Write updated local targets to global targets (using the target control priority system)
+uint32_t get_rs485_capture_bytes(void)
+{
+	return capture_head - capture_tail;
+}
+
+
+uint32_t read_rs485_capture(uint8_t* buf, uint32_t max, uint32_t* pos)
+{
+	uint32_t n = capture_head - capture_tail;
+	if(n > max)
+		n = max;
+	*pos = capture_tail;
+	for(uint32_t i=0; i<n; i++)
+		buf[i] = capture_buf[(capture_tail + i) & (RS485_CAPTURE_BYTES - 1)];
+	capture_tail += n;
+	return n;
+}
+#endif
+
+
+#if NXT != 1
+static void follow_beacon(uint32_t rx_ms)		// Measures the phase of TASK_MOTORREG against NXT1's, and shifts it once per window if it is off
+{
+	// NXT1's TASK_MOTORREG started RS485_SLOT_NXT1_MS before its beacon. Reading the beacon late (preemption, a long
+	// background loop) only ever makes the error look more negative, so the largest error of a window is the truest.
+	uint32_t cycle_start = rx_ms - RS485_SLOT_NXT1_MS;
+	uint32_t own_start = task_motorreg_start_ms;
+	int32_t err = (int32_t)(own_start - cycle_start) % MOTORREG_PERIOD_MS;
+	if(err >= MOTORREG_PERIOD_MS/2)			err -= MOTORREG_PERIOD_MS;
+	else if(err < -MOTORREG_PERIOD_MS/2)	err += MOTORREG_PERIOD_MS;
+
+	if(phase_samples == 0 || err > phase_err_max)
+		phase_err_max = err;
+	beacon_ms = rx_ms;
+	if(++phase_samples < RS485_SYNC_WINDOW)
+		return;
+	phase_samples = 0;
+
+	if(baud_state == RS485_BAUD_PROBING)	// Relocking stops this NXT sending for a window, which would fail the probe
+		return;
+	if(phase_err_max >= -RS485_SYNC_TOLERANCE_MS && phase_err_max <= RS485_SYNC_TOLERANCE_MS)
+	{
+		synced = TRUE;
+		return;
 	}
 
-	return bytes_remaining;
+	// Restart ALARM_MOTORREG so that its next expiry lands on the start of one of NXT1's cycles
+	int32_t delay = (int32_t)(own_start - phase_err_max + MOTORREG_PERIOD_MS - systick_get_ms());
+	while(delay < 1)
+		delay += MOTORREG_PERIOD_MS;
+	CancelAlarm(ALARM_MOTORREG);
+	SetRelAlarm(ALARM_MOTORREG, (TickType)delay, MOTORREG_PERIOD_MS);
+	rs485_sync_shifts++;
+	synced = FALSE;							// Confirm the new phase over another window before sending
 }
+#endif
 
 
-void update_rs485()
+#if NXT != 1
+static void follow_clock(uint32_t rx_ms)		// Passes the exchange that the beacon just completed to the clock estimator
+{
+	uint8_t k = OWN_HEADER - PACKET_NXT2_HEADER;
+	uint8_t seq = sync.seq[k];
+	if(sync.hold_ms[k] == RS485_SYNC_NO_HOLD || sync_tx_seq[seq % 4] != seq)		// NXT1 missed this NXT's frame
+		return;
+	add_clock_sample(sync_tx_ms[seq % 4], sync.tx_ms - sync.hold_ms[k], sync.tx_ms, rx_ms);
+}
+#endif
+
+
+static void set_baud(uint8_t index)		// Only called at the start of a cycle, when the bus is quiet
+{
+	ecrobot_term_rs485();
+	ecrobot_init_rs485(baud_rates[index]);
+	flush_buffer();
+	rs485_baud_index = index;
+	last_valid_ms = systick_get_ms();
+}
+
+
+static void fall_back(uint8_t index)		// Returns to a slower rate at once, without announcing it
 {
+	switch_pending = FALSE;
+	committed_index = index;
+	set_baud(index);
+	rs485_baud_fallbacks++;
 	#if NXT == 1
+		state_cycles = 0;
+		baud_state = RS485_BAUD_SETTLING;
+	#else
+		baud_state = RS485_BAUD_RUNNING;
+	#endif
+}
+
+
+#if NXT == 1
+static void announce_switch(uint8_t index, BOOL probe)	// Beacons count down to the switch for RS485_BAUD_COUNTDOWN cycles
+{
+	if(probe && ++probe_num == 0)
+		probe_num = 1;
+	switch_pending = TRUE;
+	switch_index = index;
+	switch_probe = probe ? probe_num : 0;
+	switch_ms = cycle_ms + RS485_BAUD_COUNTDOWN*MOTORREG_PERIOD_MS - MOTORREG_PERIOD_MS/2;
+	baud.next = index;
+	baud.probe = switch_probe;
+	baud_state = RS485_BAUD_ANNOUNCING;
+}
+
+
+static void probe_or_commit(uint8_t next)	// Probes rate next unless it failed before, or else commits the fastest rate that passed
+{
+	if(next < rs485_baud_ceiling)
+		announce_switch(next, TRUE);
+	else if(best_index != rs485_baud_index)
+		announce_switch(best_index, FALSE);
+	else
+		baud_state = RS485_BAUD_RUNNING;
+}
+
+
+static uint32_t bus_errors(void)
+{
+	return rs485_crc_errors + rs485_frame_errors + rs485_lost_frames;
+}
+
 
-		switch(state)
+static void start_error_window(void)
+{
+	state_cycles = 0;
+	complete_cycles = 0;
+	window_errors = 0;
+	window_bus_errors = bus_errors();
+}
+
+
+static void end_cycle(void)		// Evaluates the cycle that just ended
+{
+	// NXT2/3 go quiet for a few cycles whenever they relock to the beacon. Only longer silences count as errors.
+	BOOL complete = TRUE;
+	for(int k=0; k<2; k++)
+	{
+		if((heard >> (PACKET_NXT2_HEADER + k)) & 0x01)
+			silent_cycles[k] = 0;
+		else
 		{
-			case RS485_UNINITIALIZED:			//STATE: RS485_UNINITIALIZED
-				flush_buffer();
-				beep();
-				state = RS485_SENDING_PACKET;			//Start of the update cycle. Choose in what state the state machine begins.
-				break;
+			complete = FALSE;
+			if(silent_cycles[k] < UINT8_MAX && ++silent_cycles[k] > RS485_SILENT_CYCLES)
+				window_errors++;
+		}
+	}
+	heard = 0;
+	if(complete)
+		complete_cycles++;
 
-			case RS485_SENDING_PACKET:			//STATE: RS485_SENDING_PACKET
-				send_header();						//Send a 1-byte packet header.
-				send_packet();						//Send this NXT's data packet.
-				state = RS485_WAITING_NXT2;			//Transition to state: RS485_WAITING_NXT2
+	switch(baud_state)
+	{
+		case RS485_BAUD_SETTLING:
+			state_cycles = complete ? state_cycles + 1 : 0;
+			if(state_cycles >= RS485_SETTLE_CYCLES)
+			{
+				best_index = rs485_baud_index;
+				probe_or_commit(rs485_baud_index + 1);
+			}
+			break;
+
+		case RS485_BAUD_REPORTING:
+		{
+			BOOL reported = (probe_report[0].probe == probe_num && probe_report[1].probe == probe_num);
+			if(!reported && ++state_cycles < RS485_SETTLE_CYCLES)
 				break;
+			if(reported && probe_own_frames >= RS485_PROBE_MIN_FRAMES && probe_report[0].frames >= RS485_PROBE_MIN_FRAMES
+				&& probe_report[1].frames >= RS485_PROBE_MIN_FRAMES)
+				best_index = probe_index;
+			else
+				rs485_baud_ceiling = probe_index;
+			probe_or_commit(probe_index + 1);
+			break;
+		}
 
-			case RS485_WAITING_NXT2:			//STATE: RS485_WAITING_NXT2
-				if(read_header()==PACKET_NXT2_HEADER) //Attempt to read a 1-byte packet header. If correct response is received,
-					state = RS485_RECEIVING_NXT2;		//Transition to state: RS485_RECEIVING_NXT2
+		case RS485_BAUD_RUNNING:
+			if(++state_cycles < RS485_ERROR_WINDOW)
 				break;
+			rs485_baud_cycles_per_s[rs485_baud_index] = (uint8_t)(complete_cycles * 1000 / (RS485_ERROR_WINDOW * MOTORREG_PERIOD_MS));
+			if(window_errors + (bus_errors() - window_bus_errors) > RS485_FALLBACK_ERRORS && rs485_baud_index > 0)
+			{
+				rs485_baud_ceiling = rs485_baud_index;
+				rs485_baud_fallbacks++;
+				announce_switch(rs485_baud_index - 1, FALSE);
+			}
+			start_error_window();
+			break;
+
+		default:						// ANNOUNCING and PROBING: complete_cycles counts the probe
+			break;
+	}
+}
+#endif
 
-			case RS485_RECEIVING_NXT2:			//STATE: RS485_RECEIVING_NXT2
-				if(read_packet() == 0)				//Attempt to read packet. Check if full packet has been read (bytes_remaining == 0)
-					state = RS485_WAITING_NXT3;			//Transition to state: RS485_WAITING_NXT3
-				break;
 
-			case RS485_WAITING_NXT3:			//STATE: RS485_WAITING_NXT3
-				if(read_header()==PACKET_NXT3_HEADER) //Attempt to read a 1-byte packet header. If correct response is received,
-					state = RS485_RECEIVING_NXT3;		//Transition to state: RS485_RECEIVING_NXT3
-				break;
+#if NXT != 1
+static void follow_baud(uint32_t rx_ms)		// Schedules the switch a beacon announces
+{
+	if(baud.countdown == 0 || baud.next >= RS485_NUM_BAUDS || baud_state == RS485_BAUD_PROBING)
+		return;
+	switch_pending = TRUE;
+	switch_index = baud.next;
+	switch_probe = baud.probe;
+	switch_ms = rx_ms - RS485_SLOT_NXT1_MS + baud.countdown*MOTORREG_PERIOD_MS - MOTORREG_PERIOD_MS/2;
+	baud_state = RS485_BAUD_ANNOUNCING;
+}
+#endif
 
-			case RS485_RECEIVING_NXT3:			//STATE: RS485_RECEIVING_NXT3
-				if(read_packet() == 0)				//Attempt to read packet. Check if full packet has been read (bytes_remaining == 0)
-				{
-					state = RS485_SENDING_PACKET;		//Transition to state: RS485_SENDING_PACKET
-					rs485_update_cycles++;
-				}
-				break;
 
-			default:							//STATE: DEFAULT
-				error_buzz();						//An error in the state machine has occurred.
-				systick_wait_ms(1000);
-				break;
+static void start_cycle(void)		// Switches rate when a switch is due or a probe ends. Every NXT does so in the same cycle.
+{
+	if(switch_pending && (int32_t)(cycle_ms - switch_ms) >= 0)
+	{
+		switch_pending = FALSE;
+		set_baud(switch_index);
+		if(switch_probe != 0)
+		{
+			probe_num = switch_probe;
+			probe_index = switch_index;
+			probe_end_ms = cycle_ms + RS485_PROBE_CYCLES*MOTORREG_PERIOD_MS - MOTORREG_PERIOD_MS/2;
+			memset(probe_frames, 0, sizeof(probe_frames));
+			baud_state = RS485_BAUD_PROBING;
+		}
+		else
+		{
+			committed_index = switch_index;
+			baud_state = RS485_BAUD_RUNNING;
 		}
+		#if NXT == 1
+			start_error_window();
+		#endif
+	}
+	else if(baud_state == RS485_BAUD_PROBING && (int32_t)(cycle_ms - probe_end_ms) >= 0)
+	{
+		set_baud(committed_index);
+		uint8_t fewest = 0xFF;
+		for(uint8_t h=PACKET_NXT1_HEADER; h<=PACKET_NXT3_HEADER; h++)
+			if(h != OWN_HEADER && probe_frames[h] < fewest)
+				fewest = probe_frames[h];
+		#if NXT == 1
+			probe_own_frames = fewest;
+			rs485_baud_cycles_per_s[probe_index] = (uint8_t)(complete_cycles * 1000 / (RS485_PROBE_CYCLES * MOTORREG_PERIOD_MS));
+			state_cycles = 0;
+			baud_state = RS485_BAUD_REPORTING;
+		#else
+			probe_report[OWN_HEADER - PACKET_NXT2_HEADER].probe = probe_num;
+			probe_report[OWN_HEADER - PACKET_NXT2_HEADER].frames = fewest;
+			baud_state = RS485_BAUD_RUNNING;
+		#endif
+	}
+}
 
-	#elif NXT == 2
 
-		switch(state)
+#if NXT == 1
+static void forward_waypoint(void)		// One waypoint per frame, sent again until NXT2 and NXT3 have it
+{
+	if(wpt_seq != 0)
+	{
+		for(int k=0; k<2; k++)
+			if(wpt_ack[k] != wpt_seq && silent_cycles[k] <= RS485_SILENT_CYCLES)	// An NXT gone silent is not waited for
+				return;
+		release_forward_waypoint();
+	}
+	if(peek_forward_waypoint(&wpt))
+	{
+		wpt_last_seq = (wpt_last_seq == UINT8_MAX) ? 1 : wpt_last_seq + 1;
+		wpt_seq = wpt_last_seq;
+	}
+	else
+	{
+		wpt.joint_mask = 0;
+		wpt_seq = 0;
+	}
+}
+#endif
+
+
+static void send_packet(void)
+{
+	get_targets_from_global_state();	// Read global targets into local variables, in case any targets are about to be transmitted.
+
+	tx_seq++;
+	uint32_t now = systick_get_ms();
+	sync.sample_ms = sample_stamp(j[joint_list[0]].t);
+	#if NXT == 1
+		sync.tx_ms = now;
+		baud.countdown = switch_pending ? (uint8_t)((int32_t)(switch_ms + MOTORREG_PERIOD_MS/2 - cycle_ms) / MOTORREG_PERIOD_MS) : 0;
+		for(int k=0; k<2; k++)
 		{
-			case RS485_UNINITIALIZED:			//STATE: RS485_UNINITIALIZED
-				flush_buffer();
-				beep();
-				state = RS485_WAITING_NXT1;			//Start of the update cycle. Choose in what state the state machine begins.
-				break;
+			uint32_t hold = now - sync_rx_ms[k];
+			sync.hold_ms[k] = (sync_rx_valid[k] && hold < RS485_SYNC_NO_HOLD) ? (uint8_t)hold : RS485_SYNC_NO_HOLD;
+			sync_rx_valid[k] = FALSE;
+		}
+	#else
+		sync_tx_ms[tx_seq % 4] = now;
+		sync_tx_seq[tx_seq % 4] = tx_seq;
+	#endif
 
-			case RS485_WAITING_NXT1:			//STATE: RS485_WAITING_NXT1
-				if(read_header()==PACKET_NXT1_HEADER)		//Attempt to read a 1-byte packet header. If correct response is received,
-					state = RS485_RECEIVING_NXT1;		//Transition to state: RS485_RECEIVING_NXT1
-				break;
+	uint8_t* packet = frame + 2;
+	#if NXT == 1
+		forward_waypoint();
+		encode_nxt1(packet);
+	#elif NXT == 2
+		encode_nxt2(packet);
+	#elif NXT == 3
+		encode_nxt3(packet);
+	#endif
 
-			case RS485_RECEIVING_NXT1:			//STATE: RS485_RECEIVING_NXT1
-				if(read_packet() == 0)				//Attempt to read packet. Check if full packet has been read (bytes_remaining == 0)
-					state = RS485_SENDING_PACKET;		//Transition to state: RS485_SENDING_PACKET
-				break;
+	uint32_t len = OWN_BYTES + 2;
+	len += encode_messages(frame + len, RS485_MSG_BUDGET, now);
+
+	frame[0] = OWN_HEADER;
+	frame[1] = tx_seq;
+	uint16_t crc = crc16(frame, len);
+	frame[len++] = (uint8_t)crc;
+	frame[len++] = (uint8_t)(crc >> 8);
+
+	// The leading delimiter ends any garbage the receivers have buffered, so they start this frame clean
+	uint32_t n = 0;
+	tx_wire[n++] = FRAME_DELIMITER;
+	n += cobs_encode(frame, len, tx_wire + n);
+	tx_wire[n++] = FRAME_DELIMITER;
+	ecrobot_send_rs485(tx_wire, 0, n);
+
+	#if RS485_CAPTURE
+		uint8_t tx[2] = { tx_seq, (uint8_t)n };
+		capture_record(CAPTURE_TX, now, tx, 2);
+	#endif
+}
 
-			case RS485_SENDING_PACKET:			//STATE: RS485_SENDING_PACKET
-				send_header();						//Send a 1-byte packet header.
-				send_packet();						//Send this NXT's data packet.
-				state = RS485_WAITING_NXT3;			//Transition to state: RS485_WAITING_NXT3
-				break;
 
-			case RS485_WAITING_NXT3:			//STATE: RS485_WAITING_NXT3
-				if(read_header()==PACKET_NXT3_HEADER) //Attempt to read a 1-byte packet header. If correct response is received,
-					state = RS485_RECEIVING_NXT3;		//Transition to state: RS485_RECEIVING_NXT3
-				break;
+static uint8_t read_frame(void)		// Checks and parses the complete frame in rx_wire. Returns its header, or NO_PACKET if it is invalid.
+{
+	uint32_t len = cobs_decode(rx_wire, rx_len, frame);
+	uint8_t header = (len > 0) ? frame[0] : NO_PACKET;
+	uint32_t size = packet_bytes(header);
+	if(size == 0 || len < size + RS485_FRAME_OVERHEAD || len > size + RS485_FRAME_OVERHEAD + RS485_MSG_BUDGET)
+	{
+		rs485_frame_errors++;
+		return NO_PACKET;
+	}
+	if(crc16(frame, len - 2) != (uint16_t)(frame[len-2] | (frame[len-1] << 8)))
+	{
+		rs485_crc_errors++;
+		return NO_PACKET;
+	}
+	if(header == OWN_HEADER)			// Own frame echoed back. Not a protocol error.
+		return NO_PACKET;
+
+	uint8_t seq = frame[1];
+	BOOL duplicate = rx_seq_valid[header] && seq == rx_seq[header];
+	if(rx_seq_valid[header] && !duplicate)
+		rs485_lost_frames += (uint8_t)(seq - rx_seq[header] - 1);
+	rx_seq[header] = seq;
+	rx_seq_valid[header] = TRUE;
+	probe_frames[header]++;
+	last_valid_ms = rx_last_byte_ms;
+	#if NXT == 1
+		heard |= (1<<header);
+	#endif
 
-			case RS485_RECEIVING_NXT3:			//STATE: RS485_RECEIVING_NXT3
-				if(read_packet() == 0)				//Attempt to read packet. Check if full packet has been read (bytes_remaining == 0)
+	get_targets_from_global_state();	// Read global targets into local variables. Possibly not all local targets will be set via this transmission.
+
+	const uint8_t* packet = frame + 2;
+	switch(header)			// Joint states are marked JOINT_STATE_UPDATING until the new ones are complete and stamped
+	{
+		case PACKET_NXT1_HEADER:
+			j[1].t = JOINT_STATE_UPDATING;
+			decode_nxt1(packet);
+			#if NXT != 1
+				enable_joint_limits &= ~get_homing_joint_mask();	// A joint this NXT is homing stays in homing mode
+			#endif
+			#if NXT != 1
+				if(wpt_seq != wpt_ack[OWN_HEADER - PACKET_NXT2_HEADER])		// New, or 0 after the last one
 				{
-					state = RS485_WAITING_NXT1;			//Transition to state: RS485_WAITING_NXT1
-					rs485_update_cycles++;
+					if(wpt_seq != 0)
+						add_waypoint(source, &wpt);
+					wpt_ack[OWN_HEADER - PACKET_NXT2_HEADER] = wpt_seq;
 				}
-				break;
-
-			default:							//STATE: DEFAULT
-				error_buzz();						//An error in the state machine has occurred.
-				systick_wait_ms(1000);
-				break;
+				follow_clock(rx_last_byte_ms);
+				follow_baud(rx_last_byte_ms);
+			#endif
+			j[1].t = sample_time(sync.sample_ms);
+			break;
+		case PACKET_NXT2_HEADER:
+			j[0].t = j[4].t = JOINT_STATE_UPDATING;
+			decode_nxt2(packet);
+			j[0].t = j[4].t = sample_time(sync.sample_ms);
+			break;
+		case PACKET_NXT3_HEADER:
+			j[2].t = j[3].t = JOINT_STATE_UPDATING;
+			decode_nxt3(packet);
+			j[2].t = j[3].t = sample_time(sync.sample_ms);
+			break;
+	}
+	#if NXT == 1
+		if(header != PACKET_NXT1_HEADER)		// Held until the next beacon, which reports how long for
+		{
+			sync.seq[header - PACKET_NXT2_HEADER] = seq;
+			sync_rx_ms[header - PACKET_NXT2_HEADER] = rx_last_byte_ms;
+			sync_rx_valid[header - PACKET_NXT2_HEADER] = TRUE;
 		}
+	#endif
 
+	promote_targets_to_global_state();	// Write updated local targets to global targets (using the target control priority system)
+
+	if(!duplicate)
+		decode_messages(header, packet + size, len - size - RS485_FRAME_OVERHEAD, rx_last_byte_ms);
+	return header;
+}
 
-	#elif NXT == 3
 
-		switch(state)
+static void receive_frames(void)	// Reads and parses everything that has arrived
+{
+	uint8_t b;
+	while(ecrobot_read_rs485(&b, 0, 1) != 0)
+	{
+		rx_last_byte_ms = systick_get_ms();
+		if(b != FRAME_DELIMITER)
 		{
-			case RS485_UNINITIALIZED:			//STATE: RS485_UNINITIALIZED
-				flush_buffer();
-				beep();
-				state = RS485_WAITING_NXT1;			//Start of the update cycle. Choose in what state the state machine begins.
-				break;
+			if(rx_len < sizeof(rx_wire))
+				rx_wire[rx_len++] = b;
+			else
+				rx_overflow = TRUE;
+			continue;
+		}
+		if(rx_len == 0)					// Leading delimiter
+			continue;
+		#if RS485_CAPTURE
+			capture_record(rx_overflow ? CAPTURE_RX_OVERFLOW : CAPTURE_RX, rx_last_byte_ms, rx_wire, rx_len);
+		#endif
+
+		if(rx_overflow)
+			rs485_frame_errors++;
+		#if NXT == 1
+			else
+				read_frame();
+		#else
+			else if(read_frame() == PACKET_NXT1_HEADER)
+				follow_beacon(rx_last_byte_ms);
+		#endif
+		rx_len = 0;
+		rx_overflow = FALSE;
+	}
+}
 
-			case RS485_WAITING_NXT1:			//STATE: RS485_WAITING_NXT1
-				if(read_header()==PACKET_NXT1_HEADER)		//Attempt to read a 1-byte packet header. If correct response is received,
-					state = RS485_RECEIVING_NXT1;		//Transition to state: RS485_RECEIVING_NXT1
-				break;
 
-			case RS485_RECEIVING_NXT1:			//STATE: RS485_RECEIVING_NXT1
-				if(read_packet() == 0)				//Attempt to read packet. Check if full packet has been read (bytes_remaining == 0)
-					state = RS485_WAITING_NXT2;			//Transition to state: RS485_WAITING_NXT2
-				break;
+static void update_slot(uint32_t now)	// Sends this NXT's frame once per cycle, in its slot
+{
+	if(cycle_ms == sent_cycle_ms || now - cycle_ms < OWN_SLOT_MS)
+		return;
+	sent_cycle_ms = cycle_ms;
+
+	uint32_t late_ms = now - cycle_ms - OWN_SLOT_MS;
+	if(late_ms > rs485_slot_late_max_ms)
+		rs485_slot_late_max_ms = late_ms;
+	uint32_t frame_us = OWN_FRAME_BITS * 1000000UL / baud_rates[rs485_baud_index];
+	if(late_ms*1000 + frame_us > RS485_SLOT_MS*1000)
+	{
+		rs485_slot_overruns++;
+		if(late_ms >= RS485_SLOT_MS)	// The slot is over and the next NXT may be sending. Skip this cycle.
+			return;
+	}
 
-			case RS485_WAITING_NXT2:			//STATE: RS485_WAITING_NXT2
-				if(read_header()==PACKET_NXT2_HEADER) //Attempt to read a 1-byte packet header. If correct response is received,
-					state = RS485_RECEIVING_NXT2;		//Transition to state: RS485_RECEIVING_NXT2
-				break;
+	send_packet();
+	rs485_update_cycles++;
+}
 
-			case RS485_RECEIVING_NXT2:			//STATE: RS485_RECEIVING_NXT2
-				if(read_packet() == 0)				//Attempt to read packet. Check if full packet has been read (bytes_remaining == 0)
-					state = RS485_SENDING_PACKET;		//Transition to state: RS485_SENDING_PACKET
-				break;
 
-			case RS485_SENDING_PACKET:			//STATE: RS485_SENDING_PACKET
-				send_header();						//Send a 1-byte packet header.
-				send_packet();						//Send this NXT's data packet.
-				state = RS485_WAITING_NXT1;			//Transition to state: RS485_WAITING_NXT1
-				rs485_update_cycles++;
-				break;
+void update_rs485()
+{
+	if(state == RS485_UNINITIALIZED)	//STATE: RS485_UNINITIALIZED
+	{
+		flush_buffer();
+		beep();
+		sent_cycle_ms = task_motorreg_start_ms;		// Start with the next full cycle
+		cycle_ms = task_motorreg_start_ms;
+		last_valid_ms = systick_get_ms();
+		#if NXT == 1
+			baud_state = RS485_BAUD_SETTLING;
+		#else
+			baud_state = RS485_BAUD_RUNNING;
+		#endif
+	}
 
-			default:							//STATE: DEFAULT
-				error_buzz();						//An error in the state machine has occurred.
-				systick_wait_ms(1000);
-				break;
+	#if RS485_CAPTURE
+		update_capture();
+	#endif
 
-		}
+	if(task_motorreg_start_ms != cycle_ms)		// A new cycle, the only time the rate changes
+	{
+		cycle_ms = task_motorreg_start_ms;
+		#if RS485_CAPTURE
+			capture_record(CAPTURE_CYCLE, cycle_ms, NULL, 0);
+		#endif
+		#if NXT == 1
+			end_cycle();
+		#endif
+		start_cycle();
+	}
+
+	receive_frames();
+	uint32_t now = systick_get_ms();
+	if(rx_len > 0 && now - rx_last_byte_ms > RS485_FRAME_TIMEOUT_MS)
+	{
+		#if RS485_CAPTURE
+			capture_record(CAPTURE_RX_TIMEOUT, rx_last_byte_ms, rx_wire, rx_len);
+		#endif
+		rs485_frame_errors++;							//Frame stopped halfway. Drop it.
+		rx_len = 0;
+		rx_overflow = FALSE;
+	}
 
+	if(rs485_baud_index != 0 && baud_state != RS485_BAUD_PROBING && now - last_valid_ms > RS485_BAUD_LOST_MS)
+	{
+		#if NXT == 1
+			rs485_baud_ceiling = rs485_baud_index;
+		#endif
+		fall_back(0);							//Lost the other NXTs at this rate. Meet them again at the slowest.
+	}
 
+	#if NXT != 1
+		if(synced && now - beacon_ms > RS485_SYNC_TIMEOUT_MS && baud_state != RS485_BAUD_PROBING)	//Lost NXT1. Stop sending until the beacon is back and locked again.
+		{
+			synced = FALSE;
+			phase_samples = 0;
+		}
+		if(!synced)
+		{
+			state = RS485_SYNCING;
+			return;
+		}
 	#endif
+
+	update_slot(now);
+	state = (rx_len > 0) ? RS485_RECEIVING : RS485_WAITING_SLOT;
 }
 
 
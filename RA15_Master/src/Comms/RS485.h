@@ -15,29 +15,102 @@
 
 #include <string.h>
 #include "../Globals.h"
+#include "PacketSchema.h"
+#include "Framing.h"
+#include "Messages.h"
 #include "../HumanInterface/Sound.h"
 #include "../Control/Targeting.h"
+#include "../Control/Trajectory.h"
+#include "../Control/MotorRegulator.h"
 
 
 enum rs485_state {
 	RS485_UNINITIALIZED,
-	RS485_SENDING_PACKET,
-	RS485_WAITING_NXT1,
-	RS485_RECEIVING_NXT1,
-	RS485_WAITING_NXT2,
-	RS485_RECEIVING_NXT2,
-	RS485_WAITING_NXT3,
-	RS485_RECEIVING_NXT3
+	RS485_SYNCING,				// NXT2/3: locking TASK_MOTORREG to NXT1's beacon. Listens, but does not send.
+	RS485_WAITING_SLOT,			// Listening until this NXT's slot
+	RS485_RECEIVING				// Part of a frame has arrived
 };
 
 
-extern uint32_t rs485_update_cycles;
+// TDMA schedule. The bus runs one cycle per TASK_MOTORREG period. Each NXT sends its frame once per cycle, in a
+// fixed slot measured from the start of its own TASK_MOTORREG. NXT1's frame is the sync beacon: NXT2/3 shift
+// ALARM_MOTORREG until their TASK_MOTORREG starts with NXT1's, so every joint state on the bus is sampled at the
+// start of a cycle and used at the start of the next. Remote state age is one MOTORREG_PERIOD_MS, give or take
+// RS485_SYNC_TOLERANCE_MS and a systick.
+#define RS485_SLOT_NXT1_MS		1		// Slot start after TASK_MOTORREG starts. Leaves time for the regulator to finish.
+#define RS485_SLOT_NXT2_MS		6
+#define RS485_SLOT_NXT3_MS		11
+#define RS485_SLOT_MS			5		// Slot length. A frame that cannot finish within its slot is an overrun.
+#define RS485_SYNC_TOLERANCE_MS	1		// NXT2/3: regulator phase error left uncorrected
+#define RS485_SYNC_WINDOW		8		// NXT2/3: beacons per phase measurement. The least delayed one is used.
+#define RS485_SYNC_TIMEOUT_MS	(5 * MOTORREG_PERIOD_MS)	// NXT2/3: stop sending after this long without a beacon
+
+#if RS485_SLOT_NXT1_MS + RS485_SLOT_MS > RS485_SLOT_NXT2_MS || RS485_SLOT_NXT2_MS + RS485_SLOT_MS > RS485_SLOT_NXT3_MS \
+	|| RS485_SLOT_NXT3_MS + RS485_SLOT_MS > MOTORREG_PERIOD_MS
+	#error "RS485 slots overlap or do not fit in MOTORREG_PERIOD_MS"
+#endif
+
+#define RS485_FRAME_TIMEOUT_MS	3		// RS485_RECEIVING: longest gap between two bytes of a frame before it is dropped
+
+
+// Baud rate negotiation. Every NXT starts at RS485_BAUD_RATES[0] (PacketSchema.h). Once NXT2 and NXT3 are both
+// sending, NXT1 probes the next faster rate: its beacon announces the switch RS485_BAUD_COUNTDOWN cycles ahead, all
+// NXTs switch at the start of the same cycle, exchange their usual frames for RS485_PROBE_CYCLES and switch back on
+// their own. NXT2/3 then report how many frames they received. NXT1 probes upwards until a rate fails, and commits
+// the fastest one that passed with another announced switch. While running, it falls back one rate when frames go
+// missing, and does not probe that rate again.
+#define RS485_BAUD_COUNTDOWN	5		// Cycles from the first announcement of a switch to the switch
+#define RS485_PROBE_CYCLES		25		// Cycles spent at a probed rate
+#define RS485_PROBE_MIN_FRAMES	24		// Frames each NXT must receive from each other NXT during a probe
+#define RS485_SETTLE_CYCLES		10		// NXT1: cycles with frames from both NXT2 and NXT3 before the next probe
+#define RS485_ERROR_WINDOW		50		// NXT1: cycles per error count while running
+#define RS485_FALLBACK_ERRORS	5		// NXT1: bad, lost or missing frames in a window that trigger a fallback
+#define RS485_SILENT_CYCLES		(RS485_SYNC_WINDOW + 2)		// NXT1: cycles NXT2/3 may go without sending before each further one counts as missing
+#define RS485_BAUD_LOST_MS		500		// Time without a valid frame after which an NXT above RS485_BAUD_RATES[0] returns there on its own
+
+enum rs485_baud_state {
+	RS485_BAUD_SETTLING,		// NXT1: waiting for NXT2 and NXT3 to be heard every cycle
+	RS485_BAUD_ANNOUNCING,		// NXT1: counting down to an announced switch. NXT2/3: a switch is pending.
+	RS485_BAUD_PROBING,			// At a probed rate, until the probe ends
+	RS485_BAUD_REPORTING,		// NXT1: waiting for NXT2/3 to report on the last probe
+	RS485_BAUD_RUNNING			// Settled. NXT1 watches for errors.
+};
+
+// Bus capture (NXT1 only, the one with Bluetooth). While rs485_capture is set, every frame received or sent, every
+// dropped partial frame and every cycle start is recorded with its systick into a RAM ring buffer, in the record
+// format of PacketSchema.h. Bluetooth.c streams the buffer to the PC, where RA15_Host rs485_replay feeds it back
+// through update_rs485() to reproduce what this NXT saw. Records that find the buffer full are dropped and counted.
+// RS485_CAPTURE_BYTES must be a power of 2. Set it to 0 to leave capture out of the build.
+#define RS485_CAPTURE_BYTES		4096
+#define RS485_CAPTURE			(NXT == 1 && RS485_CAPTURE_BYTES > 0)
+
+extern uint32_t rs485_update_cycles;	// Frames sent
+extern uint32_t rs485_crc_errors;		// Frames with a bad CRC
+extern uint32_t rs485_frame_errors;		// Frames that were not valid COBS, had the wrong length or header, or stopped halfway
+extern uint32_t rs485_lost_frames;		// Frames missing from the sequence numbers received
+extern uint32_t rs485_slot_overruns;	// Frames that started too late to finish within their slot. Those that could not start at all are not sent.
+extern uint32_t rs485_slot_late_max_ms;	// Latest start of a frame after its slot start, since startup
+extern uint32_t rs485_sync_shifts;		// NXT2/3: times ALARM_MOTORREG was shifted to follow the beacon
+extern uint8_t rs485_baud_index;		// Index in RS485_BAUD_RATES of the rate in use
+extern uint8_t rs485_baud_ceiling;		// NXT1: rates from this index up failed, and are not probed again
+extern uint32_t rs485_baud_fallbacks;	// Switches to a slower rate because of errors or a lost bus
+extern uint8_t rs485_baud_cycles_per_s[RS485_NUM_BAUDS];	// NXT1: complete cycles per second (frames from both NXT2 and NXT3) measured at each rate, in its last probe or error window. 0 until measured.
+#if RS485_CAPTURE
+	extern uint8_t rs485_capture;			// Set by the PC to capture. A new capture empties the buffer.
+	extern uint32_t rs485_capture_dropped;	// Records lost to a full buffer in the current capture
+#endif
 
 void init_rs485(void);					//should be called in device startup hook
 void term_rs485(void);					//should be called in device shutdown hook
 enum rs485_state get_rs485_state(void);
+enum rs485_baud_state get_rs485_baud_state(void);
 void update_rs485(void);				//should be called in a loop.
 void disp_rs485_state(int starty);
+void disp_rs485_baud(int starty);		//RS485_NUM_BAUDS + 2 lines: negotiation state and fallbacks, then each rate with its cycles per second
+#if RS485_CAPTURE
+	uint32_t get_rs485_capture_bytes(void);							//Captured bytes not read yet
+	uint32_t read_rs485_capture(uint8_t* buf, uint32_t max, uint32_t* pos);	//Reads up to max captured bytes. *pos: stream position of the first.
+#endif
 
 
 
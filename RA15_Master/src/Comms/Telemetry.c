@@ -0,0 +1,207 @@
+/*
+ * Telemetry.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Daniel
+ */
+
+#include "Telemetry.h"
+
+#include <string.h>
+#include "RS485.h"
+#include "Bluetooth.h"
+#include "../Control/MotorRegulator.h"
+#include "../Control/Trajectory.h"
+#include "../Control/Timing.h"
+
+
+// REGISTRY
+
+// Every signal the PC can subscribe to. X(name, type, variable). The id of a signal is its place in the list, so
+// add new ones at the end. Compilation fails if a variable's size does not match its type, or a name is longer than
+// TELEMETRY_NAME_CHARS.
+// Controller signals are per controller index ci, which drives joint joint_list[ci] (Globals.h).
+#define JOINT_SIGNALS(X, n)															\
+	X("j" #n ".p",			TLM_FIX16,	j[n-1].p)									\
+	X("j" #n ".v",			TLM_FIX16,	j[n-1].v)									\
+	X("j" #n ".pt",			TLM_FIX16,	j[n-1].pt)									\
+	X("j" #n ".vt",			TLM_FIX16,	j[n-1].vt)									\
+	X("j" #n ".pwm",		TLM_INT8,	j[n-1].pwm)									\
+	X("j" #n ".t",			TLM_UINT32,	j[n-1].t)
+
+#define CONTROLLER_SIGNALS(X, ci)													\
+	X("c" #ci ".dt",		TLM_FIX16,	jctrl[ci].dt)								\
+	X("c" #ci ".pos_err",	TLM_FIX16,	jctrl[ci].pos_err)							\
+	X("c" #ci ".pos_acc",	TLM_FIX16,	jctrl[ci].pos_err_acc)						\
+	X("c" #ci ".vel_err",	TLM_FIX16,	jctrl[ci].vel_err)							\
+	X("c" #ci ".vel_acc",	TLM_FIX16,	jctrl[ci].vel_err_acc)						\
+	X("c" #ci ".pwm_base",	TLM_FIX16,	jctrl[ci].pwm_base)
+
+#define TELEMETRY_SIGNALS(X)														\
+	JOINT_SIGNALS(X, 1)	JOINT_SIGNALS(X, 2)	JOINT_SIGNALS(X, 3)							\
+	JOINT_SIGNALS(X, 4)	JOINT_SIGNALS(X, 5)	JOINT_SIGNALS(X, 6)							\
+	CONTROLLER_SIGNALS(X, 0)	CONTROLLER_SIGNALS(X, 1)								\
+	X("systick",			TLM_UINT32,	systick_ms)									\
+	X("us.motorreg",		TLM_UINT16,	task_motorreg_duration_us)					\
+	X("us.targeting",		TLM_UINT16,	task_targeting_duration_us)					\
+	X("us.sensors",			TLM_UINT16,	task_sensors_duration_us)					\
+	X("us.bluetooth",		TLM_UINT16,	task_bluetooth_duration_us)					\
+	X("us.lcd",				TLM_UINT16,	task_lcd_duration_us)						\
+	X("us.collision",		TLM_UINT16,	collision_check_duration_us)				\
+	X("remote_age",			TLM_UINT16,	remote_state_age_max_ms)					\
+	X("remote_err",			TLM_UINT16,	remote_state_err_max_mdeg)					\
+	X("clock_offset",		TLM_INT32,	clock_offset_us)							\
+	X("clock_drift",		TLM_INT32,	clock_drift_ppm)							\
+	X("rs.crc",			TLM_UINT32,	rs485_crc_errors)							\
+	X("rs.frame_err",		TLM_UINT32,	rs485_frame_errors)							\
+	X("rs.lost",			TLM_UINT32,	rs485_lost_frames)							\
+	X("rs.overruns",		TLM_UINT32,	rs485_slot_overruns)						\
+	X("rs.baud",			TLM_UINT8,	rs485_baud_index)							\
+	X("bt.dropped",			TLM_UINT32,	bt_samples_dropped)							\
+	X("bt.refused",			TLM_UINT32,	bt_incomplete_sent)							\
+	X("bt.resyncs",			TLM_UINT32,	bt_rx_resync_bytes)							\
+	X("bt.rate",			TLM_UINT16,	bt_tx_rate)									\
+	X("bt.interval",		TLM_UINT16,	bt_tx_interval)								\
+	X("tlm.dropped",		TLM_UINT32,	telemetry_records_dropped)					\
+	X("wp.dropped",			TLM_UINT32,	waypoints_dropped)							\
+	X("wp.underruns",		TLM_UINT32,	traj_underruns)								\
+	X("tmux",				TLM_UINT8,	tmux)										\
+	X("rcx",				TLM_UINT8,	rcx)										\
+	X("ea1",				TLM_UINT8,	ea1)										\
+	X("ea2",				TLM_UINT8,	ea2)										\
+	X("ea3",				TLM_UINT8,	ea3)
+
+struct telemetry_signal {
+	const char* name;
+	uint8_t type;				// enum telemetry_type
+	const void* value;
+};
+
+#define SIGNAL_CHECK(name, type, expr)	(0*sizeof(char[(sizeof(expr) == TELEMETRY_TYPE_BYTES(type) &&			\
+										sizeof(name) <= TELEMETRY_NAME_CHARS+1) ? 1 : -1]))
+#define SIGNAL_ENTRY(name, type, expr)	{ name, type, (const uint8_t*)&(expr) + SIGNAL_CHECK(name, type, expr) },
+
+static const struct telemetry_signal signals[] = { TELEMETRY_SIGNALS(SIGNAL_ENTRY) };
+#define NUM_SIGNALS		(sizeof(signals) / sizeof(signals[0]))
+
+
+// PUBLIC VARIABLES
+
+uint32_t telemetry_records_dropped = 0;
+
+
+// PRIVATE VARIABLES
+
+// The subscription is written by subscribe_telemetry() (background task) into the one TASK_MOTORREG is not using,
+// then made active with a single store, so TASK_MOTORREG never sees one half written.
+static struct telemetry_subscription subscription[2];
+static volatile uint8_t active = 0;
+
+// Records, as [length][layout][seq, uint16_t][values], written by record_telemetry() (TASK_MOTORREG) and read by
+// peek/pop_telemetry_record() (background task). Each index is written by only one side, so no resource is needed.
+#define RECORD_HEADER	4
+static uint8_t ring[TELEMETRY_RING];
+static volatile uint16_t ring_head = 0;		// Written by record_telemetry() only
+static volatile uint16_t ring_tail = 0;		// Written by the readers only
+static uint8_t recorded_layout = 0;			// Layout of the last record, and the cycle and seq counts that go with it
+static uint8_t cycles = 0;
+static uint16_t seq = 0;
+
+
+// FUNCTION DEFINITIONS
+
+uint8_t get_telemetry_signal_count(void)
+{
+	return (uint8_t)NUM_SIGNALS;
+}
+
+uint8_t describe_telemetry_signal(uint8_t id, char name[TELEMETRY_NAME_CHARS])
+{
+	if(id >= NUM_SIGNALS)
+		return TLM_NUM_TYPES;
+	strncpy(name, signals[id].name, TELEMETRY_NAME_CHARS);
+	return signals[id].type;
+}
+
+const struct telemetry_subscription* subscribe_telemetry(const uint8_t* ids, uint8_t count, uint8_t decimation)
+{
+	const struct telemetry_subscription* old = &subscription[active];
+	struct telemetry_subscription* s = &subscription[!active];
+
+	s->layout = (old->layout == 255) ? 1 : old->layout+1;
+	s->decimation = decimation;
+	s->count = 0;
+	s->record_bytes = 0;
+	for(int i=0; i<count && i<TELEMETRY_SUB_MAX && decimation > 0; i++)
+	{
+		if(ids[i] >= NUM_SIGNALS || s->record_bytes + TELEMETRY_TYPE_BYTES(signals[ids[i]].type) > TELEMETRY_SUB_RECORD_MAX)
+			continue;
+		s->ids[s->count++] = ids[i];
+		s->record_bytes += TELEMETRY_TYPE_BYTES(signals[ids[i]].type);
+	}
+	if(s->count == 0)
+		s->decimation = 0;
+
+	active = !active;
+	ring_tail = ring_head;		// Anything TASK_MOTORREG records from now on has the new layout
+	return s;
+}
+
+void record_telemetry(void)
+{
+	const struct telemetry_subscription* s = &subscription[active];
+	if(s->layout != recorded_layout)
+	{
+		recorded_layout = s->layout;
+		cycles = 0;
+		seq = 0;
+	}
+	if(s->decimation == 0 || ++cycles < s->decimation)
+		return;
+	cycles = 0;
+
+	uint8_t record[RECORD_HEADER + TELEMETRY_SUB_RECORD_MAX];
+	uint8_t len = RECORD_HEADER;
+	record[0] = s->record_bytes;
+	record[1] = s->layout;
+	record[2] = (uint8_t)seq;
+	record[3] = (uint8_t)(seq >> 8);
+	seq++;
+
+	uint16_t used = (uint16_t)(ring_head - ring_tail) % TELEMETRY_RING;
+	if(used + RECORD_HEADER + s->record_bytes >= TELEMETRY_RING)	// The link has fallen behind
+	{
+		telemetry_records_dropped++;
+		return;
+	}
+	for(int i=0; i<s->count; i++)
+	{
+		const struct telemetry_signal* sig = &signals[s->ids[i]];
+		memcpy(record + len, sig->value, TELEMETRY_TYPE_BYTES(sig->type));
+		len += TELEMETRY_TYPE_BYTES(sig->type);
+	}
+
+	uint16_t head = ring_head;
+	for(int i=0; i<len; i++)
+		ring[(head + i) % TELEMETRY_RING] = record[i];
+	ring_head = (head + len) % TELEMETRY_RING;
+}
+
+uint8_t peek_telemetry_record(uint8_t* layout, uint16_t* seq_out)
+{
+	uint16_t tail = ring_tail;
+	if(tail == ring_head)
+		return 0;
+	*layout = ring[(tail+1) % TELEMETRY_RING];
+	*seq_out = ring[(tail+2) % TELEMETRY_RING] | (uint16_t)(ring[(tail+3) % TELEMETRY_RING] << 8);
+	return ring[tail];
+}
+
+void pop_telemetry_record(uint8_t* buf)
+{
+	uint16_t tail = ring_tail;
+	uint8_t len = ring[tail];
+	for(int i=0; i<len; i++)
+		buf[i] = ring[(tail + RECORD_HEADER + i) % TELEMETRY_RING];
+	ring_tail = (tail + RECORD_HEADER + len) % TELEMETRY_RING;
+}
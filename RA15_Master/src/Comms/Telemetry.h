@@ -0,0 +1,59 @@
+/*
+ * Telemetry.h
+ *
+ *	Public interface for Telemetry.c.
+ *	Registry of named signals the PC can subscribe to over Bluetooth: joint states, controller internals,
+ *	task timings, comms counters and sensors. A subscription picks up to TELEMETRY_SUB_MAX of them, and
+ *	TASK_MOTORREG records their values every decimation cycles into a ring, which Bluetooth.c sends as
+ *	TELEMETRY_SUB_BT packets. Signal ids and wire types are listed in PacketSchema.h.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Daniel
+ */
+
+#ifndef SRC_COMMS_TELEMETRY_H_
+#define SRC_COMMS_TELEMETRY_H_
+
+#include "kernel.h"
+#include "kernel_id.h"
+#include "ecrobot_interface.h"
+#include "stdint.h"
+
+#include "../Globals.h"
+#include "PacketSchema.h"
+
+
+#define TELEMETRY_RING	512		// Bytes of recorded values waiting to be sent (640ms of a 16 byte record every cycle)
+
+struct telemetry_subscription {
+	uint8_t layout;					// Numbers the subscription, 1 to 255 and round again. 0 before the first.
+	uint8_t decimation;				// A record every decimation TASK_MOTORREG cycles. 0: nothing is recorded.
+	uint8_t count;					// Signals in a record
+	uint8_t record_bytes;
+	uint8_t ids[TELEMETRY_SUB_MAX];	// Signal ids, in record order
+};
+
+// PUBLIC VARIABLES
+
+extern uint32_t telemetry_records_dropped;	// Records lost because the ring was full. The PC sees the gap in seq.
+
+// Signals in the registry. Ids run from 0 to get_telemetry_signal_count()-1.
+uint8_t get_telemetry_signal_count(void);
+
+// Writes the signal's name (at most TELEMETRY_NAME_CHARS, zero padded) and returns its type (enum telemetry_type).
+// Returns TLM_NUM_TYPES if there is no such signal.
+uint8_t describe_telemetry_signal(uint8_t id, char name[TELEMETRY_NAME_CHARS]);
+
+// Replaces the subscription (background task). Unknown ids, and those past TELEMETRY_SUB_RECORD_MAX bytes of record,
+// are left out. Records of the previous subscription that were not read yet are discarded. Returns the new one.
+const struct telemetry_subscription* subscribe_telemetry(const uint8_t* ids, uint8_t count, uint8_t decimation);
+
+void record_telemetry(void);	// Called by TASK_MOTORREG every cycle, while it holds RES_MOTORS
+
+// Oldest record in the ring (background task): writes its layout and seq and returns its length, or 0 if the ring
+// is empty. pop_telemetry_record() then copies it to buf and removes it.
+uint8_t peek_telemetry_record(uint8_t* layout, uint16_t* seq);
+void pop_telemetry_record(uint8_t* buf);
+
+
+#endif /* SRC_COMMS_TELEMETRY_H_ */
@@ -0,0 +1,161 @@
+/*
+ * Collision.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Daniel
+ */
+
+#include "Collision.h"
+
+
+// CAPSULE MODEL
+//	Segments run between DH frame origins, so capsule lengths follow the DH params in jpmtr.
+//	Radii are the half-widths of the link_*_thin.ipt profiles, rounded up to cover motors and wiring.
+
+#define NUM_CAPSULES 5
+
+static const struct capsule_definition {
+	uint8_t start;		// Frame origin at one end of the segment (0-6)
+	uint8_t end;		// Frame origin at the other end
+	int32_t radius;		// mm
+	BOOL check_floor;	// Test this capsule against the table surface
+} capsule[NUM_CAPSULES] = {
+	{ .start=0, .end=1, .radius=45, .check_floor=FALSE },	// Link 1: turntable and base column
+	{ .start=1, .end=2, .radius=28, .check_floor=FALSE },	// Link 2: upper arm
+	{ .start=2, .end=3, .radius=35, .check_floor=TRUE  },	// Link 3: elbow, including J3 motors
+	{ .start=3, .end=4, .radius=24, .check_floor=TRUE  },	// Link 4: forearm
+	{ .start=4, .end=6, .radius=20, .check_floor=FALSE },	// Links 5-6: wrist and end effector (O4 == O5). Allowed to touch the table.
+};
+
+// Adjacent capsules share a joint and always touch, so only pairs at least 2 apart are tested.
+// The upper arm and forearm (1,3) are only 48mm apart across the elbow at any J3 angle; folding is limited by J3 pmin/pmax instead.
+#define NUM_PAIRS 5
+static const uint8_t pair[NUM_PAIRS][2] = { {0,2}, {0,3}, {0,4}, {1,4}, {2,4} };
+
+
+// PRIVATE VARIABLES
+
+static struct point3d origins[7];
+
+
+// PRIVATE FUNCTIONS
+
+struct point_mm { int32_t x, y, z; };
+
+static inline struct point_mm to_mm(struct point3d p)
+{
+	struct point_mm r = { fix16_to_int(p.x), fix16_to_int(p.y), fix16_to_int(p.z) };
+	return r;
+}
+
+static inline int64_t dot(struct point_mm a, struct point_mm b)
+{
+	return (int64_t)a.x*b.x + (int64_t)a.y*b.y + (int64_t)a.z*b.z;
+}
+
+static inline int64_t clamp_unit(int64_t num, int64_t den)	// Returns num/den clamped to [0,1], as a Q16 fraction. den > 0.
+{
+	if(num <= 0)	return 0;
+	if(num >= den)	return fix16_one;
+	return (num << 16) / den;
+}
+
+static uint32_t isqrt(uint32_t n)
+{
+	uint32_t root = 0, bit = 1UL << 30;
+	while(bit > n)
+		bit >>= 2;
+	while(bit != 0)
+	{
+		if(n >= root + bit)
+		{
+			n -= root + bit;
+			root = (root >> 1) + bit;
+		}
+		else
+			root >>= 1;
+		bit >>= 2;
+	}
+	return root;
+}
+
+// Squared distance (mm^2) between segments p1-q1 and p2-q2. Integer mm coordinates keep every product
+// within int64 for the ~600mm reach of the arm; s and t are Q16 fractions along each segment.
+static uint32_t segment_distance_sq(struct point_mm p1, struct point_mm q1, struct point_mm p2, struct point_mm q2)
+{
+	struct point_mm d1 = { q1.x-p1.x, q1.y-p1.y, q1.z-p1.z };
+	struct point_mm d2 = { q2.x-p2.x, q2.y-p2.y, q2.z-p2.z };
+	struct point_mm r  = { p1.x-p2.x, p1.y-p2.y, p1.z-p2.z };
+	int64_t a = dot(d1, d1), e = dot(d2, d2), f = dot(d2, r);
+	int64_t s, t;
+
+	if(a == 0 && e == 0)				// Both segments are points
+	{
+		s = 0;	t = 0;
+	}
+	else if(a == 0)						// First segment is a point
+	{
+		s = 0;	t = clamp_unit(f, e);
+	}
+	else
+	{
+		int64_t c = dot(d1, r);
+		if(e == 0)						// Second segment is a point
+		{
+			t = 0;	s = clamp_unit(-c, a);
+		}
+		else
+		{
+			int64_t b = dot(d1, d2);
+			int64_t denom = a*e - b*b;		// Zero if segments are parallel; any s is then valid
+			s = (denom != 0) ? clamp_unit(b*f - c*e, denom) : 0;
+
+			int64_t tnom = b*s + (f << 16);	// t = (b*s + f)/e, in Q16
+			if(tnom < 0)
+			{
+				t = 0;			s = clamp_unit(-c, a);
+			}
+			else if(tnom > (e << 16))
+			{
+				t = fix16_one;	s = clamp_unit(b - c, a);
+			}
+			else
+				t = tnom / e;
+		}
+	}
+
+	int32_t dx = (p1.x + (int32_t)((d1.x*s) >> 16)) - (p2.x + (int32_t)((d2.x*t) >> 16));
+	int32_t dy = (p1.y + (int32_t)((d1.y*s) >> 16)) - (p2.y + (int32_t)((d2.y*t) >> 16));
+	int32_t dz = (p1.z + (int32_t)((d1.z*s) >> 16)) - (p2.z + (int32_t)((d2.z*t) >> 16));
+	return (uint32_t)(dx*dx + dy*dy + dz*dz);
+}
+
+
+// PUBLIC FUNCTIONS
+
+int32_t min_clearance_mm(const fix16_t q[6])
+{
+	forward_kinematics(q, origins);
+
+	int32_t clearance = INT32_MAX;
+
+	for(int i=0; i<NUM_PAIRS; i++)
+	{
+		const struct capsule_definition* c1 = &capsule[pair[i][0]];
+		const struct capsule_definition* c2 = &capsule[pair[i][1]];
+		uint32_t dist_sq = segment_distance_sq(to_mm(origins[c1->start]), to_mm(origins[c1->end]),
+											   to_mm(origins[c2->start]), to_mm(origins[c2->end]));
+		clearance = min_int(clearance, (int32_t)isqrt(dist_sq) - c1->radius - c2->radius);
+	}
+
+	for(int ci=0; ci<NUM_CAPSULES; ci++)
+	{
+		if(capsule[ci].check_floor)
+		{
+			int32_t lowest = min_int(fix16_to_int(origins[capsule[ci].start].z), fix16_to_int(origins[capsule[ci].end].z));
+			clearance = min_int(clearance, lowest - capsule[ci].radius - FLOOR_Z_MM);
+		}
+	}
+
+	return clearance;
+}
@@ -0,0 +1,34 @@
+/*
+ * Collision.h
+ *
+ *	Public interface for Collision.c.
+ *	Self-collision model: each link is a capsule (line segment between two DH frame origins, plus a radius).
+ *
+ *     Version: 1.0
+ *  Created on: Oct 19, 2026
+ *      Author: Daniel
+ */
+
+#ifndef SRC_CONTROL_COLLISION_H_
+#define SRC_CONTROL_COLLISION_H_
+
+#include "kernel.h"
+#include "kernel_id.h"
+#include "ecrobot_interface.h"
+#include "stdint.h"
+
+#include "../Globals.h"
+#include "Kinematics.h"
+#include "fix16.h"
+
+
+#define MIN_CLEARANCE_MM	15		// Targets are clamped if they would bring two capsules closer than this (mm)
+#define FLOOR_Z_MM			0		// Height of the table surface in the base frame (mm)
+
+
+// Returns the smallest surface-to-surface distance (mm) between any two non-adjacent link capsules,
+// or between the elbow/forearm capsules and the floor, at joint angles q (deg). Negative if they overlap.
+int32_t min_clearance_mm(const fix16_t q[6]);
+
+
+#endif /* SRC_CONTROL_COLLISION_H_ */
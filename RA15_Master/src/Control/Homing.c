@@ -63,6 +63,11 @@ enum homing_sequence_state get_homing_sequence_state(void)
 	return state;
 }
 
+uint8_t get_homing_joint_mask(void)
+{
+	return (state == HOMING_INACTIVE) ? 0 : (0x01<<ji);
+}
+
 void update_homing_sequence()
 {
 	BOOL switch_pressed = is_tmux_pressed(ji);
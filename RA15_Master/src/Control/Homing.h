@@ -40,6 +40,9 @@ void end_homing_sequence(void);
 
 enum homing_sequence_state get_homing_sequence_state(void);
 
+// Bit of the joint being homed (1<<ji), 0 if none
+uint8_t get_homing_joint_mask(void);
+
 
 // Called rapidly by targeting
 void update_homing_sequence(void);
@@ -9,3 +9,53 @@
 #include "Kinematics.h"
 
 
+static const fix16_t RAD_PER_DEG = F16(3.14159265358979323846f/180.0f);
+
+
+// PRIVATE VARIABLES
+
+static mf16 T_base;		// Pose of the current frame in the base frame. Static to keep forward_kinematics() off the task stack.
+static mf16 T_link;		// Transform from the current frame to the next frame
+static mf16 T_next;
+
+
+// FUNCTION DEFINITIONS
+
+void dh_transform(mf16* T, fix16_t theta, fix16_t alpha, fix16_t r, fix16_t d)
+{
+	theta = fix16_mul(theta, RAD_PER_DEG);
+	alpha = fix16_mul(alpha, RAD_PER_DEG);
+	fix16_t st = fix16_sin(theta), ct = fix16_cos(theta);
+	fix16_t sa = fix16_sin(alpha), ca = fix16_cos(alpha);
+
+	T->rows = 4;
+	T->columns = 4;
+	T->errors = 0;
+
+	//	[ ct, -st*ca,  st*sa, r*ct ]
+	//	[ st,  ct*ca, -ct*sa, r*st ]
+	//	[  0,     sa,     ca,    d ]
+	//	[  0,      0,      0,    1 ]
+	T->data[0][0] = ct;	T->data[0][1] = -fix16_mul(st, ca);	T->data[0][2] =  fix16_mul(st, sa);	T->data[0][3] = fix16_mul(r, ct);
+	T->data[1][0] = st;	T->data[1][1] =  fix16_mul(ct, ca);	T->data[1][2] = -fix16_mul(ct, sa);	T->data[1][3] = fix16_mul(r, st);
+	T->data[2][0] = 0;	T->data[2][1] = sa;					T->data[2][2] = ca;					T->data[2][3] = d;
+	T->data[3][0] = 0;	T->data[3][1] = 0;					T->data[3][2] = 0;					T->data[3][3] = fix16_one;
+}
+
+
+void forward_kinematics(const fix16_t q[6], struct point3d origins[7])
+{
+	dh_transform(&T_base, 0, 0, 0, 0);		// identity
+	origins[0].x = 0;	origins[0].y = 0;	origins[0].z = 0;
+
+	for(int ji=0; ji<6; ji++)
+	{
+		dh_transform(&T_link, q[ji], jpmtr[ji].a, jpmtr[ji].r, jpmtr[ji].d);
+		mf16_mul(&T_next, &T_base, &T_link);
+		T_base = T_next;
+
+		origins[ji+1].x = T_base.data[0][3];
+		origins[ji+1].y = T_base.data[1][3];
+		origins[ji+1].z = T_base.data[2][3];
+	}
+}
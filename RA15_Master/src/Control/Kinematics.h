@@ -21,7 +21,20 @@
 #include "fixmatrix.h"
 
 
+struct point3d {
+	fix16_t x;	// mm, base frame
+	fix16_t y;
+	fix16_t z;
+};
 
 
+// Homogeneous transformation matrix using DH parameter convention (same as matlab/Kinematics.m).
+// theta and alpha in degrees, r and d in mm.
+void dh_transform(mf16* T, fix16_t theta, fix16_t alpha, fix16_t r, fix16_t d);
+
+// Computes the origins of frames 0-6 in the base frame for joint angles q (deg).
+// origins[0] is the base, origins[6] is the tool flange. Not reentrant; call from one task only.
+void forward_kinematics(const fix16_t q[6], struct point3d origins[7]);
+
 
 #endif /* SRC_CONTROL_KINEMATICS_H_ */
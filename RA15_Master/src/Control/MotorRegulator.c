@@ -1,4 +1,7 @@
 #include "MotorRegulator.h"
+#include "Trajectory.h"
+#include "Parameters.h"
+#include "../Comms/Bluetooth.h"
 
 
 
@@ -17,32 +20,34 @@ static inline BOOL is_joint_limit_enabled(uint8_t ji)
 static fix16_t enc_cnt_to_jp(uint8_t ji, int32_t count);		// convert encoder count to joint position
 static fix16_t enc_vel_to_jv(uint8_t ji, fix16_t enc_v);	// convert encoder velocity (counts per second) to joint velocity
 static int32_t     enc_cnt_from_jp(uint8_t ji, fix16_t jp);	// convert joint position to encoder count
+static fix16_t coupled_jp(uint8_t i);						// position of joint i at regulator_time, extrapolated if it was sampled earlier
+static void update_remote_stats(void);						// age and extrapolation error of the remote joint states used for coupling
 
 static fix16_t pos_ctrl(uint8_t ci, fix16_t jp, fix16_t jpt, fix16_t jv_max);	// input position target, output velocity response
-static fix16_t vel_ctrl(uint8_t ci, fix16_t jv, fix16_t jvt);					// input velocity target, output pwm response
+static fix16_t vel_ctrl(uint8_t ci, fix16_t jv, fix16_t jvt, fix16_t ja_ff);		// input velocity target and acceleration feedforward, output pwm response
 
 enum homing_switch_states {
 	RELEASED,
 	PRESSED,
 };
 
-static struct joint_controller{
-	uint8_t recent_sample;				// Index of the most recent encoder sample
-	int32_t enc_cnt[NUM_SAMPLES];		// Stores last NUM_SAMPLES encoder counts
-	uint32_t enc_cnt_ms[NUM_SAMPLES];	// Stores last NUM_SAMPLES timestamps (milliseconds)
-	fix16_t dt;						// Elapsed time (seconds) between the most recent sample and the previous sample
+struct joint_controller jctrl[NUM_CONTROLLERS];
 
-	fix16_t pos_err;				// Position error
-	fix16_t pos_err_acc;			// Sum of all previous error values (accumulator for integral term)
+// Joints driven by other NXTs are only known from their last RS485 state, stamped with the global time it was sampled at
+// (about one TDMA cycle old). Coupling terms extrapolate them to regulator_time with the reported velocity.
+#define EXTRAPOLATE_MAX_MS	100		// Older states (sender stopped), and JOINT_STATE_UNSYNCED ones, are used as they are
 
-	fix16_t vel_err;				// Velocity error
-	fix16_t vel_err_acc;			// Sum of all previous error values (accumulator for integral term)
+static uint32_t regulator_time = 0;		// global_time_ms() at the start of the current TASK_MOTORREG cycle
+static uint8_t remote_coupled_mask = 0;	// Bit i set if a local joint is coupled to joint i, driven by another NXT
 
-	enum homing_switch_states home_sw;	// State of this joint's homing switch. Stays at RISING_EDGE or FALLING_EDGE for 1 cycle each.
-	int32_t enc_cnt_rising_edge;		// Encoder count at the homing switch's rising edge
-	int32_t enc_cnt_falling_edge;		// Encoder count at the homing switch's falling edge
-
-} jctrl[NUM_CONTROLLERS];
+static struct remote_joint_record{
+	uint32_t t;						// j[i].t, p and v of the previous state received
+	fix16_t p;
+	fix16_t v;
+} remote_prev[6];
+static uint32_t remote_stats_second = 0;	// systick_seconds of the window being measured
+static uint16_t remote_age_ms = 0;		// Worst cases so far in this window
+static uint16_t remote_err_mdeg = 0;
 
 
 
@@ -55,7 +60,13 @@ void init_motor_regulator()
 		uint8_t ji = joint_list[ci];	// get index of joint to control (0-5)
 		apply_pwm(ji, 0);
 		set_enc(ji, 0);
+
+		for(int i=0; i<6; i++)
+			if(jpmtr[ji].coaxial_rec[i] != 0)
+				remote_coupled_mask |= (1<<i);
 	}
+	for(int ci=0; ci<NUM_CONTROLLERS; ci++)
+		remote_coupled_mask &= ~(1<<joint_list[ci]);
 }
 
 void term_motor_regulator()
@@ -67,7 +78,14 @@ fix16_t lcdval = 0;
 TASK(TASK_MOTORREG)
 {
 	uint32_t task_start_time = SYSTICK_TIMER_HIRES;
+	uint32_t now = systick_get_ms();
+	uint32_t sampled_at = global_time_ms();
+	task_motorreg_start_ms = now;
+	regulator_time = sampled_at;
 	GetResource(RES_MOTORS);
+	apply_parameters(sampled_at);		// A committed table takes over here, so a cycle uses only one
+
+	update_remote_stats();
 
 	for(int ci=0; ci<NUM_CONTROLLERS; ci++)	// loop through joint_list to repeat for all joints this controller is responsible for
 	{
@@ -79,19 +97,30 @@ TASK(TASK_MOTORREG)
 
 		fix16_t jp = enc_cnt_to_jp(ji, enc_cnt);	j[ji].p = jp;
 		fix16_t jv = enc_vel_to_jv(ji, enc_vel);	j[ji].v = jv;
+		j[ji].t = sampled_at;
 
 		// Update state of homing switch. Recalculate joint position based on rising/falling edge if in homing mode.
 		update_home_sw(ci);
 
-		// Position-level and velocity-level PID controllers
+		// Position-level and velocity-level PID controllers.
+		// While a spline trajectory is playing, it replaces pt/vt and supplies velocity and acceleration feedforward.
 		fix16_t jpt = j[ji].pt;							// Position target
-		fix16_t jvt = pos_ctrl(ci, jp, jpt, j[ji].vt);	// Velocity target set by position controller
-		fix16_t pwm = vel_ctrl(ci, jv, jvt);			// Power level set by velocity controller
+		fix16_t jv_max = j[ji].vt;						// Speed limit while travelling to jpt
+		fix16_t jv_ff = 0, ja_ff = 0;
+		if(get_spline_reference(ji, now, &jpt, &jv_ff, &ja_ff))
+			jv_max = jpmtr[ji].vmax;
+		fix16_t jvt = fix16_add(jv_ff, pos_ctrl(ci, jp, jpt, jv_max));	// Velocity target set by position controller
+		fix16_t pwm = vel_ctrl(ci, jv, jvt, ja_ff);		// Power level set by velocity controller
 
 		// Apply calculated power level to this joint's motors.
 		apply_pwm(ji, fix16_to_int(pwm));
 	}
 
+	#if NXT == 1
+		record_bt_sample(now);		// Every cycle's joint states go to the PC, not only the ones at nxt_bt_tx_interval
+		record_telemetry();			// ... and the signals it subscribed to
+	#endif
+
 	ReleaseResource(RES_MOTORS);
 	task_motorreg_duration_us = (uint16_t)elapsed_time_us_between(task_start_time, SYSTICK_TIMER_HIRES);
 	TerminateTask();
@@ -128,7 +157,7 @@ static fix16_t pos_ctrl(uint8_t ci, fix16_t jp, fix16_t jpt, fix16_t jv_max)		//
 	return vt;
 }
 
-static fix16_t vel_ctrl(uint8_t ci, fix16_t jv, fix16_t jvt)			// input velocity target, output pwm response
+static fix16_t vel_ctrl(uint8_t ci, fix16_t jv, fix16_t jvt, fix16_t ja_ff)	// input velocity target and acceleration feedforward, output pwm response
 {
 	uint8_t ji = joint_list[ci];										// Index of current joint (0-5)
 
@@ -144,6 +173,8 @@ static fix16_t vel_ctrl(uint8_t ci, fix16_t jv, fix16_t jvt)			// input velocity
 	pwm_base = fix16_add(pwm_base, fix16_mul(jpmtr[ji].b[3], fix16_mul(x1, x1)));
 	pwm_base = fix16_add(pwm_base, fix16_mul(jpmtr[ji].b[4], fix16_mul(x2, x2)));
 	pwm_base = fix16_add(pwm_base, fix16_mul(jpmtr[ji].b[5], fix16_mul(x1, x2)));
+	pwm_base = fix16_add(pwm_base, fix16_mul(jpmtr[ji].ka, ja_ff));		// Extra power needed to accelerate
+	jctrl[ci].pwm_base = pwm_base;
 
 	// Calculate error between current position and target position
 	fix16_t error = fix16_sub(jvt, jv);						//current error = target - current
@@ -237,7 +268,7 @@ static fix16_t enc_cnt_to_jp(uint8_t ji, int32_t count)
 	{
 		fix16_t dep = jpmtr[ji].coaxial_rec[i];
 		if(dep != 0)								// Perform this check before doing math because most coaxial dependencies are 0.
-			jp = fix16_add(jp, fix16_mul(j[i].p, dep));
+			jp = fix16_add(jp, fix16_mul(coupled_jp(i), dep));
 	}
 
 	return jp;
@@ -272,7 +303,7 @@ static int32_t enc_cnt_from_jp(uint8_t ji, fix16_t jp)
 	{
 		fix16_t dep = jpmtr[ji].coaxial_rec[i];
 		if(dep != 0)								// Perform this check before doing math because most coaxial dependencies are 0.
-			count = fix16_sub(count, fix16_mul(j[i].p, dep));
+			count = fix16_sub(count, fix16_mul(coupled_jp(i), dep));
 	}
 
 	count = fix16_mul(count, jpmtr[ji].gear);
@@ -281,6 +312,55 @@ static int32_t enc_cnt_from_jp(uint8_t ji, fix16_t jp)
 }
 
 
+static fix16_t coupled_jp(uint8_t i)
+{
+	// jp = p + v*(regulator_time - t), for states at most EXTRAPOLATE_MAX_MS old
+
+	uint32_t age = regulator_time - j[i].t;		// Wraps to a large value for a state stamped in the future
+	if(j[i].t == JOINT_STATE_UPDATING || j[i].t == JOINT_STATE_UNSYNCED || age > EXTRAPOLATE_MAX_MS)
+		return j[i].p;
+
+	return fix16_add(j[i].p, fix16_mul(j[i].v, fix16_mul(fix16_from_int(age), S_PER_MS)));
+}
+
+
+static void update_remote_stats(void)
+{
+	if(systick_seconds != remote_stats_second)		// Publish the last window and start a new one
+	{
+		remote_state_age_max_ms = remote_age_ms;
+		remote_state_err_max_mdeg = remote_err_mdeg;
+		remote_age_ms = 0;
+		remote_err_mdeg = 0;
+		remote_stats_second = systick_seconds;
+	}
+
+	for(int i=0; i<6; i++)
+	{
+		if(!((remote_coupled_mask>>i)&0x01) || j[i].t == JOINT_STATE_UPDATING || j[i].t == JOINT_STATE_UNSYNCED)
+			continue;
+
+		uint32_t age = regulator_time - j[i].t;
+		if(age > remote_age_ms)
+			remote_age_ms = (age > UINT16_MAX) ? UINT16_MAX : (uint16_t)age;
+
+		if(j[i].t != remote_prev[i].t)				// New state: how far off was the extrapolation of the previous one?
+		{
+			uint32_t dt = j[i].t - remote_prev[i].t;
+			if(remote_prev[i].t != JOINT_STATE_UPDATING && remote_prev[i].t != JOINT_STATE_UNSYNCED && dt <= EXTRAPOLATE_MAX_MS)
+			{
+				fix16_t predicted = fix16_add(remote_prev[i].p, fix16_mul(remote_prev[i].v, fix16_mul(fix16_from_int(dt), S_PER_MS)));
+				fix16_t err = fix16_min(fix16_abs(fix16_sub(j[i].p, predicted)), F16(60.0f));	// Keeps millidegrees within uint16_t
+				remote_err_mdeg = (uint16_t)max_int(remote_err_mdeg, fix16_to_int(fix16_mul(err, F16(1000.0f))));
+			}
+			remote_prev[i].t = j[i].t;
+			remote_prev[i].p = j[i].p;
+			remote_prev[i].v = j[i].v;
+		}
+	}
+}
+
+
 static void update_home_sw(uint8_t ci)
 {
 	uint8_t ji = joint_list[ci];
@@ -22,10 +22,34 @@
 
 
 #define BRAKEMODE 1
+#define MOTORREG_PERIOD_MS 20		// Must match CYCLETIME of ALARM_MOTORREG in MotorRegulator.oil
 #define NUM_SAMPLES 5
 #define POS_ERR_ACC_MAX F16(100.0f)
 #define VEL_ERR_ACC_MAX F16(100.0f)
 
+// State of each controller on this NXT, indexed by controller index ci (joint joint_list[ci]). Written by TASK_MOTORREG
+// only. Public for the telemetry registry (Telemetry.h).
+struct joint_controller{
+	uint8_t recent_sample;				// Index of the most recent encoder sample
+	int32_t enc_cnt[NUM_SAMPLES];		// Stores last NUM_SAMPLES encoder counts
+	uint32_t enc_cnt_ms[NUM_SAMPLES];	// Stores last NUM_SAMPLES timestamps (milliseconds)
+	fix16_t dt;						// Elapsed time (seconds) between the most recent sample and the previous sample
+
+	fix16_t pos_err;				// Position error
+	fix16_t pos_err_acc;			// Sum of all previous error values (accumulator for integral term)
+
+	fix16_t vel_err;				// Velocity error
+	fix16_t vel_err_acc;			// Sum of all previous error values (accumulator for integral term)
+	fix16_t pwm_base;				// Feedforward pwm estimated by the regression model, before the PID terms
+
+	uint8_t home_sw;					// State of this joint's homing switch (enum homing_switch_states, MotorRegulator.c)
+	int32_t enc_cnt_rising_edge;		// Encoder count at the homing switch's rising edge
+	int32_t enc_cnt_falling_edge;		// Encoder count at the homing switch's falling edge
+
+};
+
+extern struct joint_controller jctrl[NUM_CONTROLLERS];
+
 DeclareResource(RES_MOTORS);
 DeclareAlarm(ALARM_MOTORREG);
 DeclareTask(TASK_MOTORREG);
@@ -0,0 +1,258 @@
+/*
+ * Parameters.c
+ *
+ *     Version: 1.0
+ *  Created on: Oct 19, 2026
+ *      Author: Daniel
+ */
+
+#include "Parameters.h"
+
+#include <stddef.h>
+#include <string.h>
+#include "Timing.h"
+#include "../Comms/Messages.h"
+
+
+// PUBLIC VARIABLES
+
+uint16_t param_version = 0;
+
+
+// PRIVATE VARIABLES
+
+#define PARAM_OFFSET(name, field, min, max)		offsetof(struct joint_parameter, field),
+#define PARAM_MIN(name, field, min, max)		F16(min),
+#define PARAM_MAX(name, field, min, max)		F16(max),
+static const uint16_t param_offset[PARAM_COUNT] = { JOINT_PARAMETERS(PARAM_OFFSET) };
+static const fix16_t param_min[PARAM_COUNT] = { JOINT_PARAMETERS(PARAM_MIN) };
+static const fix16_t param_max[PARAM_COUNT] = { JOINT_PARAMETERS(PARAM_MAX) };
+
+// jpmtr points at bank[live]. The background task writes only the other bank, and only while no switch is armed.
+// It sets armed last, TASK_MOTORREG switches and then clears it last, so no resource is needed.
+static struct joint_parameter bank[2][6];
+static volatile uint8_t live = 0;
+static volatile BOOL armed = FALSE;		// A switch to the staging bank is due at switch_at
+static volatile BOOL resync = FALSE;	// Set by a switch: the staging bank still holds the table switched from
+static BOOL switched = FALSE;			// switch_at is that of the latest switch
+static uint32_t switch_at = 0;			// Global time
+static uint16_t switch_version = 0;
+
+#if NXT == 1
+	static const uint8_t remote_nxt[2] = {2, 3};
+	static uint32_t dirty[6];			// Bit id set if parameter id of joint ji was set since the last successful commit
+	static uint8_t commit_result = PARAM_OK;	// enum param_result
+	static uint16_t commit_version;
+	static BOOL commit_at_set;			// commit_at is fixed: both NXT2 and NXT3 have every changed value
+	static uint32_t commit_at;
+	static struct remote_commit {		// Progress of the commit on NXT2 and NXT3
+		uint8_t next;					// Next parameter to send, ji*PARAM_COUNT + id. 6*PARAM_COUNT: the commit itself.
+		BOOL waiting;					// Request msg_id is not answered yet
+		uint8_t msg_id;
+		BOOL committed;					// It accepted the commit
+	} remote[2];
+#endif
+
+
+// PRIVATE FUNCTIONS
+
+static fix16_t* field(struct joint_parameter* p, uint8_t id)
+{
+	return (fix16_t*)((uint8_t*)p + param_offset[id]);
+}
+
+
+static struct joint_parameter* staging(void)	// The staging bank, brought up to date after a switch
+{
+	if(resync)
+	{
+		memcpy(bank[!live], bank[live], sizeof(bank[0]));
+		resync = FALSE;
+	}
+	return bank[!live];
+}
+
+
+static BOOL is_consistent(const struct joint_parameter* p)
+{
+	for(int ji=0; ji<6; ji++)
+		if(p[ji].pmin >= p[ji].pmax || p[ji].phome < p[ji].pmin || p[ji].phome > p[ji].pmax)
+			return FALSE;
+	return TRUE;
+}
+
+
+#if NXT == 1
+static BOOL values_sent(const struct remote_commit* c)	// Every changed value was accepted
+{
+	for(uint8_t next = c->next; next < 6*PARAM_COUNT; next++)
+		if(dirty[next / PARAM_COUNT] & (1UL << (next % PARAM_COUNT)))
+			return FALSE;
+	return TRUE;
+}
+#endif
+
+
+static BOOL is_busy(void)
+{
+	#if NXT == 1
+		if(commit_result == PARAM_PENDING)
+			return TRUE;
+	#endif
+	return armed;
+}
+
+
+// PUBLIC FUNCTIONS
+
+void init_parameters(void)
+{
+	memcpy(bank[0], jpmtr_defaults, sizeof(bank[0]));
+	memcpy(bank[1], jpmtr_defaults, sizeof(bank[1]));
+	live = 0;
+	jpmtr = bank[0];
+	param_version = 0;
+}
+
+
+enum param_result get_parameter(uint8_t ji, uint8_t id, fix16_t* value)
+{
+	if(ji >= 6 || id >= PARAM_COUNT)
+		return PARAM_UNKNOWN;
+	*value = *field(&staging()[ji], id);
+	return PARAM_OK;
+}
+
+
+enum param_result set_parameter(uint8_t ji, uint8_t id, fix16_t value)
+{
+	if(ji >= 6 || id >= PARAM_COUNT)
+		return PARAM_UNKNOWN;
+	if(value < param_min[id] || value > param_max[id])
+		return PARAM_OUT_OF_RANGE;
+	if(is_busy())
+		return PARAM_BUSY;
+	*field(&staging()[ji], id) = value;
+	#if NXT == 1
+		dirty[ji] |= (1UL << id);
+	#endif
+	return PARAM_OK;
+}
+
+
+enum param_result schedule_parameters(uint16_t version, uint32_t at_ms)
+{
+	if(armed)
+		return PARAM_BUSY;
+	if(!is_consistent(staging()))
+		return PARAM_INCONSISTENT;
+	if((int32_t)(at_ms - global_time_ms()) <= 0)	// Too late to switch with the others
+		return PARAM_FAILED;
+	switch_version = version;
+	switch_at = at_ms;
+	armed = TRUE;
+	return PARAM_OK;
+}
+
+
+void apply_parameters(uint32_t now)
+{
+	if(!armed || (int32_t)(now - switch_at) < 0)
+		return;
+	live = !live;
+	jpmtr = bank[live];
+	param_version = switch_version;
+	switched = TRUE;
+	resync = TRUE;
+	armed = FALSE;
+}
+
+
+#if NXT == 1
+enum param_result commit_parameters(uint16_t version)
+{
+	if(is_busy() || (switched && (int32_t)(global_time_ms() - switch_at) < PARAM_SWITCH_GUARD_MS))
+		return PARAM_BUSY;
+	if(!is_consistent(staging()))
+		return PARAM_INCONSISTENT;
+	commit_version = version;
+	commit_at_set = FALSE;
+	memset(remote, 0, sizeof(remote));
+	commit_result = PARAM_PENDING;
+	return PARAM_PENDING;
+}
+
+
+enum param_result get_commit_result(void)
+{
+	return (enum param_result)commit_result;
+}
+
+
+void update_parameters(void)
+{
+	if(commit_result != PARAM_PENDING)
+		return;
+
+	for(int r=0; r<2; r++)
+	{
+		struct remote_commit* c = &remote[r];
+		if(c->waiting)
+		{
+			enum msg_result result = get_message_result(c->msg_id);
+			if(result == MSG_PENDING)
+				continue;
+			c->waiting = FALSE;
+			if(result != MSG_OK)			// The values stay dirty, and go again with the next commit
+			{
+				commit_result = PARAM_FAILED;
+				return;
+			}
+			if(c->next < 6*PARAM_COUNT)
+				c->next++;
+			else
+				c->committed = TRUE;
+		}
+		if(c->committed)
+			continue;
+
+		while(c->next < 6*PARAM_COUNT && !(dirty[c->next / PARAM_COUNT] & (1UL << (c->next % PARAM_COUNT))))
+			c->next++;
+
+		uint8_t args[MSG_MAX_ARGS];
+		if(c->next < 6*PARAM_COUNT)		// Changed values first, one request at a time
+		{
+			uint8_t ji = c->next / PARAM_COUNT;
+			uint8_t id = c->next % PARAM_COUNT;
+			uint32_t value = (uint32_t)*field(&staging()[ji], id);
+			args[0] = ji;
+			args[1] = id;
+			for(int k=0; k<4; k++)
+				args[2+k] = (uint8_t)(value >> (8*k));
+			c->waiting = post_message(remote_nxt[r], MSG_SET_PARAM, MSG_PRIORITY_LOW, args, &c->msg_id);
+		}
+		else							// Then the commit, with the same switch time for both
+		{
+			if(!commit_at_set)			// The other may still be taking its values, in turns with this one
+			{
+				if(!values_sent(&remote[0]) || !values_sent(&remote[1]))
+					continue;
+				commit_at = global_time_ms() + PARAM_SWITCH_DELAY_MS;
+				commit_at_set = TRUE;
+			}
+			args[0] = (uint8_t)commit_version;
+			args[1] = (uint8_t)(commit_version >> 8);
+			for(int k=0; k<4; k++)
+				args[2+k] = (uint8_t)(commit_at >> (8*k));
+			c->waiting = post_message(remote_nxt[r], MSG_COMMIT_PARAMS, MSG_PRIORITY_LOW, args, &c->msg_id);
+		}								// If the queue was full, it is posted again next time
+	}
+
+	if(remote[0].committed && remote[1].committed)
+	{
+		commit_result = (schedule_parameters(commit_version, commit_at) == PARAM_OK) ? PARAM_OK : PARAM_FAILED;
+		if(commit_result == PARAM_OK)
+			memset(dirty, 0, sizeof(dirty));
+	}
+}
+#endif
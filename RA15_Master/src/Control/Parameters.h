@@ -0,0 +1,67 @@
+/*
+ * Parameters.h
+ *
+ *	Public interface for Parameters.c.
+ *	Joint parameters the PC can tune over Bluetooth without reflashing: the fields of jpmtr[] listed in
+ *	JOINT_PARAMETERS (PacketSchema.h). Each NXT keeps two RAM copies of jpmtr[], started from the flashed
+ *	jpmtr_defaults[]: the one in use, and a staging copy that set_parameter() writes to. A commit switches jpmtr to
+ *	the staging copy at a given global time, at the start of a TASK_MOTORREG cycle, so a cycle never sees half of an
+ *	update. Every NXT holds all six joints, as kinematics and trajectories use the others' limits too.
+ *	On NXT1 commit_parameters() first sends the changed values and then the commit to NXT2 and NXT3 over RS485
+ *	(Messages.h), and switches itself only once both have accepted, at the same time as they do. If one of them
+ *	accepted and the other did not, the accepting one switches on its own and the versions differ until the next
+ *	commit succeeds. The changes stay staged on NXT1, and are sent again by the next commit.
+ *
+ *     Version: 1.0
+ *  Created on: Oct 19, 2026
+ *      Author: Daniel
+ */
+
+#ifndef SRC_CONTROL_PARAMETERS_H_
+#define SRC_CONTROL_PARAMETERS_H_
+
+#include "kernel.h"
+#include "kernel_id.h"
+#include "ecrobot_interface.h"
+#include "stdint.h"
+
+#include "../Globals.h"
+#include "../Comms/PacketSchema.h"
+#include "MotorRegulator.h"
+
+
+#define PARAM_SWITCH_DELAY_MS	400		// From sending the commit, once NXT2/3 have every value, to the switch: time for every resend of it
+#define PARAM_SWITCH_GUARD_MS	(2 * MOTORREG_PERIOD_MS)	// After a switch, until the next commit: the NXTs' clocks differ slightly
+
+extern uint16_t param_version;			// Version of the table in use. 0: jpmtr_defaults[].
+
+
+void init_parameters(void);				// Should be called in device startup hook
+
+// Staged value of parameter id of joint ji. Returns PARAM_UNKNOWN if there is no such parameter.
+enum param_result get_parameter(uint8_t ji, uint8_t id, fix16_t* value);
+
+// Stages a value (background task). Returns PARAM_OUT_OF_RANGE outside the parameter's limits, PARAM_BUSY while
+// a commit is under way. The table in use does not change until the next commit.
+enum param_result set_parameter(uint8_t ji, uint8_t id, fix16_t value);
+
+// Arms a switch to the staged table, as version, at global time at_ms (background task). Returns PARAM_INCONSISTENT
+// if a joint's staged pmin, phome and pmax are out of order, PARAM_BUSY if a switch is already armed, PARAM_FAILED if
+// at_ms has passed, as the other NXTs would switch on a different cycle.
+enum param_result schedule_parameters(uint16_t version, uint32_t at_ms);
+
+// Called by TASK_MOTORREG at the start of every cycle, with the global time it samples at. Switches if it is due.
+void apply_parameters(uint32_t now);
+
+#if NXT == 1
+	// Starts committing the staged table to all three NXTs as version. Returns PARAM_PENDING if it started, or why not.
+	enum param_result commit_parameters(uint16_t version);
+
+	// Outcome of the latest commit: PARAM_PENDING until it is sent to NXT2/3 and armed, then PARAM_OK or PARAM_FAILED.
+	enum param_result get_commit_result(void);
+
+	void update_parameters(void);		// Called rapidly by the background task. Carries commits to NXT2/3.
+#endif
+
+
+#endif /* SRC_CONTROL_PARAMETERS_H_ */
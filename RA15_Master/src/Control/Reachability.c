@@ -0,0 +1,57 @@
+/*
+ * Reachability.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Daniel
+ */
+
+#include "Reachability.h"
+
+
+// PRIVATE FUNCTIONS
+
+static int32_t voxel_axis_index(fix16_t val, int32_t origin_mm, int32_t n)	// Returns -1 if outside the map
+{
+	int32_t mm = (val >> 16) - origin_mm;		// floor to whole mm
+	if(mm < 0)
+		return -1;
+	int32_t i = mm / REACH_VOXEL_MM;
+	return (i < n) ? i : -1;
+}
+
+static const int8_t* lookup_voxel(fix16_t x, fix16_t y, fix16_t z)		// Returns NULL if unreachable
+{
+	int32_t ix = voxel_axis_index(x, REACH_X0_MM, REACH_NX);
+	int32_t iy = voxel_axis_index(y, REACH_Y0_MM, REACH_NY);
+	int32_t iz = voxel_axis_index(z, REACH_Z0_MM, REACH_NZ);
+	if(ix < 0 || iy < 0 || iz < 0)
+		return NULL;
+
+	const int8_t* seed = reach_seed[(iz*REACH_NY + iy)*REACH_NX + ix];
+	return (seed[0] == REACH_UNREACHABLE) ? NULL : seed;
+}
+
+
+// PUBLIC FUNCTIONS
+
+BOOL is_wrist_center_reachable(fix16_t x, fix16_t y, fix16_t z)
+{
+	return lookup_voxel(x, y, z) != NULL;
+}
+
+BOOL get_ik_seed(fix16_t x, fix16_t y, fix16_t z, fix16_t seed[REACH_SEED_JOINTS])
+{
+	const int8_t* voxel = lookup_voxel(x, y, z);
+	if(voxel == NULL)
+		return FALSE;
+
+	for(int ji=0; ji<REACH_SEED_JOINTS; ji++)
+		seed[ji] = fix16_from_int(reach_seed_center[ji] + voxel[ji]*REACH_SEED_STEP_DEG);
+	return TRUE;
+}
+
+void wrist_center_from_tool(const fix16_t p[3], const fix16_t approach[3], fix16_t wc[3])
+{
+	for(int i=0; i<3; i++)
+		wc[i] = fix16_sub(p[i], fix16_mul(jpmtr[5].d, approach[i]));
+}
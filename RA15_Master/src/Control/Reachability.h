@@ -0,0 +1,41 @@
+/*
+ * Reachability.h
+ *
+ *	Public interface for Reachability.c.
+ *	O(1) workspace checks and IK seeds, looked up in the voxel map stored in ReachabilityTable.c.
+ *	Regenerate the table with RA15_Host/build/reachability_gen whenever DH params or joint limits change.
+ *	Not linked into RA15 yet: every target path (PC_BT, waypoints, the LCD) is in joint space. The first one
+ *	that takes Cartesian targets adds Reachability.c and ReachabilityTable.c to the Makefile, see BUILD_MODE there.
+ *	Until then RA15_Host's reach_sil builds them for the PC and checks them against forward_kinematics().
+ *
+ *     Version: 1.0
+ *  Created on: Oct 19, 2026
+ *      Author: Daniel
+ */
+
+#ifndef SRC_CONTROL_REACHABILITY_H_
+#define SRC_CONTROL_REACHABILITY_H_
+
+#include "kernel.h"
+#include "kernel_id.h"
+#include "ecrobot_interface.h"
+#include "stdint.h"
+
+#include <stddef.h>
+#include "../Globals.h"
+#include "ReachabilityTable.h"
+#include "fix16.h"
+
+
+// Returns TRUE if the wrist center (x,y,z in mm, base frame) lies in a voxel that J1-J3 can reach.
+BOOL is_wrist_center_reachable(fix16_t x, fix16_t y, fix16_t z);
+
+// Writes the IK starting point for J1-J3 (deg) nearest to the wrist center (x,y,z in mm, base frame).
+// Returns FALSE and leaves seed untouched if the position is unreachable.
+BOOL get_ik_seed(fix16_t x, fix16_t y, fix16_t z, fix16_t seed[REACH_SEED_JOINTS]);
+
+// Converts a tool target p (mm) with unit approach vector (z6) into the wrist center: wc = p - d6*approach
+void wrist_center_from_tool(const fix16_t p[3], const fix16_t approach[3], fix16_t wc[3]);
+
+
+#endif /* SRC_CONTROL_REACHABILITY_H_ */
@@ -0,0 +1,449 @@
+/*
+ * ReachabilityTable.c
+ *
+ *	GENERATED FILE - DO NOT EDIT. Regenerate with RA15_Host/build/reachability_gen.
+ *
+ *	2564 of 10868 voxels reachable, 32604 bytes.
+ */
+
+#include "ReachabilityTable.h"
+
+const int8_t reach_seed[REACH_NX*REACH_NY*REACH_NZ][REACH_SEED_JOINTS] = {
+	// z = 100 mm
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-52,-34},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-52,-44},{-40,-52,-39},{-37,-52,-33},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-52,-52},{-40,-52,-49},{-35,-52,-43},{-31,-52,-37},{-28,-52,-33},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-33,-52,-52},{-29,-52,-47},{-25,-52,-40},{-23,-52,-34},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-26,-52,-52},{-21,-52,-50},{-19,-52,-43},{-17,-52,-36},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-13,-52,-52},{-12,-52,-45},{-10,-52,-38},{-9,-52,-33},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-5,-52,-52},{-4,-52,-46},{-4,-52,-39},{-3,-52,-33},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{5,-52,-52},{4,-52,-46},{4,-52,-39},{3,-52,-33},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{13,-52,-52},{12,-52,-45},{10,-52,-38},{9,-52,-33},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{26,-52,-52},{21,-52,-50},{19,-52,-43},{17,-52,-36},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{33,-52,-52},{29,-52,-47},{25,-52,-40},{23,-52,-34},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-52,-52},{40,-52,-49},{35,-52,-43},{31,-52,-37},{28,-52,-33},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-52,-44},{40,-52,-39},{37,-52,-33},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-52,-34},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	// z = 125 mm
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-52,-22},{-42,-52,-17},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-49,-33},{-41,-51,-27},{-38,-52,-21},{-35,-52,-17},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-46,-45},{-40,-47,-39},{-37,-49,-33},{-33,-52,-25},{-30,-52,-19},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-45,-52},{-40,-45,-51},{-35,-46,-44},{-31,-48,-37},{-28,-50,-30},{-26,-52,-22},{-23,-52,-17},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-33,-45,-52},{-29,-45,-49},{-25,-47,-41},{-23,-49,-33},{-20,-52,-25},{-19,-52,-19},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-21,-44,-52},{-19,-46,-44},{-17,-48,-36},{-15,-51,-28},{-14,-52,-20},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-13,-45,-52},{-12,-46,-46},{-10,-48,-38},{-9,-50,-30},{-8,-52,-22},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-5,-45,-52},{-4,-45,-47},{-4,-47,-39},{-3,-50,-31},{-3,-52,-22},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{5,-45,-52},{4,-45,-47},{4,-47,-39},{3,-50,-31},{3,-52,-22},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{13,-45,-52},{12,-46,-46},{10,-48,-38},{9,-50,-30},{8,-52,-22},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{21,-44,-52},{19,-46,-44},{17,-48,-36},{15,-51,-28},{14,-52,-20},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{33,-45,-52},{29,-45,-49},{25,-47,-41},{23,-49,-33},{20,-52,-25},{19,-52,-19},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-45,-52},{40,-45,-51},{35,-46,-44},{31,-48,-37},{28,-50,-30},{26,-52,-22},{23,-52,-17},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-46,-45},{40,-47,-39},{37,-49,-33},{33,-52,-25},{30,-52,-19},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-49,-33},{41,-51,-27},{38,-52,-21},{35,-52,-17},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-52,-22},{42,-52,-17},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	// z = 150 mm
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-52,-9},{-42,-52,-6},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-48,-21},{-42,-51,-14},{-39,-52,-8},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-43,-34},{-41,-45,-28},{-38,-48,-20},{-35,-52,-12},{-32,-52,-7},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-38,-46},{-40,-40,-40},{-37,-43,-34},{-33,-46,-26},{-30,-49,-18},{-28,-52,-10},{-25,-52,-6},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-37,-52},{-40,-36,-52},{-35,-38,-45},{-31,-41,-38},{-28,-44,-31},{-26,-47,-22},{-23,-51,-13},{-22,-52,-7},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-33,-36,-52},{-29,-37,-50},{-25,-40,-42},{-23,-43,-34},{-20,-46,-26},{-19,-50,-17},{-17,-52,-9},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-21,-36,-52},{-19,-38,-45},{-17,-41,-37},{-15,-45,-29},{-14,-49,-19},{-13,-52,-10},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-13,-36,-52},{-12,-38,-47},{-10,-41,-39},{-9,-44,-31},{-8,-48,-21},{-8,-52,-11},{-7,-52,-6},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-7,-38,-52},{-4,-37,-49},{-4,-40,-40},{-3,-44,-31},{-3,-47,-22},{-3,-52,-12},{-3,-52,-6},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{7,-38,-52},{4,-37,-49},{4,-40,-40},{3,-44,-31},{3,-47,-22},{3,-52,-12},{3,-52,-6},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{13,-36,-52},{12,-38,-47},{10,-41,-39},{9,-44,-31},{8,-48,-21},{8,-52,-11},{7,-52,-6},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{21,-36,-52},{19,-38,-45},{17,-41,-37},{15,-45,-29},{14,-49,-19},{13,-52,-10},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{33,-36,-52},{29,-37,-50},{25,-40,-42},{23,-43,-34},{20,-46,-26},{19,-50,-17},{17,-52,-9},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-37,-52},{40,-36,-52},{35,-38,-45},{31,-41,-38},{28,-44,-31},{26,-47,-22},{23,-51,-13},{22,-52,-7},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-38,-46},{40,-40,-40},{37,-43,-34},{33,-46,-26},{30,-49,-18},{28,-52,-10},{25,-52,-6},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-43,-34},{41,-45,-28},{38,-48,-20},{35,-52,-12},{32,-52,-7},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-48,-21},{42,-51,-14},{39,-52,-8},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-52,-9},{42,-52,-6},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	// z = 175 mm
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-52,4},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-49,-7},{-42,-52,1},{-39,-52,4},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-42,-22},{-42,-46,-14},{-39,-50,-6},{-36,-52,1},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-36,-34},{-41,-39,-28},{-38,-43,-21},{-35,-47,-12},{-32,-51,-3},{-30,-52,3},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-31,-46},{-40,-34,-40},{-37,-37,-33},{-33,-40,-26},{-30,-44,-18},{-28,-48,-9},{-26,-52,1},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-28,-52},{-40,-28,-52},{-35,-31,-45},{-31,-34,-38},{-28,-38,-31},{-26,-42,-22},{-23,-46,-13},{-22,-51,-3},{-20,-52,3},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-33,-28,-52},{-29,-29,-50},{-25,-33,-42},{-23,-36,-34},{-20,-40,-26},{-19,-45,-17},{-17,-49,-7},{-16,-52,2},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-21,-28,-52},{-19,-31,-45},{-17,-35,-37},{-15,-39,-29},{-14,-43,-20},{-13,-48,-10},{-12,-52,1},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-13,-28,-52},{-12,-30,-48},{-10,-34,-39},{-9,-38,-31},{-8,-42,-22},{-8,-47,-11},{-7,-52,-1},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-7,-25,-52},{-4,-30,-49},{-4,-34,-40},{-3,-38,-31},{-3,-42,-22},{-3,-47,-12},{-3,-52,-2},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{7,-25,-52},{4,-30,-49},{4,-34,-40},{3,-38,-31},{3,-42,-22},{3,-47,-12},{3,-52,-2},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{13,-28,-52},{12,-30,-48},{10,-34,-39},{9,-38,-31},{8,-42,-22},{8,-47,-11},{7,-52,-1},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{21,-28,-52},{19,-31,-45},{17,-35,-37},{15,-39,-29},{14,-43,-20},{13,-48,-10},{12,-52,1},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{33,-28,-52},{29,-29,-50},{25,-33,-42},{23,-36,-34},{20,-40,-26},{19,-45,-17},{17,-49,-7},{16,-52,2},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-28,-52},{40,-28,-52},{35,-31,-45},{31,-34,-38},{28,-38,-31},{26,-42,-22},{23,-46,-13},{22,-51,-3},{20,-52,3},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-31,-46},{40,-34,-40},{37,-37,-33},{33,-40,-26},{30,-44,-18},{28,-48,-9},{26,-52,1},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-36,-34},{41,-39,-28},{38,-43,-21},{35,-47,-12},{32,-51,-3},{30,-52,3},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-42,-22},{42,-46,-14},{39,-50,-6},{36,-52,1},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-49,-7},{42,-52,1},{39,-52,4},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-52,4},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	// z = 200 mm
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-52,10},{-42,-52,13},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-45,-6},{-42,-49,3},{-39,-52,10},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-37,-21},{-42,-41,-13},{-39,-45,-5},{-36,-50,5},{-33,-52,11},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-30,-34},{-41,-34,-27},{-38,-38,-20},{-35,-42,-11},{-32,-47,-2},{-30,-52,9},{-27,-52,13},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-24,-46},{-40,-27,-39},{-37,-31,-33},{-33,-35,-25},{-30,-39,-17},{-28,-44,-8},{-26,-49,3},{-24,-52,10},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-19,-52},{-40,-21,-51},{-35,-24,-45},{-31,-28,-37},{-28,-33,-30},{-26,-37,-22},{-23,-42,-12},{-22,-47,-2},{-20,-52,9},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-33,-19,-52},{-29,-22,-49},{-25,-26,-41},{-23,-30,-34},{-20,-35,-25},{-19,-40,-16},{-17,-45,-6},{-16,-51,6},{-15,-52,12},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-21,-20,-52},{-19,-24,-45},{-17,-29,-36},{-15,-34,-28},{-14,-38,-19},{-13,-44,-9},{-12,-49,3},{-11,-52,11},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-13,-19,-52},{-12,-23,-47},{-10,-28,-38},{-9,-33,-30},{-8,-37,-21},{-8,-43,-10},{-7,-48,1},{-7,-52,10},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-5,-19,-52},{-4,-23,-48},{-4,-27,-39},{-3,-32,-31},{-3,-37,-22},{-3,-42,-11},{-3,-48,0},{-2,-52,10},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{5,-19,-52},{4,-23,-48},{4,-27,-39},{3,-32,-31},{3,-37,-22},{3,-42,-11},{3,-48,0},{2,-52,10},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{13,-19,-52},{12,-23,-47},{10,-28,-38},{9,-33,-30},{8,-37,-21},{8,-43,-10},{7,-48,1},{7,-52,10},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{21,-20,-52},{19,-24,-45},{17,-29,-36},{15,-34,-28},{14,-38,-19},{13,-44,-9},{12,-49,3},{11,-52,11},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{33,-19,-52},{29,-22,-49},{25,-26,-41},{23,-30,-34},{20,-35,-25},{19,-40,-16},{17,-45,-6},{16,-51,6},{15,-52,12},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-19,-52},{40,-21,-51},{35,-24,-45},{31,-28,-37},{28,-33,-30},{26,-37,-22},{23,-42,-12},{22,-47,-2},{20,-52,9},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-24,-46},{40,-27,-39},{37,-31,-33},{33,-35,-25},{30,-39,-17},{28,-44,-8},{26,-49,3},{24,-52,10},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-30,-34},{41,-34,-27},{38,-38,-20},{35,-42,-11},{32,-47,-2},{30,-52,9},{27,-52,13},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-37,-21},{42,-41,-13},{39,-45,-5},{36,-50,5},{33,-52,11},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-45,-6},{42,-49,3},{39,-52,10},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-52,10},{42,-52,13},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	// z = 225 mm
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-50,13},{-42,-52,18},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-41,-4},{-42,-46,5},{-39,-51,14},{-37,-52,19},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-33,-19},{-42,-37,-11},{-39,-42,-3},{-36,-47,7},{-33,-52,17},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-25,-32},{-41,-29,-25},{-38,-34,-18},{-35,-38,-10},{-32,-43,0},{-30,-49,11},{-28,-52,18},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-18,-43},{-40,-22,-37},{-37,-26,-31},{-33,-30,-23},{-30,-35,-15},{-28,-40,-6},{-26,-46,5},{-24,-52,17},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-11,-52},{-40,-14,-49},{-35,-18,-42},{-31,-23,-36},{-28,-28,-28},{-26,-32,-20},{-23,-38,-10},{-22,-43,0},{-20,-49,11},{-19,-52,18},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-33,-11,-52},{-29,-15,-47},{-25,-20,-39},{-23,-25,-32},{-20,-30,-23},{-19,-36,-14},{-17,-41,-4},{-16,-47,8},{-15,-52,18},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-25,-10,-52},{-21,-13,-50},{-19,-18,-42},{-17,-24,-34},{-15,-29,-26},{-14,-34,-17},{-13,-40,-7},{-12,-46,5},{-11,-52,17},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-13,-11,-52},{-12,-17,-44},{-10,-22,-36},{-9,-28,-28},{-8,-33,-19},{-8,-39,-9},{-7,-45,3},{-7,-51,15},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-5,-11,-52},{-4,-16,-46},{-4,-22,-37},{-3,-27,-29},{-3,-32,-20},{-3,-38,-10},{-3,-44,2},{-2,-51,14},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{5,-11,-52},{4,-16,-46},{4,-22,-37},{3,-27,-29},{3,-32,-20},{3,-38,-10},{3,-44,2},{2,-51,14},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{13,-11,-52},{12,-17,-44},{10,-22,-36},{9,-28,-28},{8,-33,-19},{8,-39,-9},{7,-45,3},{7,-51,15},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{25,-10,-52},{21,-13,-50},{19,-18,-42},{17,-24,-34},{15,-29,-26},{14,-34,-17},{13,-40,-7},{12,-46,5},{11,-52,17},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{33,-11,-52},{29,-15,-47},{25,-20,-39},{23,-25,-32},{20,-30,-23},{19,-36,-14},{17,-41,-4},{16,-47,8},{15,-52,18},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-11,-52},{40,-14,-49},{35,-18,-42},{31,-23,-36},{28,-28,-28},{26,-32,-20},{23,-38,-10},{22,-43,0},{20,-49,11},{19,-52,18},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-18,-43},{40,-22,-37},{37,-26,-31},{33,-30,-23},{30,-35,-15},{28,-40,-6},{26,-46,5},{24,-52,17},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-25,-32},{41,-29,-25},{38,-34,-18},{35,-38,-10},{32,-43,0},{30,-49,11},{28,-52,18},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-33,-19},{42,-37,-11},{39,-42,-3},{36,-47,7},{33,-52,17},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-41,-4},{42,-46,5},{39,-51,14},{37,-52,19},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-50,13},{42,-52,18},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	// z = 250 mm
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-48,17},{-42,-52,25},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-38,-2},{-42,-43,8},{-39,-48,18},{-37,-52,26},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-29,-16},{-42,-34,-9},{-39,-38,-1},{-36,-44,9},{-33,-50,21},{-31,-52,26},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-21,-29},{-41,-25,-22},{-38,-30,-15},{-35,-35,-7},{-32,-40,3},{-30,-46,14},{-28,-52,25},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-13,-40},{-40,-17,-35},{-37,-22,-28},{-33,-26,-21},{-30,-31,-13},{-28,-37,-3},{-26,-43,8},{-24,-50,20},{-22,-52,27},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-4,-51},{-40,-8,-46},{-35,-13,-39},{-31,-18,-33},{-28,-23,-25},{-26,-29,-17},{-23,-34,-8},{-22,-40,3},{-20,-47,15},{-19,-52,25},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-38,0,-52},{-33,-5,-50},{-29,-10,-43},{-25,-16,-36},{-23,-21,-29},{-20,-26,-21},{-19,-32,-12},{-17,-38,-2},{-16,-44,10},{-15,-52,24},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-25,-2,-52},{-21,-8,-47},{-19,-13,-39},{-17,-19,-32},{-15,-25,-23},{-14,-30,-14},{-13,-36,-4},{-12,-43,8},{-11,-50,21},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-16,0,-52},{-13,-6,-49},{-12,-12,-41},{-10,-18,-34},{-9,-23,-25},{-8,-29,-16},{-8,-35,-6},{-7,-42,6},{-7,-49,19},{-5,-52,28},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-5,1,-52},{-5,-5,-50},{-4,-11,-42},{-4,-17,-35},{-3,-23,-26},{-3,-29,-17},{-3,-35,-7},{-3,-41,5},{-2,-48,18},{-2,-52,26},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{5,1,-52},{5,-5,-50},{4,-11,-42},{4,-17,-35},{3,-23,-26},{3,-29,-17},{3,-35,-7},{3,-41,5},{2,-48,18},{2,-52,26},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{16,0,-52},{13,-6,-49},{12,-12,-41},{10,-18,-34},{9,-23,-25},{8,-29,-16},{8,-35,-6},{7,-42,6},{7,-49,19},{5,-52,28},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{25,-2,-52},{21,-8,-47},{19,-13,-39},{17,-19,-32},{15,-25,-23},{14,-30,-14},{13,-36,-4},{12,-43,8},{11,-50,21},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{38,0,-52},{33,-5,-50},{29,-10,-43},{25,-16,-36},{23,-21,-29},{20,-26,-21},{19,-32,-12},{17,-38,-2},{16,-44,10},{15,-52,24},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-4,-51},{40,-8,-46},{35,-13,-39},{31,-18,-33},{28,-23,-25},{26,-29,-17},{23,-34,-8},{22,-40,3},{20,-47,15},{19,-52,25},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-13,-40},{40,-17,-35},{37,-22,-28},{33,-26,-21},{30,-31,-13},{28,-37,-3},{26,-43,8},{24,-50,20},{22,-52,27},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-21,-29},{41,-25,-22},{38,-30,-15},{35,-35,-7},{32,-40,3},{30,-46,14},{28,-52,25},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-29,-16},{42,-34,-9},{39,-38,-1},{36,-44,9},{33,-50,21},{31,-52,26},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-38,-2},{42,-43,8},{39,-48,18},{37,-52,26},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-48,17},{42,-52,25},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	// z = 275 mm
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-52,34},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-46,21},{-42,-52,33},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-35,3},{-42,-41,12},{-39,-46,22},{-37,-52,33},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-26,-12},{-42,-31,-5},{-39,-36,3},{-36,-42,14},{-33,-48,25},{-31,-52,33},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-17,-25},{-41,-22,-19},{-38,-27,-12},{-35,-32,-4},{-32,-38,7},{-30,-44,18},{-28,-52,32},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-8,-37},{-40,-13,-31},{-37,-18,-24},{-33,-23,-17},{-30,-28,-9},{-28,-34,1},{-26,-41,12},{-24,-48,24},{-22,-52,33},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,2,-47},{-40,-4,-42},{-35,-9,-36},{-31,-15,-29},{-28,-20,-22},{-26,-26,-13},{-23,-31,-4},{-22,-38,7},{-20,-45,19},{-19,-52,33},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,11,-52},{-38,6,-51},{-33,1,-46},{-29,-6,-40},{-25,-12,-33},{-23,-17,-25},{-20,-23,-17},{-19,-29,-8},{-17,-35,3},{-16,-42,15},{-15,-50,29},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-29,10,-52},{-25,4,-49},{-21,-3,-42},{-19,-9,-36},{-17,-15,-28},{-15,-21,-20},{-14,-27,-11},{-13,-34,0},{-12,-41,12},{-11,-48,25},{-9,-52,35},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-19,12,-52},{-16,6,-51},{-13,-1,-44},{-12,-8,-37},{-10,-14,-30},{-9,-20,-22},{-8,-26,-12},{-8,-32,-3},{-7,-39,9},{-7,-47,23},{-6,-52,33},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-5,8,-52},{-5,1,-46},{-4,-7,-38},{-4,-13,-31},{-3,-19,-22},{-3,-26,-13},{-3,-32,-4},{-3,-39,8},{-2,-46,22},{-2,-52,33},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{5,8,-52},{5,1,-46},{4,-7,-38},{4,-13,-31},{3,-19,-22},{3,-26,-13},{3,-32,-4},{3,-39,8},{2,-46,22},{2,-52,33},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{19,12,-52},{16,6,-51},{13,-1,-44},{12,-8,-37},{10,-14,-30},{9,-20,-22},{8,-26,-12},{8,-32,-3},{7,-39,9},{7,-47,23},{6,-52,33},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{29,10,-52},{25,4,-49},{21,-3,-42},{19,-9,-36},{17,-15,-28},{15,-21,-20},{14,-27,-11},{13,-34,0},{12,-41,12},{11,-48,25},{9,-52,35},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,11,-52},{38,6,-51},{33,1,-46},{29,-6,-40},{25,-12,-33},{23,-17,-25},{20,-23,-17},{19,-29,-8},{17,-35,3},{16,-42,15},{15,-50,29},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,2,-47},{40,-4,-42},{35,-9,-36},{31,-15,-29},{28,-20,-22},{26,-26,-13},{23,-31,-4},{22,-38,7},{20,-45,19},{19,-52,33},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-8,-37},{40,-13,-31},{37,-18,-24},{33,-23,-17},{30,-28,-9},{28,-34,1},{26,-41,12},{24,-48,24},{22,-52,33},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-17,-25},{41,-22,-19},{38,-27,-12},{35,-32,-4},{32,-38,7},{30,-44,18},{28,-52,32},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-26,-12},{42,-31,-5},{39,-36,3},{36,-42,14},{33,-48,25},{31,-52,33},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-35,3},{42,-41,12},{39,-46,22},{37,-52,33},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-46,21},{42,-52,33},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-52,34},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	// z = 300 mm
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-52,40},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-45,27},{-42,-52,40},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-34,8},{-42,-39,16},{-39,-46,28},{-37,-52,40},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-24,-8},{-42,-29,0},{-39,-34,9},{-36,-40,19},{-33,-48,32},{-31,-52,40},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-14,-21},{-41,-19,-14},{-38,-24,-7},{-35,-30,2},{-32,-36,11},{-30,-43,23},{-28,-51,38},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-5,-32},{-40,-10,-26},{-37,-15,-20},{-33,-21,-12},{-30,-26,-4},{-28,-32,6},{-26,-39,16},{-24,-47,30},{-22,-52,40},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,5,-42},{-40,-1,-36},{-35,-6,-31},{-31,-12,-24},{-28,-17,-17},{-26,-23,-9},{-23,-29,1},{-22,-36,11},{-20,-44,25},{-19,-52,40},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,16,-50},{-38,10,-46},{-33,4,-40},{-29,-2,-35},{-25,-8,-28},{-23,-14,-21},{-20,-21,-12},{-19,-27,-3},{-17,-34,8},{-16,-41,20},{-15,-50,36},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,26,-52},{-36,21,-52},{-29,14,-49},{-25,7,-44},{-21,1,-37},{-19,-6,-31},{-17,-12,-23},{-15,-19,-15},{-14,-25,-6},{-13,-32,5},{-12,-39,16},{-11,-48,32},{-9,-52,40},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-23,24,-52},{-19,17,-51},{-16,10,-46},{-13,3,-39},{-12,-4,-33},{-10,-11,-25},{-9,-17,-17},{-8,-24,-8},{-8,-30,2},{-7,-38,15},{-7,-46,29},{-6,-52,40},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-8,26,-52},{-7,19,-52},{-5,11,-47},{-5,4,-40},{-4,-3,-34},{-4,-10,-26},{-3,-17,-18},{-3,-23,-9},{-3,-30,2},{-3,-37,14},{-2,-46,28},{-2,-52,40},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{8,26,-52},{7,19,-52},{5,11,-47},{5,4,-40},{4,-3,-34},{4,-10,-26},{3,-17,-18},{3,-23,-9},{3,-30,2},{3,-37,14},{2,-46,28},{2,-52,40},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{23,24,-52},{19,17,-51},{16,10,-46},{13,3,-39},{12,-4,-33},{10,-11,-25},{9,-17,-17},{8,-24,-8},{8,-30,2},{7,-38,15},{7,-46,29},{6,-52,40},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,26,-52},{36,21,-52},{29,14,-49},{25,7,-44},{21,1,-37},{19,-6,-31},{17,-12,-23},{15,-19,-15},{14,-25,-6},{13,-32,5},{12,-39,16},{11,-48,32},{9,-52,40},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,16,-50},{38,10,-46},{33,4,-40},{29,-2,-35},{25,-8,-28},{23,-14,-21},{20,-21,-12},{19,-27,-3},{17,-34,8},{16,-41,20},{15,-50,36},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,5,-42},{40,-1,-36},{35,-6,-31},{31,-12,-24},{28,-17,-17},{26,-23,-9},{23,-29,1},{22,-36,11},{20,-44,25},{19,-52,40},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-5,-32},{40,-10,-26},{37,-15,-20},{33,-21,-12},{30,-26,-4},{28,-32,6},{26,-39,16},{24,-47,30},{22,-52,40},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-14,-21},{41,-19,-14},{38,-24,-7},{35,-30,2},{32,-36,11},{30,-43,23},{28,-51,38},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-24,-8},{42,-29,0},{39,-34,9},{36,-40,19},{33,-48,32},{31,-52,40},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-34,8},{42,-39,16},{39,-46,28},{37,-52,40},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-45,27},{42,-52,40},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-52,40},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	// z = 325 mm
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-45,34},{-42,-52,48},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-32,13},{-42,-38,23},{-39,-46,36},{-37,-52,47},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-22,-2},{-42,-27,5},{-39,-33,15},{-36,-40,25},{-33,-48,40},{-31,-52,47},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-13,-15},{-41,-17,-9},{-38,-23,-2},{-35,-29,8},{-32,-35,18},{-30,-43,31},{-28,-52,48},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-3,-26},{-40,-8,-21},{-37,-13,-14},{-33,-19,-7},{-30,-25,2},{-28,-31,12},{-26,-38,23},{-24,-47,39},{-22,-52,47},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,7,-36},{-40,2,-31},{-35,-4,-25},{-31,-10,-19},{-28,-15,-12},{-26,-21,-4},{-23,-28,6},{-22,-35,18},{-20,-43,31},{-19,-52,48},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,18,-44},{-38,12,-40},{-33,6,-35},{-29,0,-29},{-25,-6,-23},{-23,-13,-15},{-20,-19,-7},{-19,-25,2},{-17,-32,13},{-16,-40,26},{-15,-51,45},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,29,-50},{-36,23,-47},{-29,16,-43},{-25,10,-38},{-21,3,-32},{-19,-4,-25},{-17,-10,-18},{-15,-17,-10},{-14,-23,-1},{-13,-31,11},{-12,-38,23},{-11,-48,40},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,41,-52},{-31,34,-52},{-23,27,-49},{-19,19,-45},{-16,12,-40},{-13,5,-34},{-12,-2,-27},{-10,-9,-20},{-9,-15,-12},{-8,-22,-2},{-8,-29,8},{-7,-37,21},{-7,-46,37},{-6,-52,47},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,48,-52},{-19,45,-52},{-12,37,-52},{-8,29,-50},{-7,21,-46},{-5,14,-41},{-5,6,-35},{-4,-1,-28},{-4,-8,-21},{-3,-15,-12},{-3,-21,-4},{-3,-29,8},{-3,-36,20},{-2,-46,36},{-2,-52,47},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,48,-52},{19,45,-52},{12,37,-52},{8,29,-50},{7,21,-46},{5,14,-41},{5,6,-35},{4,-1,-28},{4,-8,-21},{3,-15,-12},{3,-21,-4},{3,-29,8},{3,-36,20},{2,-46,36},{2,-52,47},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,41,-52},{31,34,-52},{23,27,-49},{19,19,-45},{16,12,-40},{13,5,-34},{12,-2,-27},{10,-9,-20},{9,-15,-12},{8,-22,-2},{8,-29,8},{7,-37,21},{7,-46,37},{6,-52,47},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,29,-50},{36,23,-47},{29,16,-43},{25,10,-38},{21,3,-32},{19,-4,-25},{17,-10,-18},{15,-17,-10},{14,-23,-1},{13,-31,11},{12,-38,23},{11,-48,40},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,18,-44},{38,12,-40},{33,6,-35},{29,0,-29},{25,-6,-23},{23,-13,-15},{20,-19,-7},{19,-25,2},{17,-32,13},{16,-40,26},{15,-51,45},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,7,-36},{40,2,-31},{35,-4,-25},{31,-10,-19},{28,-15,-12},{26,-21,-4},{23,-28,6},{22,-35,18},{20,-43,31},{19,-52,48},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-3,-26},{40,-8,-21},{37,-13,-14},{33,-19,-7},{30,-25,2},{28,-31,12},{26,-38,23},{24,-47,39},{22,-52,47},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-13,-15},{41,-17,-9},{38,-23,-2},{35,-29,8},{32,-35,18},{30,-43,31},{28,-52,48},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-22,-2},{42,-27,5},{39,-33,15},{36,-40,25},{33,-48,40},{31,-52,47},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-32,13},{42,-38,23},{39,-46,36},{37,-52,47},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-45,34},{42,-52,48},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	// z = 350 mm
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-47,45},{-42,-51,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-32,21},{-42,-39,31},{-39,-48,47},{-37,-52,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-21,4},{-42,-27,12},{-39,-33,22},{-36,-41,35},{-33,-50,52},{-31,-52,52},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-11,-9},{-41,-17,-2},{-38,-22,6},{-35,-28,14},{-32,-35,25},{-30,-44,40},{-28,-51,52},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-2,-20},{-40,-7,-14},{-37,-12,-8},{-33,-18,-1},{-30,-24,9},{-28,-31,18},{-26,-39,31},{-24,-50,51},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,9,-29},{-40,3,-24},{-35,-3,-19},{-31,-8,-13},{-28,-14,-5},{-26,-21,4},{-23,-28,14},{-22,-35,25},{-20,-45,42},{-19,-51,52},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,19,-37},{-38,13,-33},{-33,7,-28},{-29,1,-22},{-25,-5,-16},{-23,-11,-9},{-20,-18,-1},{-19,-25,9},{-17,-32,21},{-16,-41,36},{-15,-51,52},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,30,-43},{-36,24,-40},{-29,17,-36},{-25,11,-31},{-21,4,-25},{-19,-3,-19},{-17,-9,-12},{-15,-16,-4},{-14,-23,6},{-13,-30,18},{-12,-39,31},{-11,-50,52},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,41,-47},{-31,34,-45},{-23,27,-42},{-19,20,-38},{-16,13,-33},{-13,6,-27},{-12,-1,-21},{-10,-8,-13},{-9,-14,-5},{-8,-21,4},{-8,-29,15},{-7,-37,29},{-7,-49,49},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,52,-49},{-19,45,-48},{-12,37,-46},{-8,30,-43},{-7,22,-38},{-5,15,-34},{-5,7,-28},{-4,1,-22},{-4,-7,-14},{-3,-14,-6},{-3,-21,4},{-3,-28,14},{-3,-37,28},{-2,-48,47},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,52,-49},{19,45,-48},{12,37,-46},{8,30,-43},{7,22,-38},{5,15,-34},{5,7,-28},{4,1,-22},{4,-7,-14},{3,-14,-6},{3,-21,4},{3,-28,14},{3,-37,28},{2,-48,47},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,41,-47},{31,34,-45},{23,27,-42},{19,20,-38},{16,13,-33},{13,6,-27},{12,-1,-21},{10,-8,-13},{9,-14,-5},{8,-21,4},{8,-29,15},{7,-37,29},{7,-49,49},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,30,-43},{36,24,-40},{29,17,-36},{25,11,-31},{21,4,-25},{19,-3,-19},{17,-9,-12},{15,-16,-4},{14,-23,6},{13,-30,18},{12,-39,31},{11,-50,52},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,19,-37},{38,13,-33},{33,7,-28},{29,1,-22},{25,-5,-16},{23,-11,-9},{20,-18,-1},{19,-25,9},{17,-32,21},{16,-41,36},{15,-51,52},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,9,-29},{40,3,-24},{35,-3,-19},{31,-8,-13},{28,-14,-5},{26,-21,4},{23,-28,14},{22,-35,25},{20,-45,42},{19,-51,52},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-2,-20},{40,-7,-14},{37,-12,-8},{33,-18,-1},{30,-24,9},{28,-31,18},{26,-39,31},{24,-50,51},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-11,-9},{41,-17,-2},{38,-22,6},{35,-28,14},{32,-35,25},{30,-44,40},{28,-51,52},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-21,4},{42,-27,12},{39,-33,22},{36,-41,35},{33,-50,52},{31,-52,52},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-32,21},{42,-39,31},{39,-48,47},{37,-52,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-47,45},{42,-51,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	// z = 375 mm
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-47,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-34,31},{-42,-41,43},{-39,-47,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-22,13},{-42,-28,21},{-39,-34,31},{-36,-43,47},{-33,-47,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-11,-2},{-41,-17,6},{-38,-22,13},{-35,-29,23},{-32,-37,36},{-30,-46,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-1,-13},{-40,-7,-7},{-37,-12,0},{-33,-18,8},{-30,-25,17},{-28,-32,28},{-26,-41,43},{-24,-47,52},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,9,-22},{-40,4,-17},{-35,-2,-12},{-31,-8,-5},{-28,-14,3},{-26,-21,11},{-23,-28,22},{-22,-37,36},{-20,-47,52},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,19,-29},{-38,13,-25},{-33,8,-21},{-29,2,-15},{-25,-5,-9},{-23,-11,-2},{-20,-18,8},{-19,-25,18},{-17,-34,31},{-16,-44,49},{-14,-48,52},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,29,-35},{-36,23,-32},{-29,17,-28},{-25,11,-24},{-21,5,-18},{-19,-2,-12},{-17,-9,-5},{-15,-16,4},{-14,-23,15},{-13,-31,27},{-12,-41,43},{-11,-47,52},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,39,-39},{-31,33,-37},{-23,27,-34},{-19,20,-30},{-16,13,-25},{-13,7,-20},{-12,-1,-13},{-10,-7,-6},{-9,-14,3},{-8,-22,13},{-8,-30,24},{-7,-39,40},{-7,-47,52},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,49,-41},{-19,43,-40},{-12,36,-38},{-8,29,-35},{-7,22,-31},{-5,15,-26},{-5,8,-21},{-4,1,-14},{-4,-7,-7},{-3,-14,2},{-3,-21,11},{-3,-29,23},{-3,-38,38},{-2,-47,52},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,49,-41},{19,43,-40},{12,36,-38},{8,29,-35},{7,22,-31},{5,15,-26},{5,8,-21},{4,1,-14},{4,-7,-7},{3,-14,2},{3,-21,11},{3,-29,23},{3,-38,38},{2,-47,52},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,39,-39},{31,33,-37},{23,27,-34},{19,20,-30},{16,13,-25},{13,7,-20},{12,-1,-13},{10,-7,-6},{9,-14,3},{8,-22,13},{8,-30,24},{7,-39,40},{7,-47,52},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,29,-35},{36,23,-32},{29,17,-28},{25,11,-24},{21,5,-18},{19,-2,-12},{17,-9,-5},{15,-16,4},{14,-23,15},{13,-31,27},{12,-41,43},{11,-47,52},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,19,-29},{38,13,-25},{33,8,-21},{29,2,-15},{25,-5,-9},{23,-11,-2},{20,-18,8},{19,-25,18},{17,-34,31},{16,-44,49},{14,-48,52},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,9,-22},{40,4,-17},{35,-2,-12},{31,-8,-5},{28,-14,3},{26,-21,11},{23,-28,22},{22,-37,36},{20,-47,52},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-1,-13},{40,-7,-7},{37,-12,0},{33,-18,8},{30,-25,17},{28,-32,28},{26,-41,43},{24,-47,52},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-11,-2},{41,-17,6},{38,-22,13},{35,-29,23},{32,-37,36},{30,-46,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-22,13},{42,-28,21},{39,-34,31},{36,-43,47},{33,-47,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-34,31},{42,-41,43},{39,-47,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-47,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	// z = 400 mm
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-44,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-37,44},{-42,-43,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-23,22},{-42,-29,31},{-39,-38,45},{-36,-43,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-12,8},{-41,-18,15},{-38,-24,23},{-35,-31,34},{-32,-41,50},{-30,-43,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-2,-4},{-40,-7,2},{-37,-13,8},{-33,-19,17},{-30,-26,27},{-28,-35,40},{-26,-43,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,8,-14},{-40,3,-9},{-35,-3,-4},{-31,-9,3},{-28,-15,11},{-26,-22,21},{-23,-30,33},{-22,-41,50},{-19,-44,52},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,18,-21},{-38,13,-17},{-33,7,-13},{-29,1,-7},{-25,-6,0},{-23,-12,8},{-20,-19,17},{-19,-27,27},{-17,-37,44},{-16,-43,52},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,27,-26},{-36,22,-24},{-29,16,-20},{-25,10,-15},{-21,4,-10},{-19,-3,-4},{-17,-10,5},{-15,-17,13},{-14,-24,24},{-13,-34,38},{-12,-43,52},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,37,-30},{-31,32,-28},{-23,25,-25},{-19,19,-22},{-16,13,-17},{-13,6,-12},{-12,-1,-5},{-10,-8,2},{-9,-15,11},{-8,-23,22},{-8,-32,35},{-7,-42,52},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,52,-30},{-45,46,-32},{-19,40,-31},{-12,34,-29},{-8,27,-26},{-7,21,-23},{-5,14,-18},{-5,7,-13},{-4,0,-6},{-4,-7,2},{-3,-14,10},{-3,-22,21},{-3,-31,34},{-3,-42,52},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,52,-30},{45,46,-32},{19,40,-31},{12,34,-29},{8,27,-26},{7,21,-23},{5,14,-18},{5,7,-13},{4,0,-6},{4,-7,2},{3,-14,10},{3,-22,21},{3,-31,34},{3,-42,52},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,37,-30},{31,32,-28},{23,25,-25},{19,19,-22},{16,13,-17},{13,6,-12},{12,-1,-5},{10,-8,2},{9,-15,11},{8,-23,22},{8,-32,35},{7,-42,52},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,27,-26},{36,22,-24},{29,16,-20},{25,10,-15},{21,4,-10},{19,-3,-4},{17,-10,5},{15,-17,13},{14,-24,24},{13,-34,38},{12,-43,52},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,18,-21},{38,13,-17},{33,7,-13},{29,1,-7},{25,-6,0},{23,-12,8},{20,-19,17},{19,-27,27},{17,-37,44},{16,-43,52},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,8,-14},{40,3,-9},{35,-3,-4},{31,-9,3},{28,-15,11},{26,-22,21},{23,-30,33},{22,-41,50},{19,-44,52},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-2,-4},{40,-7,2},{37,-13,8},{33,-19,17},{30,-26,27},{28,-35,40},{26,-43,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-12,8},{41,-18,15},{38,-24,23},{35,-31,34},{32,-41,50},{30,-43,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-23,22},{42,-29,31},{39,-38,45},{36,-43,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-37,44},{42,-43,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-44,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	// z = 425 mm
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-38,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-26,34},{-42,-34,47},{-39,-38,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-14,17},{-41,-20,25},{-38,-27,35},{-35,-36,51},{-32,-39,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-4,6},{-40,-9,11},{-37,-15,19},{-33,-21,27},{-30,-30,40},{-28,-38,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,7,-5},{-40,2,0},{-35,-5,7},{-31,-11,14},{-28,-17,22},{-26,-25,33},{-23,-35,48},{-22,-39,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,16,-12},{-38,11,-8},{-33,6,-4},{-29,-1,2},{-25,-7,9},{-23,-14,17},{-20,-21,27},{-19,-31,42},{-17,-38,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,25,-17},{-36,20,-15},{-29,15,-11},{-25,9,-6},{-21,3,-1},{-19,-5,7},{-17,-11,14},{-15,-19,24},{-14,-28,37},{-13,-37,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,52,-17},{-128,-128,-128},{-128,-128,-128},{-45,34,-21},{-31,29,-19},{-23,23,-16},{-19,17,-13},{-16,11,-8},{-13,5,-3},{-12,-3,5},{-10,-10,12},{-9,-17,22},{-8,-26,34},{-8,-37,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{19,52,-20},{45,50,-23},{-45,42,-23},{-19,37,-22},{-12,31,-20},{-8,25,-17},{-7,19,-14},{-5,12,-9},{-5,6,-4},{-4,-2,3},{-4,-9,11},{-3,-16,20},{-3,-25,33},{-3,-36,51},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-19,52,-20},{-45,50,-23},{45,42,-23},{19,37,-22},{12,31,-20},{8,25,-17},{7,19,-14},{5,12,-9},{5,6,-4},{4,-2,3},{4,-9,11},{3,-16,20},{3,-25,33},{3,-36,51},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,52,-17},{-128,-128,-128},{-128,-128,-128},{45,34,-21},{31,29,-19},{23,23,-16},{19,17,-13},{16,11,-8},{13,5,-3},{12,-3,5},{10,-10,12},{9,-17,22},{8,-26,34},{8,-37,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,25,-17},{36,20,-15},{29,15,-11},{25,9,-6},{21,3,-1},{19,-5,7},{17,-11,14},{15,-19,24},{14,-28,37},{13,-37,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,16,-12},{38,11,-8},{33,6,-4},{29,-1,2},{25,-7,9},{23,-14,17},{20,-21,27},{19,-31,42},{17,-38,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,7,-5},{40,2,0},{35,-5,7},{31,-11,14},{28,-17,22},{26,-25,33},{23,-35,48},{22,-39,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-4,6},{40,-9,11},{37,-15,19},{33,-21,27},{30,-30,40},{28,-38,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-14,17},{41,-20,25},{38,-27,35},{35,-36,51},{32,-39,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-26,34},{42,-34,47},{39,-38,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-38,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	// z = 450 mm
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,52,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-32,52},{-42,-34,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{38,52,52},{41,52,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-17,30},{-41,-24,40},{-38,-32,52},{-35,-34,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{33,52,52},{37,52,50},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-6,16},{-40,-12,23},{-37,-18,31},{-33,-26,43},{-30,-33,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{26,52,52},{28,52,50},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,4,6},{-40,-2,12},{-35,-7,18},{-31,-14,25},{-28,-21,36},{-26,-31,50},{-23,-34,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{20,52,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,13,-2},{-38,8,3},{-33,3,8},{-29,-3,13},{-25,-10,20},{-23,-17,30},{-20,-26,43},{-19,-33,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{15,52,51},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,52,-3},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,22,-7},{-36,17,-4},{-29,12,-1},{-25,6,4},{-21,-1,11},{-19,-7,18},{-17,-15,27},{-15,-23,39},{-14,-32,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{8,52,52},{9,52,50},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{19,52,-3},{31,52,-7},{45,51,-11},{-128,-128,-128},{-128,-128,-128},{-45,30,-11},{-31,26,-9},{-23,20,-6},{-19,15,-3},{-16,8,3},{-13,2,9},{-12,-5,15},{-10,-13,24},{-9,-21,36},{-8,-32,52},{-6,-34,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{3,52,52},{3,52,50},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{8,52,-3},{12,52,-9},{19,49,-12},{45,45,-13},{-45,38,-13},{-19,33,-12},{-12,28,-10},{-8,22,-7},{-7,16,-3},{-5,10,1},{-5,3,8},{-4,-4,14},{-4,-12,23},{-3,-20,34},{-3,-31,50},{-3,-34,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-3,52,52},{-3,52,50},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-8,52,-3},{-12,52,-9},{-19,49,-12},{-45,45,-13},{45,38,-13},{19,33,-12},{12,28,-10},{8,22,-7},{7,16,-3},{5,10,1},{5,3,8},{4,-4,14},{4,-12,23},{3,-20,34},{3,-31,50},{3,-34,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-8,52,52},{-9,52,50},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-19,52,-3},{-31,52,-7},{-45,51,-11},{-128,-128,-128},{-128,-128,-128},{45,30,-11},{31,26,-9},{23,20,-6},{19,15,-3},{16,8,3},{13,2,9},{12,-5,15},{10,-13,24},{9,-21,36},{8,-32,52},{6,-34,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-15,52,51},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,52,-3},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,22,-7},{36,17,-4},{29,12,-1},{25,6,4},{21,-1,11},{19,-7,18},{17,-15,27},{15,-23,39},{14,-32,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-20,52,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,13,-2},{38,8,3},{33,3,8},{29,-3,13},{25,-10,20},{23,-17,30},{20,-26,43},{19,-33,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-26,52,52},{-28,52,50},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,4,6},{40,-2,12},{35,-7,18},{31,-14,25},{28,-21,36},{26,-31,50},{23,-34,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-33,52,52},{-37,52,50},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-6,16},{40,-12,23},{37,-18,31},{33,-26,43},{30,-33,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-38,52,52},{-41,52,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-17,30},{41,-24,40},{38,-32,52},{35,-34,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,52,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-32,52},{42,-34,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	// z = 475 mm
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,51,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-29,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{41,50,52},{45,50,48},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-24,49},{-41,-28,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{33,51,52},{37,49,51},{40,52,39},{45,52,33},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-10,30},{-40,-17,38},{-37,-25,51},{-33,-28,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{26,51,52},{28,49,52},{31,52,41},{35,52,34},{40,52,28},{45,52,22},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,0,19},{-40,-5,24},{-35,-12,32},{-31,-19,42},{-28,-27,52},{-25,-29,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{20,51,52},{23,50,48},{25,52,37},{29,52,30},{33,52,23},{38,52,17},{45,52,11},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,10,10},{-38,5,14},{-33,-1,20},{-29,-7,26},{-25,-15,36},{-23,-24,49},{-20,-28,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{15,50,52},{17,51,43},{19,52,34},{21,52,27},{25,52,20},{29,52,13},{36,52,7},{45,50,5},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,18,4},{-36,14,7},{-29,8,11},{-25,3,16},{-21,-4,23},{-19,-12,32},{-17,-20,43},{-15,-27,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{9,49,52},{10,52,40},{12,52,32},{13,52,25},{16,52,17},{19,52,10},{23,51,5},{31,48,2},{45,45,1},{-128,-128,-128},{-128,-128,-128},{-45,26,0},{-31,22,2},{-23,17,5},{-19,11,9},{-16,5,14},{-13,-2,21},{-12,-10,29},{-10,-18,40},{-9,-27,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{3,49,52},{4,52,39},{4,52,31},{5,52,23},{5,52,16},{7,52,8},{8,50,5},{12,47,2},{19,43,-1},{45,40,-2},{-45,33,-2},{-19,29,-1},{-12,24,2},{-8,18,4},{-7,12,8},{-5,6,14},{-5,-1,20},{-4,-8,27},{-4,-17,38},{-3,-26,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-3,49,52},{-4,52,39},{-4,52,31},{-5,52,23},{-5,52,16},{-7,52,8},{-8,50,5},{-12,47,2},{-19,43,-1},{-45,40,-2},{45,33,-2},{19,29,-1},{12,24,2},{8,18,4},{7,12,8},{5,6,14},{5,-1,20},{4,-8,27},{4,-17,38},{3,-26,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-9,49,52},{-10,52,40},{-12,52,32},{-13,52,25},{-16,52,17},{-19,52,10},{-23,51,5},{-31,48,2},{-45,45,1},{-128,-128,-128},{-128,-128,-128},{45,26,0},{31,22,2},{23,17,5},{19,11,9},{16,5,14},{13,-2,21},{12,-10,29},{10,-18,40},{9,-27,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-15,50,52},{-17,51,43},{-19,52,34},{-21,52,27},{-25,52,20},{-29,52,13},{-36,52,7},{-45,50,5},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,18,4},{36,14,7},{29,8,11},{25,3,16},{21,-4,23},{19,-12,32},{17,-20,43},{15,-27,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-20,51,52},{-23,50,48},{-25,52,37},{-29,52,30},{-33,52,23},{-38,52,17},{-45,52,11},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,10,10},{38,5,14},{33,-1,20},{29,-7,26},{25,-15,36},{23,-24,49},{20,-28,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-26,51,52},{-28,49,52},{-31,52,41},{-35,52,34},{-40,52,28},{-45,52,22},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,0,19},{40,-5,24},{35,-12,32},{31,-19,42},{28,-27,52},{25,-29,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-33,51,52},{-37,49,51},{-40,52,39},{-45,52,33},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-10,30},{40,-17,38},{37,-25,51},{33,-28,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-41,50,52},{-45,50,48},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-24,49},{41,-28,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,51,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-29,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	// z = 500 mm
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,45,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-23,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{36,45,52},{40,44,52},{45,42,51},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-18,50},{-40,-21,52},{-36,-23,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{31,44,52},{35,42,52},{40,44,42},{45,45,34},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-6,34},{-40,-12,41},{-35,-19,52},{-31,-22,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{22,45,52},{25,43,52},{29,44,45},{33,45,35},{38,45,29},{45,45,24},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,5,24},{-38,-1,29},{-33,-7,35},{-29,-14,45},{-25,-21,52},{-22,-23,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{17,45,52},{19,42,52},{21,45,40},{25,45,32},{29,45,25},{36,44,20},{45,43,17},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,13,17},{-36,9,21},{-29,3,25},{-25,-3,31},{-21,-11,40},{-19,-19,52},{-17,-22,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{10,44,52},{12,43,49},{13,45,37},{16,45,29},{19,45,23},{23,43,18},{31,41,15},{45,39,13},{-128,-128,-128},{-128,-128,-128},{-45,21,13},{-31,17,15},{-23,12,18},{-19,6,23},{-16,-1,29},{-13,-8,37},{-12,-17,48},{-10,-22,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{4,44,52},{4,43,47},{5,45,35},{5,45,28},{7,44,22},{8,43,17},{12,40,14},{19,37,12},{45,34,11},{-45,28,11},{-19,24,12},{-12,19,14},{-8,13,17},{-7,7,22},{-5,1,28},{-5,-7,35},{-4,-16,47},{-4,-21,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-4,44,52},{-4,43,47},{-5,45,35},{-5,45,28},{-7,44,22},{-8,43,17},{-12,40,14},{-19,37,12},{-45,34,11},{45,28,11},{19,24,12},{12,19,14},{8,13,17},{7,7,22},{5,1,28},{5,-7,35},{4,-16,47},{4,-21,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-10,44,52},{-12,43,49},{-13,45,37},{-16,45,29},{-19,45,23},{-23,43,18},{-31,41,15},{-45,39,13},{-128,-128,-128},{-128,-128,-128},{45,21,13},{31,17,15},{23,12,18},{19,6,23},{16,-1,29},{13,-8,37},{12,-17,48},{10,-22,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-17,45,52},{-19,42,52},{-21,45,40},{-25,45,32},{-29,45,25},{-36,44,20},{-45,43,17},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,13,17},{36,9,21},{29,3,25},{25,-3,31},{21,-11,40},{19,-19,52},{17,-22,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-22,45,52},{-25,43,52},{-29,44,45},{-33,45,35},{-38,45,29},{-45,45,24},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,5,24},{38,-1,29},{33,-7,35},{29,-14,45},{25,-21,52},{22,-23,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-31,44,52},{-35,42,52},{-40,44,42},{-45,45,34},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-6,34},{40,-12,41},{35,-19,52},{31,-22,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-36,45,52},{-40,44,52},{-45,42,51},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-18,50},{40,-21,52},{36,-23,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,45,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-23,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	// z = 525 mm
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{40,38,52},{45,35,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-13,52},{-40,-15,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{29,38,52},{33,36,52},{38,34,51},{45,35,43},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-4,43},{-38,-10,50},{-33,-13,52},{-29,-15,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{21,37,52},{25,34,52},{29,35,44},{36,35,38},{45,34,34},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,6,34},{-36,2,38},{-29,-5,45},{-25,-12,52},{-21,-15,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{13,36,52},{16,34,51},{19,35,41},{23,34,35},{31,33,31},{45,31,29},{-128,-128,-128},{-128,-128,-128},{-45,14,29},{-31,10,32},{-23,5,35},{-19,-2,42},{-16,-10,50},{-13,-14,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{5,36,52},{5,34,48},{7,35,40},{8,34,34},{12,32,30},{19,29,28},{45,26,27},{-45,21,27},{-19,17,28},{-12,12,30},{-8,6,34},{-7,0,39},{-5,-8,49},{-5,-13,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-5,36,52},{-5,34,48},{-7,35,40},{-8,34,34},{-12,32,30},{-19,29,28},{-45,26,27},{45,21,27},{19,17,28},{12,12,30},{8,6,34},{7,0,39},{5,-8,49},{5,-13,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-13,36,52},{-16,34,51},{-19,35,41},{-23,34,35},{-31,33,31},{-45,31,29},{-128,-128,-128},{-128,-128,-128},{45,14,29},{31,10,32},{23,5,35},{19,-2,42},{16,-10,50},{13,-14,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-21,37,52},{-25,34,52},{-29,35,44},{-36,35,38},{-45,34,34},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,6,34},{36,2,38},{29,-5,45},{25,-12,52},{21,-15,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-29,38,52},{-33,36,52},{-38,34,51},{-45,35,43},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-4,43},{38,-10,50},{33,-13,52},{29,-15,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-40,38,52},{-45,35,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-13,52},{40,-15,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	// z = 550 mm
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,28,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-5,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{36,27,52},{45,24,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,-2,52},{-36,-5,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{19,28,52},{23,25,52},{31,22,52},{45,19,52},{-128,-128,-128},{-128,-128,-128},{-45,4,52},{-31,1,52},{-23,-3,52},{-19,-5,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{7,28,52},{8,24,52},{12,21,52},{19,18,50},{45,16,49},{-45,11,48},{-19,6,51},{-12,2,52},{-8,-2,52},{-7,-5,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-7,28,52},{-8,24,52},{-12,21,52},{-19,18,50},{-45,16,49},{45,11,48},{19,6,51},{12,2,52},{8,-2,52},{7,-5,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-19,28,52},{-23,25,52},{-31,22,52},{-45,19,52},{-128,-128,-128},{-128,-128,-128},{45,4,52},{31,1,52},{23,-3,52},{19,-5,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-36,27,52},{-45,24,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-2,52},{36,-5,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-45,28,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{45,-5,52},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+	{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},{-128,-128,-128},
+};
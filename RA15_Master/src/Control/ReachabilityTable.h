@@ -0,0 +1,30 @@
+/*
+ * ReachabilityTable.h
+ *
+ *	GENERATED FILE - DO NOT EDIT. Regenerate with RA15_Host/build/reachability_gen.
+ *
+ *	Voxel map of the wrist center workspace. See Reachability.h for the lookup functions.
+ */
+
+#ifndef SRC_CONTROL_REACHABILITYTABLE_H_
+#define SRC_CONTROL_REACHABILITYTABLE_H_
+
+#include "stdint.h"
+
+#define REACH_VOXEL_MM		25		// Voxel edge length (mm)
+#define REACH_X0_MM			-275		// Corner of voxel (0,0,0) in the base frame (mm)
+#define REACH_Y0_MM			-275
+#define REACH_Z0_MM			100
+#define REACH_NX			26		// Number of voxels along each axis
+#define REACH_NY			22
+#define REACH_NZ			19
+#define REACH_SEED_JOINTS	3		// Seeds are stored for J1-J3 only
+#define REACH_SEED_STEP_DEG	1		// Degrees per seed LSB
+#define REACH_UNREACHABLE	(-128)	// Seed value for a voxel with no solution
+
+static const int16_t reach_seed_center[REACH_SEED_JOINTS] = {0, 90, 0};	// Joint angle (deg) represented by a seed of 0
+
+// Indexed by ((iz*REACH_NY + iy)*REACH_NX + ix). Joint angle = reach_seed_center + seed*REACH_SEED_STEP_DEG
+extern const int8_t reach_seed[REACH_NX*REACH_NY*REACH_NZ][REACH_SEED_JOINTS];
+
+#endif /* SRC_CONTROL_REACHABILITYTABLE_H_ */
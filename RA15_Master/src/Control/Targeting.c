@@ -6,10 +6,35 @@
  */
 
 #include "Targeting.h"
+#include "Trajectory.h"
 
 
 enum control_source current_source = 0;
 
+uint32_t collision_clamps = 0;
+
+static const fix16_t MOTORREG_PERIOD_S = F16(MOTORREG_PERIOD_MS/1000.0f);
+
+static uint8_t clamped_joints = 0;		// Joints stopped for clearance, held until they can take a full step towards it again
+static uint8_t clamped_up = 0;			// ... of which the ones that were moving in the positive direction
+
+
+// Largest distance (deg) joint ji can move in one regulator tick
+static inline fix16_t max_step(uint8_t ji)
+{	return fix16_mul(jpmtr[ji].vmax, MOTORREG_PERIOD_S);	}
+
+// TRUE if targets jpt/jvt would move a clamped joint further in the direction it was stopped in
+static BOOL is_towards_clamp(uint8_t ji, fix16_t jpt, fix16_t jvt)
+{
+	if(!((clamped_joints >> ji) & 0x01))
+		return FALSE;
+
+	fix16_t dir = jvt;					// Velocity control only. DISABLE_VT is positive.
+	if(jpt != DISABLE_PT)
+		dir = fix16_sub(fix16_clamp(jpt, jpmtr[ji].pmin, jpmtr[ji].pmax), j[ji].p);
+	return ((clamped_up >> ji) & 0x01) ? (dir > 0) : (dir < 0);
+}
+
 
 
 // Request to set joint targets.
@@ -17,10 +42,16 @@ enum control_source current_source = 0;
 // Allows higher priority sources to take control without interference from lower sources.
 // Sources must release_control() when they are finished issuing targets.
 // Returns TRUE if successful, FALSE if access denied.
+// A joint stopped by the clearance check is held still instead, while the targets would move it further in.
 BOOL set_targets(enum control_source source, uint8_t ji, fix16_t jpt, fix16_t jvt)
 {
 	if(request_control(source))
 	{
+		if(is_towards_clamp(ji, jpt, jvt))
+		{
+			jpt = DISABLE_PT;
+			jvt = F16(0.0f);
+		}
 		j[ji].pt = jpt;
 		j[ji].vt = jvt;
 		return TRUE;
@@ -50,6 +81,8 @@ BOOL set_all_position_rest(enum control_source source)
 	{
 		for(int ji=0; ji<6; ji++)
 		{
+			if(is_towards_clamp(ji, jpmtr[ji].prest, jpmtr[ji].vmax/2))
+				continue;
 			j[ji].pt = jpmtr[ji].prest;
 			j[ji].vt = jpmtr[ji].vmax/2;
 		}
@@ -86,6 +119,111 @@ enum control_source get_control_source()
 }
 
 
+// Joint position one regulator tick from now, if the joint follows its current targets at the speed the controllers allow.
+// A joint following a spline trajectory ignores pt/vt, so it is assumed to keep its measured velocity, as is one
+// coasting to a stop (pt/vt say stand still).
+static fix16_t predict_next_position(uint8_t ji, uint8_t trajectory_joints)
+{
+	fix16_t jp = j[ji].p;
+	fix16_t jvt = j[ji].vt;
+
+	if(((trajectory_joints >> ji) & 0x01) || (j[ji].pt == DISABLE_PT && jvt == 0))
+		return fix16_add(jp, fix16_mul(j[ji].v, MOTORREG_PERIOD_S));
+	fix16_t step = (jvt == DISABLE_VT) ? max_step(ji) : fix16_min(fix16_mul(fix16_abs(jvt), MOTORREG_PERIOD_S), max_step(ji));
+
+	if(j[ji].pt == DISABLE_PT)			// Velocity control only
+		return (jvt < 0) ? fix16_sub(jp, step) : fix16_add(jp, step);
+
+	fix16_t jpt = fix16_clamp(j[ji].pt, jpmtr[ji].pmin, jpmtr[ji].pmax);
+	return fix16_clamp(jpt, fix16_sub(jp, step), fix16_add(jp, step));
+}
+
+// Stops any joint whose motion over the next tick would take the arm below MIN_CLEARANCE_MM.
+// Joints that increase clearance are left alone, so the arm can always back out of a violation.
+// A stopped joint stays clamped: set_targets() will not move it further the same way until a full step that way
+// would keep the clearance, so targets that arrive between two checks never take it in.
+// A trajectory is stopped once: while the joint decelerates, its measured velocity keeps predicting the violation,
+// but the stop has already ended the trajectory. Knots queued after the stop start a new one, which is stopped again.
+static void limit_targets_for_clearance(void)
+{
+	uint32_t start_time = SYSTICK_TIMER_HIRES;
+
+	uint8_t trajectory_joints = get_trajectory_joints();
+	fix16_t q_now[6], q_next[6];
+	for(int ji=0; ji<6; ji++)
+	{
+		q_now[ji] = j[ji].p;
+		q_next[ji] = predict_next_position(ji, trajectory_joints);
+	}
+
+	for(int ji=0; ji<6; ji++)		// Release the clamped joints that are clear to move on
+	{
+		if(!((clamped_joints >> ji) & 0x01))
+			continue;
+
+		fix16_t jp = q_now[ji];
+		fix16_t step = ((clamped_up >> ji) & 0x01) ? max_step(ji) : -max_step(ji);
+		q_now[ji] = fix16_clamp(fix16_add(jp, step), jpmtr[ji].pmin, jpmtr[ji].pmax);
+		if(min_clearance_mm(q_now) >= MIN_CLEARANCE_MM)
+		{
+			clamped_joints &= ~(0x01 << ji);
+			clamped_up &= ~(0x01 << ji);
+		}
+		q_now[ji] = jp;
+	}
+
+	int32_t clearance_next = min_clearance_mm(q_next);
+	if(clearance_next < MIN_CLEARANCE_MM)		// Find which joints are responsible, one at a time
+	{
+		int32_t clearance_now = min_clearance_mm(q_now);
+		uint8_t culprits = 0, moving = 0;
+		for(int ji=0; ji<6; ji++)
+		{
+			if(q_next[ji] == q_now[ji])
+				continue;
+			moving |= (0x01 << ji);
+
+			fix16_t jp = q_now[ji];
+			q_now[ji] = q_next[ji];
+			int32_t clearance = min_clearance_mm(q_now);
+			q_now[ji] = jp;
+
+			if(clearance < MIN_CLEARANCE_MM && clearance < clearance_now)
+				culprits |= (0x01 << ji);
+		}
+		if(culprits == 0 && clearance_next < clearance_now)		// Only the joints together close in: stop them all
+			culprits = moving;
+
+		uint8_t stop_mask = culprits & trajectory_joints;	// A stop the forward queue had no room for is sent again
+		if(stop_mask != 0)
+		{
+			struct waypoint stop = { .dt_ms = 0, .joint_mask = stop_mask };
+			add_waypoint(current_source, &stop);	// The trajectories' owner. Also stops them on NXT2/3.
+		}
+
+		for(int ji=0; ji<6; ji++)
+		{
+			if(!((culprits >> ji) & 0x01))
+				continue;
+			j[ji].pt = DISABLE_PT;
+			j[ji].vt = F16(0.0f);
+
+			if(!((clamped_joints >> ji) & 0x01))
+			{
+				collision_clamps++;
+				clamped_joints |= (0x01 << ji);
+				if(q_next[ji] > q_now[ji])
+					clamped_up |= (0x01 << ji);
+			}
+		}
+	}
+
+	collision_check_duration_us = (uint16_t)elapsed_time_us_between(start_time, SYSTICK_TIMER_HIRES);
+	if(collision_check_duration_us > collision_check_max_us)
+		collision_check_max_us = collision_check_duration_us;
+}
+
+
 // Called rapidly by background task
 void update_targets()
 {
@@ -115,6 +253,11 @@ void update_targets()
 		break;
 	}
 
+	#if NXT == 1
+		feed_trajectory();					// Waypoints from the PC go on to the knot buffers as they make room
+		limit_targets_for_clearance();		// Only NXT1 knows every joint position. Clamped targets reach NXT2/3 over RS485.
+	#endif
+
 	task_targeting_duration_us = (uint16_t)elapsed_time_us_between(task_start_time, SYSTICK_TIMER_HIRES);
 }
 
@@ -19,6 +19,8 @@
 #include "../Globals.h"
 #include "../Control/Timing.h"
 #include "../Control/Homing.h"
+#include "../Control/MotorRegulator.h"
+#include "../Control/Collision.h"
 #include "fix16.h"
 
 
@@ -38,6 +40,7 @@ enum control_source {
 // Allows higher priority sources to take control without interference from lower sources.
 // Sources must release_control() when they are finished issuing targets.
 // Returns TRUE if successful, FALSE if access denied.
+// A joint stopped by the clearance check is held still instead, while the targets would move it further in.
 BOOL set_targets(enum control_source source, uint8_t ji, fix16_t jpt, fix16_t jvt);
 
 // Stop motion (vt=0) for all joints.
@@ -61,6 +64,10 @@ enum control_source get_control_source(void);
 void update_targets(void);
 
 
+// Number of times a joint target was clamped to avoid a self-collision
+extern uint32_t collision_clamps;
+
+
 
 
 
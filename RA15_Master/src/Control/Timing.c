@@ -12,6 +12,8 @@
 
 uint32_t systick_seconds = 0;		//number of seconds elapsed since program start
 uint32_t ticks_per_second = 0;		//number of hires timer ticks per second (approx 30669 ticks/sec)
+int32_t clock_offset_us = 0;
+int32_t clock_drift_ppm = 0;
 
 
 // PRIVATE VARIABLES
@@ -19,6 +21,25 @@ uint32_t ticks_per_second = 0;		//number of hires timer ticks per second (approx
 static uint32_t timer_1s_val = 0;	//number of ms since last time timer_1s() was called
 static uint32_t ticks_last_sec = 0;	//number of hires timer ticks last time timer_1s() was called
 
+// Global time. The estimate is double buffered: add_clock_sample() runs in TASK_BACKGROUND and fills the spare
+// copy, then switches, so a task that preempts it in global_time_ms() never reads a half written estimate.
+static struct clock_estimate{
+	BOOL valid;
+	uint32_t at_ms;				// Own systick the estimate is for
+	int32_t offset_us;			// NXT1's systick minus own, at at_ms
+	int32_t drift_ppm;
+	uint32_t error_us;			// Error bound at at_ms
+} clock_est[2];
+static volatile uint8_t clock_est_current = 0;
+
+static uint8_t window_samples = 0;		// Exchanges in the current window
+static int32_t window_delay_ms;			// Shortest round trip in the window, and the exchange it belongs to
+static int32_t window_offset2_ms;		//  (twice its offset, to keep the half ms)
+static uint32_t window_t4;
+static BOOL drift_ref_valid = FALSE;	// Earlier estimate that the next drift estimate is measured from
+static uint32_t drift_ref_ms;
+static int32_t drift_ref_offset_us;
+
 // FUNCTION DEFINITIONS
 
 void init_timing()
@@ -58,3 +79,85 @@ uint32_t elapsed_time_us_between(uint32_t earlier_time_hires, uint32_t later_tim
 {
 	return (later_time_hires - earlier_time_hires)<<5;	//  (1E6 us/s) / (30669 ticks/s) ~= 32.6 us/tick (2^5)
 }
+
+
+uint32_t global_time_ms(void)
+{
+	uint32_t now = systick_get_ms();
+	#if NXT == 1
+		return now;
+	#else
+		struct clock_estimate e = clock_est[clock_est_current];
+		if(!e.valid)
+			return now;
+		int64_t offset_us = e.offset_us + (int64_t)e.drift_ppm * (int32_t)(now - e.at_ms) / 1000;
+		return now + (int32_t)((offset_us + (offset_us >= 0 ? 500 : -500)) / 1000);	// Rounded to the nearest ms
+	#endif
+}
+
+uint32_t global_time_error_ms(void)
+{
+	#if NXT == 1
+		return 0;
+	#else
+		struct clock_estimate e = clock_est[clock_est_current];
+		if(!e.valid)
+			return CLOCK_UNSYNCED;
+		uint32_t age_ms = systick_get_ms() - e.at_ms;
+		uint32_t error_us = e.error_us + CLOCK_DRIFT_BOUND_PPM * age_ms / 1000 + 500;	// Drift since, and the rounding in global_time_ms()
+		return (error_us + 999) / 1000;
+	#endif
+}
+
+void add_clock_sample(uint32_t t1, uint32_t t2, uint32_t t3, uint32_t t4)
+{
+	int32_t delay = (int32_t)(t4 - t1) - (int32_t)(t3 - t2);		// Round trip, less the time NXT1 held the exchange
+	int32_t offset2 = (int32_t)(t2 - t1) + (int32_t)(t3 - t4);
+	if(delay < 0)													// Possible when systick truncation shortens a fast round trip
+		delay = 0;
+
+	// Queueing in TASK_BACKGROUND only ever lengthens a round trip, and the error bound with it, so keep the shortest
+	if(window_samples == 0 || delay < window_delay_ms)
+	{
+		window_delay_ms = delay;
+		window_offset2_ms = offset2;
+		window_t4 = t4;
+	}
+	if(++window_samples < CLOCK_SYNC_WINDOW)
+		return;
+	window_samples = 0;
+
+	const struct clock_estimate* old = &clock_est[clock_est_current];
+	struct clock_estimate* e = &clock_est[clock_est_current ^ 1];
+	e->at_ms = window_t4;
+	e->offset_us = window_offset2_ms * 500;
+	e->drift_ppm = old->drift_ppm;
+
+	// The four timestamps are truncated to the ms, which makes the offset up to 1ms off and the round trip up to 2ms short
+	e->error_us = (uint32_t)window_delay_ms * 500 + 2000;
+
+	int64_t predicted_us = old->offset_us + (int64_t)old->drift_ppm * (int32_t)(window_t4 - old->at_ms) / 1000;
+	int64_t step_us = e->offset_us - predicted_us;
+	if(!old->valid || step_us > CLOCK_STEP_MS*1000 || step_us < -CLOCK_STEP_MS*1000)	// First estimate, or NXT1 restarted
+	{
+		e->drift_ppm = 0;
+		drift_ref_valid = FALSE;
+	}
+	if(!drift_ref_valid)
+	{
+		drift_ref_valid = TRUE;
+		drift_ref_ms = window_t4;
+		drift_ref_offset_us = e->offset_us;
+	}
+	else if(window_t4 - drift_ref_ms >= CLOCK_DRIFT_BASELINE_MS)
+	{
+		e->drift_ppm = (int32_t)((int64_t)(e->offset_us - drift_ref_offset_us) * 1000 / (int32_t)(window_t4 - drift_ref_ms));
+		drift_ref_ms = window_t4;
+		drift_ref_offset_us = e->offset_us;
+	}
+
+	e->valid = TRUE;
+	clock_est_current ^= 1;
+	clock_offset_us = e->offset_us;
+	clock_drift_ppm = e->drift_ppm;
+}
@@ -21,6 +21,15 @@
 static const fix16_t S_PER_MS	= F16(0.001f);
 static const fix16_t MS_PER_S	= F16(1000.0f);
 
+// Global time is NXT1's systick. NXT2/3 estimate their offset from it NTP-style: each exchange over RS485
+// gives four timestamps (NXT2/3 send, NXT1 receive, NXT1 send, NXT2/3 receive), from which the offset
+// follows, with an error of at most half the round trip.
+#define CLOCK_SYNC_WINDOW		16			// Exchanges per offset estimate. The one with the shortest round trip is kept.
+#define CLOCK_DRIFT_BASELINE_MS	60000		// Shortest time between the two offsets a drift estimate is taken from
+#define CLOCK_DRIFT_BOUND_PPM	100			// Unmodelled drift between two NXTs' crystals, for the error bound
+#define CLOCK_STEP_MS			50			// An offset this far off the prediction is a restart of NXT1, not drift
+#define CLOCK_UNSYNCED			UINT32_MAX	// global_time_error_ms() before the first estimate
+
 void init_timing(void);			//Should be called in device startup hook
 void increment_timer_1s(void);	//Should be called every 1ms
 void timer_1s(void);			//Executes every 1000ms
@@ -28,7 +37,13 @@ void timer_1s(void);			//Executes every 1000ms
 uint32_t elapsed_ticks_between(uint32_t earlier_time, uint32_t later_time);	//Ticks elapsed between earlier_time (ms) and later_time (ms).
 uint32_t elapsed_time_us_between(uint32_t earlier_time, uint32_t later_time);	//Microseconds elapsed between earlier_time (ticks) and later_time (ticks). Max elapsed time is ~4ms = 4000us.
 
+uint32_t global_time_ms(void);			//NXT1's systick, on any NXT. This NXT's own systick until the first estimate.
+uint32_t global_time_error_ms(void);	//Bound on the error of global_time_ms(). 0 on NXT1, CLOCK_UNSYNCED before the first estimate.
+void add_clock_sample(uint32_t t1, uint32_t t2, uint32_t t3, uint32_t t4);	//NXT2/3: one exchange. t1, t4: own systick at send and receive. t2, t3: NXT1's at receive and send.
+
 extern uint32_t systick_seconds;		//number of seconds elapsed since program start
 extern uint32_t ticks_per_second;	//number of hires timer ticks per second
+extern int32_t clock_offset_us;		//NXT1's systick minus this NXT's, at the latest estimate
+extern int32_t clock_drift_ppm;		//Rate at which clock_offset_us changes (us per s)
 
 #endif /* SRC_CONTROL_TIMING_H_ */
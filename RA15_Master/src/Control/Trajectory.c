@@ -0,0 +1,350 @@
+/*
+ * Trajectory.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Daniel
+ */
+
+#include "Trajectory.h"
+
+
+// Each segment is a cubic Hermite curve between two knots. The velocity at a knot is the Catmull-Rom slope
+// through its neighbours, (p[k+1]-p[k-1])/(t[k+1]-t[k-1]), so position and velocity are continuous across knots.
+// The velocity at the end of a segment is fixed when the segment starts: if the following knot has not arrived
+// by then, the joint comes to rest at the end of the segment instead.
+
+static const int64_t ACCEL_LIMIT = F16(20000.0f);	// Clamp on the acceleration feedforward (deg/s^2), for very short segments
+
+
+// PUBLIC VARIABLES
+
+uint32_t waypoints_dropped = 0;
+uint32_t traj_underruns = 0;
+
+
+// PRIVATE VARIABLES
+
+struct knot {
+	uint16_t dt_ms;
+	fix16_t p;
+};
+
+// Knots are written by add_waypoint() (background task) and read by get_spline_reference() (TASK_MOTORREG).
+// Each index is written by only one side, so no resource is needed.
+static struct joint_trajectory {
+	struct knot knot[TRAJ_KNOTS];
+	volatile uint8_t head;			// Next free slot. Written by add_waypoint() only.
+	volatile uint8_t tail;			// Oldest queued knot. Written by get_spline_reference() only.
+	volatile uint8_t flush_to;		// Knots before this index are discarded when flush is set
+	volatile BOOL flush;
+
+	BOOL active;					// A segment is playing, or the last knot is being held
+	BOOL starved;					// Holding because the knots ran out mid-trajectory
+	uint32_t start_ms;				// Start time of the current segment
+	uint16_t duration_ms;			// Length of the current segment. 0 while holding the last knot.
+	fix16_t p0, v0;					// Position (deg) and velocity (deg/s) at the start of the segment
+	fix16_t p1, v1;					// ... and at the end
+} traj[6];
+
+static enum control_source owner = CTRL_NONE;		// Source that queued the current knots
+static uint8_t owner_joints = 0;					// Joints with knots queued (or forwarded) since their last stop
+
+#if NXT == 1
+	static struct waypoint forward_queue[TRAJ_FORWARD_QUEUE];
+	static uint8_t forward_head = 0, forward_tail = 0;
+	static const uint8_t REMOTE_JOINTS = 0x1D;		// J1, J3, J4, J5 are driven by NXT2 and NXT3
+#endif
+
+// Written by queue_waypoint() and read by feed_trajectory(), both in the background task
+static struct waypoint ring[TRAJ_WAYPOINT_RING];
+static uint8_t ring_head = 0, ring_tail = 0;
+static enum control_source ring_source = CTRL_NONE;
+
+
+// PRIVATE FUNCTIONS
+
+static inline uint8_t next_index(uint8_t i, uint8_t size)
+{	return (i+1 == size) ? 0 : i+1;	}
+
+static BOOL is_local_joint(uint8_t ji)
+{
+	for(int ci=0; ci<NUM_CONTROLLERS; ci++)
+		if(joint_list[ci] == ji)
+			return TRUE;
+	return FALSE;
+}
+
+static inline int64_t mul_q16(int64_t a, int64_t b)
+{	return (a*b) >> 16;	}
+
+static inline int64_t clamp_q16(int64_t n, int64_t lim)
+{	return (n < -lim) ? -lim : ((n > lim) ? lim : n);	}
+
+// Catmull-Rom velocity (deg/s) at the knot between p_prev and p_next, clamped to vmax
+static fix16_t knot_velocity(uint8_t ji, fix16_t p_prev, fix16_t p_next, uint32_t span_ms)
+{
+	int64_t v = ((int64_t)(p_next - p_prev) * 1000) / span_ms;
+	return (fix16_t)clamp_q16(v, jpmtr[ji].vmax);
+}
+
+static void discard_trajectory(struct joint_trajectory* t)
+{
+	t->tail = t->head;
+	t->active = FALSE;
+	t->starved = FALSE;
+}
+
+
+// PUBLIC FUNCTIONS
+
+BOOL add_waypoint(enum control_source source, const struct waypoint* w)
+{
+	if(!request_control(source))
+		return FALSE;
+
+	if(source != owner)				// Knots from a previous owner are never played
+	{
+		for(int ji=0; ji<6; ji++)
+		{
+			traj[ji].flush_to = traj[ji].head;
+			traj[ji].flush = TRUE;
+		}
+		owner = source;
+		owner_joints = 0;
+	}
+
+	BOOL success = TRUE;
+	for(int ji=0; ji<6; ji++)
+	{
+		if(!((w->joint_mask >> ji) & 0x01) || !is_local_joint(ji))
+			continue;
+
+		struct joint_trajectory* t = &traj[ji];
+		if(w->dt_ms == 0)
+		{
+			t->flush_to = t->head;
+			t->flush = TRUE;
+			owner_joints &= ~(0x01 << ji);
+			continue;
+		}
+
+		uint8_t next = next_index(t->head, TRAJ_KNOTS);
+		if(next == t->tail)
+		{
+			waypoints_dropped++;
+			success = FALSE;
+			continue;
+		}
+		t->knot[t->head].dt_ms = w->dt_ms;
+		t->knot[t->head].p = fix16_clamp(w->p[ji], jpmtr[ji].pmin, jpmtr[ji].pmax);
+		t->head = next;
+		owner_joints |= (0x01 << ji);
+	}
+
+	#if NXT == 1
+		if(w->joint_mask & REMOTE_JOINTS)
+		{
+			uint8_t next = next_index(forward_head, TRAJ_FORWARD_QUEUE);
+			if(next == forward_tail)
+			{
+				waypoints_dropped++;
+				success = FALSE;
+			}
+			else
+			{
+				forward_queue[forward_head] = *w;
+				forward_queue[forward_head].joint_mask &= REMOTE_JOINTS;
+				forward_head = next;
+				if(w->dt_ms == 0)
+					owner_joints &= ~(w->joint_mask & REMOTE_JOINTS);
+				else
+					owner_joints |= (w->joint_mask & REMOTE_JOINTS);
+			}
+		}
+	#endif
+
+	return success;
+}
+
+
+#if NXT == 1
+BOOL peek_forward_waypoint(struct waypoint* w)
+{
+	if(forward_tail == forward_head)
+		return FALSE;
+	*w = forward_queue[forward_tail];
+	return TRUE;
+}
+
+
+void release_forward_waypoint(void)
+{
+	if(forward_tail != forward_head)
+		forward_tail = next_index(forward_tail, TRAJ_FORWARD_QUEUE);
+}
+#endif
+
+
+BOOL queue_waypoint(enum control_source source, const struct waypoint* w)
+{
+	uint8_t next = next_index(ring_head, TRAJ_WAYPOINT_RING);
+	if(next == ring_tail)
+	{
+		waypoints_dropped++;
+		return FALSE;
+	}
+	ring[ring_head] = *w;
+	ring_head = next;
+	ring_source = source;
+	return TRUE;
+}
+
+
+void feed_trajectory(void)
+{
+	while(ring_tail != ring_head)
+	{
+		if(!request_control(ring_source))		// Taken over: the rest of this trajectory is never played
+		{
+			ring_tail = ring_head;
+			return;
+		}
+		if(get_free_knots() == 0)
+			return;
+		add_waypoint(ring_source, &ring[ring_tail]);
+		ring_tail = next_index(ring_tail, TRAJ_WAYPOINT_RING);
+	}
+}
+
+
+uint8_t get_queued_waypoints(void)
+{
+	return (uint8_t)((ring_head + TRAJ_WAYPOINT_RING - ring_tail) % TRAJ_WAYPOINT_RING);
+}
+
+
+uint8_t get_free_waypoints(void)
+{
+	return (uint8_t)(TRAJ_WAYPOINT_RING-1 - get_queued_waypoints());
+}
+
+
+uint8_t get_trajectory_joints(void)
+{
+	return (get_control_source() == owner) ? owner_joints : 0;
+}
+
+
+uint8_t get_free_knots(void)
+{
+	int32_t free_knots = TRAJ_KNOTS-1;
+	for(int ci=0; ci<NUM_CONTROLLERS; ci++)
+	{
+		struct joint_trajectory* t = &traj[joint_list[ci]];
+		int32_t queued = (t->head + TRAJ_KNOTS - t->tail) % TRAJ_KNOTS;
+		free_knots = min_int(free_knots, TRAJ_KNOTS-1 - queued);
+	}
+	#if NXT == 1
+		int32_t forwarding = (forward_head + TRAJ_FORWARD_QUEUE - forward_tail) % TRAJ_FORWARD_QUEUE;
+		free_knots = min_int(free_knots, TRAJ_FORWARD_QUEUE-1 - forwarding);
+	#endif
+	return (uint8_t)free_knots;
+}
+
+
+BOOL get_spline_reference(uint8_t ji, uint32_t now_ms, fix16_t* jp, fix16_t* jv, fix16_t* ja)
+{
+	struct joint_trajectory* t = &traj[ji];
+
+	if(t->flush)
+	{
+		t->tail = t->flush_to;
+		t->active = FALSE;
+		t->flush = FALSE;
+	}
+
+	if(get_control_source() != owner)		// A higher priority source (e.g. homing) has taken over
+	{
+		discard_trajectory(t);
+		return FALSE;
+	}
+
+	if(!t->active)
+	{
+		if(t->tail == t->head)
+			return FALSE;
+		t->p1 = j[ji].p;					// First segment starts from rest at the current position
+		t->v1 = 0;
+		t->start_ms = now_ms;
+		t->duration_ms = 0;
+		t->active = TRUE;
+		t->starved = FALSE;
+	}
+
+	// Move on to the next segment once the current one has finished
+	while(elapsed_ticks_between(t->start_ms, now_ms) >= t->duration_ms)
+	{
+		if(t->tail == t->head)				// Out of knots: hold the last one until more arrive
+		{
+			if(t->duration_ms != 0)			// A segment has just finished, rather than a hold going on
+				t->starved = TRUE;
+			t->p0 = t->p1;	t->v0 = 0;	t->v1 = 0;
+			t->start_ms = now_ms;
+			t->duration_ms = 0;
+			*jp = t->p1;	*jv = 0;	*ja = 0;
+			return TRUE;
+		}
+
+		if(t->duration_ms == 0)				// Resuming from a hold
+		{
+			if(t->starved)
+				traj_underruns++;
+			t->starved = FALSE;
+			t->start_ms = now_ms;
+		}
+		else
+			t->start_ms += t->duration_ms;
+
+		struct knot k = t->knot[t->tail];
+		t->tail = next_index(t->tail, TRAJ_KNOTS);
+
+		t->p0 = t->p1;
+		t->v0 = t->v1;
+		t->p1 = k.p;
+		t->duration_ms = k.dt_ms;
+		if(t->tail != t->head)
+		{
+			struct knot after = t->knot[t->tail];
+			t->v1 = knot_velocity(ji, t->p0, after.p, (uint32_t)k.dt_ms + after.dt_ms);
+		}
+		else
+			t->v1 = 0;
+	}
+
+	// Evaluate the Hermite basis at s = elapsed/duration. Tangents m are velocities scaled to the segment length.
+	int64_t T = t->duration_ms;
+	int64_t s = ((int64_t)elapsed_ticks_between(t->start_ms, now_ms) << 16) / T;
+	int64_t s2 = mul_q16(s, s), s3 = mul_q16(s2, s);
+	int64_t dp = (int64_t)t->p1 - t->p0;
+	int64_t m0 = ((int64_t)t->v0 * T) / 1000;
+	int64_t m1 = ((int64_t)t->v1 * T) / 1000;
+
+	int64_t h01 = 3*s2 - 2*s3;						// h00 = 1 - h01
+	int64_t h10 = s3 - 2*s2 + s;
+	int64_t h11 = s3 - s2;
+	*jp = (fix16_t)(t->p0 + mul_q16(h01, dp) + mul_q16(h10, m0) + mul_q16(h11, m1));
+
+	int64_t dh01 = 6*s - 6*s2;						// d/ds
+	int64_t dh10 = 3*s2 - 4*s + fix16_one;
+	int64_t dh11 = 3*s2 - 2*s;
+	int64_t dp_ds = mul_q16(dh01, dp) + mul_q16(dh10, m0) + mul_q16(dh11, m1);
+	*jv = (fix16_t)clamp_q16((dp_ds * 1000) / T, jpmtr[ji].vmax);
+
+	int64_t d2h01 = 6*fix16_one - 12*s;				// d2/ds2
+	int64_t d2h10 = 6*s - 4*fix16_one;
+	int64_t d2h11 = 6*s - 2*fix16_one;
+	int64_t d2p_ds2 = mul_q16(d2h01, dp) + mul_q16(d2h10, m0) + mul_q16(d2h11, m1);
+	*ja = (fix16_t)clamp_q16((d2p_ds2 * 1000000) / (T*T), ACCEL_LIMIT);
+
+	return TRUE;
+}
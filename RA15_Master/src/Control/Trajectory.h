@@ -0,0 +1,80 @@
+/*
+ * Trajectory.h
+ *
+ *	Public interface for Trajectory.c.
+ *	Per-joint buffer of sparse waypoints (knots), played back as a cubic spline by the motor regulator.
+ *
+ *     Version: 1.0
+ *  Created on: Oct 19, 2026
+ *      Author: Daniel
+ */
+
+#ifndef SRC_CONTROL_TRAJECTORY_H_
+#define SRC_CONTROL_TRAJECTORY_H_
+
+#include "kernel.h"
+#include "kernel_id.h"
+#include "ecrobot_interface.h"
+#include "stdint.h"
+
+#include "../Globals.h"
+#include "../Control/Targeting.h"
+#include "fix16.h"
+
+
+#define TRAJ_KNOTS			8		// Knot buffer size per joint (holds TRAJ_KNOTS-1 knots)
+#define TRAJ_FORWARD_QUEUE	8		// NXT1 only: waypoints waiting to be forwarded to NXT2/3 over RS485 (holds TRAJ_FORWARD_QUEUE-1)
+#define TRAJ_WAYPOINT_RING	32		// Waypoints from the PC waiting for room in the knot buffers (holds TRAJ_WAYPOINT_RING-1)
+
+// One waypoint for any subset of the joints.
+// The spline passes through p[ji] dt_ms after the previous waypoint (or after playback starts, for the first one).
+// dt_ms == 0 discards the trajectory of every joint in joint_mask, returning them to pt/vt control.
+struct waypoint {
+	uint16_t dt_ms;			// Time since the previous waypoint (ms)
+	uint8_t joint_mask;		// Bit ji set if p[ji] is a knot for joint ji
+	fix16_t p[6];			// Joint positions (deg)
+};
+
+
+// Queues a waypoint for the joints in joint_mask that this NXT drives. NXT1 also queues it for forwarding to NXT2/3.
+// Takes control for source, like set_targets(). Returns FALSE if access was denied or a buffer was full (the knot is dropped).
+BOOL add_waypoint(enum control_source source, const struct waypoint* w);
+
+// Called by the motor regulator every tick for each joint it drives. If a trajectory is playing, writes the spline's
+// position (deg), velocity (deg/s) and acceleration (deg/s^2) at time now_ms and returns TRUE. Otherwise returns FALSE.
+BOOL get_spline_reference(uint8_t ji, uint32_t now_ms, fix16_t* jp, fix16_t* jv, fix16_t* ja);
+
+// Mask of the joints whose trajectory is playing or holding its last knot: knots have been queued for them since
+// their last stop, and their source still has control. On NXT1 this includes NXT2/3's joints, as forwarded.
+uint8_t get_trajectory_joints(void);
+
+// Smallest number of knots that can still be queued for any joint (and, on NXT1, in the forward queue).
+// The PC should keep at least 2 knots queued ahead, and never send more than this.
+uint8_t get_free_knots(void);
+
+#if NXT == 1
+	// Oldest waypoint waiting to be forwarded to NXT2/3. Returns FALSE if there is none. It stays queued until
+	// release_forward_waypoint(), which RS485.c calls once NXT2 and NXT3 have acknowledged it.
+	BOOL peek_forward_waypoint(struct waypoint* w);
+	void release_forward_waypoint(void);
+#endif
+
+// Queues a waypoint from the PC (over Bluetooth, so NXT1 only) in the waypoint ring, ahead of the knot buffers,
+// so that the PC can send a batch at a time. feed_trajectory() passes it on to add_waypoint() once every buffer
+// has room. Returns FALSE if the ring is full (the waypoint is dropped).
+BOOL queue_waypoint(enum control_source source, const struct waypoint* w);
+
+// Moves waypoints from the ring to add_waypoint() while the knot buffers have room. Called by update_targets().
+// If a higher priority source has taken control, the waypoints in the ring are discarded instead.
+void feed_trajectory(void);
+
+uint8_t get_queued_waypoints(void);		// Waypoints in the ring
+uint8_t get_free_waypoints(void);		// Waypoints the ring can still take. The PC should never have more in flight.
+
+
+extern uint32_t waypoints_dropped;		// Knots lost because a buffer was full
+extern uint32_t traj_underruns;			// Times a joint ran out of knots at the end of a segment, then carried on when more arrived.
+										// The start of a trajectory sent after the previous one came to rest counts as well.
+
+
+#endif /* SRC_CONTROL_TRAJECTORY_H_ */
@@ -11,6 +11,7 @@
 // JOINT STATE VARIABLES
 
 struct joint_state j[6];
+const struct joint_parameter* volatile jpmtr = jpmtr_defaults;
 
 void init_joint_states()
 {
@@ -21,6 +22,7 @@ void init_joint_states()
 		j[ji].pt = jpmtr[ji].prest;
 		j[ji].vt = F16(0.0f);
 		j[ji].pwm = F16(0.0f);
+		j[ji].t = 0;
 	}
 }
 
@@ -39,10 +41,15 @@ uint8_t ea3	=	0;
 // OPERATING SYSTEM
 
 uint32_t systick_ms = 0;
+uint32_t task_motorreg_start_ms		= 0;
 uint16_t task_motorreg_duration_us	= 0;
 uint16_t task_lcd_duration_us		= 0;
 uint16_t task_targeting_duration_us	= 0;
 uint16_t task_sensors_duration_us	= 0;
 uint16_t task_bluetooth_duration_us	= 0;
+uint16_t collision_check_duration_us	= 0;
+uint16_t collision_check_max_us		= 0;
+uint16_t remote_state_age_max_ms	= 0;
+uint16_t remote_state_err_max_mdeg	= 0;
 
 
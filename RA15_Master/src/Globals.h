@@ -10,8 +10,11 @@
 
 //********************************************************************************************************
 // NXT COMPILE TARGET: Change to decide which NXT to compile for (1 2 or 3)
+// Host builds of the firmware (RA15_Host/src/Sil) pass -DNXT=n instead.
 //
+#ifndef NXT
 #define NXT 1
+#endif
 //
 //********************************************************************************************************
 // COMPILER PARAMETERS
@@ -60,8 +63,12 @@ struct joint_state{
 	fix16_t pt;			//Joint angular position target.
 	fix16_t vt;			//Joint angular velocity target.
 	int8_t pwm;				//Joint effort from motor regulator (pwm duty cycle, 1-100)
+	uint32_t t;				//global_time_ms() when p and v were sampled, by whichever NXT drives the joint. JOINT_STATE_UPDATING while being written.
 };
 
+#define JOINT_STATE_UPDATING	0	// j[].t while RS485 decodes a new state, so that a preempting TASK_MOTORREG does not extrapolate a half-written one
+#define JOINT_STATE_UNSYNCED	1	// j[].t of a remote state sampled or received without a global time estimate. Never extrapolated.
+
 extern struct joint_state j[6];
 
 void init_joint_states(void);	// Should be called in ecrobot_device_initialization()
@@ -87,6 +94,8 @@ static fix16_t zero = F16(0.0f);
 
 #endif
 
+static const uint8_t joint_nxt[6] = {2,1,3,3,2,1};		// NXT that drives each joint
+
 struct joint_parameter
 {
 	uint8_t	n;					// Which joint this set of parameters corresponds to (0-5)
@@ -101,6 +110,7 @@ struct joint_parameter
 
 	fix16_t b[6];			// Coefficients for two-variable quadratic regression model: pwm_estimate = b0 + b1x1 + b2x2 + b3x1^2 + b4x2^2 + b5x1x2
 	fix16_t *x2;			// Pointer to secondary variable to be used in the model. x1 is always jvt_int (intermediate joint velocity target).
+	fix16_t ka;				// Acceleration feedforward: extra pwm per deg/s^2 of spline acceleration. 0 disables.
 	fix16_t kp_p,ki_p,kd_p; // Position controller gains
 	fix16_t kp_v,ki_v,kd_v; // Velocity controller gains
 
@@ -117,7 +127,7 @@ struct joint_parameter
 	uint8_t tmux_mask;			// Binary mask identifying which homing switch belongs to this joint.
 };
 
-static const struct joint_parameter jpmtr[6] = {
+static const struct joint_parameter jpmtr_defaults[6] = {	// Flashed values. jpmtr points at the table in use (see Parameters.h).
 	{
 		.n = 0,		//Link 1 starts at O0, ends at O1. J1 rotates around z0. J2 rotates around z1.
 
@@ -131,6 +141,7 @@ static const struct joint_parameter jpmtr[6] = {
 
 		.b = {F16(0.0f),	F16(1.0f),	F16(0.0f),	F16(0.0f),	F16(0.0f),	F16(0.0f)},
 		.x2 = &zero,	// x1 is this joint's controller's internal velocity target
+		.ka = F16(0.0f),
 		.kp_p = F16(0.0f),	.ki_p = F16(0.0f),	.kd_p = F16(0.0f),
 		.kp_v = F16(0.0f),	.ki_v = F16(0.0f),	.kd_v = F16(0.0f),
 
@@ -158,6 +169,7 @@ static const struct joint_parameter jpmtr[6] = {
 
 		.b = {F16(0.0f),	F16(1.0f),	F16(0.0f),	F16(0.0f),	F16(0.0f),	F16(0.0f)},
 		.x2 = &zero,	// x1 is this joint's controller's internal velocity target
+		.ka = F16(0.0f),
 		.kp_p = F16(0.0f),	.ki_p = F16(0.0f),	.kd_p = F16(0.0f),
 		.kp_v = F16(0.0f),	.ki_v = F16(0.0f),	.kd_v = F16(0.0f),
 
@@ -185,6 +197,7 @@ static const struct joint_parameter jpmtr[6] = {
 
 		.b = {F16(0.0f),	F16(1.0f),	F16(0.0f),	F16(0.0f),	F16(0.0f),	F16(0.0f)},
 		.x2 = &zero,	// x1 is this joint's controller's internal velocity target
+		.ka = F16(0.0f),
 		.kp_p = F16(0.0f),	.ki_p = F16(0.0f),	.kd_p = F16(0.0f),
 		.kp_v = F16(0.0f),	.ki_v = F16(0.0f),	.kd_v = F16(0.0f),
 
@@ -212,6 +225,7 @@ static const struct joint_parameter jpmtr[6] = {
 
 		.b = {F16(0.0f),	F16(1.0f),	F16(0.0f),	F16(0.0f),	F16(0.0f),	F16(0.0f)},
 		.x2 = &zero,	// x1 is this joint's controller's internal velocity target
+		.ka = F16(0.0f),
 		.kp_p = F16(0.0f),	.ki_p = F16(0.0f),	.kd_p = F16(0.0f),
 		.kp_v = F16(0.0f),	.ki_v = F16(0.0f),	.kd_v = F16(0.0f),
 
@@ -239,6 +253,7 @@ static const struct joint_parameter jpmtr[6] = {
 
 		.b = {F16(0.0f),	F16(1.0f),	F16(0.0f),	F16(0.0f),	F16(0.0f),	F16(0.0f)},
 		.x2 = &zero,	// x1 is this joint's controller's internal velocity target
+		.ka = F16(0.0f),
 		.kp_p = F16(0.0f),	.ki_p = F16(0.0f),	.kd_p = F16(0.0f),
 		.kp_v = F16(0.0f),	.ki_v = F16(0.0f),	.kd_v = F16(0.0f),
 
@@ -266,6 +281,7 @@ static const struct joint_parameter jpmtr[6] = {
 
 		.b = {F16(0.0f),	F16(1.0f),	F16(0.0f),	F16(0.0f),	F16(0.0f),	F16(0.0f)},
 		.x2 = &zero,	// x1 is this joint's controller's internal velocity target
+		.ka = F16(0.0f),
 		.kp_p = F16(0.0f),	.ki_p = F16(0.0f),	.kd_p = F16(0.0f),
 		.kp_v = F16(0.0f),	.ki_v = F16(0.0f),	.kd_v = F16(0.0f),
 
@@ -281,6 +297,7 @@ static const struct joint_parameter jpmtr[6] = {
 		.tmux_mask = (0x01 << 5)
 	}
 };
+extern const struct joint_parameter* volatile jpmtr;	// Joint parameters in use. Only switched between TASK_MOTORREG cycles.
 
 // JOINT HOMING SWITCHES
 
@@ -315,11 +332,16 @@ extern	uint8_t ea3;
 // OPERATING SYSTEM
 
 extern uint32_t systick_ms;
+extern uint32_t task_motorreg_start_ms;		// systick when TASK_MOTORREG last started. The RS485 schedule is timed from it.
 extern uint16_t task_motorreg_duration_us;
 extern uint16_t task_lcd_duration_us;
 extern uint16_t task_targeting_duration_us;
 extern uint16_t task_sensors_duration_us;
 extern uint16_t task_bluetooth_duration_us;
+extern uint16_t collision_check_duration_us;
+extern uint16_t collision_check_max_us;		// Worst case since startup
+extern uint16_t remote_state_age_max_ms;	// Oldest remote joint state extrapolated by TASK_MOTORREG in the last full second
+extern uint16_t remote_state_err_max_mdeg;	// Largest miss of that extrapolation (millidegrees) in the last full second, measured when the next state arrived
 #if NXT == 1
 	#define LEFT_BUTTON_MASK	(0x01<<6)		// TMUX mask for left UI button
 	#define RIGHT_BUTTON_MASK	(0x01<<7)		// TMUX mask for right UI button
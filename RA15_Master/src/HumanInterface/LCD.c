@@ -30,11 +30,43 @@ enum button_names {
 
 static enum page_names page = PAGE_STARTUP;
 #define FIRST_PAGE PAGE_STATUS
-#define LAST_PAGE PAGE_TIMING
+#define LAST_PAGE PAGE_RS485
 
 static int32_t line = 0;
 #define LAST_LINE 7
 
+static uint8_t remote_homing_nxt = 0;		// NXT asked to home one of its joints, 0 if none
+static uint8_t remote_homing_id;			// Id of that MSG_BEGIN_HOMING request
+
+
+// PRIVATE FUNCTIONS
+
+// Joints driven by NXT2/3 are homed by their own NXT, which sees the switch edges without the RS485 delay
+static void begin_homing(uint8_t ji)
+{
+	if(joint_nxt[ji] == NXT)
+	{
+		begin_homing_sequence(ji);
+		return;
+	}
+	enum msg_result result = get_message_result(remote_homing_id);
+	if(remote_homing_nxt != 0 && (result == MSG_PENDING || result == MSG_OK))	// One at a time, like the local sequence
+		return;
+	if(post_message(joint_nxt[ji], MSG_BEGIN_HOMING, MSG_PRIORITY_LOW, &ji, &remote_homing_id))
+		remote_homing_nxt = joint_nxt[ji];
+}
+
+static void end_homing(void)
+{
+	end_homing_sequence();
+	if(remote_homing_nxt != 0)
+	{
+		uint8_t id;
+		post_message(remote_homing_nxt, MSG_END_HOMING, MSG_PRIORITY_HIGH, NULL, &id);
+		remote_homing_nxt = 0;
+	}
+}
+
 
 // TASK
 
@@ -115,7 +147,10 @@ TASK(TASK_LCD)
 				display_goto_xy(3, 2);  display_unsigned(bt_packets_sent, 5);
 				display_goto_xy(9, 2);  display_string("rx:");
 				display_goto_xy(12, 2); display_unsigned(bt_packets_received, 4);
-				display_labeled_unsigned("RS485: ",	rs485_update_cycles,	3);
+				display_goto_xy(0, 3);  display_string("zr:");		// Sample packets: compression (%) and build time (us)
+				display_goto_xy(3, 3);  display_unsigned(get_bt_sample_ratio_pct(), 5);
+				display_goto_xy(9, 3);  display_string("us:");
+				display_goto_xy(12, 3); display_unsigned(bt_sample_encode_max_us, 4);
 				display_labeled_bin("TMUX:", 6, tmux, 8, 4);
 				display_goto_xy(1, 5);	display_int(fix16_to_int(j[0].p),4);
 				display_goto_xy(5, 5);	display_string("|");
@@ -128,15 +163,10 @@ TASK(TASK_LCD)
 				display_goto_xy(10,6);	display_string("|");
 				display_goto_xy(11,6);	display_int(fix16_to_int(j[5].p),4);
 
-//				display_labeled_unsigned("incomplete:", bt_incomplete_sent, 7);
-
-				static fix16_t angle_increment = F16(3.14159265358979323846264f/20.0f);
-				static fix16_t inc = 0;
-				fix16_t sintheta = (fix16_mul(angle_increment, inc));
-				inc = fix16_add(inc, fix16_one);
-				if(inc > F16(40.0f))
-					inc = F16(0.0f);
-				display_labeled_fix16("Val: ", sintheta, 7);
+				display_goto_xy(0, 7);  display_string("er:");
+				display_goto_xy(3, 7);  display_unsigned(rs485_crc_errors + rs485_frame_errors + rs485_lost_frames, 5);
+				display_goto_xy(9, 7);  display_string("ov:");
+				display_goto_xy(12, 7); display_unsigned(rs485_slot_overruns, 4);
 
 				break;
 			}
@@ -192,7 +222,7 @@ TASK(TASK_LCD)
 				uint8_t ji = line-2;
 				if(page_exiting)
 				{
-					end_homing_sequence();
+					end_homing();
 					set_all_velocity_zero(source);
 					release_control(source);
 				}
@@ -206,7 +236,7 @@ TASK(TASK_LCD)
 				}
 				else if(button[RIGHT] == RISING_EDGE)	// Begin homing sequence for the selected joint
 				{
-					begin_homing_sequence(ji);
+					begin_homing(ji);
 				}
 				else if(button[RIGHT] == FALLING_EDGE)
 				{
@@ -214,7 +244,7 @@ TASK(TASK_LCD)
 				}
 				else if(button[ENTER] == RISING_EDGE)	// Abort homing sequence, advance line selection
 				{
-					end_homing_sequence();
+					end_homing();
 					if(line==0) line = 2;
 					else		line = inc_wrap(line, 0, LAST_LINE);
 				}
@@ -224,7 +254,23 @@ TASK(TASK_LCD)
 				switch(get_homing_sequence_state())
 				{
 					case HOMING_INACTIVE:
-						display_string("<RestPos   Home>");
+						if(remote_homing_nxt == 0)
+						{
+							display_string("<RestPos   Home>");
+							break;
+						}
+						switch(get_message_result(remote_homing_id))		// Homing on NXT2/3
+						{
+							case MSG_PENDING:	display_string("SEND (ENTR=ABRT)");	break;
+							case MSG_OK:		display_string("NXT  (ENTR=ABRT)");	break;
+							case MSG_REFUSED:	display_string("NXT  REFUSED");		break;
+							case MSG_NO_REPLY:	display_string("NXT  NO REPLY");	break;
+							default:			display_string("NXT  FAILED");		break;
+						}
+						if(get_message_result(remote_homing_id) != MSG_PENDING)
+						{
+							display_goto_xy(3, 1);	display_unsigned(remote_homing_nxt, 1);
+						}
 						break;
 
 					case HOMING_ROLL_OFF_SWITCH_1:
@@ -257,11 +303,31 @@ TASK(TASK_LCD)
 			{
 				display_goto_xy(2, 0);	display_string("TIMING");
 				display_labeled_unsigned("HiRes T/S:",	ticks_per_second, 1);
+				display_labeled_unsigned("CollMax:",	collision_check_max_us,		2);
 				display_labeled_unsigned("MotorReg:",	task_motorreg_duration_us,	3);
 				display_labeled_unsigned("LCD:",		task_lcd_duration_us,		4);
 				display_labeled_unsigned("Targting:",	task_targeting_duration_us,	5);
-				display_labeled_unsigned("Sensors:",	task_sensors_duration_us,	6);
-				display_labeled_unsigned("BlueT:",		task_bluetooth_duration_us, 7);
+				display_goto_xy(0, 6);  display_string("Sn:");
+				display_goto_xy(3, 6);  display_unsigned(task_sensors_duration_us, 5);
+				display_goto_xy(9, 6);  display_string("BT:");
+				display_goto_xy(12, 6); display_unsigned(task_bluetooth_duration_us, 4);
+				display_goto_xy(0, 7);  display_string("ag:");		// Remote joint states: age (ms) and extrapolation error (mdeg)
+				display_goto_xy(3, 7);  display_unsigned(remote_state_age_max_ms, 5);
+				display_goto_xy(9, 7);  display_string("ex:");
+				display_goto_xy(12, 7); display_unsigned(remote_state_err_max_mdeg, 4);
+				break;
+			}
+
+			// Page: RS485 baud rate negotiation
+			case PAGE_RS485:
+			{
+				display_goto_xy(2, 0);	display_string("RS485");
+				disp_rs485_state(1);
+				disp_rs485_baud(2);
+				display_goto_xy(0, 7);  display_string("er:");
+				display_goto_xy(3, 7);  display_unsigned(rs485_crc_errors + rs485_frame_errors + rs485_lost_frames, 5);
+				display_goto_xy(9, 7);  display_string("ov:");
+				display_goto_xy(12, 7); display_unsigned(rs485_slot_overruns, 4);
 				break;
 			}
 		}
@@ -33,7 +33,8 @@ enum page_names {
 	PAGE_STATUS,
 	PAGE_DIRCTL,
 	PAGE_HOMING,
-	PAGE_TIMING
+	PAGE_TIMING,
+	PAGE_RS485
 };
 
 enum page_names get_ui_page(void);
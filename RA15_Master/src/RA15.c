@@ -7,6 +7,7 @@
 #include "Control/MotorRegulator.h"
 #include "Control/Targeting.h"
 #include "Control/Timing.h"
+#include "Control/Parameters.h"
 #include "Comms/Bluetooth.h"
 #include "Comms/RS485.h"
 #include "Sensors/Sensors.h"
@@ -28,6 +29,7 @@ void user_1ms_isr_type2(void)
 void ecrobot_device_initialize()
 {
 	init_timing();
+	init_parameters();
 	init_joint_states();
 	init_motor_regulator();
 	init_sensor_ports();
@@ -60,6 +62,7 @@ TASK(TASK_BACKGROUND)
 
 		#if NXT == 1
 			update_bt();
+			update_parameters();
 		#endif
 
 		update_targets();
@@ -20,6 +20,31 @@ classdef NXTConnection < handle
         lastPCPacket            struct
         lastRow                 = 0;
         tableSize               = 0;
+        
+        captureFile             = -1;       % RS485 bus capture being written, see startCapture()
+        captureBytes            = 0;
+        
+        samples                 struct      % Joint states of every TASK_MOTORREG cycle (TELEMETRY_SAMPLE fields and seq), one row each
+        lastSampleRow           = 0;
+        sampleTableSize         = 0;
+        nextSampleSeq           = -1;       % seq expected next, -1 before the first frame
+        samplesLost             = 0;        % Samples NXT1 dropped, or whose frame was lost, counted from seq gaps
+        
+        signals                 = struct('id', {}, 'name', {}, 'type', {});    % NXT1's telemetry registry, see listSignals()
+        subscription            = struct('layout', -1, 'decimation', 0, 'total', 0, 'names', {{}}, 'types', []);   % As NXT1 described it
+        subscribed              struct      % Records of the subscription, one column per signal (valid MATLAB names) and seq
+        lastSubscribedRow       = 0;
+        subscribedTableSize     = 0;
+        nextSubscribedSeq       = -1;
+        subscribedLost          = 0;
+        
+        parameters              = struct()  % Staged joint parameters NXT1 reported, parameters.(name)(joint), see getParameter()
+        parameterVersion        = 0;        % Version of the table NXT1 uses, 0 for the flashed one
+        commitResult            = '';       % Latest commit, see commitParameters(): 'pending', 'ok', 'failed', ...
+        
+        clockOffset             = NaN;      % NXT1's systick minus the PC's ms clock of pcStamp, see clockEchoed()
+        clockExchanges          = zeros(0, 2);  % [offset delay] of the latest CLOCK_SYNC_WINDOW echoes, ms
+        lastClockProbe          = 0;        % PC time of the latest CLOCK_BT, ms
                
     end
     
@@ -37,53 +62,50 @@ classdef NXTConnection < handle
         
         ECROBOT_HEADER_BYTES    = 2;
         
-        NXT_BT_PACKET_BYTES     = 62;
-        NXT_BT_PACKET_VALS      = 23;
+        % Packet layouts are generated from the firmware's PacketSchema.h, see NXTPackets.m
+        NXT_BT_PACKET_BYTES     = NXTPackets.NXT1_BT_BYTES;
         NXT_BT_HEADER           = [uint8(NXTConnection.NXT_BT_PACKET_BYTES), zeros(1, NXTConnection.ECROBOT_HEADER_BYTES-1, 'uint8')];
-        NXT_BT_EMPTY_PACKET     = struct(   'systick',      uint32(0),  ...
-                                            'j1p',          double(0),  ...
-                                            'j1v',          double(0),  ...
-                                            'j1pwm',        int8(0),    ...
-                                            'j2p',          double(0),  ...
-                                            'j2v',          double(0),  ...
-                                            'j2pwm',        int8(0),    ...
-                                            'j3p',          double(0),  ...
-                                            'j3v',          double(0),  ...
-                                            'j3pwm',        int8(0),    ...
-                                            'j4p',          double(0),  ...
-                                            'j4v',          double(0),  ...
-                                            'j4pwm',        int8(0),    ...
-                                            'j5p',          double(0),  ...
-                                            'j5v',          double(0),  ...
-                                            'j5pwm',        int8(0),    ...
-                                            'j6p',          double(0),  ...
-                                            'j6v',          double(0),  ...
-                                            'j6pwm',        int8(0),    ...
-                                            'tmux',         uint8(0),   ...
-                                            'ea1',          double(0),  ...
-                                            'ea2',          double(0),  ...
-                                            'ea3',          double(0)   );
+        NXT_BT_EMPTY_PACKET     = NXTPackets.NXT1_BT_EMPTY;
         NXT_PACKET_VARS         = fields(NXTConnection.NXT_BT_EMPTY_PACKET);
          
-        PC_BT_PACKET_BYTES      = 51;
-        PC_BT_PACKET_VALS       = 14;
+        PC_BT_PACKET_BYTES      = NXTPackets.PC_BT_BYTES;
         PC_BT_HEADER            = [uint8(NXTConnection.PC_BT_PACKET_BYTES), zeros(1, NXTConnection.ECROBOT_HEADER_BYTES-1, 'uint8')];
-        PC_BT_EMPTY_PACKET      = struct(   'j1pt',         double(0),  ...
-                                            'j1vt',         double(0),  ...
-                                            'j2pt',         double(0),  ...
-                                            'j2vt',         double(0),  ...
-                                            'j3pt',         double(0),  ...
-                                            'j3vt',         double(0),  ...
-                                            'j4pt',         double(0),  ...
-                                            'j4vt',         double(0),  ...
-                                            'j5pt',         double(0),  ...
-                                            'j5vt',         double(0),  ...
-                                            'j6pt',         double(0),  ...
-                                            'j6vt',         double(0),  ...
-                                            'rcx',          uint8(0),   ...
-                                            'nxtTransmitInterval', uint16(100) );
+        PC_BT_EMPTY_PACKET      = setfield(NXTPackets.PC_BT_EMPTY, 'nxtTransmitInterval', uint16(100));
         PC_PACKET_VARS          = fields(NXTConnection.PC_BT_EMPTY_PACKET);
         
+        % Spline knot: joints in jointMask pass through p1..p6 (deg) dtMs after the previous knot. dtMs == 0 stops the spline.
+        % Keep at least 2 knots queued ahead of playback, and never have more in flight than freeWaypoints.
+        WAYPOINT_BT_PACKET_BYTES = NXTPackets.WAYPOINT_BT_BYTES;
+        WAYPOINT_BT_HEADER      = [uint8(NXTConnection.WAYPOINT_BT_PACKET_BYTES), zeros(1, NXTConnection.ECROBOT_HEADER_BYTES-1, 'uint8')];
+        WAYPOINT_BT_EMPTY_PACKET = NXTPackets.WAYPOINT_BT_EMPTY;
+        % Up to WAYPOINT_BATCH knots per packet, see bluetoothSendWaypoints()
+        WAYPOINT_BATCH_BT_HEADER = [uint8(NXTPackets.WAYPOINT_BATCH_BT_BYTES), zeros(1, NXTConnection.ECROBOT_HEADER_BYTES-1, 'uint8')];
+        
+        % RS485 bus capture (NXT1 firmware built with RS485_CAPTURE). Replay the file with RA15_Host rs485_replay.
+        CAPTURE_CMD_BT_HEADER   = [uint8(NXTPackets.CAPTURE_CMD_BT_BYTES), zeros(1, NXTConnection.ECROBOT_HEADER_BYTES-1, 'uint8')];
+        CAPTURE_BT_HEADER       = [uint8(NXTPackets.CAPTURE_BT_BYTES), zeros(1, NXTConnection.ECROBOT_HEADER_BYTES-1, 'uint8')];
+        CAPTURE_DRAIN_TIME      = 1.0;      % seconds - NXT1 sends what it still has buffered after the capture stops
+        
+        % Joint states of every TASK_MOTORREG cycle, NXTPackets.TELEMETRY_BATCH per packet. Kept in samples.
+        TELEMETRY_BT_HEADER     = [uint8(NXTPackets.TELEMETRY_BT_BYTES), zeros(1, NXTConnection.ECROBOT_HEADER_BYTES-1, 'uint8')];
+        % The same, delta coded, while compressSamples is set in the PC packet. Up to NXTPackets.TELEMETRY_Z_MAX per packet.
+        TELEMETRY_Z_BT_HEADER   = [uint8(NXTPackets.TELEMETRY_Z_BT_BYTES), zeros(1, NXTConnection.ECROBOT_HEADER_BYTES-1, 'uint8')];
+        SAMPLE_VARS             = [fields(NXTPackets.TELEMETRY_SAMPLE_EMPTY); {'seq'; 'systickPc'}];
+        
+        % Telemetry subscriptions, see subscribe()
+        SUBSCRIBE_BT_HEADER     = [uint8(NXTPackets.SUBSCRIBE_BT_BYTES), zeros(1, NXTConnection.ECROBOT_HEADER_BYTES-1, 'uint8')];
+        TELEMETRY_SCHEMA_BT_HEADER = [uint8(NXTPackets.TELEMETRY_SCHEMA_BT_BYTES), zeros(1, NXTConnection.ECROBOT_HEADER_BYTES-1, 'uint8')];
+        TELEMETRY_SUB_BT_HEADER = [uint8(NXTPackets.TELEMETRY_SUB_BT_BYTES), zeros(1, NXTConnection.ECROBOT_HEADER_BYTES-1, 'uint8')];
+        
+        % Live joint parameters, see setParameter()
+        PARAM_BT_HEADER         = [uint8(NXTPackets.PARAM_BT_BYTES), zeros(1, NXTConnection.ECROBOT_HEADER_BYTES-1, 'uint8')];
+        PARAM_REPLY_BT_HEADER   = [uint8(NXTPackets.PARAM_REPLY_BT_BYTES), zeros(1, NXTConnection.ECROBOT_HEADER_BYTES-1, 'uint8')];
+        
+        % Clock probes, echoed like pcStamp. Put history and samples on the PC's clock, see clockEchoed().
+        CLOCK_BT_HEADER         = [uint8(NXTPackets.CLOCK_BT_BYTES), zeros(1, NXTConnection.ECROBOT_HEADER_BYTES-1, 'uint8')];
+        CLOCK_PROBE_INTERVAL    = 250;      % ms
+        CLOCK_SYNC_WINDOW       = 16;       % As Timing.c
+        
     end
     
     methods (Access=public, Static=false)
@@ -112,6 +134,8 @@ classdef NXTConnection < handle
                 this.packetsSent = 0;
                 this.packetsReceived = 0;
                 this.lastPCPacket = NXTConnection.PC_BT_EMPTY_PACKET;
+                this.clockOffset = NaN;
+                this.clockExchanges = zeros(0, 2);
 
                 % Preallocate space for history table
                 this.history = struct();
@@ -126,6 +150,21 @@ classdef NXTConnection < handle
                     field = NXTConnection.PC_PACKET_VARS{i};
                     this.history.(field) = repmat(NXTConnection.PC_BT_EMPTY_PACKET.(field), this.tableSize, 1);
                 end
+                
+                % PC times (ms, as pcStamp) of receiving each NXT1_BT, and of its systick
+                this.history.rxStamp = zeros(this.tableSize, 1);
+                this.history.systickPc = zeros(this.tableSize, 1);
+                
+                this.samples = struct();
+                this.lastSampleRow = 0;
+                this.sampleTableSize = NXTConnection.HISTORY_INITIAL_ROWS;
+                this.nextSampleSeq = -1;
+                this.samplesLost = 0;
+                for i=1:length(NXTConnection.SAMPLE_VARS)
+                    field = NXTConnection.SAMPLE_VARS{i};
+                    this.samples.(field) = zeros(this.sampleTableSize, 1);
+                end
+                this.resetSubscribed();
 
                 if ~isempty(this.packetProcessingFcn)
                     processedDataEmptyStruct = this.packetProcessingFcn(NXTConnection.NXT_BT_EMPTY_PACKET);
@@ -154,6 +193,20 @@ classdef NXTConnection < handle
             end
         end
         
+        
+        function tab = writeSamples(this, filename)
+            tab = table();
+            if this.connected == false && this.lastSampleRow >= 1
+                fprintf('Writing %d samples to file: %s (%d lost)\n', this.lastSampleRow, filename, this.samplesLost);
+                for i=1:length(NXTConnection.SAMPLE_VARS)
+                    field = NXTConnection.SAMPLE_VARS{i};
+                    tab.(field) = this.samples.(field)(1:this.lastSampleRow);
+                end
+                writetable(tab, filename);
+                disp('Table written.');
+            end
+        end
+        
                 
         function connected = bluetoothConnect(this, name, channel)
             if ~isempty(this.thread) && strcmp(this.thread.State, 'running')
@@ -236,6 +289,7 @@ classdef NXTConnection < handle
                 connected = this.connected;
                 return;
             end
+            this.stopCapture();
             if this.packetsReceived > 0
                 disconnect_packet = this.lastPCPacket;
                 disconnect_packet.nxtTransmitInterval = 0;    % NXT expects this value on disconnect
@@ -253,12 +307,154 @@ classdef NXTConnection < handle
         function bluetoothSend(this, pcPacket)
             if this.connected == true
                 this.packetsSent = this.packetsSent+1;
+                pcPacket.pcStamp = NXTConnection.pcMs();    % echoed in echoStamp
                 send(this.txQueue, pcPacket);  % send packet to worker thread for transmission
                 this.lastPCPacket = pcPacket;  % will get added to history next time an nxt packet is received
             end
         end
         
         
+        function bluetoothSendWaypoint(this, waypoint)
+            if this.connected == true
+                this.packetsSent = this.packetsSent+1;
+                send(this.txQueue, waypoint);  % not added to history
+            end
+        end
+        
+        
+        % Sends a struct array of knots (WAYPOINT_BT_EMPTY_PACKET fields), NXTPackets.WAYPOINT_BATCH per packet
+        function bluetoothSendWaypoints(this, waypoints)
+            for k = 1:NXTPackets.WAYPOINT_BATCH:numel(waypoints)
+                last = min(k + NXTPackets.WAYPOINT_BATCH - 1, numel(waypoints));
+                this.bluetoothSendWaypoint(struct('waypoints', waypoints(k:last)));
+            end
+        end
+        
+        
+        function tab = writeSubscribed(this, filename)
+            tab = table();
+            if this.connected == false && this.lastSubscribedRow >= 1
+                fprintf('Writing %d records to file: %s (%d lost)\n', this.lastSubscribedRow, filename, this.subscribedLost);
+                varnames = fields(this.subscribed);
+                for i=1:length(varnames)
+                    tab.(varnames{i}) = this.subscribed.(varnames{i})(1:this.lastSubscribedRow);
+                end
+                writetable(tab, filename);
+                disp('Table written.');
+            end
+        end
+        
+        
+        % Ends any subscription and asks NXT1 for its telemetry registry, which arrives in signals
+        function listSignals(this)
+            if this.connected == true
+                send(this.txQueue, struct('decimation', uint8(0), 'ids', uint8([])));
+            end
+        end
+        
+        
+        % Records the named signals (a cell array of names from signals) every decimation TASK_MOTORREG cycles, in
+        % subscribed. Replaces the previous subscription, once NXT1 has described the new one.
+        function subscribe(this, names, decimation)
+            if this.connected == false
+                return;
+            end
+            names = cellstr(names);
+            [found, k] = ismember(names, {this.signals.name});
+            if isempty(this.signals) || ~all(found)
+                error('NXTConnection:subscribe', 'Unknown signals (call listSignals() first): %s', strjoin(names(~found), ', '));
+            end
+            if numel(k) > NXTPackets.TELEMETRY_SUB_MAX
+                error('NXTConnection:subscribe', 'At most %d signals', NXTPackets.TELEMETRY_SUB_MAX);
+            end
+            send(this.txQueue, struct('decimation', uint8(decimation), 'ids', uint8([this.signals(k).id])));
+        end
+        
+        
+        % Asks NXT1 for the staged value of a joint parameter (a name from NXTPackets.PARAM_NAMES) of joint (1-6).
+        % It arrives in parameters.(name)(joint).
+        function getParameter(this, joint, name)
+            if this.connected == true
+                send(this.txQueue, NXTConnection.parameterRequest(NXTPackets.PARAM_GET, joint, name, 0, 0));
+            end
+        end
+        
+        
+        % Stages a joint parameter on NXT1. Nothing changes on the robot until commitParameters().
+        function setParameter(this, joint, name, value)
+            if this.connected == false
+                return;
+            end
+            k = find(strcmp(NXTPackets.PARAM_NAMES, name));
+            if value < NXTPackets.PARAM_MIN(k) || value > NXTPackets.PARAM_MAX(k)
+                error('NXTConnection:setParameter', '%s must be in [%g, %g]', name, NXTPackets.PARAM_MIN(k), NXTPackets.PARAM_MAX(k));
+            end
+            send(this.txQueue, NXTConnection.parameterRequest(NXTPackets.PARAM_SET, joint, name, value, 0));
+        end
+        
+        
+        % Switches all three NXTs to the staged parameters, as version (1-65535), at the same TASK_MOTORREG cycle.
+        % commitResult is 'pending' until NXT2 and NXT3 have accepted, then 'ok' (the switch follows shortly) or 'failed'.
+        function commitParameters(this, version)
+            if this.connected == true
+                this.commitResult = 'pending';
+                send(this.txQueue, NXTConnection.parameterRequest(NXTPackets.PARAM_COMMIT, 1, NXTPackets.PARAM_NAMES{1}, 0, version));
+            end
+        end
+        
+        
+        % Sends a CLOCK_BT probe. bluetoothReceived() does every CLOCK_PROBE_INTERVAL.
+        function syncClock(this)
+            if this.connected == true
+                probe = NXTPackets.CLOCK_BT_EMPTY;
+                probe.pcStamp = NXTConnection.pcMs();
+                this.lastClockProbe = double(probe.pcStamp);
+                send(this.txQueue, probe);
+            end
+        end
+        
+        
+        % PC time (ms, as pcStamp) of NXT1's systick, NaN until a probe was echoed
+        function ms = toPcMs(this, systick)
+            ms = mod(double(systick) - this.clockOffset, 2^32);
+        end
+        
+        
+        % Starts an RS485 bus capture on NXT1, written to filename as it arrives
+        function started = startCapture(this, filename)
+            started = false;
+            if this.connected == false
+                return;
+            end
+            this.stopCapture();
+            this.captureFile = fopen(filename, 'w');
+            if this.captureFile < 0
+                fprintf('Cannot open capture file: %s\n', filename);
+                return;
+            end
+            this.captureBytes = 0;
+            cmd = NXTPackets.CAPTURE_CMD_BT_EMPTY;
+            cmd.capture = uint8(1);
+            send(this.txQueue, cmd);
+            started = true;
+        end
+        
+        
+        % Stops the capture, waits for the rest of NXT1's buffer and closes the file
+        function stopCapture(this)
+            if this.captureFile < 0
+                return;
+            end
+            if this.connected == true
+                send(this.txQueue, NXTPackets.CAPTURE_CMD_BT_EMPTY);
+                pause(NXTConnection.CAPTURE_DRAIN_TIME);
+            end
+            fclose(this.captureFile);
+            this.captureFile = -1;
+            fprintf('Capture closed, %d bytes.\n', this.captureBytes);
+        end
+        
+        
     end      % end of public methods
     
     methods (Access=private, Static=false)
@@ -266,6 +462,27 @@ classdef NXTConnection < handle
         function bluetoothReceived(this, returnData) % called when background worker gets new data
             persistent PROCESSED_DATA_VARS;
             
+            if isfield(returnData, 'capture')   % RS485 bus capture, not telemetry
+                this.captureReceived(returnData.capture);
+                return;
+            end
+            if isfield(returnData, 'samples')   % Batch of TASK_MOTORREG samples
+                this.samplesReceived(returnData.samples);
+                return;
+            end
+            if isfield(returnData, 'schema')    % Description of the registry or of a subscription
+                this.schemaReceived(returnData.schema);
+                return;
+            end
+            if isfield(returnData, 'subscribed')    % Records of the subscription
+                this.subscribedReceived(returnData.subscribed);
+                return;
+            end
+            if isfield(returnData, 'paramReply')    % Answer to getParameter(), setParameter() or commitParameters()
+                this.parameterReplied(returnData.paramReply);
+                return;
+            end
+            
             if isempty(PROCESSED_DATA_VARS)
                 PROCESSED_DATA_VARS = fields(returnData.processed);
             end
@@ -285,6 +502,10 @@ classdef NXTConnection < handle
                 this.history.(field)(this.lastRow) = this.lastPCPacket.(field);
             end
             
+            this.clockEchoed(returnData.nxt, returnData.rxStamp);
+            this.history.rxStamp(this.lastRow) = returnData.rxStamp;
+            this.history.systickPc(this.lastRow) = this.toPcMs(returnData.nxt.systick);
+            
             for i=1:length(PROCESSED_DATA_VARS)
                 field = PROCESSED_DATA_VARS{i};
                 this.history.(field)(this.lastRow) = returnData.processed.(field);
@@ -306,6 +527,168 @@ classdef NXTConnection < handle
             end
         end
         
+        
+        function captureReceived(this, payload)  % payload: [uint32 stream position][capture bytes]
+            if this.captureFile < 0
+                return;
+            end
+            pos = double(typecast(payload(1:4), 'uint32'));
+            fseek(this.captureFile, pos, 'bof');
+            fwrite(this.captureFile, payload(5:end), 'uint8');
+            this.captureBytes = max(this.captureBytes, pos + NXTPackets.CAPTURE_BT_DATA);
+        end
+        
+        
+        function samplesReceived(this, samples)  % samples: struct array of consecutive samples, from decodeSamples()
+            if this.nextSampleSeq >= 0
+                this.samplesLost = this.samplesLost + mod(samples(1).seq - this.nextSampleSeq, 65536);
+            end
+            this.nextSampleSeq = mod(samples(end).seq + 1, 65536);
+            
+            if this.lastSampleRow + numel(samples) > this.sampleTableSize
+                this.sampleTableSize = this.sampleTableSize + NXTConnection.HISTORY_SIZE_INCREMENT;
+                for i=1:length(NXTConnection.SAMPLE_VARS)
+                    this.samples.(NXTConnection.SAMPLE_VARS{i})(this.sampleTableSize) = 0;
+                end
+            end
+            for k=1:numel(samples)
+                samples(k).systickPc = this.toPcMs(samples(k).systick);
+                this.lastSampleRow = this.lastSampleRow+1;
+                for i=1:length(NXTConnection.SAMPLE_VARS)
+                    field = NXTConnection.SAMPLE_VARS{i};
+                    this.samples.(field)(this.lastSampleRow) = samples(k).(field);
+                end
+            end
+        end
+        
+        
+        function resetSubscribed(this)
+            this.subscribed = struct();
+            this.lastSubscribedRow = 0;
+            this.subscribedTableSize = NXTConnection.HISTORY_INITIAL_ROWS;
+            this.nextSubscribedSeq = -1;
+            this.subscribedLost = 0;
+            for i=1:numel(this.subscription.names)
+                this.subscribed.(matlab.lang.makeValidName(this.subscription.names{i})) = zeros(this.subscribedTableSize, 1);
+            end
+            this.subscribed.seq = zeros(this.subscribedTableSize, 1);
+        end
+        
+        
+        function schemaReceived(this, payload)  % payload: TELEMETRY_SCHEMA_BT
+            header = NXTPackets.decodeTelemetrySchema(payload(1:NXTPackets.TELEMETRY_SCHEMA_BYTES));
+            entries = struct('id', {}, 'name', {}, 'type', {});
+            for k = 1:min(NXTPackets.TELEMETRY_SCHEMA_ENTRIES, double(header.total) - double(header.first))
+                offset = NXTPackets.TELEMETRY_SCHEMA_BYTES + (k-1)*NXTPackets.TELEMETRY_SCHEMA_ENTRY_BYTES;
+                entries(k).id = double(payload(offset+1));
+                entries(k).type = double(payload(offset+2));
+                entries(k).name = deblank(char(payload(offset+3 : offset+2+NXTPackets.TELEMETRY_NAME_CHARS)));
+            end
+            rows = double(header.first) + (1:numel(entries));
+            
+            if header.layout == 0       % The registry
+                if header.first == 0
+                    this.signals = entries;
+                else
+                    this.signals(rows) = entries;
+                end
+                return;
+            end
+            if header.layout ~= this.subscription.layout
+                this.subscription = struct('layout', double(header.layout), 'decimation', double(header.decimation), ...
+                    'total', double(header.total), 'names', {{}}, 'types', []);
+            end
+            this.subscription.names(rows) = {entries.name};
+            this.subscription.types(rows) = [entries.type];
+            if numel(this.subscription.names) == this.subscription.total    % Described in full: start recording
+                this.resetSubscribed();
+                fprintf('Subscribed to %d signals every %d cycles.\n', this.subscription.total, this.subscription.decimation);
+            end
+        end
+        
+        
+        function parameterReplied(this, reply)  % reply: decoded PARAM_REPLY_BT
+            result = NXTPackets.PARAM_RESULTS{double(reply.result)+1};
+            if reply.op == NXTPackets.PARAM_COMMIT
+                this.commitResult = result;
+                if ~any(strcmp(result, {'ok', 'pending'}))
+                    fprintf('Commit of parameter version %d: %s\n', reply.version, result);
+                end
+                return;
+            end
+            this.parameterVersion = double(reply.version);
+            if reply.joint >= 6 || reply.param >= numel(NXTPackets.PARAM_NAMES)
+                return;
+            end
+            name = NXTPackets.PARAM_NAMES{double(reply.param)+1};
+            if ~isfield(this.parameters, name)
+                this.parameters.(name) = NaN(1, 6);
+            end
+            this.parameters.(name)(double(reply.joint)+1) = reply.value;
+            if ~strcmp(result, 'ok')
+                fprintf('Parameter %s of joint %d: %s\n', name, double(reply.joint)+1, result);
+            end
+        end
+        
+        
+        function subscribedReceived(this, payload)  % payload: TELEMETRY_SUB_BT
+            frame = NXTPackets.decodeTelemetrySub(payload(1:NXTPackets.TELEMETRY_SUB_BYTES));
+            if frame.layout ~= this.subscription.layout || numel(this.subscription.names) ~= this.subscription.total
+                return;     % Not described yet, or of a subscription since replaced
+            end
+            if this.nextSubscribedSeq >= 0
+                this.subscribedLost = this.subscribedLost + mod(double(frame.seq) - this.nextSubscribedSeq, 65536);
+            end
+            this.nextSubscribedSeq = mod(double(frame.seq) + double(frame.count), 65536);
+            
+            varnames = cellfun(@matlab.lang.makeValidName, this.subscription.names, 'UniformOutput', false);
+            if this.lastSubscribedRow + double(frame.count) > this.subscribedTableSize
+                this.subscribedTableSize = this.subscribedTableSize + NXTConnection.HISTORY_SIZE_INCREMENT;
+                for i=1:numel(varnames)
+                    this.subscribed.(varnames{i})(this.subscribedTableSize) = 0;
+                end
+                this.subscribed.seq(this.subscribedTableSize) = 0;
+            end
+            offset = NXTPackets.TELEMETRY_SUB_BYTES;
+            for k = 1:double(frame.count)
+                this.lastSubscribedRow = this.lastSubscribedRow+1;
+                for i=1:numel(varnames)
+                    type = NXTPackets.TELEMETRY_TYPES{this.subscription.types(i)+1};
+                    if strcmp(type, 'fix16')
+                        value = fix16_to_dbl(typecast(payload(offset+1 : offset+4), 'int32'));
+                        offset = offset + 4;
+                    else
+                        bytes = numel(typecast(zeros(1, 1, type), 'uint8'));
+                        value = double(typecast(payload(offset+1 : offset+bytes), type));
+                        offset = offset + bytes;
+                    end
+                    this.subscribed.(varnames{i})(this.lastSubscribedRow) = value;
+                end
+                this.subscribed.seq(this.lastSubscribedRow) = mod(double(frame.seq) + k-1, 65536);
+            end
+        end
+        
+        
+        % Cristian's algorithm with NTP's correction for the time NXT1 holds the echo, on an NXT1_BT received at PC
+        % time rxStamp. Each echo of pcStamp gives offset = ((t2 - t1) + (t3 - t4)) / 2, off by at most half the
+        % delay (t4 - t1) - (t3 - t2), so as Timing.c does over RS485, the echo with the least delay of the latest
+        % CLOCK_SYNC_WINDOW sets clockOffset. Both clocks are ms modulo 2^32. Sends the next probe when it is due.
+        function clockEchoed(this, nxtPacket, rxStamp)
+            if nxtPacket.echoStamp ~= 0
+                t1 = double(nxtPacket.echoStamp);   t2 = double(nxtPacket.echoRxMs);
+                t4 = double(rxStamp);               t3 = double(nxtPacket.txMs);
+                wrap = @(ms) mod(ms + 2^31, 2^32) - 2^31;
+                delay = wrap(t4 - t1) - wrap(t3 - t2);
+                offset = mod(t2 - t1 - delay/2, 2^32);
+                this.clockExchanges = [this.clockExchanges(max(1, end-NXTConnection.CLOCK_SYNC_WINDOW+2):end, :); offset, delay];
+                [~, best] = min(this.clockExchanges(:, 2));
+                this.clockOffset = this.clockExchanges(best, 1);
+            end
+            if mod(double(rxStamp) - this.lastClockProbe, 2^32) >= NXTConnection.CLOCK_PROBE_INTERVAL
+                this.syncClock();
+            end
+        end
+        
     end     % end of private methods
     
     
@@ -339,7 +722,28 @@ classdef NXTConnection < handle
             % RX - readPacket called in this loop to clear the RX buffer as asap as possible
             while ~isempty(nxt) && strcmp(nxt.Status, 'open')
 
-                returnData.nxt = NXTConnection.readPacket();  % uses global nxt variable
+                [returnData.nxt, capture, samples, schema, subscribed, paramReply] = NXTConnection.readPacket();  % uses global nxt variable
+                returnData.rxStamp = NXTConnection.pcMs();
+                if ~isempty(capture)
+                    send(rxQueue, struct('capture', capture));
+                    continue;
+                end
+                if ~isempty(schema)
+                    send(rxQueue, struct('schema', schema));
+                    continue;
+                end
+                if ~isempty(subscribed)
+                    send(rxQueue, struct('subscribed', subscribed));
+                    continue;
+                end
+                if ~isempty(paramReply)
+                    send(rxQueue, struct('paramReply', paramReply));
+                    continue;
+                end
+                if ~isempty(samples)
+                    send(rxQueue, struct('samples', {samples}));
+                    continue;
+                end
                 
                 % Process the incoming packet using the provided function handle
                 if isempty(packetProcessingFcn)
@@ -354,50 +758,115 @@ classdef NXTConnection < handle
         end
         
         
-        function nxtPacket = readPacket()
+        function [nxtPacket, capture, samples, schema, subscribed, paramReply] = readPacket()  % capture, schema, subscribed: payload of that packet. samples, paramReply: decoded packet. Empty unless that is what arrived.
             global conQueue;
             global nxt;
             
+            nxtPacket = struct();
+            capture = uint8([]);
+            samples = struct([]);
+            schema = uint8([]);
+            subscribed = uint8([]);
+            paramReply = struct([]);
             if ~isempty(nxt) && strcmp(nxt.Status, 'open')
                 
-                % read bytes until the header is consumed
-                header = uint8([]);
-                while isempty(strfind(header, NXTConnection.NXT_BT_HEADER))
-                    header = [header, uint8(fread(nxt, 1, 'uint8'))];
+                % read bytes until a header is consumed. Its length tells telemetry, samples and capture apart.
+                header = uint8(fread(nxt, NXTConnection.ECROBOT_HEADER_BYTES, 'uint8'))';
+                while ~isequal(header, NXTConnection.NXT_BT_HEADER) && ~isequal(header, NXTConnection.CAPTURE_BT_HEADER) ...
+                        && ~isequal(header, NXTConnection.TELEMETRY_BT_HEADER) && ~isequal(header, NXTConnection.TELEMETRY_Z_BT_HEADER) ...
+                        && ~isequal(header, NXTConnection.TELEMETRY_SCHEMA_BT_HEADER) && ~isequal(header, NXTConnection.TELEMETRY_SUB_BT_HEADER) ...
+                        && ~isequal(header, NXTConnection.PARAM_REPLY_BT_HEADER)
+                    header = [header(2:end), uint8(fread(nxt, 1, 'uint8'))];
                 end
 
                 % Read rest of packet from bluetooth
+                if isequal(header, NXTConnection.CAPTURE_BT_HEADER)
+                    capture = uint8(fread(nxt, NXTPackets.CAPTURE_BT_BYTES, 'uint8'))';
+                    return;
+                end
+                if isequal(header, NXTConnection.TELEMETRY_BT_HEADER)
+                    samples = NXTConnection.decodeSamples(uint8(fread(nxt, NXTPackets.TELEMETRY_BT_BYTES, 'uint8'))');
+                    return;
+                end
+                if isequal(header, NXTConnection.TELEMETRY_Z_BT_HEADER)
+                    samples = NXTConnection.decodeSamplesZ(uint8(fread(nxt, NXTPackets.TELEMETRY_Z_BT_BYTES, 'uint8'))');
+                    return;
+                end
+                if isequal(header, NXTConnection.TELEMETRY_SCHEMA_BT_HEADER)
+                    schema = uint8(fread(nxt, NXTPackets.TELEMETRY_SCHEMA_BT_BYTES, 'uint8'))';
+                    return;
+                end
+                if isequal(header, NXTConnection.TELEMETRY_SUB_BT_HEADER)
+                    subscribed = uint8(fread(nxt, NXTPackets.TELEMETRY_SUB_BT_BYTES, 'uint8'))';
+                    return;
+                end
+                if isequal(header, NXTConnection.PARAM_REPLY_BT_HEADER)
+                    paramReply = NXTPackets.decodeParamReplyBt(uint8(fread(nxt, NXTPackets.PARAM_REPLY_BT_BYTES, 'uint8'))');
+                    return;
+                end
                 payload = uint8(fread(nxt, NXTConnection.NXT_BT_PACKET_BYTES, 'uint8'));
 
-                % Parse payload bytes into storage format and place in table
-                offset = 1;
-                nxtPacket = NXTConnection.NXT_BT_EMPTY_PACKET;
-                nxtPacket.systick       = uint32(       typecast(payload(offset:offset+4-1),'uint32') ); offset=offset+4;
-                nxtPacket.j1p           = fix16_to_dbl( typecast(payload(offset:offset+4-1),'int32' ) ); offset=offset+4;
-                nxtPacket.j1v           = fix16_to_dbl(	typecast(payload(offset:offset+4-1),'int32' ) ); offset=offset+4;
-                nxtPacket.j1pwm         = int8(         typecast(payload(offset:offset+1-1),'int8'  ) ); offset=offset+1;
-                nxtPacket.j2p           = fix16_to_dbl( typecast(payload(offset:offset+4-1),'int32' ) ); offset=offset+4;
-                nxtPacket.j2v           = fix16_to_dbl( typecast(payload(offset:offset+4-1),'int32' ) ); offset=offset+4;
-                nxtPacket.j2pwm         = int8(         typecast(payload(offset:offset+1-1),'int8'  ) ); offset=offset+1;
-                nxtPacket.j3p           = fix16_to_dbl( typecast(payload(offset:offset+4-1),'int32' ) ); offset=offset+4; 
-                nxtPacket.j3v           = fix16_to_dbl( typecast(payload(offset:offset+4-1),'int32' ) ); offset=offset+4;
-                nxtPacket.j3pwm         = int8(         typecast(payload(offset:offset+1-1),'int8'  ) ); offset=offset+1;
-                nxtPacket.j4p           = fix16_to_dbl( typecast(payload(offset:offset+4-1),'int32' ) ); offset=offset+4;
-                nxtPacket.j4v           = fix16_to_dbl( typecast(payload(offset:offset+4-1),'int32' ) ); offset=offset+4;
-                nxtPacket.j4pwm         = int8(         typecast(payload(offset:offset+1-1),'int8'  ) ); offset=offset+1;
-                nxtPacket.j5p           = fix16_to_dbl( typecast(payload(offset:offset+4-1),'int32' ) ); offset=offset+4;
-                nxtPacket.j5v           = fix16_to_dbl( typecast(payload(offset:offset+4-1),'int32' ) ); offset=offset+4;
-                nxtPacket.j5pwm         = int8(         typecast(payload(offset:offset+1-1),'int8'  ) ); offset=offset+1;
-                nxtPacket.j6p           = fix16_to_dbl( typecast(payload(offset:offset+4-1),'int32' ) ); offset=offset+4;
-                nxtPacket.j6v           = fix16_to_dbl( typecast(payload(offset:offset+4-1),'int32' ) ); offset=offset+4;
-                nxtPacket.j6pwm         = int8(         typecast(payload(offset:offset+1-1),'int8'  ) ); offset=offset+1;
-                nxtPacket.tmux          = uint8(        typecast(payload(offset:offset+1-1),'uint8' ) ); offset=offset+1;
-                nxtPacket.ea1           = double(       typecast(payload(offset:offset+1-1),'uint8' ) ); offset=offset+1;
-                nxtPacket.ea2           = double(       typecast(payload(offset:offset+1-1),'uint8' ) ); offset=offset+1;
-                nxtPacket.ea3           = double(       typecast(payload(offset:offset+1-1),'uint8' ) ); offset=offset+1;
-            else
-                nxtPacket = struct();
+                % Parse payload bytes into storage format
+                nxtPacket = NXTPackets.decodeNxt1Bt(payload);
+            end
+        end
+        
+        
+        function samples = decodeSamples(payload)  % TELEMETRY_BT payload -> struct array of its samples, with seq added
+            frame = NXTPackets.decodeTelemetryFrame(payload(1:NXTPackets.TELEMETRY_FRAME_BYTES));
+            samples = struct([]);
+            for k = 1:min(double(frame.count), NXTPackets.TELEMETRY_BATCH)
+                offset = NXTPackets.TELEMETRY_FRAME_BYTES + (k-1)*NXTPackets.TELEMETRY_SAMPLE_BYTES;
+                sample = NXTPackets.decodeTelemetrySample(payload(offset+1 : offset+NXTPackets.TELEMETRY_SAMPLE_BYTES));
+                sample.seq = mod(double(frame.seq) + k-1, 65536);
+                samples = [samples, sample]; %#ok<AGROW>
+            end
+        end
+        
+        
+        function samples = decodeSamplesZ(payload)  % TELEMETRY_Z_BT payload -> struct array of its samples, with seq added
+            frame = NXTPackets.decodeTelemetryFrame(payload(1:NXTPackets.TELEMETRY_FRAME_BYTES));
+            pos = NXTPackets.TELEMETRY_FRAME_BYTES;
+            wire = payload(pos+1 : pos+NXTPackets.TELEMETRY_SAMPLE_BYTES);     % First sample whole
+            pos = pos + NXTPackets.TELEMETRY_SAMPLE_BYTES;
+            samples = struct([]);
+            for k = 1:min(double(frame.count), NXTPackets.TELEMETRY_Z_MAX)
+                if k > 1    % Each field: zig-zag varint of its difference from the previous sample, mod 2^bits
+                    offset = 0;
+                    for n = NXTPackets.TELEMETRY_SAMPLE_FIELD_BYTES
+                        z = 0;
+                        shift = 0;
+                        while true
+                            pos = pos + 1;
+                            z = z + bitand(double(payload(pos)), 127) * 2^shift;
+                            shift = shift + 7;
+                            if payload(pos) < 128, break; end
+                        end
+                        if mod(z, 2) == 0, d = z/2; else, d = -(z+1)/2; end
+                        value = sum(double(wire(offset+1 : offset+n)) .* 256.^(0:n-1));
+                        value = mod(value + d, 256^n);
+                        wire(offset+1 : offset+n) = uint8(mod(floor(value ./ 256.^(0:n-1)), 256));
+                        offset = offset + n;
+                    end
+                end
+                sample = NXTPackets.decodeTelemetrySample(wire);
+                sample.seq = mod(double(frame.seq) + k-1, 65536);
+                samples = [samples, sample]; %#ok<AGROW>
+            end
+        end
+        
+        
+        function request = parameterRequest(op, joint, name, value, version)   % PARAM_BT fields, joint 1-6
+            k = find(strcmp(NXTPackets.PARAM_NAMES, name));
+            if isempty(k)
+                error('NXTConnection:parameter', 'Unknown parameter %s. See NXTPackets.PARAM_NAMES.', name);
             end
+            request = NXTPackets.PARAM_BT_EMPTY;
+            request.op = uint8(op);
+            request.joint = uint8(joint - 1);
+            request.param = uint8(k - 1);
+            request.value = value;
+            request.version = uint16(version);
         end
         
         
@@ -405,26 +874,34 @@ classdef NXTConnection < handle
             global conQueue;
             global nxt;
             
-            if ~isempty(nxt) && strcmp(nxt.Status, 'open')
+            if ~isempty(nxt) && strcmp(nxt.Status, 'open') && isfield(pcPacket, 'waypoints')
+                payload = zeros(1, NXTPackets.WAYPOINT_BATCH_BT_BYTES, 'uint8');
+                payload(1) = numel(pcPacket.waypoints);
+                for k = 1:numel(pcPacket.waypoints)
+                    offset = 1 + (k-1)*NXTPackets.WAYPOINT_BT_BYTES;
+                    payload(offset+1 : offset+NXTPackets.WAYPOINT_BT_BYTES) = NXTPackets.encodeWaypointBt(pcPacket.waypoints(k));
+                end
+                fwrite(nxt, [NXTConnection.WAYPOINT_BATCH_BT_HEADER, payload]);
+            elseif ~isempty(nxt) && strcmp(nxt.Status, 'open') && isfield(pcPacket, 'jointMask')
+                payload = NXTPackets.encodeWaypointBt(pcPacket);
+                fwrite(nxt, [NXTConnection.WAYPOINT_BT_HEADER, payload]);
+            elseif ~isempty(nxt) && strcmp(nxt.Status, 'open') && isfield(pcPacket, 'ids')
+                payload = zeros(1, NXTPackets.SUBSCRIBE_BT_BYTES, 'uint8');
+                payload(1:NXTPackets.SUBSCRIBE_BYTES) = NXTPackets.encodeSubscribe(struct('decimation', pcPacket.decimation, 'count', numel(pcPacket.ids)));
+                payload(NXTPackets.SUBSCRIBE_BYTES + (1:numel(pcPacket.ids))) = pcPacket.ids;
+                fwrite(nxt, [NXTConnection.SUBSCRIBE_BT_HEADER, payload]);
+            elseif ~isempty(nxt) && strcmp(nxt.Status, 'open') && isfield(pcPacket, 'op')
+                payload = NXTPackets.encodeParamBt(pcPacket);
+                fwrite(nxt, [NXTConnection.PARAM_BT_HEADER, payload]);
+            elseif ~isempty(nxt) && strcmp(nxt.Status, 'open') && isfield(pcPacket, 'capture')
+                payload = NXTPackets.encodeCaptureCmdBt(pcPacket);
+                fwrite(nxt, [NXTConnection.CAPTURE_CMD_BT_HEADER, payload]);
+            elseif ~isempty(nxt) && strcmp(nxt.Status, 'open') && ~isfield(pcPacket, 'nxtTransmitInterval')   % CLOCK_BT
+                payload = NXTPackets.encodeClockBt(pcPacket);
+                fwrite(nxt, [NXTConnection.CLOCK_BT_HEADER, payload]);
+            elseif ~isempty(nxt) && strcmp(nxt.Status, 'open')
                 %send(conQueue, 'Sending packet...');
-                payload = zeros(1, NXTConnection.PC_BT_PACKET_BYTES, 'uint8');
-
-                %Convert commands into robot-compatible values and insert into packet
-                offset = 1;
-                payload(offset:offset+4-1) = typecast(fix16_from_dbl(pcPacket.j1pt),	'uint8');	offset=offset+4;
-                payload(offset:offset+4-1) = typecast(fix16_from_dbl(pcPacket.j1vt),	'uint8');	offset=offset+4;
-                payload(offset:offset+4-1) = typecast(fix16_from_dbl(pcPacket.j2pt),	'uint8');	offset=offset+4;
-                payload(offset:offset+4-1) = typecast(fix16_from_dbl(pcPacket.j2vt),	'uint8');	offset=offset+4;
-                payload(offset:offset+4-1) = typecast(fix16_from_dbl(pcPacket.j3pt),	'uint8');	offset=offset+4;
-                payload(offset:offset+4-1) = typecast(fix16_from_dbl(pcPacket.j3vt),	'uint8');	offset=offset+4;
-                payload(offset:offset+4-1) = typecast(fix16_from_dbl(pcPacket.j4pt),	'uint8');	offset=offset+4;
-                payload(offset:offset+4-1) = typecast(fix16_from_dbl(pcPacket.j4vt),	'uint8');	offset=offset+4;
-                payload(offset:offset+4-1) = typecast(fix16_from_dbl(pcPacket.j5pt),	'uint8');	offset=offset+4;
-                payload(offset:offset+4-1) = typecast(fix16_from_dbl(pcPacket.j5vt),	'uint8');	offset=offset+4;
-                payload(offset:offset+4-1) = typecast(fix16_from_dbl(pcPacket.j6pt),	'uint8');	offset=offset+4;
-                payload(offset:offset+4-1) = typecast(fix16_from_dbl(pcPacket.j6vt),	'uint8');	offset=offset+4;
-                payload(offset:offset+1-1) = typecast(uint8(pcPacket.rcx),            'uint8');     offset=offset+1;
-                payload(offset:offset+2-1) = typecast(uint16(pcPacket.nxtTransmitInterval), 'uint8');	offset=offset+2;
+                payload = NXTPackets.encodePcBt(pcPacket);
                 %send(conQueue, payload);
 
                 % Attach header and send over bluetooth
@@ -441,6 +918,11 @@ classdef NXTConnection < handle
         end
         
         
+        function ms = pcMs()     % PC time in ms, modulo 2^32, as pcStamp. Never 0, which is unstamped.
+            ms = uint32(max(1, mod(round(now*86400000), 2^32)));
+        end
+        
+        
         function nxt = connect(bluetoothName, bluetoothChannel)      
             global conQueue;
             
@@ -0,0 +1,211 @@
+classdef NXTLink < handle
+    % Bluetooth link to NXT1 through libnxtlink.so (RA15_Host/src/Link/nxt_link_api.h), for Linux. Receiving and
+    % logging run in the library's own threads rather than in a parfeval worker, and everything NXT1 sends goes to
+    % column logs in logDir (see LinkRecorder.h), which readLog() reads back. Build the library with: make link
+    %
+    %   nxt = NXTLink('/dev/rfcomm0', 'logs');
+    %   nxt.listSignals(); pause(1); nxt.subscribe({'j1_p', 'rs_err'}, 1);
+    %   pause(10); disp(nxt.stats()); nxt.close();
+    %   samples = NXTLink.readLog('logs/samples.ra15log');
+
+    properties (SetAccess = private)
+        handle                  = []        % lib.pointer to the nxt_link
+    end
+
+    properties (Constant)
+        LIBRARY                 = 'libnxtlink'
+        LOG_MAGIC               = 'RA15LOG1'
+        LOG_TYPES               = {'uint8', 'int8', 'uint16', 'int16', 'uint32', 'int32', 'int32', 'int64'}  % LogType. fix16 (7th) is its raw int32.
+        LOG_FIX16               = 6
+        LOG_HEADER_BYTES        = 40        % sizeof(LogHeader)
+        LOG_ENTRY_BYTES         = 32        % sizeof(LogColumnEntry)
+    end
+
+    methods
+
+        function this = NXTLink(device, logDir)
+            if nargin < 2
+                logDir = '';
+            end
+            NXTLink.load();
+            this.handle = calllib(NXTLink.LIBRARY, 'nxt_link_open', device, logDir);
+            if isNull(this.handle)
+                this.handle = [];
+                error('NXTLink:open', '%s', calllib(NXTLink.LIBRARY, 'nxt_link_error'));
+            end
+        end
+
+
+        function delete(this)
+            this.close();
+        end
+
+
+        % Sends the disconnect packet if targets were sent, and closes the logs and the connection
+        function close(this)
+            if ~isempty(this.handle)
+                calllib(NXTLink.LIBRARY, 'nxt_link_close', this.handle);
+                this.handle = [];
+            end
+        end
+
+
+        function s = stats(this)
+            [~, ~, s] = calllib(NXTLink.LIBRARY, 'nxt_link_get_stats', this.handle, struct());
+        end
+
+
+        % Latest NXT1_BT: systick (ms), p (deg), v (deg/s), pwm
+        function j = joints(this)
+            [result, ~, j] = calllib(NXTLink.LIBRARY, 'nxt_link_get_joints', this.handle, struct());
+            this.check(result);
+        end
+
+
+        % PC_BT. pt and vt are 1x6 (deg, deg/s); NaN is DISABLE_PT/DISABLE_VT.
+        function sendTargets(this, pt, vt, intervalMs, compress)
+            if nargin < 4, intervalMs = 100; end
+            if nargin < 5, compress = false; end
+            this.check(calllib(NXTLink.LIBRARY, 'nxt_link_send_targets', this.handle, pt, vt, uint16(intervalMs), uint8(compress)));
+        end
+
+
+        % Ends any subscription and asks NXT1 for its telemetry registry. signals() has it once it arrived.
+        function listSignals(this)
+            this.check(calllib(NXTLink.LIBRARY, 'nxt_link_list_signals', this.handle));
+        end
+
+
+        % Names and types (NXTPackets.TELEMETRY_TYPES index - 1) of the registry, or empty until it arrived
+        function [names, types] = signals(this)
+            count = calllib(NXTLink.LIBRARY, 'nxt_link_signal_count', this.handle);
+            names = cell(1, max(count, 0));
+            types = zeros(1, max(count, 0));
+            for k = 1:count
+                [result, ~, name, type] = calllib(NXTLink.LIBRARY, 'nxt_link_signal', this.handle, k-1, blanks(NXTPackets.TELEMETRY_NAME_CHARS+1), 0);
+                this.check(result);
+                names{k} = deblank(name);
+                types(k) = type;
+            end
+        end
+
+
+        % Records the named signals every decimation TASK_MOTORREG cycles, in sub<layout>.ra15log
+        function subscribe(this, names, decimation)
+            this.check(calllib(NXTLink.LIBRARY, 'nxt_link_subscribe', this.handle, strjoin(cellstr(names), ','), decimation));
+        end
+
+
+        % PARAM_BT request: op is NXTPackets.PARAM_GET/SET/COMMIT, joint 1-6, name from NXTPackets.PARAM_NAMES
+        function parameter(this, op, joint, name, value, version)
+            if nargin < 5, value = 0; end
+            if nargin < 6, version = 0; end
+            k = find(strcmp(NXTPackets.PARAM_NAMES, name));
+            if isempty(k)
+                error('NXTLink:parameter', 'Unknown parameter %s. See NXTPackets.PARAM_NAMES.', name);
+            end
+            this.check(calllib(NXTLink.LIBRARY, 'nxt_link_param', this.handle, op, joint-1, k-1, value, version));
+        end
+
+
+        % Latest PARAM_REPLY_BT, with result as in NXTPackets.PARAM_RESULTS, and how many have arrived
+        function [reply, replies] = parameterReply(this)
+            [result, ~, reply, replies] = calllib(NXTLink.LIBRARY, 'nxt_link_get_param_reply', this.handle, struct(), uint64(0));
+            this.check(result);
+            reply.result = NXTPackets.PARAM_RESULTS{double(reply.result)+1};
+        end
+
+
+        % Estimate of NXT1's clock (see ClockSync.h): offset_ms (systick - the PC's clock at host_ns), drift_ppm,
+        % delay_ms and exchanges. Fails until the first clock probe was echoed.
+        function c = clock(this)
+            [result, ~, c] = calllib(NXTLink.LIBRARY, 'nxt_link_get_clock', this.handle, struct());
+            this.check(result);
+        end
+
+
+        % PC time of NXT1's systick, ns on the clock of host_ns in the logs (see nowNs())
+        function ns = toHostNs(this, systick)
+            [result, ~, ns] = calllib(NXTLink.LIBRARY, 'nxt_link_to_host_ns', this.handle, uint32(systick), int64(0));
+            this.check(result);
+        end
+
+    end
+
+
+    methods (Static)
+
+        % The PC's clock of host_ns and nxt_host_ns in the logs, ns
+        function ns = nowNs()
+            NXTLink.load();
+            ns = calllib(NXTLink.LIBRARY, 'nxt_link_now_ns');
+        end
+
+
+        % Columns of a column log (ColumnLog.h) as a struct of column vectors. fix16 columns are converted to double.
+        % Only the rows of the blocks written so far are read, so a log still being written can be read.
+        function columns = readLog(filename)
+            f = fopen(filename, 'r', 'ieee-le');
+            if f < 0
+                error('NXTLink:readLog', 'Cannot open %s', filename);
+            end
+            cleanup = onCleanup(@() fclose(f));
+            magic = fread(f, 8, '*char')';
+            if ~strcmp(magic, NXTLink.LOG_MAGIC)
+                error('NXTLink:readLog', '%s is not an RA15 column log', filename);
+            end
+            header = fread(f, 6, 'uint32');     % version, header_bytes, block_rows, block_bytes, columns, reserved
+            rows = double(fread(f, 1, 'uint64'));
+            headerBytes = header(2); blockRows = header(3); blockBytes = header(4);
+
+            columns = struct();
+            for c = 1:header(5)
+                fseek(f, NXTLink.LOG_HEADER_BYTES + (c-1)*NXTLink.LOG_ENTRY_BYTES, 'bof');
+                name = deblank(fread(f, 24, '*char')');
+                type = fread(f, 1, 'uint8');
+                fseek(f, 3, 'cof');
+                offset = fread(f, 1, 'uint32');
+
+                values = zeros(rows, 1);
+                for b = 0:ceil(rows / blockRows)-1
+                    n = min(blockRows, rows - b*blockRows);
+                    fseek(f, headerBytes + b*blockBytes + offset, 'bof');
+                    values(b*blockRows + (1:n)) = fread(f, n, NXTLink.LOG_TYPES{type+1});
+                end
+                if type == NXTLink.LOG_FIX16
+                    values = values / 65536;
+                end
+                columns.(matlab.lang.makeValidName(name)) = values;
+            end
+        end
+
+    end
+
+
+    methods (Access = private)
+
+        function check(this, result)
+            if result ~= 0
+                error('NXTLink:call', '%s', calllib(NXTLink.LIBRARY, 'nxt_link_error'));
+            end
+            if isempty(this.handle)
+                error('NXTLink:call', 'Link closed');
+            end
+        end
+
+    end
+
+
+    methods (Access = private, Static)
+
+        function load()
+            if ~libisloaded(NXTLink.LIBRARY)
+                host = fullfile(fileparts(mfilename('fullpath')), '..', 'RA15_Host');
+                loadlibrary(fullfile(host, 'build', 'libnxtlink.so'), fullfile(host, 'src', 'Link', 'nxt_link_api.h'), ...
+                    'alias', NXTLink.LIBRARY);
+            end
+        end
+
+    end
+
+end
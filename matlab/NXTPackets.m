@@ -0,0 +1,718 @@
+% NXTPackets.m
+%
+%   Packet layouts, generated from RA15_Master/src/Comms/PacketSchema.h by RA15_Host packet_gen.
+%   Do not edit. Change the schema, then run ./build/packet_gen from RA15_Host.
+%   Payloads exclude the 2 byte ecrobot Bluetooth header and the 1 byte RS485 header.
+
+classdef NXTPackets
+
+    properties (Constant)
+
+        % NXT1 -> PC telemetry
+        NXT1_BT_BYTES = 78;
+        NXT1_BT_EMPTY = struct( ...
+            'systick',         uint32(0), ...
+            'j1p',             double(0), ...
+            'j1v',             double(0), ...
+            'j1pwm',           int8(0), ...
+            'j2p',             double(0), ...
+            'j2v',             double(0), ...
+            'j2pwm',           int8(0), ...
+            'j3p',             double(0), ...
+            'j3v',             double(0), ...
+            'j3pwm',           int8(0), ...
+            'j4p',             double(0), ...
+            'j4v',             double(0), ...
+            'j4pwm',           int8(0), ...
+            'j5p',             double(0), ...
+            'j5v',             double(0), ...
+            'j5pwm',           int8(0), ...
+            'j6p',             double(0), ...
+            'j6v',             double(0), ...
+            'j6pwm',           int8(0), ...
+            'tmux',            uint8(0), ...
+            'ea1',             uint8(0), ...
+            'ea2',             uint8(0), ...
+            'ea3',             uint8(0), ...
+            'queuedWaypoints', uint8(0), ...
+            'freeWaypoints',   uint8(0), ...
+            'trajUnderruns',   uint16(0), ...
+            'echoStamp',       uint32(0), ...
+            'echoRxMs',        uint32(0), ...
+            'txMs',            uint32(0) );
+
+        % PC -> NXT1 joint targets
+        PC_BT_BYTES = 56;
+        PC_BT_EMPTY = struct( ...
+            'j1pt',                double(0), ...
+            'j1vt',                double(0), ...
+            'j2pt',                double(0), ...
+            'j2vt',                double(0), ...
+            'j3pt',                double(0), ...
+            'j3vt',                double(0), ...
+            'j4pt',                double(0), ...
+            'j4vt',                double(0), ...
+            'j5pt',                double(0), ...
+            'j5vt',                double(0), ...
+            'j6pt',                double(0), ...
+            'j6vt',                double(0), ...
+            'rcx',                 uint8(0), ...
+            'nxtTransmitInterval', uint16(0), ...
+            'compressSamples',     uint8(0), ...
+            'pcStamp',             uint32(0) );
+
+        % PC -> NXT1 clock probe, echoed in NXT1_BT
+        CLOCK_BT_BYTES = 4;
+        CLOCK_BT_EMPTY = struct( ...
+            'pcStamp', uint32(0) );
+
+        % PC -> NXT1 spline knot
+        WAYPOINT_BT_BYTES = 27;
+        WAYPOINT_BT_EMPTY = struct( ...
+            'dtMs',      uint16(0), ...
+            'jointMask', uint8(0), ...
+            'p1',        double(0), ...
+            'p2',        double(0), ...
+            'p3',        double(0), ...
+            'p4',        double(0), ...
+            'p5',        double(0), ...
+            'p6',        double(0) );
+
+        % PC -> NXT1 RS485 bus capture on (1) or off (0)
+        CAPTURE_CMD_BT_BYTES = 1;
+        CAPTURE_CMD_BT_EMPTY = struct( ...
+            'capture', uint8(0) );
+
+        % NXT1 -> PC sample frame header: first sample's seq, samples used
+        TELEMETRY_FRAME_BYTES = 3;
+        TELEMETRY_FRAME_EMPTY = struct( ...
+            'seq',   uint16(0), ...
+            'count', uint8(0) );
+
+        % NXT1 -> PC joint states of one TASK_MOTORREG cycle
+        TELEMETRY_SAMPLE_BYTES = 34;
+        TELEMETRY_SAMPLE_EMPTY = struct( ...
+            'systick', uint32(0), ...
+            'j1p',     double(0), ...
+            'j1v',     double(0), ...
+            'j1pwm',   int8(0), ...
+            'j2p',     double(0), ...
+            'j2v',     double(0), ...
+            'j2pwm',   int8(0), ...
+            'j3p',     double(0), ...
+            'j3v',     double(0), ...
+            'j3pwm',   int8(0), ...
+            'j4p',     double(0), ...
+            'j4v',     double(0), ...
+            'j4pwm',   int8(0), ...
+            'j5p',     double(0), ...
+            'j5v',     double(0), ...
+            'j5pwm',   int8(0), ...
+            'j6p',     double(0), ...
+            'j6v',     double(0), ...
+            'j6pwm',   int8(0) );
+
+        % PC -> NXT1 subscription header: record every decimation cycles (0: list the registry), ids used
+        SUBSCRIBE_BYTES = 2;
+        SUBSCRIBE_EMPTY = struct( ...
+            'decimation', uint8(0), ...
+            'count',      uint8(0) );
+
+        % NXT1 -> PC description header: layout (0: the registry), entries in all, first entry here
+        TELEMETRY_SCHEMA_BYTES = 5;
+        TELEMETRY_SCHEMA_EMPTY = struct( ...
+            'layout',      uint8(0), ...
+            'decimation',  uint8(0), ...
+            'total',       uint8(0), ...
+            'first',       uint8(0), ...
+            'recordBytes', uint8(0) );
+
+        % NXT1 -> PC subscribed records header: layout, first record's seq, records used
+        TELEMETRY_SUB_BYTES = 4;
+        TELEMETRY_SUB_EMPTY = struct( ...
+            'layout', uint8(0), ...
+            'seq',    uint16(0), ...
+            'count',  uint8(0) );
+
+        % PC -> NXT1 parameter get, set or commit
+        PARAM_BT_BYTES = 9;
+        PARAM_BT_EMPTY = struct( ...
+            'op',      uint8(0), ...
+            'joint',   uint8(0), ...
+            'param',   uint8(0), ...
+            'value',   double(0), ...
+            'version', uint16(0) );
+
+        % NXT1 -> PC answer to a PARAM_BT
+        PARAM_REPLY_BT_BYTES = 10;
+        PARAM_REPLY_BT_EMPTY = struct( ...
+            'op',      uint8(0), ...
+            'joint',   uint8(0), ...
+            'param',   uint8(0), ...
+            'value',   double(0), ...
+            'result',  uint8(0), ...
+            'version', uint16(0) );
+
+        % RS485 packet from NXT1 (for bus captures)
+        RS485_NXT1_BYTES = 46;
+        RS485_NXT1_EMPTY = struct( ...
+            'j1pt',              double(0), ...
+            'j1vt',              double(0), ...
+            'j3pt',              double(0), ...
+            'j3vt',              double(0), ...
+            'j4pt',              double(0), ...
+            'j4vt',              double(0), ...
+            'j5pt',              double(0), ...
+            'j5vt',              double(0), ...
+            'j2p',               double(0), ...
+            'enableJointLimits', uint8(0), ...
+            'tmux',              uint8(0), ...
+            'rcx',               uint8(0), ...
+            'wptDtMs',           uint16(0), ...
+            'wptJointMask',      uint8(0), ...
+            'wptSeq',            uint8(0), ...
+            'wptP1',             double(0), ...
+            'wptP3',             double(0), ...
+            'wptP4',             double(0), ...
+            'wptP5',             double(0), ...
+            'sampleMs',          uint16(0), ...
+            'txMs',              uint32(0), ...
+            'nxt2Seq',           uint8(0), ...
+            'nxt2HoldMs',        uint8(0), ...
+            'nxt3Seq',           uint8(0), ...
+            'nxt3HoldMs',        uint8(0), ...
+            'baudNext',          uint8(0), ...
+            'baudCountdown',     uint8(0), ...
+            'baudProbe',         uint8(0) );
+
+        % RS485 packet from NXT2 (for bus captures)
+        RS485_NXT2_BYTES = 15;
+        RS485_NXT2_EMPTY = struct( ...
+            'j1p',         double(0), ...
+            'j1v',         double(0), ...
+            'j5p',         double(0), ...
+            'j5v',         double(0), ...
+            'j1pwm',       int8(0), ...
+            'j5pwm',       int8(0), ...
+            'sampleMs',    uint16(0), ...
+            'wptAck',      uint8(0), ...
+            'probeNum',    uint8(0), ...
+            'probeFrames', uint8(0) );
+
+        % RS485 packet from NXT3 (for bus captures)
+        RS485_NXT3_BYTES = 18;
+        RS485_NXT3_EMPTY = struct( ...
+            'j3p',         double(0), ...
+            'j3v',         double(0), ...
+            'j4p',         double(0), ...
+            'j4v',         double(0), ...
+            'j3pwm',       int8(0), ...
+            'j4pwm',       int8(0), ...
+            'ea1',         uint8(0), ...
+            'ea2',         uint8(0), ...
+            'ea3',         uint8(0), ...
+            'sampleMs',    uint16(0), ...
+            'wptAck',      uint8(0), ...
+            'probeNum',    uint8(0), ...
+            'probeFrames', uint8(0) );
+
+        % NXT1 -> PC RS485 bus capture: [uint32 stream position][CAPTURE_BT_DATA bytes of the stream].
+        % Saved by NXTConnection.startCapture() and replayed by RA15_Host rs485_replay.
+        CAPTURE_BT_BYTES = 124;
+        CAPTURE_BT_DATA = 120;
+
+        % PC -> NXT1 batch of spline knots: [count][WAYPOINT_BATCH WAYPOINT_BT payloads], the unused ones zero.
+        WAYPOINT_BATCH = 4;
+        WAYPOINT_BATCH_BT_BYTES = 109;
+
+        % NXT1 -> PC samples: [TELEMETRY_FRAME][TELEMETRY_BATCH TELEMETRY_SAMPLEs], the unused ones zero.
+        TELEMETRY_BATCH = 3;
+        TELEMETRY_BT_BYTES = 105;
+
+        % NXT1 -> PC delta coded samples: [TELEMETRY_FRAME][first TELEMETRY_SAMPLE][the others, each field's
+        % wire bytes as a zig-zag varint difference from the previous sample's], up to TELEMETRY_Z_MAX.
+        TELEMETRY_Z_BT_BYTES = 122;
+        TELEMETRY_Z_MAX = 8;
+        TELEMETRY_SAMPLE_FIELD_BYTES = [4 2 2 1 2 2 1 2 2 1 2 2 1 2 2 1 2 2 1];
+
+        % Telemetry subscriptions. PC -> NXT1: [SUBSCRIBE][TELEMETRY_SUB_MAX signal ids]. NXT1 -> PC:
+        % [TELEMETRY_SCHEMA][TELEMETRY_SCHEMA_ENTRIES (id uint8, type uint8, name char[TELEMETRY_NAME_CHARS])]
+        % and [TELEMETRY_SUB][records of the layout's signals, in entry order]. Type t is TELEMETRY_TYPES{t+1}.
+        SUBSCRIBE_BT_BYTES = 34;
+        TELEMETRY_SUB_MAX = 32;
+        TELEMETRY_NAME_CHARS = 12;
+        TELEMETRY_SCHEMA_ENTRIES = 8;
+        TELEMETRY_SCHEMA_ENTRY_BYTES = 14;
+        TELEMETRY_SCHEMA_BT_BYTES = 117;
+        TELEMETRY_SUB_BT_BYTES = 120;
+        TELEMETRY_TYPES = {'uint8', 'int8', 'uint16', 'int16', 'uint32', 'int32', 'fix16'};    % fix16 is int32, scaled by 2^-16
+
+        % Live joint parameters. Parameter id k is PARAM_NAMES{k+1}, a field of jpmtr[] limited to
+        % [PARAM_MIN(k+1), PARAM_MAX(k+1)]. op is PARAM_GET, PARAM_SET or PARAM_COMMIT, and result r is PARAM_RESULTS{r+1}.
+        PARAM_NAMES = {'b0', 'b1', 'b2', 'b3', 'b4', 'b5', 'ka', 'kp_p', 'ki_p', 'kd_p', 'kp_v', 'ki_v', 'kd_v', 'pmin', 'pmax', 'vmax', 'phome'};
+        PARAM_MIN = [-100 -100 -100 -100 -100 -100 0 0 0 0 0 0 0 -255 -255 1 -255];
+        PARAM_MAX = [100 100 100 100 100 100 10 100 100 100 100 100 100 255 255 255 255];
+        PARAM_GET = 0;
+        PARAM_SET = 1;
+        PARAM_COMMIT = 2;
+        PARAM_RESULTS = {'ok', 'unknown', 'out_of_range', 'inconsistent', 'busy', 'pending', 'failed'};
+
+    end
+
+    methods (Static)
+
+        function packet = decodeNxt1Bt(payload)
+            payload = uint8(payload(:)');
+            packet = NXTPackets.NXT1_BT_EMPTY;
+            packet.systick         = typecast(payload(1:4), 'uint32');
+            packet.j1p             = fix16_to_dbl(typecast(payload(5:8), 'int32'));
+            packet.j1v             = fix16_to_dbl(typecast(payload(9:12), 'int32'));
+            packet.j1pwm           = typecast(payload(13:13), 'int8');
+            packet.j2p             = fix16_to_dbl(typecast(payload(14:17), 'int32'));
+            packet.j2v             = fix16_to_dbl(typecast(payload(18:21), 'int32'));
+            packet.j2pwm           = typecast(payload(22:22), 'int8');
+            packet.j3p             = fix16_to_dbl(typecast(payload(23:26), 'int32'));
+            packet.j3v             = fix16_to_dbl(typecast(payload(27:30), 'int32'));
+            packet.j3pwm           = typecast(payload(31:31), 'int8');
+            packet.j4p             = fix16_to_dbl(typecast(payload(32:35), 'int32'));
+            packet.j4v             = fix16_to_dbl(typecast(payload(36:39), 'int32'));
+            packet.j4pwm           = typecast(payload(40:40), 'int8');
+            packet.j5p             = fix16_to_dbl(typecast(payload(41:44), 'int32'));
+            packet.j5v             = fix16_to_dbl(typecast(payload(45:48), 'int32'));
+            packet.j5pwm           = typecast(payload(49:49), 'int8');
+            packet.j6p             = fix16_to_dbl(typecast(payload(50:53), 'int32'));
+            packet.j6v             = fix16_to_dbl(typecast(payload(54:57), 'int32'));
+            packet.j6pwm           = typecast(payload(58:58), 'int8');
+            packet.tmux            = typecast(payload(59:59), 'uint8');
+            packet.ea1             = typecast(payload(60:60), 'uint8');
+            packet.ea2             = typecast(payload(61:61), 'uint8');
+            packet.ea3             = typecast(payload(62:62), 'uint8');
+            packet.queuedWaypoints = typecast(payload(63:63), 'uint8');
+            packet.freeWaypoints   = typecast(payload(64:64), 'uint8');
+            packet.trajUnderruns   = typecast(payload(65:66), 'uint16');
+            packet.echoStamp       = typecast(payload(67:70), 'uint32');
+            packet.echoRxMs        = typecast(payload(71:74), 'uint32');
+            packet.txMs            = typecast(payload(75:78), 'uint32');
+        end
+
+        function payload = encodeNxt1Bt(packet)
+            payload = zeros(1, NXTPackets.NXT1_BT_BYTES, 'uint8');
+            payload(1:4) = typecast(uint32(packet.systick), 'uint8');
+            payload(5:8) = typecast(fix16_from_dbl(packet.j1p), 'uint8');
+            payload(9:12) = typecast(fix16_from_dbl(packet.j1v), 'uint8');
+            payload(13:13) = typecast(int8(packet.j1pwm), 'uint8');
+            payload(14:17) = typecast(fix16_from_dbl(packet.j2p), 'uint8');
+            payload(18:21) = typecast(fix16_from_dbl(packet.j2v), 'uint8');
+            payload(22:22) = typecast(int8(packet.j2pwm), 'uint8');
+            payload(23:26) = typecast(fix16_from_dbl(packet.j3p), 'uint8');
+            payload(27:30) = typecast(fix16_from_dbl(packet.j3v), 'uint8');
+            payload(31:31) = typecast(int8(packet.j3pwm), 'uint8');
+            payload(32:35) = typecast(fix16_from_dbl(packet.j4p), 'uint8');
+            payload(36:39) = typecast(fix16_from_dbl(packet.j4v), 'uint8');
+            payload(40:40) = typecast(int8(packet.j4pwm), 'uint8');
+            payload(41:44) = typecast(fix16_from_dbl(packet.j5p), 'uint8');
+            payload(45:48) = typecast(fix16_from_dbl(packet.j5v), 'uint8');
+            payload(49:49) = typecast(int8(packet.j5pwm), 'uint8');
+            payload(50:53) = typecast(fix16_from_dbl(packet.j6p), 'uint8');
+            payload(54:57) = typecast(fix16_from_dbl(packet.j6v), 'uint8');
+            payload(58:58) = typecast(int8(packet.j6pwm), 'uint8');
+            payload(59:59) = typecast(uint8(packet.tmux), 'uint8');
+            payload(60:60) = typecast(uint8(packet.ea1), 'uint8');
+            payload(61:61) = typecast(uint8(packet.ea2), 'uint8');
+            payload(62:62) = typecast(uint8(packet.ea3), 'uint8');
+            payload(63:63) = typecast(uint8(packet.queuedWaypoints), 'uint8');
+            payload(64:64) = typecast(uint8(packet.freeWaypoints), 'uint8');
+            payload(65:66) = typecast(uint16(packet.trajUnderruns), 'uint8');
+            payload(67:70) = typecast(uint32(packet.echoStamp), 'uint8');
+            payload(71:74) = typecast(uint32(packet.echoRxMs), 'uint8');
+            payload(75:78) = typecast(uint32(packet.txMs), 'uint8');
+        end
+
+        function packet = decodePcBt(payload)
+            payload = uint8(payload(:)');
+            packet = NXTPackets.PC_BT_EMPTY;
+            packet.j1pt                = fix16_to_dbl(typecast(payload(1:4), 'int32'));
+            packet.j1vt                = fix16_to_dbl(typecast(payload(5:8), 'int32'));
+            packet.j2pt                = fix16_to_dbl(typecast(payload(9:12), 'int32'));
+            packet.j2vt                = fix16_to_dbl(typecast(payload(13:16), 'int32'));
+            packet.j3pt                = fix16_to_dbl(typecast(payload(17:20), 'int32'));
+            packet.j3vt                = fix16_to_dbl(typecast(payload(21:24), 'int32'));
+            packet.j4pt                = fix16_to_dbl(typecast(payload(25:28), 'int32'));
+            packet.j4vt                = fix16_to_dbl(typecast(payload(29:32), 'int32'));
+            packet.j5pt                = fix16_to_dbl(typecast(payload(33:36), 'int32'));
+            packet.j5vt                = fix16_to_dbl(typecast(payload(37:40), 'int32'));
+            packet.j6pt                = fix16_to_dbl(typecast(payload(41:44), 'int32'));
+            packet.j6vt                = fix16_to_dbl(typecast(payload(45:48), 'int32'));
+            packet.rcx                 = typecast(payload(49:49), 'uint8');
+            packet.nxtTransmitInterval = typecast(payload(50:51), 'uint16');
+            packet.compressSamples     = typecast(payload(52:52), 'uint8');
+            packet.pcStamp             = typecast(payload(53:56), 'uint32');
+        end
+
+        function payload = encodePcBt(packet)
+            payload = zeros(1, NXTPackets.PC_BT_BYTES, 'uint8');
+            payload(1:4) = typecast(fix16_from_dbl(packet.j1pt), 'uint8');
+            payload(5:8) = typecast(fix16_from_dbl(packet.j1vt), 'uint8');
+            payload(9:12) = typecast(fix16_from_dbl(packet.j2pt), 'uint8');
+            payload(13:16) = typecast(fix16_from_dbl(packet.j2vt), 'uint8');
+            payload(17:20) = typecast(fix16_from_dbl(packet.j3pt), 'uint8');
+            payload(21:24) = typecast(fix16_from_dbl(packet.j3vt), 'uint8');
+            payload(25:28) = typecast(fix16_from_dbl(packet.j4pt), 'uint8');
+            payload(29:32) = typecast(fix16_from_dbl(packet.j4vt), 'uint8');
+            payload(33:36) = typecast(fix16_from_dbl(packet.j5pt), 'uint8');
+            payload(37:40) = typecast(fix16_from_dbl(packet.j5vt), 'uint8');
+            payload(41:44) = typecast(fix16_from_dbl(packet.j6pt), 'uint8');
+            payload(45:48) = typecast(fix16_from_dbl(packet.j6vt), 'uint8');
+            payload(49:49) = typecast(uint8(packet.rcx), 'uint8');
+            payload(50:51) = typecast(uint16(packet.nxtTransmitInterval), 'uint8');
+            payload(52:52) = typecast(uint8(packet.compressSamples), 'uint8');
+            payload(53:56) = typecast(uint32(packet.pcStamp), 'uint8');
+        end
+
+        function packet = decodeClockBt(payload)
+            payload = uint8(payload(:)');
+            packet = NXTPackets.CLOCK_BT_EMPTY;
+            packet.pcStamp = typecast(payload(1:4), 'uint32');
+        end
+
+        function payload = encodeClockBt(packet)
+            payload = zeros(1, NXTPackets.CLOCK_BT_BYTES, 'uint8');
+            payload(1:4) = typecast(uint32(packet.pcStamp), 'uint8');
+        end
+
+        function packet = decodeWaypointBt(payload)
+            payload = uint8(payload(:)');
+            packet = NXTPackets.WAYPOINT_BT_EMPTY;
+            packet.dtMs      = typecast(payload(1:2), 'uint16');
+            packet.jointMask = typecast(payload(3:3), 'uint8');
+            packet.p1        = fix16_to_dbl(typecast(payload(4:7), 'int32'));
+            packet.p2        = fix16_to_dbl(typecast(payload(8:11), 'int32'));
+            packet.p3        = fix16_to_dbl(typecast(payload(12:15), 'int32'));
+            packet.p4        = fix16_to_dbl(typecast(payload(16:19), 'int32'));
+            packet.p5        = fix16_to_dbl(typecast(payload(20:23), 'int32'));
+            packet.p6        = fix16_to_dbl(typecast(payload(24:27), 'int32'));
+        end
+
+        function payload = encodeWaypointBt(packet)
+            payload = zeros(1, NXTPackets.WAYPOINT_BT_BYTES, 'uint8');
+            payload(1:2) = typecast(uint16(packet.dtMs), 'uint8');
+            payload(3:3) = typecast(uint8(packet.jointMask), 'uint8');
+            payload(4:7) = typecast(fix16_from_dbl(packet.p1), 'uint8');
+            payload(8:11) = typecast(fix16_from_dbl(packet.p2), 'uint8');
+            payload(12:15) = typecast(fix16_from_dbl(packet.p3), 'uint8');
+            payload(16:19) = typecast(fix16_from_dbl(packet.p4), 'uint8');
+            payload(20:23) = typecast(fix16_from_dbl(packet.p5), 'uint8');
+            payload(24:27) = typecast(fix16_from_dbl(packet.p6), 'uint8');
+        end
+
+        function packet = decodeCaptureCmdBt(payload)
+            payload = uint8(payload(:)');
+            packet = NXTPackets.CAPTURE_CMD_BT_EMPTY;
+            packet.capture = typecast(payload(1:1), 'uint8');
+        end
+
+        function payload = encodeCaptureCmdBt(packet)
+            payload = zeros(1, NXTPackets.CAPTURE_CMD_BT_BYTES, 'uint8');
+            payload(1:1) = typecast(uint8(packet.capture), 'uint8');
+        end
+
+        function packet = decodeTelemetryFrame(payload)
+            payload = uint8(payload(:)');
+            packet = NXTPackets.TELEMETRY_FRAME_EMPTY;
+            packet.seq   = typecast(payload(1:2), 'uint16');
+            packet.count = typecast(payload(3:3), 'uint8');
+        end
+
+        function payload = encodeTelemetryFrame(packet)
+            payload = zeros(1, NXTPackets.TELEMETRY_FRAME_BYTES, 'uint8');
+            payload(1:2) = typecast(uint16(packet.seq), 'uint8');
+            payload(3:3) = typecast(uint8(packet.count), 'uint8');
+        end
+
+        function packet = decodeTelemetrySample(payload)
+            payload = uint8(payload(:)');
+            packet = NXTPackets.TELEMETRY_SAMPLE_EMPTY;
+            packet.systick = typecast(payload(1:4), 'uint32');
+            packet.j1p     = NXTPackets.dequantize(typecast(payload(5:6), 'int16'), 9);
+            packet.j1v     = NXTPackets.dequantize(typecast(payload(7:8), 'int16'), 9);
+            packet.j1pwm   = typecast(payload(9:9), 'int8');
+            packet.j2p     = NXTPackets.dequantize(typecast(payload(10:11), 'int16'), 9);
+            packet.j2v     = NXTPackets.dequantize(typecast(payload(12:13), 'int16'), 9);
+            packet.j2pwm   = typecast(payload(14:14), 'int8');
+            packet.j3p     = NXTPackets.dequantize(typecast(payload(15:16), 'int16'), 9);
+            packet.j3v     = NXTPackets.dequantize(typecast(payload(17:18), 'int16'), 9);
+            packet.j3pwm   = typecast(payload(19:19), 'int8');
+            packet.j4p     = NXTPackets.dequantize(typecast(payload(20:21), 'int16'), 9);
+            packet.j4v     = NXTPackets.dequantize(typecast(payload(22:23), 'int16'), 9);
+            packet.j4pwm   = typecast(payload(24:24), 'int8');
+            packet.j5p     = NXTPackets.dequantize(typecast(payload(25:26), 'int16'), 9);
+            packet.j5v     = NXTPackets.dequantize(typecast(payload(27:28), 'int16'), 9);
+            packet.j5pwm   = typecast(payload(29:29), 'int8');
+            packet.j6p     = NXTPackets.dequantize(typecast(payload(30:31), 'int16'), 9);
+            packet.j6v     = NXTPackets.dequantize(typecast(payload(32:33), 'int16'), 9);
+            packet.j6pwm   = typecast(payload(34:34), 'int8');
+        end
+
+        function payload = encodeTelemetrySample(packet)
+            payload = zeros(1, NXTPackets.TELEMETRY_SAMPLE_BYTES, 'uint8');
+            payload(1:4) = typecast(uint32(packet.systick), 'uint8');
+            payload(5:6) = typecast(NXTPackets.quantize(packet.j1p, 9), 'uint8');
+            payload(7:8) = typecast(NXTPackets.quantize(packet.j1v, 9), 'uint8');
+            payload(9:9) = typecast(int8(packet.j1pwm), 'uint8');
+            payload(10:11) = typecast(NXTPackets.quantize(packet.j2p, 9), 'uint8');
+            payload(12:13) = typecast(NXTPackets.quantize(packet.j2v, 9), 'uint8');
+            payload(14:14) = typecast(int8(packet.j2pwm), 'uint8');
+            payload(15:16) = typecast(NXTPackets.quantize(packet.j3p, 9), 'uint8');
+            payload(17:18) = typecast(NXTPackets.quantize(packet.j3v, 9), 'uint8');
+            payload(19:19) = typecast(int8(packet.j3pwm), 'uint8');
+            payload(20:21) = typecast(NXTPackets.quantize(packet.j4p, 9), 'uint8');
+            payload(22:23) = typecast(NXTPackets.quantize(packet.j4v, 9), 'uint8');
+            payload(24:24) = typecast(int8(packet.j4pwm), 'uint8');
+            payload(25:26) = typecast(NXTPackets.quantize(packet.j5p, 9), 'uint8');
+            payload(27:28) = typecast(NXTPackets.quantize(packet.j5v, 9), 'uint8');
+            payload(29:29) = typecast(int8(packet.j5pwm), 'uint8');
+            payload(30:31) = typecast(NXTPackets.quantize(packet.j6p, 9), 'uint8');
+            payload(32:33) = typecast(NXTPackets.quantize(packet.j6v, 9), 'uint8');
+            payload(34:34) = typecast(int8(packet.j6pwm), 'uint8');
+        end
+
+        function packet = decodeSubscribe(payload)
+            payload = uint8(payload(:)');
+            packet = NXTPackets.SUBSCRIBE_EMPTY;
+            packet.decimation = typecast(payload(1:1), 'uint8');
+            packet.count      = typecast(payload(2:2), 'uint8');
+        end
+
+        function payload = encodeSubscribe(packet)
+            payload = zeros(1, NXTPackets.SUBSCRIBE_BYTES, 'uint8');
+            payload(1:1) = typecast(uint8(packet.decimation), 'uint8');
+            payload(2:2) = typecast(uint8(packet.count), 'uint8');
+        end
+
+        function packet = decodeTelemetrySchema(payload)
+            payload = uint8(payload(:)');
+            packet = NXTPackets.TELEMETRY_SCHEMA_EMPTY;
+            packet.layout      = typecast(payload(1:1), 'uint8');
+            packet.decimation  = typecast(payload(2:2), 'uint8');
+            packet.total       = typecast(payload(3:3), 'uint8');
+            packet.first       = typecast(payload(4:4), 'uint8');
+            packet.recordBytes = typecast(payload(5:5), 'uint8');
+        end
+
+        function payload = encodeTelemetrySchema(packet)
+            payload = zeros(1, NXTPackets.TELEMETRY_SCHEMA_BYTES, 'uint8');
+            payload(1:1) = typecast(uint8(packet.layout), 'uint8');
+            payload(2:2) = typecast(uint8(packet.decimation), 'uint8');
+            payload(3:3) = typecast(uint8(packet.total), 'uint8');
+            payload(4:4) = typecast(uint8(packet.first), 'uint8');
+            payload(5:5) = typecast(uint8(packet.recordBytes), 'uint8');
+        end
+
+        function packet = decodeTelemetrySub(payload)
+            payload = uint8(payload(:)');
+            packet = NXTPackets.TELEMETRY_SUB_EMPTY;
+            packet.layout = typecast(payload(1:1), 'uint8');
+            packet.seq    = typecast(payload(2:3), 'uint16');
+            packet.count  = typecast(payload(4:4), 'uint8');
+        end
+
+        function payload = encodeTelemetrySub(packet)
+            payload = zeros(1, NXTPackets.TELEMETRY_SUB_BYTES, 'uint8');
+            payload(1:1) = typecast(uint8(packet.layout), 'uint8');
+            payload(2:3) = typecast(uint16(packet.seq), 'uint8');
+            payload(4:4) = typecast(uint8(packet.count), 'uint8');
+        end
+
+        function packet = decodeParamBt(payload)
+            payload = uint8(payload(:)');
+            packet = NXTPackets.PARAM_BT_EMPTY;
+            packet.op      = typecast(payload(1:1), 'uint8');
+            packet.joint   = typecast(payload(2:2), 'uint8');
+            packet.param   = typecast(payload(3:3), 'uint8');
+            packet.value   = fix16_to_dbl(typecast(payload(4:7), 'int32'));
+            packet.version = typecast(payload(8:9), 'uint16');
+        end
+
+        function payload = encodeParamBt(packet)
+            payload = zeros(1, NXTPackets.PARAM_BT_BYTES, 'uint8');
+            payload(1:1) = typecast(uint8(packet.op), 'uint8');
+            payload(2:2) = typecast(uint8(packet.joint), 'uint8');
+            payload(3:3) = typecast(uint8(packet.param), 'uint8');
+            payload(4:7) = typecast(fix16_from_dbl(packet.value), 'uint8');
+            payload(8:9) = typecast(uint16(packet.version), 'uint8');
+        end
+
+        function packet = decodeParamReplyBt(payload)
+            payload = uint8(payload(:)');
+            packet = NXTPackets.PARAM_REPLY_BT_EMPTY;
+            packet.op      = typecast(payload(1:1), 'uint8');
+            packet.joint   = typecast(payload(2:2), 'uint8');
+            packet.param   = typecast(payload(3:3), 'uint8');
+            packet.value   = fix16_to_dbl(typecast(payload(4:7), 'int32'));
+            packet.result  = typecast(payload(8:8), 'uint8');
+            packet.version = typecast(payload(9:10), 'uint16');
+        end
+
+        function payload = encodeParamReplyBt(packet)
+            payload = zeros(1, NXTPackets.PARAM_REPLY_BT_BYTES, 'uint8');
+            payload(1:1) = typecast(uint8(packet.op), 'uint8');
+            payload(2:2) = typecast(uint8(packet.joint), 'uint8');
+            payload(3:3) = typecast(uint8(packet.param), 'uint8');
+            payload(4:7) = typecast(fix16_from_dbl(packet.value), 'uint8');
+            payload(8:8) = typecast(uint8(packet.result), 'uint8');
+            payload(9:10) = typecast(uint16(packet.version), 'uint8');
+        end
+
+        function packet = decodeRs485Nxt1(payload)
+            payload = uint8(payload(:)');
+            packet = NXTPackets.RS485_NXT1_EMPTY;
+            packet.j1pt              = NXTPackets.dequantizeTarget(typecast(payload(1:2), 'int16'), 9);
+            packet.j1vt              = NXTPackets.dequantizeTarget(typecast(payload(3:4), 'int16'), 9);
+            packet.j3pt              = NXTPackets.dequantizeTarget(typecast(payload(5:6), 'int16'), 9);
+            packet.j3vt              = NXTPackets.dequantizeTarget(typecast(payload(7:8), 'int16'), 9);
+            packet.j4pt              = NXTPackets.dequantizeTarget(typecast(payload(9:10), 'int16'), 9);
+            packet.j4vt              = NXTPackets.dequantizeTarget(typecast(payload(11:12), 'int16'), 9);
+            packet.j5pt              = NXTPackets.dequantizeTarget(typecast(payload(13:14), 'int16'), 9);
+            packet.j5vt              = NXTPackets.dequantizeTarget(typecast(payload(15:16), 'int16'), 9);
+            packet.j2p               = NXTPackets.dequantize(typecast(payload(17:18), 'int16'), 9);
+            packet.enableJointLimits = typecast(payload(19:19), 'uint8');
+            packet.tmux              = typecast(payload(20:20), 'uint8');
+            packet.rcx               = typecast(payload(21:21), 'uint8');
+            packet.wptDtMs           = typecast(payload(22:23), 'uint16');
+            packet.wptJointMask      = typecast(payload(24:24), 'uint8');
+            packet.wptSeq            = typecast(payload(25:25), 'uint8');
+            packet.wptP1             = NXTPackets.dequantize(typecast(payload(26:27), 'int16'), 9);
+            packet.wptP3             = NXTPackets.dequantize(typecast(payload(28:29), 'int16'), 9);
+            packet.wptP4             = NXTPackets.dequantize(typecast(payload(30:31), 'int16'), 9);
+            packet.wptP5             = NXTPackets.dequantize(typecast(payload(32:33), 'int16'), 9);
+            packet.sampleMs          = typecast(payload(34:35), 'uint16');
+            packet.txMs              = typecast(payload(36:39), 'uint32');
+            packet.nxt2Seq           = typecast(payload(40:40), 'uint8');
+            packet.nxt2HoldMs        = typecast(payload(41:41), 'uint8');
+            packet.nxt3Seq           = typecast(payload(42:42), 'uint8');
+            packet.nxt3HoldMs        = typecast(payload(43:43), 'uint8');
+            packet.baudNext          = typecast(payload(44:44), 'uint8');
+            packet.baudCountdown     = typecast(payload(45:45), 'uint8');
+            packet.baudProbe         = typecast(payload(46:46), 'uint8');
+        end
+
+        function payload = encodeRs485Nxt1(packet)
+            payload = zeros(1, NXTPackets.RS485_NXT1_BYTES, 'uint8');
+            payload(1:2) = typecast(NXTPackets.quantizeTarget(packet.j1pt, 9), 'uint8');
+            payload(3:4) = typecast(NXTPackets.quantizeTarget(packet.j1vt, 9), 'uint8');
+            payload(5:6) = typecast(NXTPackets.quantizeTarget(packet.j3pt, 9), 'uint8');
+            payload(7:8) = typecast(NXTPackets.quantizeTarget(packet.j3vt, 9), 'uint8');
+            payload(9:10) = typecast(NXTPackets.quantizeTarget(packet.j4pt, 9), 'uint8');
+            payload(11:12) = typecast(NXTPackets.quantizeTarget(packet.j4vt, 9), 'uint8');
+            payload(13:14) = typecast(NXTPackets.quantizeTarget(packet.j5pt, 9), 'uint8');
+            payload(15:16) = typecast(NXTPackets.quantizeTarget(packet.j5vt, 9), 'uint8');
+            payload(17:18) = typecast(NXTPackets.quantize(packet.j2p, 9), 'uint8');
+            payload(19:19) = typecast(uint8(packet.enableJointLimits), 'uint8');
+            payload(20:20) = typecast(uint8(packet.tmux), 'uint8');
+            payload(21:21) = typecast(uint8(packet.rcx), 'uint8');
+            payload(22:23) = typecast(uint16(packet.wptDtMs), 'uint8');
+            payload(24:24) = typecast(uint8(packet.wptJointMask), 'uint8');
+            payload(25:25) = typecast(uint8(packet.wptSeq), 'uint8');
+            payload(26:27) = typecast(NXTPackets.quantize(packet.wptP1, 9), 'uint8');
+            payload(28:29) = typecast(NXTPackets.quantize(packet.wptP3, 9), 'uint8');
+            payload(30:31) = typecast(NXTPackets.quantize(packet.wptP4, 9), 'uint8');
+            payload(32:33) = typecast(NXTPackets.quantize(packet.wptP5, 9), 'uint8');
+            payload(34:35) = typecast(uint16(packet.sampleMs), 'uint8');
+            payload(36:39) = typecast(uint32(packet.txMs), 'uint8');
+            payload(40:40) = typecast(uint8(packet.nxt2Seq), 'uint8');
+            payload(41:41) = typecast(uint8(packet.nxt2HoldMs), 'uint8');
+            payload(42:42) = typecast(uint8(packet.nxt3Seq), 'uint8');
+            payload(43:43) = typecast(uint8(packet.nxt3HoldMs), 'uint8');
+            payload(44:44) = typecast(uint8(packet.baudNext), 'uint8');
+            payload(45:45) = typecast(uint8(packet.baudCountdown), 'uint8');
+            payload(46:46) = typecast(uint8(packet.baudProbe), 'uint8');
+        end
+
+        function packet = decodeRs485Nxt2(payload)
+            payload = uint8(payload(:)');
+            packet = NXTPackets.RS485_NXT2_EMPTY;
+            packet.j1p         = NXTPackets.dequantize(typecast(payload(1:2), 'int16'), 9);
+            packet.j1v         = NXTPackets.dequantize(typecast(payload(3:4), 'int16'), 9);
+            packet.j5p         = NXTPackets.dequantize(typecast(payload(5:6), 'int16'), 9);
+            packet.j5v         = NXTPackets.dequantize(typecast(payload(7:8), 'int16'), 9);
+            packet.j1pwm       = typecast(payload(9:9), 'int8');
+            packet.j5pwm       = typecast(payload(10:10), 'int8');
+            packet.sampleMs    = typecast(payload(11:12), 'uint16');
+            packet.wptAck      = typecast(payload(13:13), 'uint8');
+            packet.probeNum    = typecast(payload(14:14), 'uint8');
+            packet.probeFrames = typecast(payload(15:15), 'uint8');
+        end
+
+        function payload = encodeRs485Nxt2(packet)
+            payload = zeros(1, NXTPackets.RS485_NXT2_BYTES, 'uint8');
+            payload(1:2) = typecast(NXTPackets.quantize(packet.j1p, 9), 'uint8');
+            payload(3:4) = typecast(NXTPackets.quantize(packet.j1v, 9), 'uint8');
+            payload(5:6) = typecast(NXTPackets.quantize(packet.j5p, 9), 'uint8');
+            payload(7:8) = typecast(NXTPackets.quantize(packet.j5v, 9), 'uint8');
+            payload(9:9) = typecast(int8(packet.j1pwm), 'uint8');
+            payload(10:10) = typecast(int8(packet.j5pwm), 'uint8');
+            payload(11:12) = typecast(uint16(packet.sampleMs), 'uint8');
+            payload(13:13) = typecast(uint8(packet.wptAck), 'uint8');
+            payload(14:14) = typecast(uint8(packet.probeNum), 'uint8');
+            payload(15:15) = typecast(uint8(packet.probeFrames), 'uint8');
+        end
+
+        function packet = decodeRs485Nxt3(payload)
+            payload = uint8(payload(:)');
+            packet = NXTPackets.RS485_NXT3_EMPTY;
+            packet.j3p         = NXTPackets.dequantize(typecast(payload(1:2), 'int16'), 9);
+            packet.j3v         = NXTPackets.dequantize(typecast(payload(3:4), 'int16'), 9);
+            packet.j4p         = NXTPackets.dequantize(typecast(payload(5:6), 'int16'), 9);
+            packet.j4v         = NXTPackets.dequantize(typecast(payload(7:8), 'int16'), 9);
+            packet.j3pwm       = typecast(payload(9:9), 'int8');
+            packet.j4pwm       = typecast(payload(10:10), 'int8');
+            packet.ea1         = typecast(payload(11:11), 'uint8');
+            packet.ea2         = typecast(payload(12:12), 'uint8');
+            packet.ea3         = typecast(payload(13:13), 'uint8');
+            packet.sampleMs    = typecast(payload(14:15), 'uint16');
+            packet.wptAck      = typecast(payload(16:16), 'uint8');
+            packet.probeNum    = typecast(payload(17:17), 'uint8');
+            packet.probeFrames = typecast(payload(18:18), 'uint8');
+        end
+
+        function payload = encodeRs485Nxt3(packet)
+            payload = zeros(1, NXTPackets.RS485_NXT3_BYTES, 'uint8');
+            payload(1:2) = typecast(NXTPackets.quantize(packet.j3p, 9), 'uint8');
+            payload(3:4) = typecast(NXTPackets.quantize(packet.j3v, 9), 'uint8');
+            payload(5:6) = typecast(NXTPackets.quantize(packet.j4p, 9), 'uint8');
+            payload(7:8) = typecast(NXTPackets.quantize(packet.j4v, 9), 'uint8');
+            payload(9:9) = typecast(int8(packet.j3pwm), 'uint8');
+            payload(10:10) = typecast(int8(packet.j4pwm), 'uint8');
+            payload(11:11) = typecast(uint8(packet.ea1), 'uint8');
+            payload(12:12) = typecast(uint8(packet.ea2), 'uint8');
+            payload(13:13) = typecast(uint8(packet.ea3), 'uint8');
+            payload(14:15) = typecast(uint16(packet.sampleMs), 'uint8');
+            payload(16:16) = typecast(uint8(packet.wptAck), 'uint8');
+            payload(17:17) = typecast(uint8(packet.probeNum), 'uint8');
+            payload(18:18) = typecast(uint8(packet.probeFrames), 'uint8');
+        end
+
+        % Quantized fix16_t fields (int16_t on the wire, see PacketSchema.h). Out of range values
+        % clamp to +-(intmax('int16')-1). Targets saturate instead: saturated values stand for
+        % DISABLE_PT/DISABLE_VT and decode to +-Inf.
+        function x = dequantize(q, shift)
+            x = double(q) * 2^(shift-16);
+        end
+
+        function q = quantize(x, shift)
+            q = int16(max(min(x * 2^(16-shift), double(intmax('int16'))-1), 1-double(intmax('int16'))));
+        end
+
+        function x = dequantizeTarget(q, shift)
+            x = NXTPackets.dequantize(q, shift);
+            x(q == intmax('int16')) = Inf;
+            x(q == intmin('int16')) = -Inf;
+        end
+
+        function q = quantizeTarget(x, shift)
+            q = int16(x * 2^(16-shift));
+        end
+
+    end
+
+end